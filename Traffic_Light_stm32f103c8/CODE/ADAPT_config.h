@@ -0,0 +1,55 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : ADAPT_config.h            *****************/
+/****************************************************************/
+#ifndef ADAPT_CONFIG_H_
+#define ADAPT_CONFIG_H_
+
+/**
+ * @brief Install computed plans from boot (ADAPT_SetEnabled changes it at run time).
+ */
+#define ADAPT_ENABLED               1
+#define ADAPT_DISABLED              0
+#define ADAPT_AT_BOOT               ADAPT_ENABLED
+
+/**
+ * @brief Phases whose durations are adapted: the car green and the walk.
+ *
+ * Every other phase on the cycle between them counts as lost time.
+ */
+#define ADAPT_CAR_PHASE             PHASE_CAR_GO
+#define ADAPT_PED_PHASE             PHASE_PED_WALK
+
+/**
+ * @brief Saturation flows: vehicles one hour of car green discharges, and pedestrian
+ * requests one hour of walk serves.
+ */
+#define ADAPT_SAT_FLOW_VPH          1800
+#define ADAPT_PED_SAT_FLOW_PH       3600
+
+/**
+ * @brief Weight of a new cycle in the moving averages: 1 / 2^ADAPT_EMA_SHIFT.
+ */
+#define ADAPT_EMA_SHIFT             2
+
+/**
+ * @brief Largest Y used in the cycle formula (Q16). Above it the crossing is saturated and
+ * the cycle goes to ADAPT_MAX_CYCLE_MS.
+ */
+#define ADAPT_MAX_RATIO_Q16         58982   /**< 0.9 */
+
+/**
+ * @brief Limits of the computed plan in milliseconds.
+ *
+ * With the default plan a car green of ADAPT_MAX_GREEN_MS keeps the worst pedestrian wait
+ * within PHASE_MAX_PED_WAIT_MS; longer greens are refused by PHASE_InstallTable.
+ */
+#define ADAPT_MIN_CYCLE_MS          20000
+#define ADAPT_MAX_CYCLE_MS          40000
+#define ADAPT_MIN_WALK_MS           5000
+#define ADAPT_MIN_CAR_GREEN_MS      2000
+#define ADAPT_MAX_GREEN_MS          15000
+
+#endif /**< ADAPT_CONFIG_H_ */
@@ -0,0 +1,119 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : ADAPT_interface.h         *****************/
+/****************************************************************/
+#ifndef ADAPT_INTERFACE_H_
+#define ADAPT_INTERFACE_H_
+
+/**
+ * @defgroup ADAPT_Types ADAPT Types
+ * @{
+ */
+
+/**
+ * @brief Demand estimates of one crossing and the plan derived from them.
+ *
+ * Q16 values carry 16 fractional bits (65536 = 1.0).
+ */
+typedef struct
+{
+    u32 FlowQ16;        /**< Car flow over the detector, vehicles per hour */
+    u32 OccupancyQ16;   /**< Share of the cycle the detector is occupied during the car green */
+    u32 PedFlowQ16;     /**< Pedestrian requests per hour */
+    u32 RatioQ16;       /**< Sum of the critical flow ratios (Webster Y) */
+    u16 CycleTicks;     /**< Cycle length of the last plan */
+    u16 CarGreenTicks;  /**< Car green of the last plan */
+    u16 WalkTicks;      /**< Walk of the last plan */
+    u16 Rejected;       /**< Plans PHASE_InstallTable refused */
+} ADAPT_Estimate_t;
+
+/** @} */ // End of ADAPT_Types
+
+/**
+ * @defgroup ADAPT_Functions ADAPT Functions
+ * @brief Cycle length and green splits from detector counts (Webster), in fixed point.
+ *
+ * Per crossing, the vehicle and request counts, the detector occupancy during the car green and
+ * the cycle length are kept as exponential moving averages over cycles, and the rates are
+ * their ratios. At each cycle boundary (PHASE_CYCLE_START)
+ * the optimum cycle C = (1.5 L + 5 s) / (1 - Y) is computed from the lost time L of the
+ * active plan and the sum Y of the critical flow ratios, and C - L is split between the car
+ * green and the walk in proportion to their ratios. Vehicles that cross the detector in one
+ * block hide from the count, so the car ratio is never taken below the green occupancy. The
+ * occupancy on red is left out: on a stop-line detector it only shows that a queue stands.
+ *
+ * The result is a copy of the active plan with the two green times replaced, installed
+ * through the double buffer of PHASE_InstallTable. An uploaded plan thus keeps its structure
+ * and intergreens, and only its greens are adapted from the next cycle on.
+ * @{
+ */
+
+/**
+ * @brief Clear the estimates of all crossings and enable or disable adaptation per ADAPT_AT_BOOT.
+ *
+ * @return None.
+ */
+void ADAPT_Init(void);
+
+/**
+ * @brief Enable or disable adaptation. The estimates keep running either way.
+ *
+ * @param[in] Copy_Enable 1 to install computed plans, 0 to leave the plans alone.
+ *
+ * @return None.
+ */
+void ADAPT_SetEnabled(u8 Copy_Enable);
+
+/**
+ * @brief Note a detector edge. Called from the detector interrupt on both edges.
+ *
+ * @param[in] Copy_Intersection The crossing.
+ * @param[in] Copy_Level 1 when a vehicle arrives over the detector, 0 when it leaves.
+ *
+ * @return None.
+ */
+void ADAPT_OnDetector(u8 Copy_Intersection, u8 Copy_Level);
+
+/**
+ * @brief Note a pedestrian request. Called from the button interrupt.
+ *
+ * @param[in] Copy_Intersection The crossing.
+ *
+ * @return None.
+ */
+void ADAPT_OnPedestrian(u8 Copy_Intersection);
+
+/**
+ * @brief Advance the cycle timers and re-plan at each cycle boundary.
+ *
+ * Call once per control tick right after PHASE_Tick, from the same context.
+ *
+ * @return None.
+ */
+void ADAPT_Tick(void);
+
+/**
+ * @brief Get the estimates and the last plan of a crossing.
+ *
+ * @param[in]  Copy_Intersection The crossing.
+ * @param[out] Copy_Estimate Receives the estimates.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid crossing or a NULL pointer.
+ */
+Std_ReturnType ADAPT_GetEstimate(u8 Copy_Intersection, ADAPT_Estimate_t *Copy_Estimate);
+
+/**
+ * @brief Check whether a plan is one of the buffers written by the optimizer.
+ *
+ * @param[in] Copy_Intersection The crossing.
+ * @param[in] Copy_Table The plan, e.g. from PHASE_GetActiveTable.
+ *
+ * @return 1 if the optimizer computed it, 0 otherwise.
+ */
+u8 ADAPT_IsOwnPlan(u8 Copy_Intersection, const PHASE_Descriptor_t *Copy_Table);
+
+/** @} */ // End of ADAPT_Functions
+
+#endif /**< ADAPT_INTERFACE_H_ */
@@ -0,0 +1,61 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : ADAPT_private.h           *****************/
+/****************************************************************/
+#ifndef ADAPT_PRIVATE_H_
+#define ADAPT_PRIVATE_H_
+
+/**< Convert a configured duration to control ticks */
+#define ADAPT_MS_TO_TICKS(MS)           ((u32)((MS) / PHASE_TICK_MS))
+
+#define ADAPT_MIN_CYCLE_TICKS           ADAPT_MS_TO_TICKS(ADAPT_MIN_CYCLE_MS)
+#define ADAPT_MAX_CYCLE_TICKS           ADAPT_MS_TO_TICKS(ADAPT_MAX_CYCLE_MS)
+#define ADAPT_MIN_WALK_TICKS            ADAPT_MS_TO_TICKS(ADAPT_MIN_WALK_MS)
+#define ADAPT_MIN_CAR_GREEN_TICKS       ADAPT_MS_TO_TICKS(ADAPT_MIN_CAR_GREEN_MS)
+#define ADAPT_MAX_GREEN_TICKS           ADAPT_MS_TO_TICKS(ADAPT_MAX_GREEN_MS)
+
+/**< The 5 s constant of the Webster cycle */
+#define ADAPT_WEBSTER_CONST_TICKS       ADAPT_MS_TO_TICKS(5000)
+
+/**< Q16 one, and the number of control ticks in an hour (flows are per hour) */
+#define ADAPT_Q16_ONE                   65536UL
+#define ADAPT_TICKS_PER_HOUR            ADAPT_MS_TO_TICKS(3600000UL)
+
+/**< Largest Q16 rate per tick that converts to a per-hour rate without overflow */
+#define ADAPT_MAX_PER_TICK_Q16          (0xFFFFFFFFUL / ADAPT_TICKS_PER_HOUR)
+
+/**< Fractional bits of the per-cycle averages; a u16 count keeps them within 32 bits */
+#define ADAPT_AVERAGE_SHIFT             8
+
+#if ADAPT_MAX_RATIO_Q16 >= 65536
+#error "ADAPT_MAX_RATIO_Q16 must stay below 1.0"
+#endif
+
+#if (ADAPT_MIN_CYCLE_MS > ADAPT_MAX_CYCLE_MS) || (ADAPT_MIN_WALK_MS > ADAPT_MAX_GREEN_MS) || \
+    (ADAPT_MIN_CAR_GREEN_MS > ADAPT_MAX_GREEN_MS)
+#error "ADAPT limits are inverted"
+#endif
+
+/**
+ * @brief Estimator and plan buffers of one crossing.
+ */
+typedef struct
+{
+    PHASE_Descriptor_t Plans[2][PHASE_COUNT];  /**< Double buffer: the one not running is rewritten */
+    ADAPT_Estimate_t Estimate;
+    u32 VehiclesAverage;        /**< Vehicles per cycle, ADAPT_AVERAGE_SHIFT fractional bits */
+    u32 PedestriansAverage;     /**< Pedestrian requests per cycle, same format */
+    u32 OccupiedAverage;        /**< Occupied car green ticks per cycle, same format */
+    u32 CycleAverage;           /**< Cycle length in ticks, same format */
+    u16 CycleTicks;             /**< Ticks since the cycle started, saturating */
+    u16 OccupiedTicks;          /**< Ticks of car green this cycle with the detector occupied, saturating */
+    u8 LastPhase;
+    u8 Cycles;                  /**< Cycle starts seen, saturating at 2: the averages are seeded */
+    volatile u8 Occupied;       /**< Detector level, set from its interrupt */
+    volatile u16 Vehicles;      /**< Arrivals this cycle, set from the detector interrupt */
+    volatile u16 Pedestrians;   /**< Requests this cycle, set from the button interrupt */
+} ADAPT_State_t;
+
+#endif /**< ADAPT_PRIVATE_H_ */
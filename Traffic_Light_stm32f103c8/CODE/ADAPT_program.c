@@ -0,0 +1,355 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : ADAPT_program.c           *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "SCB_interface.h"
+/*****************************< APP *****************************/
+#include "PHASE_interface.h"
+#include "PHASE_config.h"
+#include "ADAPT_interface.h"
+#include "ADAPT_config.h"
+#include "ADAPT_private.h"
+/*****************************< Private Variables *****************************/
+static ADAPT_State_t ADAPT_States[PHASE_INTERSECTION_COUNT];
+static u8 ADAPT_Enabled = ADAPT_AT_BOOT;
+/*****************************< Private Functions *****************************/
+/**
+ * @brief Q16 quotient Copy_Num / Copy_Den, saturating. Copy_Den must not exceed 65536.
+ */
+static u32 ADAPT_DivQ16(u32 Copy_Num, u32 Copy_Den)
+{
+    u32 Local_Whole;
+
+    if (Copy_Den == 0)
+    {
+        return 0xFFFFFFFFUL;
+    }
+
+    Local_Whole = Copy_Num / Copy_Den;
+    if (Local_Whole >= 0x10000UL)
+    {
+        return 0xFFFFFFFFUL;
+    }
+
+    return (Local_Whole << 16) + (((Copy_Num % Copy_Den) << 16) / Copy_Den);
+}
+
+/**
+ * @brief Move a moving average 1 / 2^ADAPT_EMA_SHIFT of the way to a new sample.
+ */
+static u32 ADAPT_Average(u32 Copy_Average, u32 Copy_Sample)
+{
+    if (Copy_Sample >= Copy_Average)
+    {
+        return Copy_Average + ((Copy_Sample - Copy_Average) >> ADAPT_EMA_SHIFT);
+    }
+
+    return Copy_Average - ((Copy_Average - Copy_Sample) >> ADAPT_EMA_SHIFT);
+}
+
+static u32 ADAPT_Clamp(u32 Copy_Value, u32 Copy_Min, u32 Copy_Max)
+{
+    if (Copy_Value < Copy_Min)
+    {
+        return Copy_Min;
+    }
+
+    return (Copy_Value > Copy_Max) ? Copy_Max : Copy_Value;
+}
+
+/**
+ * @brief Per-hour Q16 rate of a count averaged per cycle, over the average cycle length.
+ */
+static u32 ADAPT_PerHour(u32 Copy_CountAverage, u32 Copy_CycleAverage)
+{
+    u32 Local_Cycle = ADAPT_Clamp(Copy_CycleAverage >> ADAPT_AVERAGE_SHIFT, 1, 0xFFFF);
+    u32 Local_PerTickQ16 = ADAPT_DivQ16(Copy_CountAverage, Local_Cycle) >> ADAPT_AVERAGE_SHIFT;
+
+    return (Local_PerTickQ16 > ADAPT_MAX_PER_TICK_Q16) ? 0xFFFFFFFFUL : (Local_PerTickQ16 * ADAPT_TICKS_PER_HOUR);
+}
+
+/**
+ * @brief Take the counts of the cycle that just ended into the moving averages.
+ */
+static void ADAPT_Sample(ADAPT_State_t *Copy_State)
+{
+    u32 Local_PriMask;
+    u32 Local_Vehicles;
+    u32 Local_Pedestrians;
+    u32 Local_Occupied = (u32)Copy_State->OccupiedTicks << ADAPT_AVERAGE_SHIFT;
+    u32 Local_Cycle = (u32)Copy_State->CycleTicks << ADAPT_AVERAGE_SHIFT;
+
+    /**< The input interrupts update the counts */
+    Local_PriMask = SCB_EnterCritical();
+    Local_Vehicles = (u32)Copy_State->Vehicles << ADAPT_AVERAGE_SHIFT;
+    Local_Pedestrians = (u32)Copy_State->Pedestrians << ADAPT_AVERAGE_SHIFT;
+    Copy_State->Vehicles = 0;
+    Copy_State->Pedestrians = 0;
+    SCB_ExitCritical(Local_PriMask);
+
+    Copy_State->OccupiedTicks = 0;
+
+    /**< Counting starts at the first cycle start, and the first full cycle seeds the averages */
+    if (Copy_State->Cycles == 0)
+    {
+        Copy_State->Cycles = 1;
+        return;
+    }
+    else if (Copy_State->Cycles == 1)
+    {
+        Copy_State->Cycles = 2;
+        Copy_State->VehiclesAverage = Local_Vehicles;
+        Copy_State->PedestriansAverage = Local_Pedestrians;
+        Copy_State->OccupiedAverage = Local_Occupied;
+        Copy_State->CycleAverage = Local_Cycle;
+    }
+    else
+    {
+        Copy_State->VehiclesAverage = ADAPT_Average(Copy_State->VehiclesAverage, Local_Vehicles);
+        Copy_State->PedestriansAverage = ADAPT_Average(Copy_State->PedestriansAverage, Local_Pedestrians);
+        Copy_State->OccupiedAverage = ADAPT_Average(Copy_State->OccupiedAverage, Local_Occupied);
+        Copy_State->CycleAverage = ADAPT_Average(Copy_State->CycleAverage, Local_Cycle);
+    }
+
+    /**< Ratios of the averages: the actuated green lengthens the cycles that carry more vehicles,
+         so an average of per-cycle rates would read low */
+    Copy_State->Estimate.FlowQ16 = ADAPT_PerHour(Copy_State->VehiclesAverage, Copy_State->CycleAverage);
+    Copy_State->Estimate.PedFlowQ16 = ADAPT_PerHour(Copy_State->PedestriansAverage, Copy_State->CycleAverage);
+    Copy_State->Estimate.OccupancyQ16 = ADAPT_Clamp(ADAPT_DivQ16(Copy_State->OccupiedAverage, Copy_State->CycleAverage >> ADAPT_AVERAGE_SHIFT) >> ADAPT_AVERAGE_SHIFT, 0, ADAPT_Q16_ONE);
+}
+
+/**
+ * @brief Recompute the greens from the estimates and install the plan if it differs.
+ */
+static void ADAPT_Plan(u8 Copy_Intersection)
+{
+    ADAPT_State_t *Local_State = &ADAPT_States[Copy_Intersection];
+    const PHASE_Descriptor_t *Local_Active = PHASE_GetActiveTable(Copy_Intersection);
+    PHASE_Descriptor_t *Local_Plan;
+    u32 Local_LostTicks = 0;
+    u32 Local_CarRatio;
+    u32 Local_PedRatio;
+    u32 Local_Ratio;
+    u32 Local_Cycle;
+    u32 Local_Green;
+    u32 Local_CarGreen;
+    u32 Local_Walk;
+    u32 Local_MinCarGreen;
+    u8 Local_PedOnCycle = 0;
+    u8 Local_Phase;
+    u8 Local_Steps;
+
+    /**< A plan uploaded over the link takes over untouched; it is adapted from the cycle after */
+    if ((Local_Active == NULL) || (PHASE_GetPendingTable(Copy_Intersection) != NULL))
+    {
+        return;
+    }
+
+    /**< Lost time: every phase on the cycle between the two greens */
+    Local_Phase = Local_Active[ADAPT_CAR_PHASE].Next;
+    for (Local_Steps = 0; (Local_Steps < PHASE_COUNT) && (Local_Phase != ADAPT_CAR_PHASE); Local_Steps++)
+    {
+        if (Local_Phase == ADAPT_PED_PHASE)
+        {
+            Local_PedOnCycle = 1;
+        }
+        else
+        {
+            Local_LostTicks += Local_Active[Local_Phase].DurationTicks;
+        }
+        Local_Phase = Local_Active[Local_Phase].Next;
+    }
+    if ((Local_Phase != ADAPT_CAR_PHASE) || !Local_PedOnCycle)
+    {
+        return;
+    }
+
+    /**< Critical flow ratios; a queue discharging over the detector in one block is seen in the occupancy only */
+    Local_CarRatio = Local_State->Estimate.FlowQ16 / ADAPT_SAT_FLOW_VPH;
+    if (Local_State->Estimate.OccupancyQ16 > Local_CarRatio)
+    {
+        Local_CarRatio = Local_State->Estimate.OccupancyQ16;
+    }
+    Local_CarRatio = ADAPT_Clamp(Local_CarRatio, 0, ADAPT_Q16_ONE);
+    Local_PedRatio = ADAPT_Clamp(Local_State->Estimate.PedFlowQ16 / ADAPT_PED_SAT_FLOW_PH, 0, ADAPT_Q16_ONE);
+    Local_Ratio = ADAPT_Clamp(Local_CarRatio + Local_PedRatio, 0, ADAPT_MAX_RATIO_Q16);
+    Local_State->Estimate.RatioQ16 = Local_Ratio;
+
+    /**< Webster: C = (1.5 L + 5 s) / (1 - Y) */
+    Local_Cycle = ADAPT_DivQ16(((3 * Local_LostTicks) / 2) + ADAPT_WEBSTER_CONST_TICKS, ADAPT_Q16_ONE - Local_Ratio);
+    Local_Cycle = ADAPT_Clamp(Local_Cycle, ADAPT_MIN_CYCLE_TICKS, ADAPT_MAX_CYCLE_TICKS);
+    Local_Green = (Local_Cycle > Local_LostTicks) ? (Local_Cycle - Local_LostTicks) : 0;
+
+    /**< Split in proportion to the ratios, 8 bits are plenty; evenly without demand */
+    if (((Local_CarRatio + Local_PedRatio) >> 8) == 0)
+    {
+        Local_CarGreen = Local_Green / 2;
+    }
+    else
+    {
+        Local_CarGreen = (Local_Green * (Local_CarRatio >> 8)) / ((Local_CarRatio + Local_PedRatio) >> 8);
+    }
+
+    Local_MinCarGreen = Local_Active[ADAPT_CAR_PHASE].MinTicks;
+    if (Local_MinCarGreen < ADAPT_MIN_CAR_GREEN_TICKS)
+    {
+        Local_MinCarGreen = ADAPT_MIN_CAR_GREEN_TICKS;
+    }
+    Local_Walk = ADAPT_Clamp(Local_Green - ADAPT_Clamp(Local_CarGreen, 0, Local_Green), ADAPT_MIN_WALK_TICKS, ADAPT_MAX_GREEN_TICKS);
+    Local_CarGreen = ADAPT_Clamp(Local_CarGreen, Local_MinCarGreen, ADAPT_MAX_GREEN_TICKS);
+
+    Local_State->Estimate.CycleTicks = (u16)ADAPT_Clamp(Local_CarGreen + Local_Walk + Local_LostTicks, 0, 0xFFFF);
+    Local_State->Estimate.CarGreenTicks = (u16)Local_CarGreen;
+    Local_State->Estimate.WalkTicks = (u16)Local_Walk;
+
+    if (!ADAPT_Enabled ||
+        ((Local_Active[ADAPT_CAR_PHASE].DurationTicks == Local_CarGreen) &&
+         (Local_Active[ADAPT_PED_PHASE].DurationTicks == Local_Walk)))
+    {
+        return;
+    }
+
+    /**< Rewrite the buffer that is not running; the engine switches at the next cycle start */
+    Local_Plan = (Local_Active == Local_State->Plans[0]) ? Local_State->Plans[1] : Local_State->Plans[0];
+    for (Local_Phase = 0; Local_Phase < PHASE_COUNT; Local_Phase++)
+    {
+        Local_Plan[Local_Phase] = Local_Active[Local_Phase];
+    }
+    Local_Plan[ADAPT_CAR_PHASE].DurationTicks = (u16)Local_CarGreen;
+    if (Local_Plan[ADAPT_CAR_PHASE].MinTicks > Local_CarGreen)
+    {
+        Local_Plan[ADAPT_CAR_PHASE].MinTicks = (u16)Local_CarGreen;
+    }
+    Local_Plan[ADAPT_PED_PHASE].DurationTicks = (u16)Local_Walk;
+
+    if (PHASE_InstallTable(Copy_Intersection, Local_Plan) != E_OK)
+    {
+        Local_State->Estimate.Rejected++;
+    }
+}
+/*****************************< Function Implementations *****************************/
+void ADAPT_Init(void)
+{
+    u8 Local_Index;
+
+    for (Local_Index = 0; Local_Index < PHASE_INTERSECTION_COUNT; Local_Index++)
+    {
+        ADAPT_States[Local_Index].Estimate.FlowQ16 = 0;
+        ADAPT_States[Local_Index].Estimate.OccupancyQ16 = 0;
+        ADAPT_States[Local_Index].Estimate.PedFlowQ16 = 0;
+        ADAPT_States[Local_Index].Estimate.RatioQ16 = 0;
+        ADAPT_States[Local_Index].Estimate.CycleTicks = 0;
+        ADAPT_States[Local_Index].Estimate.CarGreenTicks = 0;
+        ADAPT_States[Local_Index].Estimate.WalkTicks = 0;
+        ADAPT_States[Local_Index].Estimate.Rejected = 0;
+        ADAPT_States[Local_Index].VehiclesAverage = 0;
+        ADAPT_States[Local_Index].PedestriansAverage = 0;
+        ADAPT_States[Local_Index].OccupiedAverage = 0;
+        ADAPT_States[Local_Index].CycleAverage = 0;
+        ADAPT_States[Local_Index].CycleTicks = 0;
+        ADAPT_States[Local_Index].OccupiedTicks = 0;
+        ADAPT_States[Local_Index].Cycles = 0;
+        ADAPT_States[Local_Index].LastPhase = PHASE_COUNT;
+        ADAPT_States[Local_Index].Occupied = 0;
+        ADAPT_States[Local_Index].Vehicles = 0;
+        ADAPT_States[Local_Index].Pedestrians = 0;
+    }
+
+    ADAPT_Enabled = ADAPT_AT_BOOT;
+}
+
+void ADAPT_SetEnabled(u8 Copy_Enable)
+{
+    ADAPT_Enabled = Copy_Enable ? 1 : 0;
+}
+
+void ADAPT_OnDetector(u8 Copy_Intersection, u8 Copy_Level)
+{
+    ADAPT_State_t *Local_State;
+
+    if (Copy_Intersection >= PHASE_INTERSECTION_COUNT)
+    {
+        return;
+    }
+    Local_State = &ADAPT_States[Copy_Intersection];
+
+    if (Copy_Level && !Local_State->Occupied && (Local_State->Vehicles != 0xFFFF))
+    {
+        Local_State->Vehicles++;
+    }
+    Local_State->Occupied = Copy_Level ? 1 : 0;
+}
+
+void ADAPT_OnPedestrian(u8 Copy_Intersection)
+{
+    if ((Copy_Intersection < PHASE_INTERSECTION_COUNT) && (ADAPT_States[Copy_Intersection].Pedestrians != 0xFFFF))
+    {
+        ADAPT_States[Copy_Intersection].Pedestrians++;
+    }
+}
+
+void ADAPT_Tick(void)
+{
+    ADAPT_State_t *Local_State;
+    u8 Local_Index;
+    u8 Local_Phase;
+
+    for (Local_Index = 0; Local_Index < PHASE_INTERSECTION_COUNT; Local_Index++)
+    {
+        Local_State = &ADAPT_States[Local_Index];
+        Local_Phase = PHASE_GetCurrentPhase(Local_Index);
+
+        if (Local_State->CycleTicks != 0xFFFF)
+        {
+            Local_State->CycleTicks++;
+        }
+
+        /**< On red the detector only shows that a queue stands, not how fast it would discharge */
+        if ((Local_Phase == ADAPT_CAR_PHASE) && Local_State->Occupied && (Local_State->OccupiedTicks != 0xFFFF))
+        {
+            Local_State->OccupiedTicks++;
+        }
+
+        if ((Local_Phase == PHASE_CYCLE_START) && (Local_State->LastPhase != PHASE_CYCLE_START))
+        {
+            ADAPT_Sample(Local_State);
+            if (Local_State->Cycles > 1)
+            {
+                ADAPT_Plan(Local_Index);
+            }
+            Local_State->CycleTicks = 0;
+        }
+        Local_State->LastPhase = Local_Phase;
+    }
+}
+
+Std_ReturnType ADAPT_GetEstimate(u8 Copy_Intersection, ADAPT_Estimate_t *Copy_Estimate)
+{
+    if ((Copy_Intersection >= PHASE_INTERSECTION_COUNT) || (Copy_Estimate == NULL))
+    {
+        return E_NOT_OK;
+    }
+
+    *Copy_Estimate = ADAPT_States[Copy_Intersection].Estimate;
+
+    return E_OK;
+}
+
+u8 ADAPT_IsOwnPlan(u8 Copy_Intersection, const PHASE_Descriptor_t *Copy_Table)
+{
+    if ((Copy_Intersection >= PHASE_INTERSECTION_COUNT) || (Copy_Table == NULL))
+    {
+        return 0;
+    }
+
+    return ((Copy_Table == ADAPT_States[Copy_Intersection].Plans[0]) ||
+            (Copy_Table == ADAPT_States[Copy_Intersection].Plans[1])) ? 1 : 0;
+}
+/*****************************< End of Function Implementations *****************************/
@@ -61,6 +61,25 @@ typedef enum
     AFIO_REMAP_CUSTOM,   /**< Custom remap (user-defined) */ 
 } AFIO_RemapConfig_t;
 
+/**
+ * @name Timer Remap
+ * @brief Timers and remap values for MCAL_AFIO_SetTimerRemap.
+ *
+ * - TIM2: NONE CH1..CH4 = PA0..PA3; PARTIAL1 CH1 = PA15, CH2 = PB3; PARTIAL2 CH3 = PB10, CH4 = PB11; FULL all four.
+ * - TIM3: NONE CH1..CH4 = PA6, PA7, PB0, PB1; PARTIAL2 CH1 = PB4, CH2 = PB5; FULL on PC6..PC9.
+ * - TIM4: NONE CH1..CH4 = PB6..PB9; FULL on PD12..PD15.
+ * @{
+ */
+#define AFIO_TIMER2                 0
+#define AFIO_TIMER3                 1
+#define AFIO_TIMER4                 2
+
+#define AFIO_TIM_REMAP_NONE         0
+#define AFIO_TIM_REMAP_PARTIAL1     1   /**< TIM2 only */
+#define AFIO_TIM_REMAP_PARTIAL2     2   /**< TIM2 and TIM3 */
+#define AFIO_TIM_REMAP_FULL         3
+/** @} */
+
 /** @} */  // End of AFIO_Remap_Options group
 
 
@@ -114,6 +133,18 @@ Std_ReturnType MCAL_AFIO_SetDebugPort(u8 Copy_DebugConfig);
  */
 Std_ReturnType MCAL_AFIO_SetMAPR2(u32 Copy_MAPR2Config);
 
+/**
+ * @brief Route the channels of a general-purpose timer to their pins.
+ *
+ * The SWJ_CFG bits read back undefined, so they are written as 000 (full SWJ, the reset state).
+ *
+ * @param[in] Copy_Timer AFIO_TIMER2, AFIO_TIMER3 or AFIO_TIMER4.
+ * @param[in] Copy_Remap AFIO_TIM_REMAP_x, as far as the timer supports it.
+ *
+ * @return Std_ReturnType E_OK on success, E_NOT_OK for an invalid timer or remap.
+ */
+Std_ReturnType MCAL_AFIO_SetTimerRemap(u8 Copy_Timer, u8 Copy_Remap);
+
 /**
  * @brief Configures EXTI (External Interrupt) line mapping for a specific GPIO port.
  *
@@ -93,6 +93,49 @@ void AFIO_MAPR_ADC2ETRGINJRemap(bool Copy_Enable)
     AFIO->MAPR = regValue;
 }
 
+Std_ReturnType MCAL_AFIO_SetTimerRemap(u8 Copy_Timer, u8 Copy_Remap)
+{
+    u32 Local_Mask;
+    u32 Local_Value;
+
+    switch (Copy_Timer)
+    {
+    case AFIO_TIMER2:
+        Local_Mask = AFIO_MAPR_TIM2_REMAP_Msk;
+        Local_Value = (u32)Copy_Remap << AFIO_MAPR_TIM2_REMAP_Pos;
+        break;
+    case AFIO_TIMER3:
+        /**< TIM3 has no first partial remap */
+        if (Copy_Remap == AFIO_TIM_REMAP_PARTIAL1)
+        {
+            return E_NOT_OK;
+        }
+        Local_Mask = AFIO_MAPR_TIM3_REMAP_Msk;
+        Local_Value = (u32)Copy_Remap << AFIO_MAPR_TIM3_REMAP_Pos;
+        break;
+    case AFIO_TIMER4:
+        /**< TIM4 has a single remap bit */
+        if ((Copy_Remap != AFIO_TIM_REMAP_NONE) && (Copy_Remap != AFIO_TIM_REMAP_FULL))
+        {
+            return E_NOT_OK;
+        }
+        Local_Mask = AFIO_MAPR_TIM4_REMAP_Msk;
+        Local_Value = (Copy_Remap == AFIO_TIM_REMAP_FULL) ? AFIO_MAPR_TIM4_REMAP_Msk : 0;
+        break;
+    default:
+        return E_NOT_OK;
+    }
+
+    if (Copy_Remap > AFIO_TIM_REMAP_FULL)
+    {
+        return E_NOT_OK;
+    }
+
+    AFIO->MAPR = (AFIO->MAPR & ~(Local_Mask | AFIO_MAPR_SWJ_CFG_Msk)) | Local_Value;
+
+    return E_OK;
+}
+
 Std_ReturnType MCAL_AFIO_SetEXTIConfiguration(u8 Copy_Line, u8 Copy_PortMap)
 {
     Std_ReturnType Local_FunctionStatus = E_NOT_OK;
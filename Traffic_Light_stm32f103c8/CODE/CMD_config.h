@@ -0,0 +1,25 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : CMD_config.h               *****************/
+/****************************************************************/
+#ifndef CMD_CONFIG_H_
+#define CMD_CONFIG_H_
+
+/**
+ * @brief Largest encoded command frame in bytes, delimiter excluded.
+ *
+ * A SET_PHASE_TABLE frame is 1 + 1 + 8 * PHASE_COUNT + 2 bytes before COBS adds its code byte.
+ * Longer frames are dropped and answered with CMD_STATUS_BAD_FRAME.
+ */
+#define CMD_FRAME_SIZE      64
+
+/**
+ * @brief Crossing that receives uploaded plans (0 .. PHASE_INTERSECTION_COUNT - 1).
+ *
+ * The image mapper passed to CMD_Init must map the signals of this crossing.
+ */
+#define CMD_PLAN_INTERSECTION   0
+
+#endif /**< CMD_CONFIG_H_ */
@@ -0,0 +1,112 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : CMD_interface.h            *****************/
+/****************************************************************/
+#ifndef CMD_INTERFACE_H_
+#define CMD_INTERFACE_H_
+
+/**
+ * @defgroup CMD_Types CMD Type Definitions
+ *
+ * Commands use the telemetry framing (see TLM_interface.h):
+ *
+ *     COBS( sequence:u8  command:u8  body...  crc16:u16le )  0x00
+ *
+ * Every command frame is answered with a TLM_MSG_ACK record carrying the command ID and
+ * a CMD_STATUS_x code. Frames are handled one at a time: send the next command after the
+ * acknowledgement of the previous one.
+ * @{
+ */
+
+/**
+ * @name Command IDs
+ * @{
+ */
+#define CMD_NO_COMMAND          0x00    /**< Used in acknowledgements of frames that could not be decoded */
+/**
+ * Body: PHASE_COUNT descriptors of 8 bytes, in phase order:
+ *
+ *     signals:u8  flags:u8  duration_ms:u16le  min_ms:u16le  next:u8  next_on_request:u8
+ *
+ * Durations must be multiples of PHASE_TICK_MS. An accepted plan takes over at the next
+ * cycle boundary (PHASE_CYCLE_START) of crossing CMD_PLAN_INTERSECTION; a later upload
+ * replaces a plan still pending.
+ */
+#define CMD_SET_PHASE_TABLE     0x01
+/**
+ * Body: seconds:u32le since Monday 1 January 2024, 00:00 local time.
+ *
+ * Sets the clock of the time-of-day scheduler, which selects the scheduled plan at once.
+ */
+#define CMD_SET_CLOCK           0x02
+/** @} */
+
+/**
+ * @name Status Codes
+ * @{
+ */
+#define CMD_STATUS_OK               0   /**< Command executed, plan pending for the next cycle */
+#define CMD_STATUS_BAD_FRAME        1   /**< COBS, CRC or length error, or frame dropped while busy */
+#define CMD_STATUS_BAD_COMMAND      2   /**< Unknown command ID or wrong body length */
+#define CMD_STATUS_BAD_PLAN         3   /**< Plan rejected by PHASE_CheckTable or durations off the tick */
+#define CMD_STATUS_UNSAFE_IMAGE     4   /**< A phase shows conflicting greens or green with red */
+#define CMD_STATUS_NO_CLEARANCE     5   /**< A conflicting green can follow within SAFETY_MIN_CLEARANCE_MS */
+#define CMD_STATUS_NO_CLOCK         6   /**< The RTC does not run (LSE not started) */
+/** @} */
+
+/**
+ * @brief Maps a PHASE_SIG_x image to the output image the safety monitor judges.
+ */
+typedef u32 (*CMD_ImageMapper_t)(u8 Copy_Signals);
+
+/** @} */ // End of CMD_Types
+
+/**
+ * @defgroup CMD_Functions CMD Functions
+ * @brief Command channel for live timing-plan updates over the telemetry UART.
+ *
+ * Received bytes are collected into a frame buffer from the USART receive interrupt;
+ * decoding, validation and installation run from the main loop, in the context that
+ * calls PHASE_Tick, so the engine never sees a half-written plan. Uploaded plans are
+ * kept in two buffers: one may be active while the other is being filled.
+ * @{
+ */
+
+/**
+ * @brief Reset the command channel.
+ *
+ * @param[in] Copy_MapImage Converts phase signals to the output image (same as the one driving the pins).
+ *
+ * @return None.
+ */
+void CMD_Init(CMD_ImageMapper_t Copy_MapImage);
+
+/**
+ * @brief Collect received bytes into command frames. Register with MCAL_USART_SetRxCallback.
+ *
+ * @param[in] Copy_Data The received bytes.
+ * @param[in] Copy_Length Number of bytes.
+ *
+ * @return None.
+ */
+void CMD_ReceiveBytes(const u8 *Copy_Data, u32 Copy_Length);
+
+/**
+ * @brief Execute a complete command frame, if any, and acknowledge it. Call from the main loop.
+ *
+ * @return None.
+ */
+void CMD_Process(void);
+
+/**
+ * @brief Check whether CMD_Process has anything to do.
+ *
+ * @return 1 if a frame is waiting or a dropped frame has not been acknowledged yet, 0 otherwise.
+ */
+u8 CMD_IsPending(void);
+
+/** @} */ // End of CMD_Functions
+
+#endif /**< CMD_INTERFACE_H_ */
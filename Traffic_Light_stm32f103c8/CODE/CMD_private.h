@@ -0,0 +1,41 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : CMD_private.h              *****************/
+/****************************************************************/
+#ifndef CMD_PRIVATE_H_
+#define CMD_PRIVATE_H_
+
+#define CMD_DELIMITER               0x00
+
+/**< Wire size of one phase descriptor in CMD_SET_PHASE_TABLE */
+#define CMD_DESCRIPTOR_SIZE         8
+
+#if CMD_FRAME_SIZE < (1 + 1 + (CMD_DESCRIPTOR_SIZE * PHASE_COUNT) + 2 + 1)
+#error "CMD_FRAME_SIZE cannot hold a SET_PHASE_TABLE frame"
+#endif
+
+#if CMD_PLAN_INTERSECTION >= PHASE_INTERSECTION_COUNT
+#error "CMD_PLAN_INTERSECTION is not a crossing of the phase engine"
+#endif
+
+/**< Little-endian u16 at a byte pointer */
+#define CMD_GET_U16(PTR)            ((u16)((PTR)[0] | ((PTR)[1] << 8)))
+
+/**< Little-endian u32 at a byte pointer */
+#define CMD_GET_U32(PTR)            ((u32)CMD_GET_U16(PTR) | ((u32)CMD_GET_U16((PTR) + 2) << 16))
+
+/**< Body size of CMD_SET_CLOCK */
+#define CMD_CLOCK_SIZE              4
+
+/**< Flags that let a phase end at its minimum, as PLAN_FLAG_SHORTENS for the built-in plans */
+#define CMD_FLAG_SHORTENS           (PHASE_FLAG_ENDS_ON_REQUEST | PHASE_FLAG_ACTUATED)
+
+/**< Distance of a phase that cannot be reached */
+#define CMD_UNREACHED               0xFFFFFFFFUL
+
+/**< Clearance of the safety monitor rounded up to phase ticks */
+#define CMD_CLEARANCE_TICKS(MS)     (((MS) + PHASE_TICK_MS - 1) / PHASE_TICK_MS)
+
+#endif /**< CMD_PRIVATE_H_ */
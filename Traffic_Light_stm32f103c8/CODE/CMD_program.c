@@ -0,0 +1,295 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : CMD_program.c              *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< SERVICE *****************************/
+#include "TLM_interface.h"
+/*****************************< APP *****************************/
+#include "PHASE_interface.h"
+#include "PHASE_config.h"
+#include "SAFETY_interface.h"
+#include "TOD_interface.h"
+#include "CMD_interface.h"
+#include "CMD_config.h"
+#include "CMD_private.h"
+/*****************************< Private Variables *****************************/
+static u8 CMD_RxFrame[CMD_FRAME_SIZE];
+static u32 CMD_RxLength = 0;                /**< Bytes of the frame being received */
+static u32 CMD_FrameLength = 0;             /**< Bytes of the complete frame, valid while CMD_FrameReady */
+static volatile u8 CMD_FrameReady = 0;      /**< Set by the receive interrupt, cleared by CMD_Process */
+static u8 CMD_RxDiscard = 0;                /**< Skipping to the next delimiter */
+static volatile u8 CMD_RxDropped = 0;       /**< Frames dropped by the receive interrupt */
+static u8 CMD_RxDroppedAcked = 0;           /**< Dropped frames already acknowledged */
+static PHASE_Descriptor_t CMD_Tables[2][PHASE_COUNT];
+static CMD_ImageMapper_t CMD_MapImage = NULL;
+/*****************************< Private Functions *****************************/
+/**< Earliest a phase can end: gap-out, a request or a force-off all end it at its minimum */
+static u32 CMD_ShortestTicks(u8 Copy_Index, const PHASE_Descriptor_t *Copy_Phase)
+{
+    if ((Copy_Phase->Flags & CMD_FLAG_SHORTENS) || (Copy_Index == PHASE_CYCLE_START))
+    {
+        return Copy_Phase->MinTicks;
+    }
+
+    return Copy_Phase->DurationTicks;
+}
+
+static Std_ReturnType CMD_CheckClearance(const PHASE_Descriptor_t *Copy_Table, const u8 *Copy_Greens,
+                                         u8 Copy_Start, u8 Copy_Ended)
+{
+    u32 Local_Distance[PHASE_COUNT];
+    u32 Local_Limit = CMD_CLEARANCE_TICKS(SAFETY_GetMinClearanceMs());
+    u8 Local_Conflicts = SAFETY_GetConflicts(Copy_Ended);
+    const PHASE_Descriptor_t *Local_Phase;
+    u32 Local_Shortest;
+    u8 Local_Round;
+    u8 Local_Index;
+
+    for (Local_Index = 0; Local_Index < PHASE_COUNT; Local_Index++)
+    {
+        Local_Distance[Local_Index] = CMD_UNREACHED;
+    }
+    Local_Distance[Copy_Start] = 0;
+
+    /**< Shortest time from the end of the green to every phase, stopping at conflicting greens */
+    for (Local_Round = 0; Local_Round < PHASE_COUNT; Local_Round++)
+    {
+        for (Local_Index = 0; Local_Index < PHASE_COUNT; Local_Index++)
+        {
+            if ((Local_Distance[Local_Index] == CMD_UNREACHED) || (Copy_Greens[Local_Index] & Local_Conflicts))
+            {
+                continue;
+            }
+
+            Local_Phase = &Copy_Table[Local_Index];
+            Local_Shortest = Local_Distance[Local_Index] + CMD_ShortestTicks(Local_Index, Local_Phase);
+            if (Local_Shortest < Local_Distance[Local_Phase->Next])
+            {
+                Local_Distance[Local_Phase->Next] = Local_Shortest;
+            }
+            if ((Local_Phase->Flags & PHASE_FLAG_ENDS_ON_REQUEST) &&
+                (Local_Shortest < Local_Distance[Local_Phase->NextOnRequest]))
+            {
+                Local_Distance[Local_Phase->NextOnRequest] = Local_Shortest;
+            }
+        }
+    }
+
+    for (Local_Index = 0; Local_Index < PHASE_COUNT; Local_Index++)
+    {
+        if ((Copy_Greens[Local_Index] & Local_Conflicts) && (Local_Distance[Local_Index] < Local_Limit))
+        {
+            return E_NOT_OK;
+        }
+    }
+
+    return E_OK;
+}
+
+static u8 CMD_CheckSignals(const PHASE_Descriptor_t *Copy_Table)
+{
+    const PHASE_Descriptor_t *Local_Descriptor;
+    u8 Local_Greens[PHASE_COUNT];
+    u8 Local_Ended;
+    u8 Local_Phase;
+
+    /**< Every image must pass the stateless rules of the safety monitor */
+    for (Local_Phase = 0; Local_Phase < PHASE_COUNT; Local_Phase++)
+    {
+        if (SAFETY_CheckImage(CMD_MapImage(Copy_Table[Local_Phase].Signals), &Local_Greens[Local_Phase]) != E_OK)
+        {
+            return CMD_STATUS_UNSAFE_IMAGE;
+        }
+    }
+
+    /**< Every transition that ends a green must keep conflicting greens away for the clearance time */
+    for (Local_Phase = 0; Local_Phase < PHASE_COUNT; Local_Phase++)
+    {
+        Local_Descriptor = &Copy_Table[Local_Phase];
+        Local_Ended = Local_Greens[Local_Phase] & (u8)~Local_Greens[Local_Descriptor->Next];
+
+        if (Local_Ended &&
+            (CMD_CheckClearance(Copy_Table, Local_Greens, Local_Descriptor->Next, Local_Ended) != E_OK))
+        {
+            return CMD_STATUS_NO_CLEARANCE;
+        }
+
+        if (Local_Descriptor->Flags & PHASE_FLAG_ENDS_ON_REQUEST)
+        {
+            Local_Ended = Local_Greens[Local_Phase] & (u8)~Local_Greens[Local_Descriptor->NextOnRequest];
+            if (Local_Ended &&
+                (CMD_CheckClearance(Copy_Table, Local_Greens, Local_Descriptor->NextOnRequest, Local_Ended) != E_OK))
+            {
+                return CMD_STATUS_NO_CLEARANCE;
+            }
+        }
+    }
+
+    return CMD_STATUS_OK;
+}
+
+static u8 CMD_SetPhaseTable(const u8 *Copy_Body, u32 Copy_Length)
+{
+    PHASE_Descriptor_t *Local_Table;
+    u16 Local_DurationMs;
+    u16 Local_MinMs;
+    u8 Local_Phase;
+    u8 Local_Status;
+
+    if (Copy_Length != (CMD_DESCRIPTOR_SIZE * PHASE_COUNT))
+    {
+        return CMD_STATUS_BAD_COMMAND;
+    }
+
+    /**< Fill the buffer the engine is not running on; a plan still pending in it is withdrawn */
+    Local_Table = (PHASE_GetActiveTable(CMD_PLAN_INTERSECTION) == CMD_Tables[0]) ? CMD_Tables[1] : CMD_Tables[0];
+    if (PHASE_GetPendingTable(CMD_PLAN_INTERSECTION) == Local_Table)
+    {
+        (void)PHASE_InstallTable(CMD_PLAN_INTERSECTION, NULL);
+    }
+
+    for (Local_Phase = 0; Local_Phase < PHASE_COUNT; Local_Phase++)
+    {
+        Local_DurationMs = CMD_GET_U16(&Copy_Body[2]);
+        Local_MinMs = CMD_GET_U16(&Copy_Body[4]);
+
+        if (((Local_DurationMs % PHASE_TICK_MS) != 0) || ((Local_MinMs % PHASE_TICK_MS) != 0))
+        {
+            return CMD_STATUS_BAD_PLAN;
+        }
+
+        Local_Table[Local_Phase].Signals = Copy_Body[0];
+        Local_Table[Local_Phase].Flags = Copy_Body[1];
+        Local_Table[Local_Phase].DurationTicks = (u16)(Local_DurationMs / PHASE_TICK_MS);
+        Local_Table[Local_Phase].MinTicks = (u16)(Local_MinMs / PHASE_TICK_MS);
+        Local_Table[Local_Phase].Next = Copy_Body[6];
+        Local_Table[Local_Phase].NextOnRequest = Copy_Body[7];
+
+        Copy_Body += CMD_DESCRIPTOR_SIZE;
+    }
+
+    /**< Structure first: the signal checks index phases through the successors */
+    if (PHASE_CheckTable(Local_Table, NULL) != E_OK)
+    {
+        return CMD_STATUS_BAD_PLAN;
+    }
+
+    Local_Status = CMD_CheckSignals(Local_Table);
+    if (Local_Status != CMD_STATUS_OK)
+    {
+        return Local_Status;
+    }
+
+    return (PHASE_InstallTable(CMD_PLAN_INTERSECTION, Local_Table) == E_OK) ? CMD_STATUS_OK : CMD_STATUS_BAD_PLAN;
+}
+
+static u8 CMD_SetClock(const u8 *Copy_Body, u32 Copy_Length)
+{
+    if (Copy_Length != CMD_CLOCK_SIZE)
+    {
+        return CMD_STATUS_BAD_COMMAND;
+    }
+
+    return (TOD_SetTime(CMD_GET_U32(Copy_Body)) == E_OK) ? CMD_STATUS_OK : CMD_STATUS_NO_CLOCK;
+}
+/*****************************< Function Implementations *****************************/
+void CMD_Init(CMD_ImageMapper_t Copy_MapImage)
+{
+    CMD_MapImage = Copy_MapImage;
+    CMD_RxLength = 0;
+    CMD_FrameLength = 0;
+    CMD_RxDiscard = 0;
+    CMD_RxDroppedAcked = CMD_RxDropped;
+    CMD_FrameReady = 0;
+}
+
+void CMD_ReceiveBytes(const u8 *Copy_Data, u32 Copy_Length)
+{
+    u8 Local_Byte;
+
+    while (Copy_Length--)
+    {
+        Local_Byte = *Copy_Data++;
+
+        if (Local_Byte == CMD_DELIMITER)
+        {
+            if (CMD_RxDiscard)
+            {
+                CMD_RxDiscard = 0;
+                CMD_RxDropped++;
+            }
+            else if (CMD_RxLength != 0)
+            {
+                CMD_FrameLength = CMD_RxLength;
+                CMD_FrameReady = 1;
+            }
+            CMD_RxLength = 0;
+        }
+        else if (CMD_FrameReady || CMD_RxDiscard || (CMD_RxLength >= CMD_FRAME_SIZE))
+        {
+            /**< The frame buffer is busy or too small: drop the whole frame */
+            CMD_RxDiscard = 1;
+        }
+        else
+        {
+            CMD_RxFrame[CMD_RxLength++] = Local_Byte;
+        }
+    }
+}
+
+void CMD_Process(void)
+{
+    u8 Local_Command = CMD_NO_COMMAND;
+    u8 Local_Status = CMD_STATUS_BAD_FRAME;
+    u8 Local_Sequence;
+    u32 Local_Length;
+
+    while (CMD_RxDroppedAcked != CMD_RxDropped)
+    {
+        CMD_RxDroppedAcked++;
+        (void)TLM_RecordAck(CMD_NO_COMMAND, CMD_STATUS_BAD_FRAME);
+    }
+
+    if ((CMD_FrameReady == 0) || (CMD_MapImage == NULL))
+    {
+        return;
+    }
+
+    if ((TLM_DecodeFrame(CMD_RxFrame, CMD_FrameLength, &Local_Sequence, &Local_Length) == E_OK) &&
+        (Local_Length != 0))
+    {
+        /**< The command follows the sequence number, the body follows the command */
+        Local_Command = CMD_RxFrame[1];
+
+        switch (Local_Command)
+        {
+        case CMD_SET_PHASE_TABLE:
+            Local_Status = CMD_SetPhaseTable(&CMD_RxFrame[2], Local_Length - 1);
+            break;
+
+        case CMD_SET_CLOCK:
+            Local_Status = CMD_SetClock(&CMD_RxFrame[2], Local_Length - 1);
+            break;
+
+        default:
+            Local_Status = CMD_STATUS_BAD_COMMAND;
+            break;
+        }
+    }
+
+    /**< Hand the buffer back to the receive interrupt */
+    CMD_FrameReady = 0;
+
+    (void)TLM_RecordAck(Local_Command, Local_Status);
+}
+u8 CMD_IsPending(void)
+{
+    return (CMD_FrameReady || (CMD_RxDroppedAcked != CMD_RxDropped)) ? 1 : 0;
+}
+/*****************************< End of Function Implementations *****************************/
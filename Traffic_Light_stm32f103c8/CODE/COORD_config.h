@@ -0,0 +1,61 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : COORD_config.h             *****************/
+/****************************************************************/
+#ifndef COORD_CONFIG_H_
+#define COORD_CONFIG_H_
+
+/**
+ * @brief Role of this controller on the sync line (COORD_ROLE_NONE, COORD_ROLE_MASTER, COORD_ROLE_SLAVE).
+ */
+#define COORD_ROLE                  COORD_ROLE_NONE
+
+/**
+ * @brief Coordinated cycle, and where the cycles of this controller start in it.
+ *
+ * Both must be multiples of PHASE_TICK_MS, and the cycle a multiple of COORD_SYNC_PERIOD_MS. The
+ * same cycle is configured on all controllers; the offsets make the green wave.
+ */
+#define COORD_CYCLE_MS              20000
+#define COORD_OFFSET_MS             0
+
+/**
+ * @brief Sync line: a pulse every period, held longer at the start of the coordinated cycle.
+ *
+ * Multiples of PHASE_TICK_MS, shorter than the period.
+ */
+#define COORD_SYNC_PERIOD_MS        1000
+#define COORD_PULSE_MS              50
+#define COORD_MARK_MS               150
+
+/**
+ * @brief Loop gains: each edge slews by the error / 2^COORD_KP_SHIFT and corrects the rate by
+ * (error per period) / 2^COORD_KI_SHIFT.
+ */
+#define COORD_KP_SHIFT              1
+#define COORD_KI_SHIFT              2
+
+/**
+ * @brief Errors above COORD_CAPTURE_US are slewed out at once and do not train the rate; the
+ * slew is limited to COORD_MAX_SLEW_US per tick (1 % of a 50 ms tick), which keeps every
+ * phase within 1 % of its length while the clock is pulled in.
+ */
+#define COORD_CAPTURE_US            10000
+#define COORD_MAX_SLEW_US           500
+
+/**
+ * @brief Largest crystal error corrected, in parts per million.
+ */
+#define COORD_MAX_PPM               500
+
+/**
+ * @brief Lock indication: COORD_LOCK_PULSES edges in a row within COORD_LOCK_US. Lost after
+ * COORD_HOLDOVER_PULSES periods without an edge; the learned rate keeps being applied.
+ */
+#define COORD_LOCK_US               2000
+#define COORD_LOCK_PULSES           4
+#define COORD_HOLDOVER_PULSES       3
+
+#endif /**< COORD_CONFIG_H_ */
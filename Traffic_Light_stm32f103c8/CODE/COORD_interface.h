@@ -0,0 +1,119 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : COORD_interface.h          *****************/
+/****************************************************************/
+#ifndef COORD_INTERFACE_H_
+#define COORD_INTERFACE_H_
+
+/**
+ * @defgroup COORD_Roles COORD Roles (COORD_ROLE)
+ * @{
+ */
+#define COORD_ROLE_NONE         0 /**< Free running, the sync line is ignored */
+#define COORD_ROLE_MASTER       1 /**< Drives the sync line from the local clock */
+#define COORD_ROLE_SLAVE        2 /**< Steers the local clock onto the sync line */
+/** @} */
+
+/**
+ * @defgroup COORD_Types COORD Types
+ * @{
+ */
+
+/**
+ * @brief Synchronization state of the controller.
+ */
+typedef struct
+{
+    s32 ErrorUs;        /**< Offset of the last sync edge from the local grid, local clock late if negative */
+    u32 MaxErrorUs;     /**< Largest |ErrorUs| while locked */
+    s32 FreqPpb;        /**< Rate correction applied to the local clock, parts per billion */
+    u8 Locked;          /**< The last COORD_LOCK_PULSES edges were within COORD_LOCK_US */
+} COORD_Status_t;
+
+/** @} */ // End of COORD_Types
+
+/**
+ * @defgroup COORD_Functions COORD Functions
+ * @brief Green-wave coordination: a common cycle with fixed offsets on every controller of a route.
+ *
+ * One controller is the master and drives a sync line with a pulse every COORD_SYNC_PERIOD_MS;
+ * the pulse that starts the coordinated cycle is held for COORD_MARK_MS instead of COORD_PULSE_MS.
+ * The slaves time-stamp both edges and steer their tick grid onto the rising edges with a PI
+ * loop on TICK_Slew: the proportional part removes the phase error, the integral part learns the
+ * crystal error and keeps slewing by it between pulses (and through a lost sync line). The long
+ * pulse tells the slave where the cycle starts.
+ *
+ * On every controller each crossing then starts its cycle COORD_OFFSET_MS after the start of the
+ * coordinated cycle. The car green is run to a force-off point computed from the rest of the cycle
+ * (PHASE_SetCoordinated, PHASE_ForceOff), so a plan coordinates if its cycle with the car green at
+ * its minimum is no longer, and with the car green at its duration no shorter, than COORD_CYCLE_MS.
+ * A pending request is served inside that cycle: the car green leaves along Next when that path
+ * reaches the walk as soon as the request path would, as in the default plan, and the rest of the
+ * cycle is timed along the path the force-off takes (PHASE_GetForceOffNext).
+ * A crossing out of step (at boot, after a preemption or a new mark) has its car green cut to the
+ * minimum each cycle until a cycle can end on the offset.
+ * @{
+ */
+
+/**
+ * @brief Start the local coordinated clock and put the crossings under coordination per COORD_ROLE.
+ *
+ * Call after TICK_Init and PHASE_Init, before the first control tick.
+ *
+ * @return None.
+ */
+void COORD_Init(void);
+
+/**
+ * @brief Time-stamp an edge of the sync line. Called from its interrupt on both edges.
+ *
+ * @param[in] Copy_Level Level of the line after the edge.
+ *
+ * @return None.
+ */
+void COORD_OnSyncEdge(u8 Copy_Level);
+
+/**
+ * @brief Advance the coordinated clock by one tick, steer it and force off the crossings.
+ *
+ * Call once per control tick right before PHASE_Tick, from the same context.
+ *
+ * @return None.
+ */
+void COORD_Tick(void);
+
+/**
+ * @brief Get the level to drive on the sync line (the master's pulse, 0 on other roles).
+ *
+ * @return 1 for high, 0 for low.
+ */
+u8 COORD_GetSyncOutput(void);
+
+/**
+ * @brief Get the number of ticks until COORD_Tick has work: a sync edge to drive or expect, or a force-off.
+ *
+ * @return Ticks, at least 1, or PHASE_NO_EVENT without a role.
+ */
+u16 COORD_GetTicksToNextEvent(void);
+
+/**
+ * @brief Check whether the controller may stop its clocks. A stopped clock loses the sync.
+ *
+ * @return 1 without a role, 0 otherwise.
+ */
+u8 COORD_CanStop(void);
+
+/**
+ * @brief Get the synchronization state.
+ *
+ * @param[out] Copy_Status Receives the state.
+ *
+ * @return E_OK on success, E_NOT_OK for a NULL pointer.
+ */
+Std_ReturnType COORD_GetStatus(COORD_Status_t *Copy_Status);
+
+/** @} */ // End of COORD_Functions
+
+#endif /**< COORD_INTERFACE_H_ */
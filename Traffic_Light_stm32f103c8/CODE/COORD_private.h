@@ -0,0 +1,43 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : COORD_private.h            *****************/
+/****************************************************************/
+#ifndef COORD_PRIVATE_H_
+#define COORD_PRIVATE_H_
+
+#define COORD_TICK_US               ((u32)PHASE_TICK_MS * 1000)
+#define COORD_CYCLE_US              ((u32)COORD_CYCLE_MS * 1000)
+#define COORD_OFFSET_US             ((u32)COORD_OFFSET_MS * 1000)
+#define COORD_SYNC_PERIOD_US        ((u32)COORD_SYNC_PERIOD_MS * 1000)
+#define COORD_PULSE_US              ((u32)COORD_PULSE_MS * 1000)
+#define COORD_MARK_US               ((u32)COORD_MARK_MS * 1000)
+#define COORD_MAX_PPB               ((s32)COORD_MAX_PPM * 1000)
+
+/**< Edges of the sync line waiting for COORD_Tick */
+#define COORD_EDGE_RISE             0x01
+#define COORD_EDGE_FALL             0x02
+
+/**< Returned by COORD_RestTicks when the cycle start is not reached again */
+#define COORD_NO_PATH               0xFFFFFFFFUL
+
+#if (COORD_ROLE != COORD_ROLE_NONE) && (COORD_ROLE != COORD_ROLE_MASTER) && (COORD_ROLE != COORD_ROLE_SLAVE)
+#error "Invalid COORD_ROLE value. Please choose COORD_ROLE_NONE, COORD_ROLE_MASTER or COORD_ROLE_SLAVE."
+#endif
+
+#if ((COORD_CYCLE_MS % PHASE_TICK_MS) != 0) || ((COORD_OFFSET_MS % PHASE_TICK_MS) != 0) || \
+    ((COORD_SYNC_PERIOD_MS % PHASE_TICK_MS) != 0) || ((COORD_PULSE_MS % PHASE_TICK_MS) != 0) || \
+    ((COORD_MARK_MS % PHASE_TICK_MS) != 0)
+#error "COORD times must be multiples of PHASE_TICK_MS"
+#endif
+
+#if ((COORD_CYCLE_MS % COORD_SYNC_PERIOD_MS) != 0) || (COORD_OFFSET_MS >= COORD_CYCLE_MS)
+#error "COORD_CYCLE_MS must be a multiple of COORD_SYNC_PERIOD_MS and longer than COORD_OFFSET_MS"
+#endif
+
+#if (COORD_PULSE_MS == 0) || (COORD_PULSE_MS >= COORD_MARK_MS) || (COORD_MARK_MS >= COORD_SYNC_PERIOD_MS)
+#error "COORD pulses must satisfy 0 < COORD_PULSE_MS < COORD_MARK_MS < COORD_SYNC_PERIOD_MS"
+#endif
+
+#endif /**< COORD_PRIVATE_H_ */
@@ -0,0 +1,420 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : COORD_program.c            *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "SCB_interface.h"
+/*****************************< SERVICE *****************************/
+#include "TICK_interface.h"
+/*****************************< APP *****************************/
+#include "PHASE_interface.h"
+#include "PHASE_config.h"
+#include "COORD_interface.h"
+#include "COORD_config.h"
+#include "COORD_private.h"
+/*****************************< Private Variables *****************************/
+/**< Times are on the local clock (TICK_GetTimeUs) and compared by difference, so they may wrap */
+static u32 COORD_TickUs = 0;            /**< Tick boundary being run */
+static u32 COORD_SyncUs = 0;            /**< Master: next pulse. Slave: sync boundary nearest to the tick */
+static u32 COORD_CycleUs = 0;           /**< Start of the current coordinated cycle */
+static u32 COORD_PulseEndUs = 0;        /**< Master: end of the pulse being driven */
+static u8 COORD_Output = 0;
+static s32 COORD_SlewUs = 0;            /**< Slew not applied yet */
+static s32 COORD_FracPs = 0;            /**< Rate correction below one microsecond, carried over */
+static u32 COORD_SilentTicks = 0;       /**< Ticks since the last rising edge */
+static u8 COORD_GoodPulses = 0;
+static u32 COORD_MarkUs = 0;            /**< Sync boundary of the last rising edge */
+static u32 COORD_LastRiseUs = 0;
+static u8 COORD_RiseSeen = 0;           /**< A rising edge waits for its falling edge */
+static u16 COORD_GreenTicks[PHASE_INTERSECTION_COUNT];  /**< Ticks each crossing has been in PHASE_CYCLE_START */
+static COORD_Status_t COORD_Status;
+static volatile u8 COORD_Edges = 0;     /**< COORD_EDGE_xxx, set from the sync interrupt */
+static volatile u32 COORD_RiseUs = 0;
+static volatile u32 COORD_FallUs = 0;
+/*****************************< Private Functions *****************************/
+static s32 COORD_Abs(s32 Copy_Value)
+{
+    return (Copy_Value < 0) ? -Copy_Value : Copy_Value;
+}
+
+/**< Ticks from forcing off the cycle start into Copy_Phase until the cycle start is entered again */
+static u32 COORD_RestTicks(const PHASE_Descriptor_t *Copy_Table, u8 Copy_Phase)
+{
+    u32 Local_Ticks = 0;
+    u8 Local_Hops;
+
+    for (Local_Hops = 0; Copy_Phase != PHASE_CYCLE_START; Local_Hops++)
+    {
+        if (Local_Hops >= PHASE_COUNT)
+        {
+            return COORD_NO_PATH;
+        }
+        Local_Ticks += Copy_Table[Copy_Phase].DurationTicks;
+        Copy_Phase = Copy_Table[Copy_Phase].Next;
+    }
+
+    return Local_Ticks;
+}
+
+/**< Position in the coordinated cycle at which a crossing forced off now would start its next cycle, or COORD_NO_PATH */
+static u32 COORD_StartPosition(u8 Copy_Intersection)
+{
+    const PHASE_Descriptor_t *Local_Table = PHASE_GetActiveTable(Copy_Intersection);
+    u32 Local_Rest;
+    s32 Local_Position;
+
+    if ((Local_Table == NULL) || (PHASE_GetCurrentPhase(Copy_Intersection) != PHASE_CYCLE_START) ||
+        (PHASE_GetPreemptStep(Copy_Intersection) != PHASE_PREEMPT_NONE))
+    {
+        return COORD_NO_PATH;
+    }
+
+    Local_Rest = COORD_RestTicks(Local_Table, PHASE_GetForceOffNext(Copy_Intersection));
+    if (Local_Rest == COORD_NO_PATH)
+    {
+        return COORD_NO_PATH;
+    }
+
+    Local_Position = (s32)((COORD_TickUs + (Local_Rest * COORD_TICK_US)) - (COORD_CycleUs + COORD_OFFSET_US)) % (s32)COORD_CYCLE_US;
+
+    return (u32)((Local_Position < 0) ? (Local_Position + (s32)COORD_CYCLE_US) : Local_Position);
+}
+
+/**< Force-off only shortens the cycle start. It ends where the next cycle starts on the offset, at once if that
+     point is passed already, and as early as allowed if it lies past the phase's own end, which moves the next
+     cycle start earlier until a later cycle can end on it */
+static u8 COORD_ShouldForceOff(u8 Copy_Intersection)
+{
+    const PHASE_Descriptor_t *Local_Table = PHASE_GetActiveTable(Copy_Intersection);
+    u32 Local_Position = COORD_StartPosition(Copy_Intersection);
+    u32 Local_GreenTicks = COORD_GreenTicks[Copy_Intersection];
+    u32 Local_LeftTicks;
+
+    if (Local_Position == COORD_NO_PATH)
+    {
+        return 0;
+    }
+
+    if (Local_Position < (Local_GreenTicks * COORD_TICK_US))
+    {
+        return 1;
+    }
+
+    Local_LeftTicks = (Local_Table[PHASE_CYCLE_START].DurationTicks > Local_GreenTicks) ?
+                      (Local_Table[PHASE_CYCLE_START].DurationTicks - Local_GreenTicks) : 0;
+
+    return ((COORD_CYCLE_US - Local_Position) > (Local_LeftTicks * COORD_TICK_US)) ? 1 : 0;
+}
+
+/**< Master: a pulse on every sync boundary, the long one on the cycle start */
+static void COORD_Drive(void)
+{
+    if (COORD_TickUs == COORD_SyncUs)
+    {
+        COORD_Output = 1;
+        COORD_PulseEndUs = COORD_SyncUs + ((COORD_SyncUs == COORD_CycleUs) ? COORD_MARK_US : COORD_PULSE_US);
+        COORD_SyncUs += COORD_SYNC_PERIOD_US;
+    }
+    else if (COORD_Output && (COORD_TickUs == COORD_PulseEndUs))
+    {
+        COORD_Output = 0;
+    }
+}
+
+/**< Slave: measure the edges taken since the last tick against the local grid */
+static void COORD_TakeEdges(void)
+{
+    u32 Local_PriMask;
+    u8 Local_Edges;
+    u32 Local_RiseUs;
+    u32 Local_FallUs;
+    s32 Local_ErrorUs;
+    s32 Local_Periods;
+    s32 Local_Half = (s32)COORD_SYNC_PERIOD_US / 2;
+
+    Local_PriMask = SCB_EnterCritical();
+    Local_Edges = COORD_Edges;
+    Local_RiseUs = COORD_RiseUs;
+    Local_FallUs = COORD_FallUs;
+    COORD_Edges = 0;
+    SCB_ExitCritical(Local_PriMask);
+
+    if (Local_Edges & COORD_EDGE_RISE)
+    {
+        /**< Offset from the nearest sync boundary of the local grid */
+        Local_ErrorUs = (s32)(Local_RiseUs - COORD_SyncUs);
+        Local_Periods = ((Local_ErrorUs >= 0) ? (Local_ErrorUs + Local_Half) : (Local_ErrorUs - Local_Half)) / (s32)COORD_SYNC_PERIOD_US;
+        COORD_SyncUs += (u32)(Local_Periods * (s32)COORD_SYNC_PERIOD_US);
+        Local_ErrorUs -= Local_Periods * (s32)COORD_SYNC_PERIOD_US;
+
+        /**< PI: a small error is half slewed out and trains the rate; a large one is slewed out at once */
+        if (COORD_Abs(Local_ErrorUs) <= COORD_CAPTURE_US)
+        {
+            COORD_Status.FreqPpb += (Local_ErrorUs * (s32)(1000000UL / COORD_SYNC_PERIOD_MS)) / (1 << COORD_KI_SHIFT);
+            if (COORD_Status.FreqPpb > COORD_MAX_PPB)
+            {
+                COORD_Status.FreqPpb = COORD_MAX_PPB;
+            }
+            else if (COORD_Status.FreqPpb < -COORD_MAX_PPB)
+            {
+                COORD_Status.FreqPpb = -COORD_MAX_PPB;
+            }
+            COORD_SlewUs = Local_ErrorUs / (1 << COORD_KP_SHIFT);
+        }
+        else
+        {
+            COORD_SlewUs = Local_ErrorUs;
+        }
+
+        if (COORD_Abs(Local_ErrorUs) <= COORD_LOCK_US)
+        {
+            if (COORD_GoodPulses < COORD_LOCK_PULSES)
+            {
+                COORD_GoodPulses++;
+            }
+        }
+        else
+        {
+            COORD_GoodPulses = 0;
+        }
+        COORD_Status.Locked = (COORD_GoodPulses >= COORD_LOCK_PULSES) ? 1 : 0;
+        if (COORD_Status.Locked && ((u32)COORD_Abs(Local_ErrorUs) > COORD_Status.MaxErrorUs))
+        {
+            COORD_Status.MaxErrorUs = (u32)COORD_Abs(Local_ErrorUs);
+        }
+        COORD_Status.ErrorUs = Local_ErrorUs;
+
+        COORD_MarkUs = COORD_SyncUs;
+        COORD_LastRiseUs = Local_RiseUs;
+        COORD_RiseSeen = 1;
+        COORD_SilentTicks = 0;
+    }
+
+    /**< The long pulse starts the coordinated cycle */
+    if ((Local_Edges & COORD_EDGE_FALL) && COORD_RiseSeen)
+    {
+        COORD_RiseSeen = 0;
+        if ((Local_FallUs - COORD_LastRiseUs) >= ((COORD_PULSE_US + COORD_MARK_US) / 2))
+        {
+            COORD_CycleUs = COORD_MarkUs;
+        }
+    }
+}
+
+/**< Slave: apply the learned rate and the pending slew to the tick grid */
+static void COORD_Steer(void)
+{
+    s32 Local_StepUs;
+
+    if (COORD_SilentTicks < ((COORD_HOLDOVER_PULSES * COORD_SYNC_PERIOD_US) / COORD_TICK_US))
+    {
+        COORD_SilentTicks++;
+    }
+    else
+    {
+        COORD_GoodPulses = 0;
+        COORD_Status.Locked = 0;
+    }
+
+    /**< Parts per billion over one tick in milliseconds are picoseconds */
+    COORD_FracPs += COORD_Status.FreqPpb * PHASE_TICK_MS;
+    COORD_SlewUs += COORD_FracPs / 1000000;
+    COORD_FracPs %= 1000000;
+
+    Local_StepUs = COORD_SlewUs;
+    if (Local_StepUs > COORD_MAX_SLEW_US)
+    {
+        Local_StepUs = COORD_MAX_SLEW_US;
+    }
+    else if (Local_StepUs < -COORD_MAX_SLEW_US)
+    {
+        Local_StepUs = -COORD_MAX_SLEW_US;
+    }
+    if (Local_StepUs != 0)
+    {
+        COORD_SlewUs -= TICK_Slew(Local_StepUs);
+    }
+
+    /**< Keep the sync boundary next to the tick */
+    while ((s32)(COORD_TickUs - COORD_SyncUs) > (s32)(COORD_SYNC_PERIOD_US / 2))
+    {
+        COORD_SyncUs += COORD_SYNC_PERIOD_US;
+    }
+}
+/*****************************< Function Implementations *****************************/
+void COORD_Init(void)
+{
+    u8 Local_Index;
+
+    /**< The first control tick runs the boundary one tick after TICK_Init */
+    COORD_TickUs = 0;
+    COORD_SyncUs = COORD_SYNC_PERIOD_US;
+    COORD_CycleUs = COORD_SYNC_PERIOD_US;
+    COORD_Output = 0;
+    COORD_SlewUs = 0;
+    COORD_FracPs = 0;
+    COORD_SilentTicks = 0;
+    COORD_GoodPulses = 0;
+    COORD_RiseSeen = 0;
+    COORD_Edges = 0;
+    COORD_Status.ErrorUs = 0;
+    COORD_Status.MaxErrorUs = 0;
+    COORD_Status.FreqPpb = 0;
+    COORD_Status.Locked = 0;
+
+    for (Local_Index = 0; Local_Index < PHASE_INTERSECTION_COUNT; Local_Index++)
+    {
+        COORD_GreenTicks[Local_Index] = 0;
+        PHASE_SetCoordinated(Local_Index, (COORD_ROLE != COORD_ROLE_NONE) ? 1 : 0);
+    }
+}
+
+void COORD_OnSyncEdge(u8 Copy_Level)
+{
+    if (COORD_ROLE != COORD_ROLE_SLAVE)
+    {
+        return;
+    }
+
+    if (Copy_Level)
+    {
+        COORD_RiseUs = TICK_GetTimeUs();
+        COORD_Edges |= COORD_EDGE_RISE;
+    }
+    else
+    {
+        COORD_FallUs = TICK_GetTimeUs();
+        COORD_Edges |= COORD_EDGE_FALL;
+    }
+}
+
+void COORD_Tick(void)
+{
+    u8 Local_Index;
+
+    COORD_TickUs += COORD_TICK_US;
+
+    if (COORD_ROLE == COORD_ROLE_NONE)
+    {
+        return;
+    }
+
+    if (COORD_ROLE == COORD_ROLE_SLAVE)
+    {
+        COORD_TakeEdges();
+        COORD_Steer();
+    }
+
+    while ((s32)(COORD_TickUs - COORD_CycleUs) >= (s32)COORD_CYCLE_US)
+    {
+        COORD_CycleUs += COORD_CYCLE_US;
+    }
+
+    if (COORD_ROLE == COORD_ROLE_MASTER)
+    {
+        COORD_Drive();
+    }
+
+    /**< PHASE drops a force-off before the minimum green, so it is repeated every tick until taken */
+    for (Local_Index = 0; Local_Index < PHASE_INTERSECTION_COUNT; Local_Index++)
+    {
+        if (PHASE_GetCurrentPhase(Local_Index) != PHASE_CYCLE_START)
+        {
+            COORD_GreenTicks[Local_Index] = 0;
+        }
+        else if (COORD_GreenTicks[Local_Index] != 0xFFFF)
+        {
+            COORD_GreenTicks[Local_Index]++;
+        }
+
+        if (COORD_ShouldForceOff(Local_Index))
+        {
+            PHASE_ForceOff(Local_Index);
+        }
+    }
+}
+
+u8 COORD_GetSyncOutput(void)
+{
+    return COORD_Output;
+}
+
+u16 COORD_GetTicksToNextEvent(void)
+{
+    u32 Local_Ticks;
+    u32 Local_Position;
+    s32 Local_SinceSyncUs;
+    u8 Local_Index;
+
+    if (COORD_ROLE == COORD_ROLE_NONE)
+    {
+        return PHASE_NO_EVENT;
+    }
+
+    if (COORD_ROLE == COORD_ROLE_MASTER)
+    {
+        Local_Ticks = ((COORD_Output ? COORD_PulseEndUs : COORD_SyncUs) - COORD_TickUs) / COORD_TICK_US;
+    }
+    else
+    {
+        /**< A slew still to apply, or the next expected edge */
+        Local_SinceSyncUs = (s32)(COORD_TickUs - COORD_SyncUs);
+        if (COORD_SlewUs != 0)
+        {
+            Local_Ticks = 1;
+        }
+        else
+        {
+            Local_Ticks = (u32)((Local_SinceSyncUs >= 0) ? ((s32)COORD_SYNC_PERIOD_US - Local_SinceSyncUs) : -Local_SinceSyncUs) / COORD_TICK_US;
+        }
+    }
+
+    /**< The start position moves on by one tick per tick */
+    for (Local_Index = 0; Local_Index < PHASE_INTERSECTION_COUNT; Local_Index++)
+    {
+        Local_Position = COORD_StartPosition(Local_Index);
+        if (Local_Position == COORD_NO_PATH)
+        {
+            continue;
+        }
+        if (COORD_ShouldForceOff(Local_Index))
+        {
+            Local_Ticks = 1;
+        }
+        else if (((COORD_CYCLE_US - Local_Position) / COORD_TICK_US) < Local_Ticks)
+        {
+            Local_Ticks = (COORD_CYCLE_US - Local_Position) / COORD_TICK_US;
+        }
+    }
+
+    if (Local_Ticks == 0)
+    {
+        return 1;
+    }
+
+    return (Local_Ticks < PHASE_NO_EVENT) ? (u16)Local_Ticks : (u16)(PHASE_NO_EVENT - 1);
+}
+
+u8 COORD_CanStop(void)
+{
+    return (COORD_ROLE == COORD_ROLE_NONE) ? 1 : 0;
+}
+
+Std_ReturnType COORD_GetStatus(COORD_Status_t *Copy_Status)
+{
+    if (Copy_Status == NULL)
+    {
+        return E_NOT_OK;
+    }
+
+    *Copy_Status = COORD_Status;
+
+    return E_OK;
+}
+/*****************************< End of Function Implementations *****************************/
@@ -0,0 +1,75 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : DET_config.h               *****************/
+/****************************************************************/
+#ifndef DET_CONFIG_H_
+#define DET_CONFIG_H_
+
+/**
+ * @brief Timer time-stamping the loop edges.
+ */
+#define DET_TIMER                   TIM_TIMER1
+
+/**
+ * @brief Counter rate in Hz, a multiple of 1000. The counter wraps every 65536 ticks (32.8 s at 2000 Hz);
+ *        the timer clock divided by 65536 must not exceed it (1099 Hz at 72 MHz).
+ */
+#define DET_TICK_HZ                 2000
+
+/**
+ * @brief Number of lanes.
+ */
+#define DET_LANE_COUNT              1
+
+/**
+ * @brief Capture channels of each lane, as { TIM_CHANNELx, TIM_CAPTURE_x, DMA_CHANNELx }: the upstream loop
+ *        on, the upstream loop off and the downstream loop on.
+ *
+ * The two upstream channels form a pair and read the same input, one direct and one paired. The DMA
+ * channel is the one carrying the CCx request of DET_TIMER (TIM1: CC1 2, CC2 3, CC3 6, CC4 4).
+ * Lane 0: upstream loop on PA8 (TI1), downstream loop on PA11 (TI4, captured on channel 3).
+ */
+#define DET_LANES \
+    { { TIM_CHANNEL1, TIM_CAPTURE_DIRECT, DMA_CHANNEL2 }, \
+      { TIM_CHANNEL2, TIM_CAPTURE_PAIRED, DMA_CHANNEL3 }, \
+      { TIM_CHANNEL3, TIM_CAPTURE_PAIRED, DMA_CHANNEL6 } },
+
+/**
+ * @brief Level of the detector outputs while a vehicle is over the loop: DET_ACTIVE_HIGH or DET_ACTIVE_LOW.
+ */
+#define DET_LOOP_ACTIVE             DET_ACTIVE_HIGH
+
+/**
+ * @brief Input filter of the capture channels, 0 (none) .. 15 (ICxF).
+ */
+#define DET_INPUT_FILTER            15
+
+/**
+ * @brief Leading edge to leading edge distance of the two loops of a lane, in millimetres.
+ */
+#define DET_LOOP_SPACING_MM         4000
+
+/**
+ * @brief Longest loop-to-loop travel timed; slower vehicles (or ones that changed lanes) give no speed.
+ */
+#define DET_MAX_TRAVEL_MS           3000
+
+/**
+ * @brief Shortest gap between two vehicles on the upstream loop; a shorter drop-out (relay bounce, a
+ *        trailer) does not count another vehicle.
+ */
+#define DET_MIN_GAP_MS              100
+
+/**
+ * @brief Longest time between two drains, well below a counter wrap.
+ */
+#define DET_DRAIN_MS                10000
+
+/**
+ * @brief Captures per ring: the most edges a channel may take within DET_DRAIN_MS.
+ */
+#define DET_BUFFER_SIZE             64
+
+#endif /**< DET_CONFIG_H_ */
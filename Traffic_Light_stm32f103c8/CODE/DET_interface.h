@@ -0,0 +1,113 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : DET_interface.h            *****************/
+/****************************************************************/
+#ifndef DET_INTERFACE_H_
+#define DET_INTERFACE_H_
+
+/**
+ * @defgroup DET_Parameters DET Parameters
+ * @{
+ */
+
+/**
+ * @name Active Levels (DET_LOOP_ACTIVE)
+ * @{
+ */
+#define DET_ACTIVE_HIGH         0   /**< The detector output is high while a vehicle is over the loop */
+#define DET_ACTIVE_LOW          1   /**< It is low */
+/** @} */
+
+/** @} */ // End of DET_Parameters
+
+/**
+ * @defgroup DET_Types DET Types
+ * @{
+ */
+
+/**
+ * @brief Traffic over one lane during a batch.
+ */
+typedef struct
+{
+    u16 Vehicles;           /**< Vehicles that entered the upstream loop */
+    u16 OccupancyPermille;  /**< Share of the batch the upstream loop was occupied, per mille */
+    u16 SpeedKmhX10;        /**< Space-mean speed over the loop pair, in 0.1 km/h; 0 without samples */
+    u16 SpeedSamples;       /**< Vehicles timed from the upstream to the downstream loop */
+    u32 DurationMs;         /**< Length of the batch */
+} DET_Batch_t;
+
+/** @} */ // End of DET_Types
+
+/**
+ * @defgroup DET_Functions DET Functions
+ * @brief Per-lane vehicle counts, occupancy and speed from two loops per lane, time-stamped by input capture.
+ *
+ * Each lane has an upstream and a downstream loop DET_LOOP_SPACING_MM apart. DET_TIMER runs free
+ * at DET_TICK_HZ and latches its counter on the edges of the loop outputs: both edges of the
+ * upstream loop (on two channels of a pair) and the entering edge of the downstream loop. DMA
+ * copies every capture into a ring per channel, so an edge costs no CPU and no interrupt however
+ * busy the lane is.
+ *
+ * The rings are drained in thread context: the edges of a lane are merged back into time order and
+ * give the vehicle count, the time the upstream loop was occupied and the travel time from loop to
+ * loop of each vehicle. DET_CloseBatch turns the totals into a DET_Batch_t, at the cycle boundary.
+ * The 16-bit stamps are unambiguous for one counter wrap, so DET_Tick also drains every DET_DRAIN_MS
+ * in between. A ring must not take more than DET_BUFFER_SIZE edges in that time.
+ *
+ * STOP freezes the counter: vehicles passing while the clocks are stopped are not seen.
+ * @{
+ */
+
+/**
+ * @brief Start the capture timer, its channels and their DMA rings. The first batch starts now.
+ *
+ * The DET_TIMER and DMA1 clocks must be enabled in RCC and the loop pins set to inputs.
+ * Until this succeeds, the other functions do nothing.
+ *
+ * @param[in] Copy_TimerClockFreq Clock of DET_TIMER in Hz.
+ *
+ * @return E_OK on success, E_NOT_OK if DET_TICK_HZ cannot be reached from the clock.
+ */
+Std_ReturnType DET_Init(u32 Copy_TimerClockFreq);
+
+/**
+ * @brief Count a control tick and drain the rings when DET_DRAIN_MS have passed.
+ *
+ * Call once per control tick from thread context.
+ *
+ * @return None.
+ */
+void DET_Tick(void);
+
+/**
+ * @brief Get the number of ticks until DET_Tick drains the rings.
+ *
+ * @return Ticks, at least 1, or PHASE_NO_EVENT before DET_Init.
+ */
+u16 DET_GetTicksToNextDrain(void);
+
+/**
+ * @brief Drain the rings and close the batch of every lane; the next batch starts now.
+ *
+ * Call at the cycle boundary, from the context of DET_Tick.
+ *
+ * @return None.
+ */
+void DET_CloseBatch(void);
+
+/**
+ * @brief Get the last closed batch of a lane.
+ *
+ * @param[in] Copy_Lane 0 .. DET_LANE_COUNT - 1.
+ * @param[out] Copy_Batch Receives the batch; all zero before the first DET_CloseBatch.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid lane or a NULL pointer.
+ */
+Std_ReturnType DET_GetBatch(u8 Copy_Lane, DET_Batch_t *Copy_Batch);
+
+/** @} */ // End of DET_Functions
+
+#endif /**< DET_INTERFACE_H_ */
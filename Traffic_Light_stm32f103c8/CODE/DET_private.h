@@ -0,0 +1,86 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : DET_private.h              *****************/
+/****************************************************************/
+#ifndef DET_PRIVATE_H_
+#define DET_PRIVATE_H_
+
+/**< Capture streams of a lane, in the order of DET_LANES */
+#define DET_STREAM_UP_ON            0
+#define DET_STREAM_UP_OFF           1
+#define DET_STREAM_DOWN_ON          2
+#define DET_STREAMS                 3
+
+/**< One capture channel and the DMA channel draining it */
+typedef struct
+{
+    u8 Channel;     /**< TIM_CHANNELx */
+    u8 Input;       /**< TIM_CAPTURE_x */
+    u8 DmaChannel;  /**< DMA_CHANNELx */
+} DET_Stream_t;
+
+/**< Drain position and running totals of a lane; times are counter ticks extended to 32 bits */
+typedef struct
+{
+    u16 Read[DET_STREAMS];  /**< Next ring entry to read */
+    u32 OnSince;            /**< Upstream loop occupied since */
+    u32 OffAt;              /**< Upstream loop last freed at */
+    u32 LastArrival;        /**< Last vehicle on the upstream loop, waiting for the downstream loop */
+    u8 Occupied;
+    u8 AwaitingDown;
+    u16 Vehicles;
+    u16 SpeedSamples;
+    u32 OccupiedTicks;
+    u32 TravelTicks;
+    DET_Batch_t Batch;      /**< Last closed batch */
+} DET_Lane_t;
+
+#if DET_LOOP_ACTIVE == DET_ACTIVE_HIGH
+    #define DET_EDGE_ON             TIM_EDGE_RISING
+    #define DET_EDGE_OFF            TIM_EDGE_FALLING
+#elif DET_LOOP_ACTIVE == DET_ACTIVE_LOW
+    #define DET_EDGE_ON             TIM_EDGE_FALLING
+    #define DET_EDGE_OFF            TIM_EDGE_RISING
+#else
+    #error "You chose a wrong DET_LOOP_ACTIVE level"
+#endif
+
+#define DET_TICKS_PER_MS            (DET_TICK_HZ / 1000)
+#define DET_MS_TO_TICKS(MS)         ((u32)(MS) * DET_TICKS_PER_MS)
+
+/**< Control ticks between drains */
+#define DET_DRAIN_TICKS             (DET_DRAIN_MS / PHASE_TICK_MS)
+
+/**< Speed in 0.1 km/h is DET_SPEED_SCALE / travel ticks */
+#define DET_SPEED_SCALE             (DET_LOOP_SPACING_MM * DET_TICKS_PER_MS * 36UL)
+
+/**< Mean travel kept in 1/16 ticks */
+#define DET_TRAVEL_FRACTION_BITS    4
+
+/**< Largest batch length multiplied by 1000 in 32 bits */
+#define DET_PERMILLE_BASE_MAX       4000000UL
+
+#if (DET_TICK_HZ % 1000) != 0
+#error "DET_TICK_HZ must be a multiple of 1000"
+#endif
+
+#if (DET_DRAIN_TICKS < 1) || (DET_DRAIN_TICKS >= PHASE_NO_EVENT)
+#error "DET_DRAIN_MS is out of range"
+#endif
+
+/**< Half a wrap leaves room for a drain that comes late */
+#if ((DET_DRAIN_MS * DET_TICKS_PER_MS) > 32768) || ((DET_MAX_TRAVEL_MS * DET_TICKS_PER_MS) > 32768)
+#error "DET_DRAIN_MS and DET_MAX_TRAVEL_MS must stay below half a counter wrap"
+#endif
+
+#if (DET_SPEED_SCALE == 0) || (DET_SPEED_SCALE > (0xFFFFFFFFUL >> DET_TRAVEL_FRACTION_BITS))
+#error "DET_LOOP_SPACING_MM is out of range"
+#endif
+
+#if (DET_BUFFER_SIZE < 2) || (DET_BUFFER_SIZE > 0xFFFF)
+#error "DET_BUFFER_SIZE is out of range"
+#endif
+
+#endif /**< DET_PRIVATE_H_ */
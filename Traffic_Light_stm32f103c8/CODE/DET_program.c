@@ -0,0 +1,343 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : DET_program.c              *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "TIM_interface.h"
+#include "DMA_interface.h"
+/*****************************< APP *****************************/
+#include "PHASE_interface.h"
+#include "PHASE_config.h"
+#include "DET_interface.h"
+#include "DET_config.h"
+#include "DET_private.h"
+/*****************************< Private Variables *****************************/
+static const DET_Stream_t DET_Streams[DET_LANE_COUNT][DET_STREAMS] = { DET_LANES };
+
+/**< Written by DMA, one ring per capture channel */
+static u16 DET_Rings[DET_LANE_COUNT][DET_STREAMS][DET_BUFFER_SIZE];
+
+static DET_Lane_t DET_Lanes[DET_LANE_COUNT];
+static const DET_Lane_t DET_EmptyLane = { 0 };
+
+/**< Counter at the last drain and the same instant in extended ticks */
+static u16 DET_LastCount;
+static u32 DET_Now;
+
+static u32 DET_BatchStart;
+static u16 DET_TicksSinceDrain;
+static u8 DET_Running = 0;
+/*****************************< Private Functions *****************************/
+/**< Ticks from Copy_From (or the batch start if later) to Copy_To, 0 if Copy_To is earlier */
+static u32 DET_SpanInBatch(u32 Copy_From, u32 Copy_To)
+{
+    if ((s32)(DET_BatchStart - Copy_From) > 0)
+    {
+        Copy_From = DET_BatchStart;
+    }
+
+    return ((s32)(Copy_To - Copy_From) > 0) ? (Copy_To - Copy_From) : 0;
+}
+
+static void DET_OnEdge(DET_Lane_t *Copy_Lane, u8 Copy_Stream, u32 Copy_Time)
+{
+    u32 Local_Travel;
+
+    switch (Copy_Stream)
+    {
+    case DET_STREAM_UP_ON:
+        if (Copy_Lane->Occupied)
+        {
+            break;  /**< The off edge was lost, this is still the same vehicle */
+        }
+        Copy_Lane->Occupied = 1;
+        Copy_Lane->OnSince = Copy_Time;
+        if ((Copy_Time - Copy_Lane->OffAt) < DET_MS_TO_TICKS(DET_MIN_GAP_MS))
+        {
+            break;  /**< A drop-out within the vehicle: occupied again, not counted again */
+        }
+        if (Copy_Lane->Vehicles < 0xFFFF)
+        {
+            Copy_Lane->Vehicles++;
+        }
+        Copy_Lane->LastArrival = Copy_Time;
+        Copy_Lane->AwaitingDown = 1;
+        break;
+
+    case DET_STREAM_UP_OFF:
+        if (!Copy_Lane->Occupied)
+        {
+            break;
+        }
+        Copy_Lane->Occupied = 0;
+        Copy_Lane->OccupiedTicks += DET_SpanInBatch(Copy_Lane->OnSince, Copy_Time);
+        Copy_Lane->OffAt = Copy_Time;
+        break;
+
+    case DET_STREAM_DOWN_ON:
+        if (!Copy_Lane->AwaitingDown)
+        {
+            break;
+        }
+        /**< Only the first downstream edge after an arrival times it */
+        Copy_Lane->AwaitingDown = 0;
+        Local_Travel = Copy_Time - Copy_Lane->LastArrival;
+        if ((Local_Travel > 0) && (Local_Travel <= DET_MS_TO_TICKS(DET_MAX_TRAVEL_MS)) && (Copy_Lane->SpeedSamples < 0xFFFF))
+        {
+            Copy_Lane->TravelTicks += Local_Travel;
+            Copy_Lane->SpeedSamples++;
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**< Process the captures of a lane up to the given write positions, oldest first across its rings */
+static void DET_DrainLane(u8 Copy_Lane, const u16 *Copy_Write)
+{
+    DET_Lane_t *Local_Lane = &DET_Lanes[Copy_Lane];
+    u8 Local_Stream;
+    u8 Local_Oldest;
+    u16 Local_Age;
+    u16 Local_OldestAge = 0;
+
+    for (;;)
+    {
+        /**< Each ring is in time order: the oldest edge is at the read position of one of them */
+        Local_Oldest = DET_STREAMS;
+        for (Local_Stream = 0; Local_Stream < DET_STREAMS; Local_Stream++)
+        {
+            if (Local_Lane->Read[Local_Stream] == Copy_Write[Local_Stream])
+            {
+                continue;
+            }
+            Local_Age = (u16)(DET_LastCount - DET_Rings[Copy_Lane][Local_Stream][Local_Lane->Read[Local_Stream]]);
+            if ((Local_Oldest == DET_STREAMS) || (Local_Age > Local_OldestAge))
+            {
+                Local_Oldest = Local_Stream;
+                Local_OldestAge = Local_Age;
+            }
+        }
+        if (Local_Oldest == DET_STREAMS)
+        {
+            break;
+        }
+
+        Local_Lane->Read[Local_Oldest] = (u16)((Local_Lane->Read[Local_Oldest] + 1) % DET_BUFFER_SIZE);
+        DET_OnEdge(Local_Lane, Local_Oldest, DET_Now - Local_OldestAge);
+    }
+}
+
+static void DET_Drain(void)
+{
+    u16 Local_Write[DET_LANE_COUNT][DET_STREAMS];
+    u16 Local_Count;
+    u8 Local_Lane;
+    u8 Local_Stream;
+
+    /**< Write positions before the counter: every capture up to them was latched at or before it */
+    for (Local_Lane = 0; Local_Lane < DET_LANE_COUNT; Local_Lane++)
+    {
+        for (Local_Stream = 0; Local_Stream < DET_STREAMS; Local_Stream++)
+        {
+            Local_Write[Local_Lane][Local_Stream] =
+                (u16)((DET_BUFFER_SIZE - MCAL_DMA_GetRemainingCount(DET_Streams[Local_Lane][Local_Stream].DmaChannel)) % DET_BUFFER_SIZE);
+        }
+    }
+    Local_Count = MCAL_TIM_GetCounter(DET_TIMER);
+
+    DET_Now += (u16)(Local_Count - DET_LastCount);
+    DET_LastCount = Local_Count;
+    DET_TicksSinceDrain = 0;
+
+    for (Local_Lane = 0; Local_Lane < DET_LANE_COUNT; Local_Lane++)
+    {
+        DET_DrainLane(Local_Lane, Local_Write[Local_Lane]);
+    }
+}
+
+/**< Occupied share in per mille, scaled down so the product stays in 32 bits */
+static u16 DET_Permille(u32 Copy_Part, u32 Copy_Whole)
+{
+    while (Copy_Whole > DET_PERMILLE_BASE_MAX)
+    {
+        Copy_Part >>= 1;
+        Copy_Whole >>= 1;
+    }
+    if ((Copy_Whole == 0) || (Copy_Part >= Copy_Whole))
+    {
+        return (Copy_Whole == 0) ? 0 : 1000;
+    }
+
+    return (u16)((Copy_Part * 1000) / Copy_Whole);
+}
+
+/**< Space-mean speed in 0.1 km/h: the loop spacing over the mean travel time */
+static u16 DET_Speed(u32 Copy_TravelTicks, u16 Copy_Samples)
+{
+    u32 Local_Mean;
+    u32 Local_Speed;
+
+    if (Copy_Samples == 0)
+    {
+        return 0;
+    }
+
+    if (Copy_TravelTicks <= (0xFFFFFFFFUL >> DET_TRAVEL_FRACTION_BITS))
+    {
+        Local_Mean = (Copy_TravelTicks << DET_TRAVEL_FRACTION_BITS) / Copy_Samples;
+    }
+    else
+    {
+        Local_Mean = (Copy_TravelTicks / Copy_Samples) << DET_TRAVEL_FRACTION_BITS;
+    }
+    if (Local_Mean == 0)
+    {
+        return 0xFFFF;
+    }
+
+    Local_Speed = (DET_SPEED_SCALE << DET_TRAVEL_FRACTION_BITS) / Local_Mean;
+
+    return (Local_Speed > 0xFFFF) ? 0xFFFF : (u16)Local_Speed;
+}
+/*****************************< Function Implementations *****************************/
+Std_ReturnType DET_Init(u32 Copy_TimerClockFreq)
+{
+    DMA_ChannelConfig_t Local_Config = {
+        .Direction = DMA_PERIPHERAL_TO_MEMORY,
+        .Mode = DMA_MODE_CIRCULAR,
+        .PeripheralSize = DMA_SIZE_16BIT,
+        .MemorySize = DMA_SIZE_16BIT,
+        .PeripheralIncrement = 0,
+        .MemoryIncrement = 1,
+        .Priority = DMA_PRIORITY_HIGH,
+        .Interrupts = DMA_IT_NONE,
+    };
+    const DET_Stream_t *Local_Stream;
+    u8 Local_Lane;
+    u8 Local_Index;
+
+    DET_Running = 0;
+
+    /**< Clears every channel; the counter runs from here on */
+    if (MCAL_TIM_InitCounter(DET_TIMER, Copy_TimerClockFreq, DET_TICK_HZ) != E_OK)
+    {
+        return E_NOT_OK;
+    }
+
+    for (Local_Lane = 0; Local_Lane < DET_LANE_COUNT; Local_Lane++)
+    {
+        for (Local_Index = 0; Local_Index < DET_STREAMS; Local_Index++)
+        {
+            Local_Stream = &DET_Streams[Local_Lane][Local_Index];
+            if ((MCAL_DMA_ConfigChannel(Local_Stream->DmaChannel, &Local_Config) != E_OK) ||
+                (MCAL_DMA_StartTransfer(Local_Stream->DmaChannel, MCAL_TIM_GetCaptureAddress(DET_TIMER, Local_Stream->Channel),
+                                        DET_Rings[Local_Lane][Local_Index], DET_BUFFER_SIZE) != E_OK) ||
+                (MCAL_TIM_EnableCapture(DET_TIMER, Local_Stream->Channel, Local_Stream->Input,
+                                        (Local_Index == DET_STREAM_UP_OFF) ? DET_EDGE_OFF : DET_EDGE_ON, DET_INPUT_FILTER) != E_OK) ||
+                (MCAL_TIM_EnableDmaRequest(DET_TIMER, TIM_DMA_CC1 + Local_Stream->Channel) != E_OK))
+            {
+                return E_NOT_OK;
+            }
+        }
+    }
+
+    DET_LastCount = MCAL_TIM_GetCounter(DET_TIMER);
+    DET_Now = 0;
+    DET_BatchStart = 0;
+    DET_TicksSinceDrain = 0;
+    for (Local_Lane = 0; Local_Lane < DET_LANE_COUNT; Local_Lane++)
+    {
+        DET_Lanes[Local_Lane] = DET_EmptyLane;
+        /**< The first arrival is never taken for a drop-out */
+        DET_Lanes[Local_Lane].OffAt = DET_Now - DET_MS_TO_TICKS(DET_MIN_GAP_MS);
+    }
+
+    DET_Running = 1;
+
+    return E_OK;
+}
+
+void DET_Tick(void)
+{
+    if (!DET_Running)
+    {
+        return;
+    }
+
+    DET_TicksSinceDrain++;
+    if (DET_TicksSinceDrain >= DET_DRAIN_TICKS)
+    {
+        DET_Drain();
+    }
+}
+
+u16 DET_GetTicksToNextDrain(void)
+{
+    if (!DET_Running)
+    {
+        return PHASE_NO_EVENT;
+    }
+
+    return (DET_TicksSinceDrain < DET_DRAIN_TICKS) ? (u16)(DET_DRAIN_TICKS - DET_TicksSinceDrain) : 1;
+}
+
+void DET_CloseBatch(void)
+{
+    DET_Lane_t *Local_Lane;
+    u32 Local_Duration;
+    u8 Local_Index;
+
+    if (!DET_Running)
+    {
+        return;
+    }
+
+    DET_Drain();
+    Local_Duration = DET_Now - DET_BatchStart;
+
+    for (Local_Index = 0; Local_Index < DET_LANE_COUNT; Local_Index++)
+    {
+        Local_Lane = &DET_Lanes[Local_Index];
+
+        /**< A vehicle still on the loop counts for its time so far; the rest goes to the next batch */
+        if (Local_Lane->Occupied)
+        {
+            Local_Lane->OccupiedTicks += DET_SpanInBatch(Local_Lane->OnSince, DET_Now);
+        }
+
+        Local_Lane->Batch.Vehicles = Local_Lane->Vehicles;
+        Local_Lane->Batch.OccupancyPermille = DET_Permille(Local_Lane->OccupiedTicks, Local_Duration);
+        Local_Lane->Batch.SpeedKmhX10 = DET_Speed(Local_Lane->TravelTicks, Local_Lane->SpeedSamples);
+        Local_Lane->Batch.SpeedSamples = Local_Lane->SpeedSamples;
+        Local_Lane->Batch.DurationMs = Local_Duration / DET_TICKS_PER_MS;
+
+        Local_Lane->Vehicles = 0;
+        Local_Lane->SpeedSamples = 0;
+        Local_Lane->OccupiedTicks = 0;
+        Local_Lane->TravelTicks = 0;
+    }
+
+    DET_BatchStart = DET_Now;
+}
+
+Std_ReturnType DET_GetBatch(u8 Copy_Lane, DET_Batch_t *Copy_Batch)
+{
+    if ((Copy_Lane >= DET_LANE_COUNT) || (Copy_Batch == NULL))
+    {
+        return E_NOT_OK;
+    }
+
+    *Copy_Batch = DET_Lanes[Copy_Lane].Batch;
+
+    return E_OK;
+}
+/*****************************< End of Function Implementations *****************************/
@@ -0,0 +1,52 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : DISP_config.h              *****************/
+/****************************************************************/
+#ifndef DISP_CONFIG_H_
+#define DISP_CONFIG_H_
+
+/**
+ * @brief Port of every display pin.
+ */
+#define DISP_PORT                   GPIO_PORTB
+
+/**
+ * @brief Segment pins, a (top) clockwise to f, then g (middle).
+ */
+#define DISP_SEG_A_PIN              GPIO_PIN0
+#define DISP_SEG_B_PIN              GPIO_PIN5
+#define DISP_SEG_C_PIN              GPIO_PIN6
+#define DISP_SEG_D_PIN              GPIO_PIN7
+#define DISP_SEG_E_PIN              GPIO_PIN8
+#define DISP_SEG_F_PIN              GPIO_PIN10
+#define DISP_SEG_G_PIN              GPIO_PIN13
+
+/**
+ * @brief Digit select pins.
+ */
+#define DISP_TENS_PIN               GPIO_PIN14
+#define DISP_UNITS_PIN              GPIO_PIN15
+
+/**
+ * @brief Active levels: DISP_ACTIVE_HIGH or DISP_ACTIVE_LOW.
+ *
+ * Common-cathode digits on NPN selects are high/high; common-anode digits on PNP selects
+ * are low/low.
+ */
+#define DISP_SEGMENT_ACTIVE         DISP_ACTIVE_HIGH
+#define DISP_DIGIT_ACTIVE           DISP_ACTIVE_HIGH
+
+/**
+ * @brief Digit slots per second; each digit is lit for every other slot.
+ */
+#define DISP_SCAN_HZ                1000
+
+/**
+ * @brief Timer pacing the scan and the DMA1 channel of its update request (TIM2: 2, TIM3: 3, TIM4: 7).
+ */
+#define DISP_TIMER                  TIM_TIMER4
+#define DISP_DMA_CHANNEL            DMA_CHANNEL7
+
+#endif /**< DISP_CONFIG_H_ */
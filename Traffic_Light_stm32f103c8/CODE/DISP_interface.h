@@ -0,0 +1,89 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : DISP_interface.h           *****************/
+/****************************************************************/
+#ifndef DISP_INTERFACE_H_
+#define DISP_INTERFACE_H_
+
+/**
+ * @defgroup DISP_Parameters DISP Parameters
+ * @{
+ */
+
+/**
+ * @name Active Levels (DISP_SEGMENT_ACTIVE, DISP_DIGIT_ACTIVE)
+ * @{
+ */
+#define DISP_ACTIVE_HIGH        0   /**< A high pin lights the segment or selects the digit */
+#define DISP_ACTIVE_LOW         1   /**< A low pin does */
+/** @} */
+
+/**
+ * @brief Value that darkens the display.
+ */
+#define DISP_BLANK              0xFFFF
+
+/**
+ * @brief Largest value shown; larger values show as DISP_MAX_VALUE.
+ */
+#define DISP_MAX_VALUE          99
+
+/** @} */ // End of DISP_Parameters
+
+/**
+ * @defgroup DISP_Functions DISP Functions
+ * @brief Multiplexed 2-digit 7-segment display, scanned by DMA.
+ *
+ * The segments and digit selects share one GPIO port. A frame holds one word per digit,
+ * written by DMA to the port's BSRR on every update of DISP_TIMER: each word lights the
+ * segments of its digit, selects that digit and clears every other display pin in one bus
+ * write, so the scan costs no CPU and no interrupt. The words of every digit and position
+ * are worked out at compile time; a new value costs one table copy per changed digit.
+ * The tens digit is dark below 10.
+ *
+ * The scan stops with the timer and DMA clocks in STOP; DISP_CanStop tells when that leaves
+ * the display dark.
+ * @{
+ */
+
+/**
+ * @brief Set up the pins, the scan timer and its DMA channel, and start scanning a dark frame.
+ *
+ * The DISP_TIMER and DMA1 clocks must be enabled in RCC. Until this succeeds, DISP_Show is ignored.
+ *
+ * @param[in] Copy_TimerClockFreq Clock of DISP_TIMER in Hz.
+ *
+ * @return E_OK on success, E_NOT_OK if DISP_SCAN_HZ cannot be reached from the clock.
+ */
+Std_ReturnType DISP_Init(u32 Copy_TimerClockFreq);
+
+/**
+ * @brief Keep the scan rate after the timer clock changed.
+ *
+ * @param[in] Copy_TimerClockFreq The new clock of DISP_TIMER in Hz.
+ *
+ * @return E_OK on success, E_NOT_OK for an unreachable rate or before DISP_Init.
+ */
+Std_ReturnType DISP_SetClockFreq(u32 Copy_TimerClockFreq);
+
+/**
+ * @brief Show a value from the next scan on. Only the digits that change are written.
+ *
+ * @param[in] Copy_Value 0 .. DISP_MAX_VALUE (larger values are clamped), or DISP_BLANK.
+ *
+ * @return None.
+ */
+void DISP_Show(u16 Copy_Value);
+
+/**
+ * @brief Check whether the display is dark, so stopping its scan shows nothing.
+ *
+ * @return 1 if dark or not running, 0 otherwise.
+ */
+u8 DISP_CanStop(void);
+
+/** @} */ // End of DISP_Functions
+
+#endif /**< DISP_INTERFACE_H_ */
@@ -0,0 +1,80 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : DISP_private.h             *****************/
+/****************************************************************/
+#ifndef DISP_PRIVATE_H_
+#define DISP_PRIVATE_H_
+
+#define DISP_DIGITS                 2
+#define DISP_SLOT_TENS              0
+#define DISP_SLOT_UNITS             1
+
+/**< Counts per scan slot; only the rate matters, the count just keeps the prescaler in range */
+#define DISP_TIMER_STEPS            100
+
+#define DISP_PIN(PIN)               (1UL << (PIN))
+
+#define DISP_SEGMENT_PINS           (DISP_PIN(DISP_SEG_A_PIN) | DISP_PIN(DISP_SEG_B_PIN) | DISP_PIN(DISP_SEG_C_PIN) | \
+                                     DISP_PIN(DISP_SEG_D_PIN) | DISP_PIN(DISP_SEG_E_PIN) | DISP_PIN(DISP_SEG_F_PIN) | \
+                                     DISP_PIN(DISP_SEG_G_PIN))
+#define DISP_DIGIT_PINS             (DISP_PIN(DISP_TENS_PIN) | DISP_PIN(DISP_UNITS_PIN))
+#define DISP_ALL_PINS               (DISP_SEGMENT_PINS | DISP_DIGIT_PINS)
+
+/**
+ * @name Glyphs
+ * @brief Segments of the digits 0 .. 9, bit 0 = a .. bit 6 = g, then the dark glyph.
+ * @{
+ */
+#define DISP_GLYPHS(X) \
+    X(0x3F) X(0x06) X(0x5B) X(0x4F) X(0x66) X(0x6D) X(0x7D) X(0x07) X(0x7F) X(0x6F)
+#define DISP_GLYPH_DARK             10
+#define DISP_GLYPH_COUNT            11
+/** @} */
+
+/**< Pins of the segments lit by a glyph */
+#define DISP_SEGMENTS(GLYPH) \
+    ((((GLYPH) & 0x01) ? DISP_PIN(DISP_SEG_A_PIN) : 0) | (((GLYPH) & 0x02) ? DISP_PIN(DISP_SEG_B_PIN) : 0) | \
+     (((GLYPH) & 0x04) ? DISP_PIN(DISP_SEG_C_PIN) : 0) | (((GLYPH) & 0x08) ? DISP_PIN(DISP_SEG_D_PIN) : 0) | \
+     (((GLYPH) & 0x10) ? DISP_PIN(DISP_SEG_E_PIN) : 0) | (((GLYPH) & 0x20) ? DISP_PIN(DISP_SEG_F_PIN) : 0) | \
+     (((GLYPH) & 0x40) ? DISP_PIN(DISP_SEG_G_PIN) : 0))
+
+/**< High pins for the lit segments and the selected digits */
+#if DISP_SEGMENT_ACTIVE == DISP_ACTIVE_HIGH
+    #define DISP_SEGMENT_LEVELS(GLYPH)  DISP_SEGMENTS(GLYPH)
+#elif DISP_SEGMENT_ACTIVE == DISP_ACTIVE_LOW
+    #define DISP_SEGMENT_LEVELS(GLYPH)  (DISP_SEGMENT_PINS & ~DISP_SEGMENTS(GLYPH))
+#else
+    #error "You chose a wrong DISP_SEGMENT_ACTIVE level"
+#endif
+
+#if DISP_DIGIT_ACTIVE == DISP_ACTIVE_HIGH
+    #define DISP_DIGIT_LEVELS(PINS)     (PINS)
+#elif DISP_DIGIT_ACTIVE == DISP_ACTIVE_LOW
+    #define DISP_DIGIT_LEVELS(PINS)     (DISP_DIGIT_PINS & ~(PINS))
+#else
+    #error "You chose a wrong DISP_DIGIT_ACTIVE level"
+#endif
+
+/**< BSRR word driving every display pin: the high ones set, all others reset */
+#define DISP_BSRR(LEVELS)           ((u32)(LEVELS) | ((u32)(DISP_ALL_PINS & ~(LEVELS)) << 16))
+
+/**< One scan slot: a glyph on one digit, the other digit off; the dark glyph deselects both */
+#define DISP_TENS_WORD(GLYPH)       DISP_BSRR(DISP_SEGMENT_LEVELS(GLYPH) | DISP_DIGIT_LEVELS(DISP_PIN(DISP_TENS_PIN))),
+#define DISP_UNITS_WORD(GLYPH)      DISP_BSRR(DISP_SEGMENT_LEVELS(GLYPH) | DISP_DIGIT_LEVELS(DISP_PIN(DISP_UNITS_PIN))),
+#define DISP_DARK_WORD              DISP_BSRR(DISP_SEGMENT_LEVELS(0) | DISP_DIGIT_LEVELS(0))
+
+#if (DISP_PIN(DISP_SEG_A_PIN) + DISP_PIN(DISP_SEG_B_PIN) + DISP_PIN(DISP_SEG_C_PIN) + DISP_PIN(DISP_SEG_D_PIN) + \
+     DISP_PIN(DISP_SEG_E_PIN) + DISP_PIN(DISP_SEG_F_PIN) + DISP_PIN(DISP_SEG_G_PIN) + DISP_PIN(DISP_TENS_PIN) + \
+     DISP_PIN(DISP_UNITS_PIN)) != DISP_ALL_PINS
+#error "DISP pins must be distinct"
+#endif
+
+#if ((DISP_TIMER == TIM_TIMER2) && (DISP_DMA_CHANNEL != DMA_CHANNEL2)) || \
+    ((DISP_TIMER == TIM_TIMER3) && (DISP_DMA_CHANNEL != DMA_CHANNEL3)) || \
+    ((DISP_TIMER == TIM_TIMER4) && (DISP_DMA_CHANNEL != DMA_CHANNEL7))
+#error "DISP_DMA_CHANNEL does not carry the update request of DISP_TIMER"
+#endif
+
+#endif /**< DISP_PRIVATE_H_ */
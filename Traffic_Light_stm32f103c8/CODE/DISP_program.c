@@ -0,0 +1,125 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : DISP_program.c             *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "GPIO_Interface.h"
+#include "TIM_interface.h"
+#include "DMA_interface.h"
+/*****************************< APP *****************************/
+#include "DISP_interface.h"
+#include "DISP_config.h"
+#include "DISP_private.h"
+/*****************************< Private Variables *****************************/
+static const u32 DISP_TensWords[DISP_GLYPH_COUNT] = { DISP_GLYPHS(DISP_TENS_WORD) DISP_DARK_WORD };
+static const u32 DISP_UnitsWords[DISP_GLYPH_COUNT] = { DISP_GLYPHS(DISP_UNITS_WORD) DISP_DARK_WORD };
+
+static const u8 DISP_Pins[] = {
+    DISP_SEG_A_PIN, DISP_SEG_B_PIN, DISP_SEG_C_PIN, DISP_SEG_D_PIN, DISP_SEG_E_PIN, DISP_SEG_F_PIN, DISP_SEG_G_PIN,
+    DISP_TENS_PIN, DISP_UNITS_PIN,
+};
+
+/**< Read by DMA, one word per scan slot */
+static u32 DISP_Frame[DISP_DIGITS] = { DISP_DARK_WORD, DISP_DARK_WORD };
+
+static u16 DISP_Value = DISP_BLANK;
+static u8 DISP_Running = 0;
+/*****************************< Function Implementations *****************************/
+Std_ReturnType DISP_Init(u32 Copy_TimerClockFreq)
+{
+    DMA_ChannelConfig_t Local_Config = {
+        .Direction = DMA_MEMORY_TO_PERIPHERAL,
+        .Mode = DMA_MODE_CIRCULAR,
+        .PeripheralSize = DMA_SIZE_32BIT,
+        .MemorySize = DMA_SIZE_32BIT,
+        .PeripheralIncrement = 0,
+        .MemoryIncrement = 1,
+        .Priority = DMA_PRIORITY_MEDIUM,
+        .Interrupts = DMA_IT_NONE,
+    };
+    u8 Local_Index;
+
+    DISP_Running = 0;
+    DISP_Value = DISP_BLANK;
+    DISP_Frame[DISP_SLOT_TENS] = DISP_DARK_WORD;
+    DISP_Frame[DISP_SLOT_UNITS] = DISP_DARK_WORD;
+
+    /**< Dark levels are latched before the pins become outputs */
+    (void)MCAL_GPIO_SetPortValue(DISP_PORT, (u16)DISP_ALL_PINS, (u16)DISP_DARK_WORD);
+    for (Local_Index = 0; Local_Index < sizeof(DISP_Pins); Local_Index++)
+    {
+        (void)MCAL_GPIO_SetPinMode(DISP_PORT, DISP_Pins[Local_Index], GPIO_OUTPUT_PUSH_PULL_2MHZ);
+    }
+
+    if ((MCAL_TIM_InitPwm(DISP_TIMER, Copy_TimerClockFreq, DISP_SCAN_HZ, DISP_TIMER_STEPS) != E_OK) ||
+        (MCAL_DMA_ConfigChannel(DISP_DMA_CHANNEL, &Local_Config) != E_OK) ||
+        (MCAL_DMA_StartTransfer(DISP_DMA_CHANNEL, MCAL_GPIO_GetBsrrAddress(DISP_PORT), DISP_Frame, DISP_DIGITS) != E_OK) ||
+        (MCAL_TIM_EnableDmaRequest(DISP_TIMER, TIM_DMA_UPDATE) != E_OK))
+    {
+        return E_NOT_OK;
+    }
+
+    DISP_Running = 1;
+
+    return E_OK;
+}
+
+Std_ReturnType DISP_SetClockFreq(u32 Copy_TimerClockFreq)
+{
+    if (!DISP_Running)
+    {
+        return E_NOT_OK;
+    }
+
+    return MCAL_TIM_SetClockFreq(DISP_TIMER, Copy_TimerClockFreq, DISP_SCAN_HZ);
+}
+
+void DISP_Show(u16 Copy_Value)
+{
+    u8 Local_Tens;
+    u8 Local_Units;
+
+    if (!DISP_Running || (Copy_Value == DISP_Value))
+    {
+        return;
+    }
+
+    DISP_Value = Copy_Value;
+
+    if (Copy_Value == DISP_BLANK)
+    {
+        Local_Tens = DISP_GLYPH_DARK;
+        Local_Units = DISP_GLYPH_DARK;
+    }
+    else
+    {
+        if (Copy_Value > DISP_MAX_VALUE)
+        {
+            Copy_Value = DISP_MAX_VALUE;
+        }
+        Local_Tens = (Copy_Value >= 10) ? (u8)(Copy_Value / 10) : DISP_GLYPH_DARK;
+        Local_Units = (u8)(Copy_Value % 10);
+    }
+
+    /**< Single word stores: the DMA reads either the old or the new word of a slot, never a mix */
+    if (DISP_Frame[DISP_SLOT_TENS] != DISP_TensWords[Local_Tens])
+    {
+        DISP_Frame[DISP_SLOT_TENS] = DISP_TensWords[Local_Tens];
+    }
+    if (DISP_Frame[DISP_SLOT_UNITS] != DISP_UnitsWords[Local_Units])
+    {
+        DISP_Frame[DISP_SLOT_UNITS] = DISP_UnitsWords[Local_Units];
+    }
+}
+
+u8 DISP_CanStop(void)
+{
+    return (!DISP_Running || (DISP_Value == DISP_BLANK)) ? 1 : 0;
+}
+/*****************************< End of Function Implementations *****************************/
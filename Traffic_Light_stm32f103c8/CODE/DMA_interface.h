@@ -0,0 +1,161 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : DMA_interface.h            *****************/
+/****************************************************************/
+#ifndef DMA_INTERFACE_H_
+#define DMA_INTERFACE_H_
+
+/**
+ * @defgroup DMA_Parameters DMA Parameters
+ * @{
+ */
+
+/**
+ * @name DMA1 Channels
+ * @brief Request mapping used in this project: USART1_TX = channel 4, USART1_RX = channel 5, TIM4_UP = channel 7.
+ * @{
+ */
+#define DMA_CHANNEL1        0
+#define DMA_CHANNEL2        1
+#define DMA_CHANNEL3        2
+#define DMA_CHANNEL4        3
+#define DMA_CHANNEL5        4
+#define DMA_CHANNEL6        5
+#define DMA_CHANNEL7        6
+#define DMA_CHANNEL_COUNT   7
+/** @} */
+
+/**
+ * @name Transfer Direction
+ * @{
+ */
+#define DMA_PERIPHERAL_TO_MEMORY    0
+#define DMA_MEMORY_TO_PERIPHERAL    1
+/** @} */
+
+/**
+ * @name Mode
+ * @{
+ */
+#define DMA_MODE_NORMAL     0   /**< Stop after CNDTR items */
+#define DMA_MODE_CIRCULAR   1   /**< Reload CNDTR and restart at the buffer start */
+/** @} */
+
+/**
+ * @name Item Size (peripheral and memory side)
+ * @{
+ */
+#define DMA_SIZE_8BIT       0
+#define DMA_SIZE_16BIT      1
+#define DMA_SIZE_32BIT      2
+/** @} */
+
+/**
+ * @name Priority
+ * @{
+ */
+#define DMA_PRIORITY_LOW        0
+#define DMA_PRIORITY_MEDIUM     1
+#define DMA_PRIORITY_HIGH       2
+#define DMA_PRIORITY_VERY_HIGH  3
+/** @} */
+
+/**
+ * @name Interrupts and Flags
+ * @brief Used both to enable channel interrupts and to report which event fired.
+ * @{
+ */
+#define DMA_IT_NONE         0x0
+#define DMA_IT_COMPLETE     0x2     /**< Transfer complete */
+#define DMA_IT_HALF         0x4     /**< Half transfer */
+#define DMA_IT_ERROR        0x8     /**< Transfer error */
+/** @} */
+
+/**
+ * @brief Channel configuration.
+ */
+typedef struct
+{
+    u8 Direction;           /**< DMA_PERIPHERAL_TO_MEMORY or DMA_MEMORY_TO_PERIPHERAL */
+    u8 Mode;                /**< DMA_MODE_NORMAL or DMA_MODE_CIRCULAR */
+    u8 PeripheralSize;      /**< DMA_SIZE_xBIT */
+    u8 MemorySize;          /**< DMA_SIZE_xBIT */
+    u8 PeripheralIncrement; /**< 1 to increment the peripheral address */
+    u8 MemoryIncrement;     /**< 1 to increment the memory address */
+    u8 Priority;            /**< DMA_PRIORITY_x */
+    u8 Interrupts;          /**< OR of DMA_IT_x */
+} DMA_ChannelConfig_t;
+
+/**
+ * @brief Callback invoked from the channel interrupt with the DMA_IT_x flags that fired.
+ */
+typedef void (*DMA_Callback_t)(u8 Copy_Flags);
+
+/** @} */ // End of DMA_Parameters
+
+/**
+ * @defgroup DMA_Functions DMA Functions
+ * @brief Functions for DMA1. The DMA1 clock must be enabled in RCC before use.
+ * @{
+ */
+
+/**
+ * @brief Configure a channel. The channel is left disabled.
+ *
+ * @param[in] Copy_Channel DMA_CHANNEL1 .. DMA_CHANNEL7.
+ * @param[in] Copy_Config The channel configuration.
+ *
+ * @return E_OK if the configuration was applied, E_NOT_OK for an invalid channel or NULL configuration.
+ */
+Std_ReturnType MCAL_DMA_ConfigChannel(u8 Copy_Channel, const DMA_ChannelConfig_t *Copy_Config);
+
+/**
+ * @brief Register the function called from the channel interrupt.
+ *
+ * @param[in] Copy_Channel DMA_CHANNEL1 .. DMA_CHANNEL7.
+ * @param[in] Copy_Callback The callback, or NULL to only clear the flags.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid channel.
+ */
+Std_ReturnType MCAL_DMA_SetCallback(u8 Copy_Channel, DMA_Callback_t Copy_Callback);
+
+/**
+ * @brief Program addresses and item count, then enable the channel.
+ *
+ * The channel is disabled and its flags cleared first, so this may be called again from
+ * its own transfer-complete callback to chain the next block.
+ *
+ * @param[in] Copy_Channel DMA_CHANNEL1 .. DMA_CHANNEL7.
+ * @param[in] Copy_PeripheralAddress Address of the peripheral data register.
+ * @param[in] Copy_MemoryAddress Address of the memory buffer.
+ * @param[in] Copy_Count Number of items (1 .. 65535).
+ *
+ * @return E_OK if the transfer was started, E_NOT_OK for an invalid channel or count.
+ */
+Std_ReturnType MCAL_DMA_StartTransfer(u8 Copy_Channel, u32 Copy_PeripheralAddress, const void *Copy_MemoryAddress, u16 Copy_Count);
+
+/**
+ * @brief Disable a channel.
+ *
+ * @param[in] Copy_Channel DMA_CHANNEL1 .. DMA_CHANNEL7.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid channel.
+ */
+Std_ReturnType MCAL_DMA_StopChannel(u8 Copy_Channel);
+
+/**
+ * @brief Get the number of items the channel still has to transfer (CNDTR).
+ *
+ * In circular mode the write position in the buffer is (buffer length - remaining count).
+ *
+ * @param[in] Copy_Channel DMA_CHANNEL1 .. DMA_CHANNEL7.
+ *
+ * @return The remaining item count, 0 for an invalid channel.
+ */
+u16 MCAL_DMA_GetRemainingCount(u8 Copy_Channel);
+
+/** @} */ // End of DMA_Functions
+
+#endif /**< DMA_INTERFACE_H_ */
@@ -0,0 +1,58 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : DMA_private.h              *****************/
+/****************************************************************/
+#ifndef DMA_PRIVATE_H_
+#define DMA_PRIVATE_H_
+
+/**< DMA1 base address */
+#define DMA1_BASE_ADDRESS    0x40020000U
+
+/**< DMA channel register structure */
+typedef struct
+{
+    volatile u32 CCR;   /**< Channel Configuration Register */
+    volatile u32 CNDTR; /**< Channel Number of Data Register */
+    volatile u32 CPAR;  /**< Channel Peripheral Address Register */
+    volatile u32 CMAR;  /**< Channel Memory Address Register */
+    volatile u32 RESERVED;
+} DMA_ChannelRegDef_t;
+
+/**< DMA register structure */
+typedef struct
+{
+    volatile u32 ISR;                       /**< Interrupt Status Register */
+    volatile u32 IFCR;                      /**< Interrupt Flag Clear Register */
+    DMA_ChannelRegDef_t CH[DMA_CHANNEL_COUNT];  /**< Channels 1..7 at index 0..6 */
+} DMA_RegDef_t;
+
+/**< Pointer to DMA1 register structure */
+#define DMA1   ((DMA_RegDef_t *)DMA1_BASE_ADDRESS)
+
+/**< CCR bits */
+#define DMA_CCR_EN          0   /**< Channel enable */
+#define DMA_CCR_TCIE        1   /**< Transfer complete interrupt enable */
+#define DMA_CCR_HTIE        2   /**< Half transfer interrupt enable */
+#define DMA_CCR_TEIE        3   /**< Transfer error interrupt enable */
+#define DMA_CCR_DIR         4   /**< Read from memory */
+#define DMA_CCR_CIRC        5   /**< Circular mode */
+#define DMA_CCR_PINC        6   /**< Peripheral increment mode */
+#define DMA_CCR_MINC        7   /**< Memory increment mode */
+#define DMA_CCR_PSIZE       8   /**< Peripheral size, 2 bits */
+#define DMA_CCR_MSIZE       10  /**< Memory size, 2 bits */
+#define DMA_CCR_PL          12  /**< Channel priority level, 2 bits */
+
+/**< Flags of one channel in ISR/IFCR, shifted by 4 * channel index */
+#define DMA_FLAG_GIF        0x1U    /**< Global interrupt flag */
+#define DMA_FLAG_TCIF       0x2U    /**< Transfer complete flag */
+#define DMA_FLAG_HTIF       0x4U    /**< Half transfer flag */
+#define DMA_FLAG_TEIF       0x8U    /**< Transfer error flag */
+#define DMA_FLAG_ALL        0xFU
+#define DMA_FLAGS_SHIFT(CHANNEL_INDEX)  ((CHANNEL_INDEX) * 4)
+
+/**< Largest CNDTR value */
+#define DMA_MAX_COUNT       0xFFFFU
+
+#endif /**< DMA_PRIVATE_H_ */
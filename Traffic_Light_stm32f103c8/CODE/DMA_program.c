@@ -0,0 +1,157 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : DMA_program.c              *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "DMA_interface.h"
+#include "DMA_private.h"
+/*****************************< Private Variables *****************************/
+static DMA_Callback_t DMA_Callbacks[DMA_CHANNEL_COUNT] = {NULL};
+/*****************************< Private Functions *****************************/
+static void DMA_HandleIrq(u8 Copy_Channel)
+{
+    u8 Local_Flags = (u8)((DMA1->ISR >> DMA_FLAGS_SHIFT(Copy_Channel)) & (DMA_FLAG_TCIF | DMA_FLAG_HTIF | DMA_FLAG_TEIF));
+
+    /**< Clear before the callback, which may restart the channel */
+    DMA1->IFCR = (DMA_FLAG_ALL << DMA_FLAGS_SHIFT(Copy_Channel));
+
+    if (DMA_Callbacks[Copy_Channel] != NULL)
+    {
+        DMA_Callbacks[Copy_Channel](Local_Flags);
+    }
+}
+/*****************************< Function Implementations *****************************/
+Std_ReturnType MCAL_DMA_ConfigChannel(u8 Copy_Channel, const DMA_ChannelConfig_t *Copy_Config)
+{
+    u32 Local_Ccr = 0;
+
+    if ((Copy_Channel >= DMA_CHANNEL_COUNT) || (Copy_Config == NULL))
+    {
+        return E_NOT_OK;
+    }
+
+    /**< Direction, mode and increments */
+    if (Copy_Config->Direction == DMA_MEMORY_TO_PERIPHERAL)
+    {
+        SET_BIT(Local_Ccr, DMA_CCR_DIR);
+    }
+    if (Copy_Config->Mode == DMA_MODE_CIRCULAR)
+    {
+        SET_BIT(Local_Ccr, DMA_CCR_CIRC);
+    }
+    if (Copy_Config->PeripheralIncrement)
+    {
+        SET_BIT(Local_Ccr, DMA_CCR_PINC);
+    }
+    if (Copy_Config->MemoryIncrement)
+    {
+        SET_BIT(Local_Ccr, DMA_CCR_MINC);
+    }
+
+    /**< Sizes, priority and interrupts (DMA_IT_x match the TCIE/HTIE/TEIE bits) */
+    Local_Ccr |= ((u32)(Copy_Config->PeripheralSize & 0x3) << DMA_CCR_PSIZE);
+    Local_Ccr |= ((u32)(Copy_Config->MemorySize & 0x3) << DMA_CCR_MSIZE);
+    Local_Ccr |= ((u32)(Copy_Config->Priority & 0x3) << DMA_CCR_PL);
+    Local_Ccr |= (u32)(Copy_Config->Interrupts & (DMA_IT_COMPLETE | DMA_IT_HALF | DMA_IT_ERROR));
+
+    /**< CCR may only be written while the channel is disabled */
+    CLR_BIT(DMA1->CH[Copy_Channel].CCR, DMA_CCR_EN);
+    DMA1->CH[Copy_Channel].CCR = Local_Ccr;
+    DMA1->IFCR = (DMA_FLAG_ALL << DMA_FLAGS_SHIFT(Copy_Channel));
+
+    return E_OK;
+}
+
+Std_ReturnType MCAL_DMA_SetCallback(u8 Copy_Channel, DMA_Callback_t Copy_Callback)
+{
+    if (Copy_Channel >= DMA_CHANNEL_COUNT)
+    {
+        return E_NOT_OK;
+    }
+
+    DMA_Callbacks[Copy_Channel] = Copy_Callback;
+
+    return E_OK;
+}
+
+Std_ReturnType MCAL_DMA_StartTransfer(u8 Copy_Channel, u32 Copy_PeripheralAddress, const void *Copy_MemoryAddress, u16 Copy_Count)
+{
+    if ((Copy_Channel >= DMA_CHANNEL_COUNT) || (Copy_Count == 0))
+    {
+        return E_NOT_OK;
+    }
+
+    CLR_BIT(DMA1->CH[Copy_Channel].CCR, DMA_CCR_EN);
+    DMA1->IFCR = (DMA_FLAG_ALL << DMA_FLAGS_SHIFT(Copy_Channel));
+
+    DMA1->CH[Copy_Channel].CPAR = Copy_PeripheralAddress;
+    DMA1->CH[Copy_Channel].CMAR = (u32)Copy_MemoryAddress;
+    DMA1->CH[Copy_Channel].CNDTR = Copy_Count;
+
+    SET_BIT(DMA1->CH[Copy_Channel].CCR, DMA_CCR_EN);
+
+    return E_OK;
+}
+
+Std_ReturnType MCAL_DMA_StopChannel(u8 Copy_Channel)
+{
+    if (Copy_Channel >= DMA_CHANNEL_COUNT)
+    {
+        return E_NOT_OK;
+    }
+
+    CLR_BIT(DMA1->CH[Copy_Channel].CCR, DMA_CCR_EN);
+
+    return E_OK;
+}
+
+u16 MCAL_DMA_GetRemainingCount(u8 Copy_Channel)
+{
+    if (Copy_Channel >= DMA_CHANNEL_COUNT)
+    {
+        return 0;
+    }
+
+    return (u16)DMA1->CH[Copy_Channel].CNDTR;
+}
+/*****************************< IRQ Handlers *****************************/
+void DMA1_Channel1_IRQHandler(void)
+{
+    DMA_HandleIrq(DMA_CHANNEL1);
+}
+
+void DMA1_Channel2_IRQHandler(void)
+{
+    DMA_HandleIrq(DMA_CHANNEL2);
+}
+
+void DMA1_Channel3_IRQHandler(void)
+{
+    DMA_HandleIrq(DMA_CHANNEL3);
+}
+
+void DMA1_Channel4_IRQHandler(void)
+{
+    DMA_HandleIrq(DMA_CHANNEL4);
+}
+
+void DMA1_Channel5_IRQHandler(void)
+{
+    DMA_HandleIrq(DMA_CHANNEL5);
+}
+
+void DMA1_Channel6_IRQHandler(void)
+{
+    DMA_HandleIrq(DMA_CHANNEL6);
+}
+
+void DMA1_Channel7_IRQHandler(void)
+{
+    DMA_HandleIrq(DMA_CHANNEL7);
+}
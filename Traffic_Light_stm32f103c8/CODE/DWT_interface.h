@@ -0,0 +1,38 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : DWT_interface.h            *****************/
+/****************************************************************/
+#ifndef DWT_INTERFACE_H_
+#define DWT_INTERFACE_H_
+
+/**
+ * @defgroup DWT_Functions DWT Functions
+ * @brief Functions for the Cortex-M3 cycle counter.
+ * @{
+ */
+
+/**
+ * @brief Enable and reset the DWT cycle counter.
+ *
+ * This function enables the trace unit and starts the free-running 32-bit cycle counter
+ * from zero. The counter runs at the core clock and wraps around after 2^32 cycles.
+ *
+ * @return None.
+ */
+void MCAL_DWT_Init(void);
+
+/**
+ * @brief Get the current value of the cycle counter.
+ *
+ * Differences between two readings are valid as long as less than 2^32 cycles elapsed
+ * between them (unsigned subtraction handles a single wrap).
+ *
+ * @return The number of core clock cycles counted since MCAL_DWT_Init.
+ */
+u32 MCAL_DWT_GetCycles(void);
+
+/** @} */ // End of DWT_Functions group
+
+#endif /**< DWT_INTERFACE_H_ */
@@ -0,0 +1,29 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : DWT_private.h              *****************/
+/****************************************************************/
+#ifndef DWT_PRIVATE_H_
+#define DWT_PRIVATE_H_
+
+/**
+ * @defgroup DWT_Registers DWT Registers
+ * @brief Data Watchpoint and Trace unit registers used for cycle counting.
+ * @{
+ */
+#define DWT_CTRL            (*((volatile u32 *)0xE0001000)) /**< DWT CONTROL REGISTER */
+#define DWT_CYCCNT          (*((volatile u32 *)0xE0001004)) /**< DWT CYCLE COUNT REGISTER */
+
+#define DEMCR               (*((volatile u32 *)0xE000EDFC)) /**< DEBUG EXCEPTION AND MONITOR CONTROL REGISTER */
+/** @} */
+
+/**
+ * @defgroup DWT_Bit_Def DWT Bit Definitions
+ * @{
+ */
+#define DWT_CTRL_CYCCNTENA      0   /**< Enable the cycle counter */
+#define DEMCR_TRCENA            24  /**< Enable the DWT and ITM units */
+/** @} */
+
+#endif /**< DWT_PRIVATE_H_ */
@@ -0,0 +1,31 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : DWT_program.c              *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "DWT_interface.h"
+#include "DWT_private.h"
+/*****************************< Function Implementations *****************************/
+void MCAL_DWT_Init(void)
+{
+    /**< Enable the trace unit so the DWT registers become accessible */
+    SET_BIT(DEMCR, DEMCR_TRCENA);
+
+    /**< Restart counting from zero */
+    DWT_CYCCNT = 0;
+
+    /**< Enable the cycle counter */
+    SET_BIT(DWT_CTRL, DWT_CTRL_CYCCNTENA);
+}
+
+u32 MCAL_DWT_GetCycles(void)
+{
+    return DWT_CYCCNT;
+}
+/*****************************< End of Function Implementations *****************************/
@@ -144,12 +144,55 @@ Std_ReturnType EXTI_DisableLine(u8 Copy_Line);
  */
 Std_ReturnType EXTI_SetTrigger(u8 Copy_Line, u8 Copy_Mode);
 
+/**
+ * @brief Trigger an external interrupt line from software.
+ *
+ * This function sets the software interrupt event bit of the specified line, which
+ * raises the same pending request as a hardware edge when the line is unmasked.
+ *
+ * @param[in] Copy_Line The external interrupt line to trigger.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Software interrupt generated successfully.
+ *   - E_NOT_OK : An error occurred (invalid interrupt line).
+ */
+Std_ReturnType EXTI_GenerateSoftwareInterrupt(u8 Copy_Line);
+
 /** @} */ // End of EXTI_Control
 
+/**
+ * @brief Clear the pending flag of one line. Lines pending at the same time stay pending.
+ */
 void EXTI_CLR_PendingFLag(u8 Copy_Line);
 
+/**
+ * @brief Check whether a line has a pending request, so a handler shared by several lines can tell them apart.
+ *
+ * @param[in] Copy_Line The external interrupt line.
+ *
+ * @return 1 if the line is pending, 0 otherwise or for an invalid line.
+ */
+u8 EXTI_GetPendingFlag(u8 Copy_Line);
+
 void EXTI_Callback(CallbackFunction callback);
 
+/**
+ * @brief Install the handler of line 0 on its own, apart from the callback shared by the other lines.
+ *
+ * EXTI0 has its own NVIC vector, so this handler can run at a priority of its own.
+ *
+ * @param[in] callback The function called from EXTI0_IRQHandler, or NULL.
+ *
+ * @return None.
+ */
+void EXTI_Line0Callback(CallbackFunction callback);
+
+void EXTI0_IRQHandler(void);
+
 void EXTI4_IRQHandler(void);
 
+void EXTI9_5_IRQHandler(void);
+
+void EXTI15_10_IRQHandler(void);
+
 #endif /**< EXTI_INTERFACE_H_ */
\ No newline at end of file
@@ -20,6 +20,7 @@
 /*****************************< Function Implementations *****************************/
  typedef void (*CallbackFunction)(void);
  CallbackFunction myCallback = NULL;
+ CallbackFunction myLine0Callback = NULL;
 void EXTI_vInit(void)
 {
     for (u8 Line = 0; Line < EXTI_LINES_COUNT; Line++)
@@ -175,24 +176,60 @@ Std_ReturnType EXTI_SetTrigger(u8 Copy_Line, u8 Copy_Mode)
     return Local_FunctionStatus;
 }
 
-void EXTI_CLR_PendingFLag(u8 Copy_Line)
+Std_ReturnType EXTI_GenerateSoftwareInterrupt(u8 Copy_Line)
 {
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
 
-if(Copy_Line< 16)
-{
-EXTI->PR |= (1<< Copy_Line);
-	
+    if(Copy_Line < EXTI_LINES_COUNT)
+    {
+        SET_BIT(EXTI->SWIER, Copy_Line);
+        Local_FunctionStatus = E_OK;
+    }
+    else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+
+    return Local_FunctionStatus;
 }
-else return;
 
+void EXTI_CLR_PendingFLag(u8 Copy_Line)
+{
+    if (Copy_Line < 16)
+    {
+        /**< PR is write-1-to-clear: a read-modify-write would also clear every other pending line */
+        EXTI->PR = (1UL << Copy_Line);
+    }
+}
+u8 EXTI_GetPendingFlag(u8 Copy_Line)
+{
+    return (Copy_Line < 16) ? (u8)GET_BIT(EXTI->PR, Copy_Line) : 0;
 }
 void EXTI_Callback(CallbackFunction callback) {
     myCallback = callback;
 }
+void EXTI_Line0Callback(CallbackFunction callback) {
+    myLine0Callback = callback;
+}
+void EXTI0_IRQHandler(void)
+{
+	if (myLine0Callback != NULL)
+		myLine0Callback();
+}
 void EXTI4_IRQHandler(void)
 {
 	if (myCallback != NULL)
 		myCallback();
 }
+void EXTI9_5_IRQHandler(void)
+{
+	if (myCallback != NULL)
+		myCallback();
+}
+void EXTI15_10_IRQHandler(void)
+{
+	if (myCallback != NULL)
+		myCallback();
+}
 /*****************************< End of Function Implementations *****************************/
 
@@ -0,0 +1,19 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : FLASH_config.h             *****************/
+/****************************************************************/
+#ifndef FLASH_CONFIG_H_
+#define FLASH_CONFIG_H_
+
+/**
+ * @brief Maximum number of BSY polls per operation before it is reported as failed.
+ *
+ * A page erase takes up to 40 ms and a half-word up to 70 us (datasheet tERASE, tPROG);
+ * the core is stalled while executing from flash during both, so the bound only trips
+ * on a hung controller.
+ */
+#define FLASH_TIMEOUT           0x100000
+
+#endif /**< FLASH_CONFIG_H_ */
@@ -0,0 +1,80 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : FLASH_interface.h          *****************/
+/****************************************************************/
+#ifndef FLASH_INTERFACE_H_
+#define FLASH_INTERFACE_H_
+
+/**
+ * @defgroup FLASH_Parameters FLASH Parameters
+ * @{
+ */
+
+/**
+ * @name Main Memory Geometry (STM32F103x8, medium density)
+ * @{
+ */
+#define FLASH_PAGE_SIZE         1024    /**< Bytes per erase page */
+#define FLASH_PAGE_COUNT        64      /**< Pages of main memory */
+#define FLASH_PAGE_ADDRESS(PAGE)    (0x08000000U + ((u32)(PAGE) * FLASH_PAGE_SIZE))
+/** @} */
+
+/**
+ * @brief Value of an erased half-word.
+ */
+#define FLASH_ERASED_HALFWORD   0xFFFF
+
+/** @} */ // End of FLASH_Parameters
+
+/**
+ * @defgroup FLASH_Functions FLASH Functions
+ * @brief Program and erase the internal flash through the FPEC.
+ *
+ * The core stalls on every flash fetch while an operation runs, so each call should
+ * be kept to what the caller can afford in one go (one page erase, or a short batch
+ * of half-words).
+ * @{
+ */
+
+/**
+ * @brief Unlock the FPEC. Required once before programming or erasing.
+ *
+ * @return E_OK if the controller is unlocked, E_NOT_OK if it stays locked until the next reset.
+ */
+Std_ReturnType MCAL_FLASH_Unlock(void);
+
+/**
+ * @brief Lock the FPEC against accidental writes.
+ *
+ * @return None.
+ */
+void MCAL_FLASH_Lock(void);
+
+/**
+ * @brief Erase one page of main memory.
+ *
+ * @param[in] Copy_PageAddress Any address within the page.
+ *
+ * @return E_OK if the page now reads as FLASH_ERASED_HALFWORD, E_NOT_OK otherwise.
+ */
+Std_ReturnType MCAL_FLASH_ErasePage(u32 Copy_PageAddress);
+
+/**
+ * @brief Program consecutive half-words with a single programming sequence.
+ *
+ * PG stays set for the whole batch, so each half-word costs one store and one BSY wait.
+ * Every target must be erased (or be written with 0x0000). Each half-word is read back.
+ *
+ * @param[in] Copy_Address Half-word aligned start address.
+ * @param[in] Copy_Data The half-words to write.
+ * @param[in] Copy_Count Number of half-words.
+ *
+ * @return E_OK if all half-words read back correctly, E_NOT_OK at the first failure.
+ */
+Std_ReturnType MCAL_FLASH_ProgramHalfWords(u32 Copy_Address, const u16 *Copy_Data, u32 Copy_Count);
+
+/** @} */ // End of FLASH_Functions
+
+#endif /**< FLASH_INTERFACE_H_ */
@@ -0,0 +1,53 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : FLASH_private.h            *****************/
+/****************************************************************/
+#ifndef FLASH_PRIVATE_H_
+#define FLASH_PRIVATE_H_
+
+/**< Flash program/erase controller (FPEC) base address */
+#define FLASH_BASE_ADDRESS      0x40022000U
+
+/**< FPEC register structure */
+typedef struct
+{
+    volatile u32 ACR;       /**< Access Control Register (owned by RCC) */
+    volatile u32 KEYR;      /**< FPEC Key Register */
+    volatile u32 OPTKEYR;   /**< Option Byte Key Register */
+    volatile u32 SR;        /**< Status Register */
+    volatile u32 CR;        /**< Control Register */
+    volatile u32 AR;        /**< Address Register */
+    volatile u32 RESERVED;
+    volatile u32 OBR;       /**< Option Byte Register */
+    volatile u32 WRPR;      /**< Write Protection Register */
+} FLASH_RegDef_t;
+
+/**< Pointer to the FPEC register structure */
+#define FLASH   ((FLASH_RegDef_t *)FLASH_BASE_ADDRESS)
+
+/**< Unlock sequence written to KEYR */
+#define FLASH_KEY1              0x45670123U
+#define FLASH_KEY2              0xCDEF89ABU
+
+/**< SR bits */
+#define FLASH_SR_BSY            0   /**< Operation in progress */
+#define FLASH_SR_PGERR          2   /**< Programming a location that was not erased */
+#define FLASH_SR_WRPRTERR       4   /**< Write to a protected page */
+#define FLASH_SR_EOP            5   /**< End of operation */
+
+/**< Error and completion flags, cleared by writing 1 */
+#define FLASH_SR_CLEAR_MASK     ((1U << FLASH_SR_PGERR) | (1U << FLASH_SR_WRPRTERR) | (1U << FLASH_SR_EOP))
+
+/**< CR bits */
+#define FLASH_CR_PG             0   /**< Programming */
+#define FLASH_CR_PER            1   /**< Page erase */
+#define FLASH_CR_STRT           6   /**< Start erase */
+#define FLASH_CR_LOCK           7   /**< FPEC locked */
+
+/**< Main memory of the STM32F103x8 */
+#define FLASH_MAIN_START        0x08000000U
+#define FLASH_MAIN_END          (FLASH_MAIN_START + (FLASH_PAGE_COUNT * FLASH_PAGE_SIZE))
+
+#endif /**< FLASH_PRIVATE_H_ */
@@ -0,0 +1,123 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : FLASH_program.c            *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "FLASH_interface.h"
+#include "FLASH_config.h"
+#include "FLASH_private.h"
+/*****************************< Private Functions *****************************/
+static Std_ReturnType FLASH_WaitDone(void)
+{
+    u32 Local_Timeout = FLASH_TIMEOUT;
+    u32 Local_Status;
+
+    while (GET_BIT(FLASH->SR, FLASH_SR_BSY))
+    {
+        if (--Local_Timeout == 0)
+        {
+            return E_NOT_OK;
+        }
+    }
+
+    Local_Status = FLASH->SR;
+    FLASH->SR = FLASH_SR_CLEAR_MASK;
+
+    if (Local_Status & ((1U << FLASH_SR_PGERR) | (1U << FLASH_SR_WRPRTERR)))
+    {
+        return E_NOT_OK;
+    }
+
+    return E_OK;
+}
+/*****************************< Function Implementations *****************************/
+Std_ReturnType MCAL_FLASH_Unlock(void)
+{
+    if (GET_BIT(FLASH->CR, FLASH_CR_LOCK))
+    {
+        FLASH->KEYR = FLASH_KEY1;
+        FLASH->KEYR = FLASH_KEY2;
+    }
+
+    /**< A wrong sequence locks the FPEC until the next reset */
+    return GET_BIT(FLASH->CR, FLASH_CR_LOCK) ? E_NOT_OK : E_OK;
+}
+
+void MCAL_FLASH_Lock(void)
+{
+    SET_BIT(FLASH->CR, FLASH_CR_LOCK);
+}
+
+Std_ReturnType MCAL_FLASH_ErasePage(u32 Copy_PageAddress)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    const volatile u32 *Local_Word;
+    u32 Local_Index;
+
+    if ((Copy_PageAddress < FLASH_MAIN_START) || (Copy_PageAddress >= FLASH_MAIN_END) ||
+        (FLASH_WaitDone() != E_OK))
+    {
+        return E_NOT_OK;
+    }
+
+    SET_BIT(FLASH->CR, FLASH_CR_PER);
+    FLASH->AR = Copy_PageAddress;
+    SET_BIT(FLASH->CR, FLASH_CR_STRT);
+    Local_FunctionStatus = FLASH_WaitDone();
+    CLR_BIT(FLASH->CR, FLASH_CR_PER);
+
+    if (Local_FunctionStatus == E_OK)
+    {
+        /**< Blank check */
+        Local_Word = (const volatile u32 *)(Copy_PageAddress & ~(u32)(FLASH_PAGE_SIZE - 1));
+        for (Local_Index = 0; Local_Index < (FLASH_PAGE_SIZE / 4); Local_Index++)
+        {
+            if (Local_Word[Local_Index] != 0xFFFFFFFFU)
+            {
+                Local_FunctionStatus = E_NOT_OK;
+                break;
+            }
+        }
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_FLASH_ProgramHalfWords(u32 Copy_Address, const u16 *Copy_Data, u32 Copy_Count)
+{
+    Std_ReturnType Local_FunctionStatus = E_OK;
+    volatile u16 *Local_Target = (volatile u16 *)Copy_Address;
+
+    if ((Copy_Data == NULL) || (Copy_Address & 1) || (Copy_Address < FLASH_MAIN_START) ||
+        ((Copy_Address + (Copy_Count * 2)) > FLASH_MAIN_END) || (FLASH_WaitDone() != E_OK))
+    {
+        return E_NOT_OK;
+    }
+
+    SET_BIT(FLASH->CR, FLASH_CR_PG);
+
+    while (Copy_Count--)
+    {
+        *Local_Target = *Copy_Data;
+
+        if ((FLASH_WaitDone() != E_OK) || (*Local_Target != *Copy_Data))
+        {
+            Local_FunctionStatus = E_NOT_OK;
+            break;
+        }
+
+        Local_Target++;
+        Copy_Data++;
+    }
+
+    CLR_BIT(FLASH->CR, FLASH_CR_PG);
+
+    return Local_FunctionStatus;
+}
+/*****************************< End of Function Implementations *****************************/
@@ -7,4 +7,12 @@
 #ifndef GPIO_CONFIG_H
 #define GPIO_CONFIG_H
 
+/**
+ * @brief Record every output data register change in the trace stream.
+ * @note Choose one of the available options:
+ *       - GPIO_TRACE_ENABLED  : each pin write appends the new ODR image (see TRACE_interface.h).
+ *       - GPIO_TRACE_DISABLED : no tracing, no extra cycles on the write path.
+ */
+#define GPIO_TRACE_OUTPUTS GPIO_TRACE_DISABLED
+
 #endif /*GPIO_CONFIG_H*/
\ No newline at end of file
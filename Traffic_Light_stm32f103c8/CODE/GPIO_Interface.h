@@ -131,6 +131,44 @@ Std_ReturnType MCAL_GPIO_SetPinValue(u8 Copy_PortId, u8 Copy_PinId, u8 Copy_PinV
  */
 Std_ReturnType MCAL_GPIO_GetPinValue(u8 Copy_PortId, u8 Copy_PinId, u8 *Copy_PinReturnValue);
 
+/**
+ * @brief Writes several pins of a GPIO port at once.
+ *
+ * This function drives every pin selected by the mask to the corresponding bit of the value with a
+ * single store to the bit set/reset register, so all pins change in the same bus cycle and no
+ * read-modify-write of the output data register can race with an interrupt.
+ *
+ * @param[in] Copy_PortId The ID of the GPIO port (e.g., GPIO_PORTA, GPIO_PORTB, etc.).
+ * @param[in] Copy_PinMask Bit mask of the pins to drive (bit n = pin n).
+ * @param[in] Copy_PortValue Desired levels of the selected pins (bit n = level of pin n).
+ * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK if an error occurred.
+ */
+Std_ReturnType MCAL_GPIO_SetPortValue(u8 Copy_PortId, u16 Copy_PinMask, u16 Copy_PortValue);
+
+/**
+ * @brief Reads the output data register of a GPIO port.
+ *
+ * This function returns the levels the port is driving (not the pin inputs), so a caller can
+ * compute a toggle and write it back with a single MCAL_GPIO_SetPortValue store.
+ *
+ * @param[in] Copy_PortId The ID of the GPIO port (e.g., GPIO_PORTA, GPIO_PORTB, etc.).
+ * @param[out] Copy_PortReturnValue Pointer to store the output levels (bit n = pin n).
+ * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK if an error occurred.
+ */
+Std_ReturnType MCAL_GPIO_GetPortOutput(u8 Copy_PortId, u16 *Copy_PortReturnValue);
+
+/**
+ * @brief Gets the address of the bit set/reset register of a GPIO port.
+ *
+ * This function is meant for DMA transfers that drive pins without the CPU: each word written to
+ * the register sets the pins of its low half and resets the pins of its high half. Such writes
+ * bypass the output trace.
+ *
+ * @param[in] Copy_PortId The ID of the GPIO port (e.g., GPIO_PORTA, GPIO_PORTB, etc.).
+ * @return u32 The register address, or 0 for an invalid port.
+ */
+u32 MCAL_GPIO_GetBsrrAddress(u8 Copy_PortId);
+
 /** @} */ // End of GPIO_Functions group
 
 #endif /**< GPIO_INTERFACE_H_ */
\ No newline at end of file
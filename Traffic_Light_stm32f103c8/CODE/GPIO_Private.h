@@ -52,4 +52,10 @@
 
 /** @} */ // End of GPIO_Registers_Addresses group
 
+/**
+ * @brief Output tracing options (see GPIO_TRACE_OUTPUTS in GPIO_Config.h)
+ */
+#define GPIO_TRACE_DISABLED 0
+#define GPIO_TRACE_ENABLED 1
+
 #endif /**< GPIO_PRIVATE_H_ */
\ No newline at end of file
@@ -11,6 +11,10 @@
 #include "GPIO_interface.h"
 #include "GPIO_private.h"
 #include "GPIO_config.h"
+#if GPIO_TRACE_OUTPUTS == GPIO_TRACE_ENABLED
+/*****************************< SERVICE *****************************/
+#include "TRACE_interface.h"
+#endif
 /*****************************< Function Implementations *****************************/
 Std_ReturnType MCAL_GPIO_SetPinMode(u8 Copy_PortId, u8 Copy_PinId, u8 Copy_PinMode)
 {
@@ -27,8 +31,8 @@ Std_ReturnType MCAL_GPIO_SetPinMode(u8 Copy_PortId, u8 Copy_PinId, u8 Copy_PinMo
         }
         else if (Copy_PinId < 16)
         {
-            GPIOA_CRH &= ~((0b1111) << (Copy_PinId * 4));
-            GPIOA_CRH |= (Copy_PinMode << (Copy_PinId * 4));
+            GPIOA_CRH &= ~((0b1111) << ((Copy_PinId - 8) * 4));
+            GPIOA_CRH |= (Copy_PinMode << ((Copy_PinId - 8) * 4));
             Local_FunctionStatus = E_OK;
         }
         else
@@ -45,8 +49,8 @@ Std_ReturnType MCAL_GPIO_SetPinMode(u8 Copy_PortId, u8 Copy_PinId, u8 Copy_PinMo
         }
         else if (Copy_PinId < 16)
         {
-            GPIOB_CRH &= ~((0b1111) << (Copy_PinId * 4));
-            GPIOB_CRH |= (Copy_PinMode << (Copy_PinId * 4));
+            GPIOB_CRH &= ~((0b1111) << ((Copy_PinId - 8) * 4));
+            GPIOB_CRH |= (Copy_PinMode << ((Copy_PinId - 8) * 4));
             Local_FunctionStatus = E_OK;
         }
         else
@@ -63,8 +67,8 @@ Std_ReturnType MCAL_GPIO_SetPinMode(u8 Copy_PortId, u8 Copy_PinId, u8 Copy_PinMo
         }
         else if (Copy_PinId < 16)
         {
-            GPIOC_CRH &= ~((0b1111) << (Copy_PinId * 4));
-            GPIOC_CRH |= (Copy_PinMode << (Copy_PinId * 4));
+            GPIOC_CRH &= ~((0b1111) << ((Copy_PinId - 8) * 4));
+            GPIOC_CRH |= (Copy_PinMode << ((Copy_PinId - 8) * 4));
             Local_FunctionStatus = E_OK;
         }
         else
@@ -143,6 +147,24 @@ Std_ReturnType MCAL_GPIO_SetPinValue(u8 Copy_PortId, u8 Copy_PinId, u8 Copy_PinV
         break;
     }
 
+#if GPIO_TRACE_OUTPUTS == GPIO_TRACE_ENABLED
+    if (Local_FunctionStatus == E_OK)
+    {
+        switch (Copy_PortId)
+        {
+        case GPIO_PORTA:
+            TRACE_RecordOutput(GPIO_PORTA, (u16)GPIOA_ODR);
+            break;
+        case GPIO_PORTB:
+            TRACE_RecordOutput(GPIO_PORTB, (u16)GPIOB_ODR);
+            break;
+        default:
+            TRACE_RecordOutput(GPIO_PORTC, (u16)GPIOC_ODR);
+            break;
+        }
+    }
+#endif
+
     return Local_FunctionStatus;
 }
 
@@ -178,4 +200,100 @@ Std_ReturnType MCAL_GPIO_GetPinValue(u8 Copy_PortId, u8 Copy_PinId, u8 *Copy_Pin
     }
 
     return Local_FunctionStatus;
-}
\ No newline at end of file
+}
+
+Std_ReturnType MCAL_GPIO_SetPortValue(u8 Copy_PortId, u16 Copy_PinMask, u16 Copy_PortValue)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    /**< Set bits in the low half, reset bits in the high half of BSRR */
+    u32 Local_BsrValue = ((u32)(Copy_PortValue & Copy_PinMask)) |
+                         (((u32)(~Copy_PortValue & Copy_PinMask)) << 16);
+
+    switch (Copy_PortId)
+    {
+    case GPIO_PORTA:
+        GPIOA_BSR = Local_BsrValue;
+        Local_FunctionStatus = E_OK;
+#if GPIO_TRACE_OUTPUTS == GPIO_TRACE_ENABLED
+        TRACE_RecordOutput(GPIO_PORTA, (u16)GPIOA_ODR);
+#endif
+        break;
+    case GPIO_PORTB:
+        GPIOB_BSR = Local_BsrValue;
+        Local_FunctionStatus = E_OK;
+#if GPIO_TRACE_OUTPUTS == GPIO_TRACE_ENABLED
+        TRACE_RecordOutput(GPIO_PORTB, (u16)GPIOB_ODR);
+#endif
+        break;
+    case GPIO_PORTC:
+        GPIOC_BSR = Local_BsrValue;
+        Local_FunctionStatus = E_OK;
+#if GPIO_TRACE_OUTPUTS == GPIO_TRACE_ENABLED
+        TRACE_RecordOutput(GPIO_PORTC, (u16)GPIOC_ODR);
+#endif
+        break;
+
+    default:
+        Local_FunctionStatus = E_NOT_OK;
+        break;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_GPIO_GetPortOutput(u8 Copy_PortId, u16 *Copy_PortReturnValue)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if (Copy_PortReturnValue == NULL)
+    {
+        return E_NOT_OK;
+    }
+
+    switch (Copy_PortId)
+    {
+    case GPIO_PORTA:
+        *Copy_PortReturnValue = (u16)GPIOA_ODR;
+        Local_FunctionStatus = E_OK;
+        break;
+    case GPIO_PORTB:
+        *Copy_PortReturnValue = (u16)GPIOB_ODR;
+        Local_FunctionStatus = E_OK;
+        break;
+    case GPIO_PORTC:
+        *Copy_PortReturnValue = (u16)GPIOC_ODR;
+        Local_FunctionStatus = E_OK;
+        break;
+
+    default:
+        Local_FunctionStatus = E_NOT_OK;
+        break;
+    }
+
+    return Local_FunctionStatus;
+}
+
+u32 MCAL_GPIO_GetBsrrAddress(u8 Copy_PortId)
+{
+    u32 Local_Address = 0;
+
+    switch (Copy_PortId)
+    {
+    case GPIO_PORTA:
+        Local_Address = (u32)&GPIOA_BSR;
+        break;
+    case GPIO_PORTB:
+        Local_Address = (u32)&GPIOB_BSR;
+        break;
+    case GPIO_PORTC:
+        Local_Address = (u32)&GPIOC_BSR;
+        break;
+
+    default:
+        Local_Address = 0;
+        break;
+    }
+
+    return Local_Address;
+}
@@ -11,8 +11,74 @@
 /*****************************< MCAL *****************************/
 #include "GPIO_interface.h"
 #include "STK_interface.h"
+#include "AFIO_interface.h"
+#include "TIM_interface.h"
+#include "SCB_interface.h"
 /*****************************< HAL *****************************/
 #include "LED.h"
+/*****************************< Private Variables *****************************/
+static const LED_PwmMap_t LED_PwmMap[] = { LED_PWM_MAP };
+
+#define LED_PWM_COUNT   (sizeof(LED_PwmMap) / sizeof(LED_PwmMap[0]))
+
+static u32 LED_PwmLit = 0;                  /**< Lit state of each LED_PwmMap entry */
+static u8 LED_PwmRunning = 0;               /**< Set once the pins are on their timer channels */
+static u8 LED_Brightness = LED_BRIGHTNESS_FULL;
+static LED_SeqSlot_t LED_SeqSlots[LED_SEQ_SLOTS];
+static const LED_Group_t LED_AllOff = { { 0 } };
+/*****************************< Private Functions *****************************/
+static u16 LED_Compare(u8 Copy_Index)
+{
+    return (LED_PwmLit & (1UL << Copy_Index)) ? (u16)(((u32)LED_Brightness * LED_PWM_STEPS) / LED_BRIGHTNESS_FULL) : 0;
+}
+
+/**< Follow a GPIO write on the PWM-driven LEDs among Copy_PinMask */
+static void LED_UpdatePwm(LED_Port_t Copy_LedPortId, u16 Copy_PinMask, u16 Copy_Value)
+{
+    u32 Local_PriMask;
+    u8 Local_Index;
+
+    /**< The preemption interrupt writes the same heads: its lit state and compare must not land in between */
+    Local_PriMask = SCB_EnterCritical();
+
+    for (Local_Index = 0; Local_Index < LED_PWM_COUNT; Local_Index++)
+    {
+        if ((LED_PwmMap[Local_Index].Port != Copy_LedPortId) || !(Copy_PinMask & (1U << LED_PwmMap[Local_Index].Pin)))
+        {
+            continue;
+        }
+
+        if (Copy_Value & (1U << LED_PwmMap[Local_Index].Pin))
+        {
+            LED_PwmLit |= (1UL << Local_Index);
+        }
+        else
+        {
+            LED_PwmLit &= ~(1UL << Local_Index);
+        }
+
+        if (LED_PwmRunning)
+        {
+            (void)MCAL_TIM_SetCompare(LED_PwmMap[Local_Index].Timer, LED_PwmMap[Local_Index].Channel, LED_Compare(Local_Index));
+        }
+    }
+
+    SCB_ExitCritical(Local_PriMask);
+}
+
+static void LED_SeqOutput(const LED_SeqSlot_t *Copy_Slot, u8 Copy_Level)
+{
+    (void)HAL_LED_WritePort(Copy_Slot->Port, Copy_Slot->Mask, (u16)((Copy_Level ? Copy_Slot->Mask : 0) ^ Copy_Slot->Invert));
+}
+
+static void LED_SeqEnterStep(LED_SeqSlot_t *Copy_Slot, u8 Copy_Step)
+{
+    const LED_SeqStep_t *Local_Step = &Copy_Slot->Pattern->Steps[Copy_Step];
+
+    Copy_Slot->Step = Copy_Step;
+    Copy_Slot->TicksLeft = (Local_Step->Ticks != 0) ? Local_Step->Ticks : 1;
+    LED_SeqOutput(Copy_Slot, Local_Step->Level);
+}
 /*****************************< Function Implementations *****************************/
 /**
  * @defgroup Public_Functions LED Driver
@@ -27,17 +93,28 @@ Std_ReturnType HAL_LED_Init(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId)
 
 Std_ReturnType HAL_LED_On(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId)
 {
+    LED_UpdatePwm(Copy_LedPortId, (u16)(1U << Copy_LedPinId), (u16)(1U << Copy_LedPinId));
+
     return MCAL_GPIO_SetPinValue(Copy_LedPortId, Copy_LedPinId, GPIO_HIGH);
 }
 
 Std_ReturnType HAL_LED_Off(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId)
 {
+    LED_UpdatePwm(Copy_LedPortId, (u16)(1U << Copy_LedPinId), 0);
+
     return MCAL_GPIO_SetPinValue(Copy_LedPortId, Copy_LedPinId, GPIO_LOW);
 }
 
 Std_ReturnType HAL_LED_Toggle(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId)
 {
-   
+    u16 Local_Output;
+
+    if (MCAL_GPIO_GetPortOutput(Copy_LedPortId, &Local_Output) != E_OK)
+    {
+        return E_NOT_OK;
+    }
+
+    return HAL_LED_WritePort(Copy_LedPortId, (u16)(1U << Copy_LedPinId), (u16)~Local_Output);
 }
 
 Std_ReturnType HAL_LED_BlinkOnce(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId, LED_Delay_ms_t Copy_BlinkTime)
@@ -74,6 +151,262 @@ Std_ReturnType HAL_LED_BlinkTwice(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedP
     return E_OK;
 }
 
+Std_ReturnType HAL_LED_WritePort(LED_Port_t Copy_LedPortId, u16 Copy_PinMask, u16 Copy_Value)
+{
+    LED_UpdatePwm(Copy_LedPortId, Copy_PinMask, Copy_Value);
+
+    /**< Keeps the data register in step, it drives the LED again whenever the pin is GPIO */
+    return MCAL_GPIO_SetPortValue(Copy_LedPortId, Copy_PinMask, Copy_Value);
+}
+
+Std_ReturnType HAL_LED_GroupWrite(const LED_Group_t *Copy_Group, const LED_Group_t *Copy_Levels)
+{
+    u8 Local_Port;
+    Std_ReturnType Local_Status = E_OK;
+
+    if ((Copy_Group == NULL) || (Copy_Levels == NULL))
+    {
+        return E_NOT_OK;
+    }
+
+    for (Local_Port = 0; Local_Port < LED_PORT_COUNT; Local_Port++)
+    {
+        if ((Copy_Group->Mask[Local_Port] != 0) &&
+            (HAL_LED_WritePort((LED_Port_t)Local_Port, Copy_Group->Mask[Local_Port], Copy_Levels->Mask[Local_Port]) != E_OK))
+        {
+            Local_Status = E_NOT_OK;
+        }
+    }
+
+    return Local_Status;
+}
+
+Std_ReturnType HAL_LED_GroupOn(const LED_Group_t *Copy_Group)
+{
+    return HAL_LED_GroupWrite(Copy_Group, Copy_Group);
+}
+
+Std_ReturnType HAL_LED_GroupOff(const LED_Group_t *Copy_Group)
+{
+    return HAL_LED_GroupWrite(Copy_Group, &LED_AllOff);
+}
+
+Std_ReturnType HAL_LED_GroupToggle(const LED_Group_t *Copy_Group)
+{
+    u8 Local_Port;
+    LED_Group_t Local_Levels = { { 0 } };
+
+    if (Copy_Group == NULL)
+    {
+        return E_NOT_OK;
+    }
+
+    /**< Snapshot every port first, so all ports toggle from the same instant */
+    for (Local_Port = 0; Local_Port < LED_PORT_COUNT; Local_Port++)
+    {
+        if ((Copy_Group->Mask[Local_Port] != 0) &&
+            (MCAL_GPIO_GetPortOutput(Local_Port, &Local_Levels.Mask[Local_Port]) != E_OK))
+        {
+            return E_NOT_OK;
+        }
+        Local_Levels.Mask[Local_Port] = (u16)~Local_Levels.Mask[Local_Port];
+    }
+
+    return HAL_LED_GroupWrite(Copy_Group, &Local_Levels);
+}
+
+Std_ReturnType HAL_LED_InitPwm(u32 Copy_TimerClockFreq)
+{
+    u8 Local_Index;
+    u8 Local_Started = 0;   /**< Timers already initialized, one bit per timer */
+    u8 Local_Timer;
+
+    for (Local_Index = 0; Local_Index < LED_PWM_COUNT; Local_Index++)
+    {
+        Local_Timer = LED_PwmMap[Local_Index].Timer;
+
+        if (!(Local_Started & (1U << Local_Timer)))
+        {
+            if ((MCAL_AFIO_SetTimerRemap(Local_Timer, LED_PwmMap[Local_Index].Remap) != E_OK) ||
+                (MCAL_TIM_InitPwm(Local_Timer, Copy_TimerClockFreq, LED_PWM_FREQ_HZ, LED_PWM_STEPS) != E_OK))
+            {
+                return E_NOT_OK;
+            }
+            Local_Started |= (1U << Local_Timer);
+        }
+
+        /**< The channel already outputs the current state when the pin switches over */
+        if ((MCAL_TIM_EnablePwmChannel(Local_Timer, LED_PwmMap[Local_Index].Channel, LED_Compare(Local_Index)) != E_OK) ||
+            (MCAL_GPIO_SetPinMode(LED_PwmMap[Local_Index].Port, LED_PwmMap[Local_Index].Pin, GPIO_OUTPUT_AF_PUSH_PULL_2MHZ) != E_OK))
+        {
+            return E_NOT_OK;
+        }
+    }
+
+    LED_PwmRunning = 1;
+
+    return E_OK;
+}
+
+Std_ReturnType HAL_LED_SetPwmOutputs(u8 Copy_Enable)
+{
+    u8 Local_Index;
+
+    if (!LED_PwmRunning)
+    {
+        return E_NOT_OK;
+    }
+
+    for (Local_Index = 0; Local_Index < LED_PWM_COUNT; Local_Index++)
+    {
+        (void)MCAL_GPIO_SetPinMode(LED_PwmMap[Local_Index].Port, LED_PwmMap[Local_Index].Pin,
+                                   Copy_Enable ? GPIO_OUTPUT_AF_PUSH_PULL_2MHZ : GPIO_OUTPUT_PUSH_PULL_2MHZ);
+    }
+
+    return E_OK;
+}
+
+Std_ReturnType HAL_LED_SetClockFreq(u32 Copy_TimerClockFreq)
+{
+    u8 Local_Index;
+    Std_ReturnType Local_FunctionStatus = E_OK;
+
+    for (Local_Index = 0; Local_Index < LED_PWM_COUNT; Local_Index++)
+    {
+        if (MCAL_TIM_SetClockFreq(LED_PwmMap[Local_Index].Timer, Copy_TimerClockFreq, LED_PWM_FREQ_HZ) != E_OK)
+        {
+            Local_FunctionStatus = E_NOT_OK;
+        }
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType HAL_LED_SetBrightness(u8 Copy_Percent)
+{
+    u32 Local_PriMask;
+    u8 Local_Index;
+
+    if (Copy_Percent > LED_BRIGHTNESS_FULL)
+    {
+        return E_NOT_OK;
+    }
+
+    /**< A head switched from an interrupt between LED_Compare and the store would get the stale compare */
+    Local_PriMask = SCB_EnterCritical();
+
+    LED_Brightness = (Copy_Percent < LED_MIN_BRIGHTNESS) ? LED_MIN_BRIGHTNESS : Copy_Percent;
+
+    if (LED_PwmRunning)
+    {
+        for (Local_Index = 0; Local_Index < LED_PWM_COUNT; Local_Index++)
+        {
+            (void)MCAL_TIM_SetCompare(LED_PwmMap[Local_Index].Timer, LED_PwmMap[Local_Index].Channel, LED_Compare(Local_Index));
+        }
+    }
+
+    SCB_ExitCritical(Local_PriMask);
+
+    return E_OK;
+}
+
+u8 HAL_LED_GetBrightness(void)
+{
+    return LED_Brightness;
+}
+
+Std_ReturnType HAL_LED_SeqStart(u8 Copy_Slot, LED_Port_t Copy_LedPortId, u16 Copy_PinMask, u16 Copy_InvertMask, const LED_SeqPattern_t *Copy_Pattern)
+{
+    LED_SeqSlot_t *Local_Slot;
+
+    if ((Copy_Slot >= LED_SEQ_SLOTS) || (Copy_Pattern == NULL) || (Copy_Pattern->Steps == NULL) || (Copy_Pattern->StepCount == 0))
+    {
+        return E_NOT_OK;
+    }
+
+    Local_Slot = &LED_SeqSlots[Copy_Slot];
+    Local_Slot->Pattern = Copy_Pattern;
+    Local_Slot->Port = Copy_LedPortId;
+    Local_Slot->Mask = Copy_PinMask;
+    Local_Slot->Invert = Copy_InvertMask & Copy_PinMask;
+    Local_Slot->RepeatsLeft = (Copy_Pattern->Repeats != LED_SEQ_FOREVER) ? (u8)(Copy_Pattern->Repeats - 1) : 0;
+    LED_SeqEnterStep(Local_Slot, 0);
+
+    return E_OK;
+}
+
+Std_ReturnType HAL_LED_SeqStop(u8 Copy_Slot, u8 Copy_Level)
+{
+    if (Copy_Slot >= LED_SEQ_SLOTS)
+    {
+        return E_NOT_OK;
+    }
+
+    if (LED_SeqSlots[Copy_Slot].Pattern != NULL)
+    {
+        LED_SeqSlots[Copy_Slot].Pattern = NULL;
+        LED_SeqOutput(&LED_SeqSlots[Copy_Slot], Copy_Level);
+    }
+
+    return E_OK;
+}
+
+u8 HAL_LED_SeqIsRunning(u8 Copy_Slot)
+{
+    return ((Copy_Slot < LED_SEQ_SLOTS) && (LED_SeqSlots[Copy_Slot].Pattern != NULL)) ? 1 : 0;
+}
+
+void HAL_LED_SeqTick(void)
+{
+    u8 Local_Index;
+    LED_SeqSlot_t *Local_Slot;
+
+    for (Local_Index = 0; Local_Index < LED_SEQ_SLOTS; Local_Index++)
+    {
+        Local_Slot = &LED_SeqSlots[Local_Index];
+
+        if ((Local_Slot->Pattern == NULL) || (--Local_Slot->TicksLeft != 0))
+        {
+            continue;
+        }
+
+        if ((Local_Slot->Step + 1) < Local_Slot->Pattern->StepCount)
+        {
+            LED_SeqEnterStep(Local_Slot, Local_Slot->Step + 1);
+        }
+        else if (Local_Slot->Pattern->Repeats == LED_SEQ_FOREVER)
+        {
+            LED_SeqEnterStep(Local_Slot, 0);
+        }
+        else if (Local_Slot->RepeatsLeft != 0)
+        {
+            Local_Slot->RepeatsLeft--;
+            LED_SeqEnterStep(Local_Slot, 0);
+        }
+        else
+        {
+            /**< Done: the LEDs keep the level of the last step */
+            Local_Slot->Pattern = NULL;
+        }
+    }
+}
+
+u16 HAL_LED_SeqGetTicksToNextStep(void)
+{
+    u8 Local_Index;
+    u16 Local_Ticks = LED_SEQ_NO_STEP;
+
+    for (Local_Index = 0; Local_Index < LED_SEQ_SLOTS; Local_Index++)
+    {
+        if ((LED_SeqSlots[Local_Index].Pattern != NULL) && (LED_SeqSlots[Local_Index].TicksLeft < Local_Ticks))
+        {
+            Local_Ticks = LED_SeqSlots[Local_Index].TicksLeft;
+        }
+    }
+
+    return Local_Ticks;
+}
+
 /**
  * @} // End of Public_Functions
  */
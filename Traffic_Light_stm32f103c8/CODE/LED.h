@@ -11,7 +11,33 @@
  *                     Configuration Section                    *
  ****************************************************************/
 
+/**
+ * @brief Dimming PWM: frequency in Hz (well above flicker fusion) and counts per period.
+ */
+#define LED_PWM_FREQ_HZ         1000
+#define LED_PWM_STEPS           1000
+
+/**
+ * @brief Lowest brightness in percent, so a lit lamp always stays visible.
+ */
+#define LED_MIN_BRIGHTNESS      10
+
+/**
+ * @brief LEDs driven by a timer channel: { port, pin, timer, channel, AFIO remap }.
+ *
+ * All entries of one timer must use the same remap. LEDs not listed are switched by GPIO
+ * only and always shine at full brightness.
+ */
+#define LED_PWM_MAP                                                             \
+    { LED_PORTA, LED_PIN1, TIM_TIMER2, TIM_CHANNEL2, AFIO_TIM_REMAP_NONE },     \
+    { LED_PORTA, LED_PIN2, TIM_TIMER2, TIM_CHANNEL3, AFIO_TIM_REMAP_NONE },     \
+    { LED_PORTA, LED_PIN3, TIM_TIMER2, TIM_CHANNEL4, AFIO_TIM_REMAP_NONE },     \
+    { LED_PORTB, LED_PIN1, TIM_TIMER3, TIM_CHANNEL4, AFIO_TIM_REMAP_NONE },
 
+/**
+ * @brief Number of patterns the sequencer can play at the same time.
+ */
+#define LED_SEQ_SLOTS           4
 
 /****************************************************************
  *                 End of Configuration Section                 *
@@ -37,6 +63,11 @@ typedef enum {
     LED_PORTC  /**< Port C */
 } LED_Port_t;
 
+/**
+ * @brief Number of LED ports, the size of the per-port arrays of LED_Group_t.
+ */
+#define LED_PORT_COUNT          3
+
 /**
  * @brief LED Pin Enumeration
  *
@@ -68,6 +99,50 @@ typedef enum {
  */
 typedef u32 LED_Delay_ms_t;
 
+/**
+ * @brief Brightness that leaves the PWM outputs constantly on.
+ */
+#define LED_BRIGHTNESS_FULL     100
+
+/**
+ * @brief A set of LEDs across ports: one pin mask per port, indexed by LED_Port_t.
+ *
+ * Also used for the levels of a group write (bit n of entry p = level of pin n of port p).
+ */
+typedef struct
+{
+    u16 Mask[LED_PORT_COUNT];
+} LED_Group_t;
+
+/**
+ * @brief Repeat count of a pattern that plays until it is stopped.
+ */
+#define LED_SEQ_FOREVER         0
+
+/**
+ * @brief Returned by HAL_LED_SeqGetTicksToNextStep when no pattern is playing.
+ */
+#define LED_SEQ_NO_STEP         0xFFFF
+
+/**
+ * @brief One step of a pattern: a level held for a number of sequencer ticks.
+ */
+typedef struct
+{
+    u8 Level;   /**< 1 on, 0 off */
+    u16 Ticks;  /**< Duration, at least 1 */
+} LED_SeqStep_t;
+
+/**
+ * @brief A pattern, normally a const object in flash.
+ */
+typedef struct
+{
+    const LED_SeqStep_t *Steps;
+    u8 StepCount;
+    u8 Repeats;     /**< Times the steps are played, or LED_SEQ_FOREVER */
+} LED_SeqPattern_t;
+
 /**
  * @} (LED_Parameters)
  */
@@ -114,7 +189,8 @@ Std_ReturnType HAL_LED_Off(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId);
 /**
  * @brief Toggle an LED
  *
- * Toggles the state of the specified LED.
+ * Toggles the state of the specified LED with a single store, computed from the port's
+ * output register.
  *
  * @param[in] Copy_LedPortId The ID of the LED port.
  * @param[in] Copy_LedPinId The ID of the LED pin.
@@ -126,6 +202,7 @@ Std_ReturnType HAL_LED_Toggle(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId
  * @brief Blink an LED Once
  *
  * Blinks the specified LED once with a specified delay.
+ * Blocks in a SysTick delay; use the sequencer (HAL_LED_SeqStart) from the control loop.
  *
  * @param[in] Copy_LedPortId The ID of the LED port.
  * @param[in] Copy_LedPinId The ID of the LED pin.
@@ -138,6 +215,7 @@ Std_ReturnType HAL_LED_BlinkOnce(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPi
  * @brief Blink an LED Twice
  *
  * Blinks the specified LED twice with a specified delay between blinks.
+ * Blocks in a SysTick delay; use the sequencer (HAL_LED_SeqStart) from the control loop.
  *
  * @param[in] Copy_LedPortId The ID of the LED port.
  * @param[in] Copy_LedPinId The ID of the LED pin.
@@ -146,6 +224,155 @@ Std_ReturnType HAL_LED_BlinkOnce(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPi
  */
 Std_ReturnType HAL_LED_BlinkTwice(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId, LED_Delay_ms_t Copy_BlinkTime);
 
+/**
+ * @brief Write several LEDs of one port with a single store.
+ *
+ * LEDs in LED_PWM_MAP follow through their compare value, the others through the output
+ * data register, so the same call works before and after HAL_LED_InitPwm.
+ *
+ * @param[in] Copy_LedPortId The ID of the LED port.
+ * @param[in] Copy_PinMask The LEDs to write, one bit per pin.
+ * @param[in] Copy_Value The new states, one bit per pin.
+ * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK if an error occurs.
+ */
+Std_ReturnType HAL_LED_WritePort(LED_Port_t Copy_LedPortId, u16 Copy_PinMask, u16 Copy_Value);
+
+/**
+ * @brief Hand the LEDs in LED_PWM_MAP over to their timer channels.
+ *
+ * The caller enables the timer clocks in RCC and AFIO. Each channel starts with the state
+ * last written, so no LED changes when its pin switches to the alternate function.
+ *
+ * @param[in] Copy_TimerClockFreq Clock of the timers in Hz.
+ * @return Std_ReturnType Returns E_OK if all channels are running, or E_NOT_OK if an error occurs.
+ */
+Std_ReturnType HAL_LED_InitPwm(u32 Copy_TimerClockFreq);
+
+/**
+ * @brief Move the LEDs in LED_PWM_MAP between their timer channels and plain GPIO.
+ *
+ * A timer stopped in STOP freezes its output at whatever level it had, so a dimmed LED would
+ * stay dark or lit at random. On GPIO the LEDs show the state last written at full brightness,
+ * and keep it with the clocks stopped. Writes keep both the compare values and the data
+ * register in step, so no LED changes at the switch.
+ *
+ * @param[in] Copy_Enable 1 for the timer channels, 0 for GPIO.
+ * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK before HAL_LED_InitPwm.
+ */
+Std_ReturnType HAL_LED_SetPwmOutputs(u8 Copy_Enable);
+
+/**
+ * @brief Drive a group of LEDs to the given levels.
+ *
+ * Each port with LEDs in the group gets exactly one store, so all its LEDs change together;
+ * ports without LEDs in the group are not written.
+ *
+ * @param[in] Copy_Group The LEDs to drive.
+ * @param[in] Copy_Levels The levels, only the bits inside the group are used.
+ * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK for a NULL argument.
+ */
+Std_ReturnType HAL_LED_GroupWrite(const LED_Group_t *Copy_Group, const LED_Group_t *Copy_Levels);
+
+/**
+ * @brief Turn on all LEDs of a group, one store per port.
+ *
+ * @param[in] Copy_Group The LEDs to turn on.
+ * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK for a NULL group.
+ */
+Std_ReturnType HAL_LED_GroupOn(const LED_Group_t *Copy_Group);
+
+/**
+ * @brief Turn off all LEDs of a group, one store per port.
+ *
+ * @param[in] Copy_Group The LEDs to turn off.
+ * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK for a NULL group.
+ */
+Std_ReturnType HAL_LED_GroupOff(const LED_Group_t *Copy_Group);
+
+/**
+ * @brief Toggle all LEDs of a group, one store per port.
+ *
+ * The new levels are computed from a snapshot of each port's output register and written
+ * back through the set/reset register, so pins outside the group are never touched.
+ *
+ * @param[in] Copy_Group The LEDs to toggle.
+ * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK for a NULL group.
+ */
+Std_ReturnType HAL_LED_GroupToggle(const LED_Group_t *Copy_Group);
+
+/**
+ * @brief Keep the PWM frequency after the timer clock changed.
+ *
+ * @param[in] Copy_TimerClockFreq The new clock of the timers in Hz.
+ * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK if an error occurs.
+ */
+Std_ReturnType HAL_LED_SetClockFreq(u32 Copy_TimerClockFreq);
+
+/**
+ * @brief Set the brightness of the lit LEDs in LED_PWM_MAP.
+ *
+ * Takes effect at the next PWM period, in hardware.
+ *
+ * @param[in] Copy_Percent LED_MIN_BRIGHTNESS .. LED_BRIGHTNESS_FULL; lower values are raised to the minimum.
+ * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK if an error occurs.
+ */
+Std_ReturnType HAL_LED_SetBrightness(u8 Copy_Percent);
+
+/**
+ * @brief Get the brightness set last.
+ *
+ * @return Brightness in percent.
+ */
+u8 HAL_LED_GetBrightness(void);
+
+/**
+ * @brief Start playing a pattern on a group of LEDs.
+ *
+ * All LEDs of the group switch with one write per step, so they stay phase-locked; LEDs in
+ * Copy_InvertMask take the opposite level (alternating pairs, active-low LEDs). The first
+ * step is output at once. A pattern already playing in the slot is replaced.
+ *
+ * @param[in] Copy_Slot 0 .. LED_SEQ_SLOTS - 1.
+ * @param[in] Copy_LedPortId The ID of the LED port.
+ * @param[in] Copy_PinMask The LEDs of the group, one bit per pin.
+ * @param[in] Copy_InvertMask The LEDs of the group driven inverted.
+ * @param[in] Copy_Pattern The pattern; must stay valid while it plays.
+ * @return Std_ReturnType Returns E_OK if the pattern started, or E_NOT_OK for an invalid slot or pattern.
+ */
+Std_ReturnType HAL_LED_SeqStart(u8 Copy_Slot, LED_Port_t Copy_LedPortId, u16 Copy_PinMask, u16 Copy_InvertMask, const LED_SeqPattern_t *Copy_Pattern);
+
+/**
+ * @brief Stop the pattern of a slot and leave its LEDs at a level.
+ *
+ * @param[in] Copy_Slot 0 .. LED_SEQ_SLOTS - 1.
+ * @param[in] Copy_Level 1 on, 0 off (inverted LEDs take the opposite level).
+ * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK for an invalid slot.
+ */
+Std_ReturnType HAL_LED_SeqStop(u8 Copy_Slot, u8 Copy_Level);
+
+/**
+ * @brief Check whether a slot still plays its pattern.
+ *
+ * @param[in] Copy_Slot 0 .. LED_SEQ_SLOTS - 1.
+ * @return 1 while playing, 0 when finished, stopped or invalid.
+ */
+u8 HAL_LED_SeqIsRunning(u8 Copy_Slot);
+
+/**
+ * @brief Advance all playing patterns by one tick.
+ *
+ * Call at a fixed rate, from the same context as the other LED writes. A slot costs a
+ * decrement per tick and one port write per step.
+ */
+void HAL_LED_SeqTick(void);
+
+/**
+ * @brief Get the ticks until the next step of any playing pattern, so a tickless idle can wake for it.
+ *
+ * @return Ticks, at least 1, or LED_SEQ_NO_STEP if nothing is playing.
+ */
+u16 HAL_LED_SeqGetTicksToNextStep(void);
+
 /**
  * @} (end of LED_Functions)
  */
@@ -158,7 +385,31 @@ Std_ReturnType HAL_LED_BlinkTwice(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedP
  *                     Private Section                          *
  ****************************************************************/
 
+/**
+ * @brief One entry of LED_PWM_MAP.
+ */
+typedef struct
+{
+    LED_Port_t Port;
+    LED_Pin_t Pin;
+    u8 Timer;       /**< TIM_TIMERx */
+    u8 Channel;     /**< TIM_CHANNELx */
+    u8 Remap;       /**< AFIO_TIM_REMAP_x */
+} LED_PwmMap_t;
 
+/**
+ * @brief Run-time state of a sequencer slot.
+ */
+typedef struct
+{
+    const LED_SeqPattern_t *Pattern;    /**< NULL when idle */
+    LED_Port_t Port;
+    u16 Mask;
+    u16 Invert;
+    u16 TicksLeft;      /**< Ticks until the next step */
+    u8 Step;
+    u8 RepeatsLeft;     /**< Plays left after the current one, unused with LED_SEQ_FOREVER */
+} LED_SeqSlot_t;
 
 
 /****************************************************************
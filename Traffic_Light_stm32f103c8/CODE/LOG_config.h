@@ -0,0 +1,24 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : LOG_config.h               *****************/
+/****************************************************************/
+#ifndef LOG_CONFIG_H_
+#define LOG_CONFIG_H_
+
+/**
+ * @brief First flash page of the log area and number of pages in it.
+ *
+ * The pages are used round-robin, so each one is erased once every LOG_PAGE_COUNT page
+ * fills. The area must stay outside the linker's ROM region (IROM in the project options).
+ */
+#define LOG_FIRST_PAGE      56
+#define LOG_PAGE_COUNT      8
+
+/**
+ * @brief Records buffered in RAM until LOG_Drain writes them. Must be a power of two.
+ */
+#define LOG_QUEUE_SIZE      16
+
+#endif /**< LOG_CONFIG_H_ */
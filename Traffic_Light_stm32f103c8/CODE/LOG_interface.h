@@ -0,0 +1,116 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : LOG_interface.h            *****************/
+/****************************************************************/
+#ifndef LOG_INTERFACE_H_
+#define LOG_INTERFACE_H_
+
+/**
+ * @defgroup LOG_Types LOG Type Definitions
+ * @{
+ */
+
+/**
+ * @name Event IDs
+ * @{
+ */
+#define LOG_EVT_BOOT            0x01    /**< Arg = clock bring-up status */
+#define LOG_EVT_SAFETY_FAULT    0x02    /**< The safety monitor latched flashing red */
+#define LOG_EVT_PLAN            0x03    /**< A new timing plan took over */
+#define LOG_EVT_WAKE_SLOW       0x04    /**< Value = wake-up latency from STOP in us (saturated), over the bound */
+#define LOG_EVT_PREEMPT         0x05    /**< An emergency vehicle preemption started */
+/** @} */
+
+/**
+ * @brief One log record.
+ */
+typedef struct
+{
+    u32 Time;       /**< Caller's time stamp */
+    u8 Id;          /**< LOG_EVT_x */
+    u8 Arg;         /**< Event specific */
+    u16 Value;      /**< Event specific */
+} LOG_Record_t;
+
+/**
+ * @brief Reports whether the core may stall on flash now. Called with interrupts disabled.
+ */
+typedef u8 (*LOG_StallCheck_t)(void);
+
+/** @} */ // End of LOG_Types
+
+/**
+ * @defgroup LOG_Functions LOG Functions
+ * @brief Append-only event log in internal flash that survives power cycles.
+ *
+ * Records are queued in RAM from any context and written by LOG_Drain from the idle
+ * part of the main loop, one bounded flash operation per call. The log fills its pages
+ * round-robin and overwrites the oldest page once all are full, so every page sees the
+ * same number of erases. A power failure at any point loses at most the record or page
+ * header being written.
+ * @{
+ */
+
+/**
+ * @brief Find the head of the log and unlock the flash controller.
+ *
+ * @return E_OK if the log can be written, E_NOT_OK if the flash controller stays locked.
+ */
+Std_ReturnType LOG_Init(void);
+
+/**
+ * @brief Queue a record.
+ *
+ * @param[in] Copy_Id The event ID.
+ * @param[in] Copy_Arg Event specific.
+ * @param[in] Copy_Value Event specific.
+ * @param[in] Copy_Time Caller's time stamp.
+ *
+ * @return E_OK if the record was queued, E_NOT_OK if the queue was full or the log failed.
+ */
+Std_ReturnType LOG_Append(u8 Copy_Id, u8 Copy_Arg, u16 Copy_Value, u32 Copy_Time);
+
+/**
+ * @brief Do one step of flash work: write one record, or erase and open the next page.
+ *
+ * Call from idle time. A record costs five half-word programs (about 0.3 ms), opening a
+ * page one erase and six programs (up to about 40 ms), during which the core stalls and
+ * no interrupt served from flash runs. The step is taken only if Copy_MayStall allows it,
+ * checked and started with interrupts disabled, so nothing the check relies on can change
+ * before the flash is busy; otherwise the records stay queued for a later call.
+ *
+ * @param[in] Copy_MayStall Decides whether the stall is harmless now.
+ *
+ * @return None.
+ */
+void LOG_Drain(LOG_StallCheck_t Copy_MayStall);
+
+/**
+ * @brief Check whether the queue is empty.
+ *
+ * @return 1 if every queued record is in flash (or the log failed), 0 otherwise.
+ */
+u8 LOG_IsIdle(void);
+
+/**
+ * @brief Read the log from the oldest record to the newest.
+ *
+ * @param[in,out] Copy_Cursor Set to 0 for the oldest record, advanced past the record returned.
+ * @param[out] Copy_Record The record.
+ *
+ * @return E_OK if a record was returned, E_NOT_OK past the newest one.
+ */
+Std_ReturnType LOG_Read(u32 *Copy_Cursor, LOG_Record_t *Copy_Record);
+
+/**
+ * @brief Get the number of records lost because the queue was full.
+ *
+ * @return The drop count since LOG_Init.
+ */
+u32 LOG_GetDroppedCount(void);
+
+/** @} */ // End of LOG_Functions
+
+#endif /**< LOG_INTERFACE_H_ */
@@ -0,0 +1,64 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : LOG_private.h              *****************/
+/****************************************************************/
+#ifndef LOG_PRIVATE_H_
+#define LOG_PRIVATE_H_
+
+#if (LOG_FIRST_PAGE + LOG_PAGE_COUNT) > FLASH_PAGE_COUNT
+#error "The log area does not fit in main memory"
+#endif
+
+#if (LOG_PAGE_COUNT < 2) || (LOG_QUEUE_SIZE & (LOG_QUEUE_SIZE - 1))
+#error "The log needs at least two pages and a power-of-two queue"
+#endif
+
+#define LOG_QUEUE_MASK          (LOG_QUEUE_SIZE - 1)
+
+/**
+ * Page layout, in half-words:
+ *
+ *     magic  sequence_low  sequence_high  ~sequence_low  ~sequence_high  | record 0 | record 1 | ...
+ *
+ * The magic is programmed last, and cleared to 0x0000 before the page is erased again,
+ * so a page whose erase or header write was cut short never looks valid. An erase only
+ * turns bits to 1, so a partly erased header also breaks the complement. The valid page
+ * with the highest sequence number is the head.
+ */
+#define LOG_MAGIC                   0x4C47  /**< "LG" */
+#define LOG_MAGIC_CLEARED           0x0000
+#define LOG_HEADER_MAGIC            0
+#define LOG_HEADER_SEQUENCE_LOW     1
+#define LOG_HEADER_SEQUENCE_HIGH    2
+#define LOG_HEADER_INVERSE_LOW      3
+#define LOG_HEADER_INVERSE_HIGH     4
+#define LOG_HEADER_HALFWORDS        5
+
+/**
+ * Record layout, in half-words:
+ *
+ *     check  (id | arg << 8)  value  time_low  time_high
+ *
+ * The check half-word is programmed last and commits the record: a slot is a record only
+ * if its check matches the other four, which also rejects a commit or an erase cut short.
+ */
+#define LOG_RECORD_CHECK            0
+#define LOG_RECORD_ID_ARG           1
+#define LOG_RECORD_VALUE            2
+#define LOG_RECORD_TIME_LOW         3
+#define LOG_RECORD_TIME_HIGH        4
+#define LOG_RECORD_HALFWORDS        5
+#define LOG_SLOTS_PER_PAGE          (((FLASH_PAGE_SIZE / 2) - LOG_HEADER_HALFWORDS) / LOG_RECORD_HALFWORDS)
+
+/**< Seed of the record check */
+#define LOG_CHECK_SEED              0x4C47
+
+#define LOG_PAGE_ADDRESS(INDEX)         FLASH_PAGE_ADDRESS(LOG_FIRST_PAGE + (INDEX))
+#define LOG_SLOT_ADDRESS(INDEX, SLOT)   (LOG_PAGE_ADDRESS(INDEX) + (2 * (LOG_HEADER_HALFWORDS + ((u32)(SLOT) * LOG_RECORD_HALFWORDS))))
+
+/**< Half-word view of flash */
+#define LOG_HALFWORDS(ADDRESS)  ((const volatile u16 *)(ADDRESS))
+
+#endif /**< LOG_PRIVATE_H_ */
@@ -0,0 +1,306 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : LOG_program.c              *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "FLASH_interface.h"
+#include "SCB_interface.h"
+/*****************************< SERVICE *****************************/
+#include "LOG_interface.h"
+#include "LOG_config.h"
+#include "LOG_private.h"
+/*****************************< Private Variables *****************************/
+static LOG_Record_t LOG_Queue[LOG_QUEUE_SIZE];
+static volatile u32 LOG_QueueHead = 0;      /**< Free-running write index */
+static volatile u32 LOG_QueueTail = 0;      /**< Free-running read index, advanced by LOG_Drain */
+static u32 LOG_Dropped = 0;
+static u8 LOG_HeadPage = 0;                 /**< Page index (0 .. LOG_PAGE_COUNT - 1) being filled */
+static u16 LOG_NextSlot = 0;                /**< First free slot of the head page */
+static u32 LOG_Sequence = 0;                /**< Sequence number of the head page */
+static u8 LOG_Failed = 1;                   /**< Flash unusable: records are dropped */
+/*****************************< Private Functions *****************************/
+static u16 LOG_Check(const u16 *Copy_Body)
+{
+    u16 Local_Check = LOG_CHECK_SEED;
+    u8 Local_Index;
+
+    for (Local_Index = 0; Local_Index < (LOG_RECORD_HALFWORDS - 1); Local_Index++)
+    {
+        Local_Check = (u16)(((Local_Check << 1) | (Local_Check >> 15)) ^ Copy_Body[Local_Index]);
+    }
+
+    /**< An erased check half-word means "no record" */
+    return (Local_Check == FLASH_ERASED_HALFWORD) ? 0 : Local_Check;
+}
+
+static Std_ReturnType LOG_ReadHeader(u8 Copy_Page, u32 *Copy_Sequence)
+{
+    const volatile u16 *Local_Header = LOG_HALFWORDS(LOG_PAGE_ADDRESS(Copy_Page));
+
+    /**< A half-word XOR its complement is all ones */
+    if ((Local_Header[LOG_HEADER_MAGIC] != LOG_MAGIC) ||
+        ((Local_Header[LOG_HEADER_SEQUENCE_LOW] ^ Local_Header[LOG_HEADER_INVERSE_LOW]) != 0xFFFF) ||
+        ((Local_Header[LOG_HEADER_SEQUENCE_HIGH] ^ Local_Header[LOG_HEADER_INVERSE_HIGH]) != 0xFFFF))
+    {
+        return E_NOT_OK;
+    }
+
+    *Copy_Sequence = Local_Header[LOG_HEADER_SEQUENCE_LOW] | ((u32)Local_Header[LOG_HEADER_SEQUENCE_HIGH] << 16);
+
+    return E_OK;
+}
+
+static u16 LOG_FindFreeSlot(u8 Copy_Page)
+{
+    const volatile u16 *Local_Slot;
+    u16 Local_SlotIndex = LOG_SLOTS_PER_PAGE;
+    u8 Local_Index;
+
+    /**< The free slots are the erased tail of the page; a torn record is skipped, not reused */
+    while (Local_SlotIndex > 0)
+    {
+        Local_Slot = LOG_HALFWORDS(LOG_SLOT_ADDRESS(Copy_Page, Local_SlotIndex - 1));
+        for (Local_Index = 0; Local_Index < LOG_RECORD_HALFWORDS; Local_Index++)
+        {
+            if (Local_Slot[Local_Index] != FLASH_ERASED_HALFWORD)
+            {
+                return Local_SlotIndex;
+            }
+        }
+        Local_SlotIndex--;
+    }
+
+    return 0;
+}
+
+static Std_ReturnType LOG_OpenNextPage(void)
+{
+    u8 Local_Page = (u8)((LOG_HeadPage + 1) % LOG_PAGE_COUNT);
+    u32 Local_Sequence = LOG_Sequence + 1;
+    u32 Local_Address = LOG_PAGE_ADDRESS(Local_Page);
+    u16 Local_Header[LOG_HEADER_HALFWORDS];
+
+    /**< Invalidate the oldest page before erasing it; programming 0x0000 is allowed over any value */
+    Local_Header[LOG_HEADER_MAGIC] = LOG_MAGIC_CLEARED;
+    if ((LOG_HALFWORDS(Local_Address)[LOG_HEADER_MAGIC] != FLASH_ERASED_HALFWORD) &&
+        (MCAL_FLASH_ProgramHalfWords(Local_Address, &Local_Header[LOG_HEADER_MAGIC], 1) != E_OK))
+    {
+        return E_NOT_OK;
+    }
+
+    if (MCAL_FLASH_ErasePage(Local_Address) != E_OK)
+    {
+        return E_NOT_OK;
+    }
+
+    /**< Sequence first, magic last */
+    Local_Header[LOG_HEADER_MAGIC] = LOG_MAGIC;
+    Local_Header[LOG_HEADER_SEQUENCE_LOW] = (u16)Local_Sequence;
+    Local_Header[LOG_HEADER_SEQUENCE_HIGH] = (u16)(Local_Sequence >> 16);
+    Local_Header[LOG_HEADER_INVERSE_LOW] = (u16)~Local_Sequence;
+    Local_Header[LOG_HEADER_INVERSE_HIGH] = (u16)(~Local_Sequence >> 16);
+
+    if ((MCAL_FLASH_ProgramHalfWords(Local_Address + (2 * LOG_HEADER_SEQUENCE_LOW), &Local_Header[LOG_HEADER_SEQUENCE_LOW], LOG_HEADER_HALFWORDS - 1) != E_OK) ||
+        (MCAL_FLASH_ProgramHalfWords(Local_Address + (2 * LOG_HEADER_MAGIC), &Local_Header[LOG_HEADER_MAGIC], 1) != E_OK))
+    {
+        return E_NOT_OK;
+    }
+
+    LOG_HeadPage = Local_Page;
+    LOG_Sequence = Local_Sequence;
+    LOG_NextSlot = 0;
+
+    return E_OK;
+}
+
+static void LOG_WriteStep(void)
+{
+    const LOG_Record_t *Local_Record;
+    u16 Local_Data[LOG_RECORD_HALFWORDS];
+    u32 Local_Address;
+
+    /**< Opening a page is a step of its own: the erase is the longest stall */
+    if (LOG_NextSlot >= LOG_SLOTS_PER_PAGE)
+    {
+        if (LOG_OpenNextPage() != E_OK)
+        {
+            LOG_Failed = 1;
+        }
+        return;
+    }
+
+    Local_Record = &LOG_Queue[LOG_QueueTail & LOG_QUEUE_MASK];
+    Local_Data[LOG_RECORD_ID_ARG] = (u16)(Local_Record->Id | (Local_Record->Arg << 8));
+    Local_Data[LOG_RECORD_VALUE] = Local_Record->Value;
+    Local_Data[LOG_RECORD_TIME_LOW] = (u16)Local_Record->Time;
+    Local_Data[LOG_RECORD_TIME_HIGH] = (u16)(Local_Record->Time >> 16);
+    Local_Data[LOG_RECORD_CHECK] = LOG_Check(&Local_Data[LOG_RECORD_ID_ARG]);
+
+    Local_Address = LOG_SLOT_ADDRESS(LOG_HeadPage, LOG_NextSlot);
+    LOG_NextSlot++;
+
+    /**< Body in one batch, then the committing check; a failed slot is skipped and the record retried */
+    if ((MCAL_FLASH_ProgramHalfWords(Local_Address + (2 * LOG_RECORD_ID_ARG), &Local_Data[LOG_RECORD_ID_ARG], LOG_RECORD_HALFWORDS - 1) == E_OK) &&
+        (MCAL_FLASH_ProgramHalfWords(Local_Address + (2 * LOG_RECORD_CHECK), &Local_Data[LOG_RECORD_CHECK], 1) == E_OK))
+    {
+        LOG_QueueTail++;
+    }
+}
+/*****************************< Function Implementations *****************************/
+Std_ReturnType LOG_Init(void)
+{
+    u32 Local_Sequence;
+    u8 Local_Found = 0;
+    u8 Local_Page;
+
+    LOG_QueueHead = 0;
+    LOG_QueueTail = 0;
+    LOG_Dropped = 0;
+
+    /**< Nothing valid: pretend the last page is full, so the first record opens page 0 with sequence 0 */
+    LOG_HeadPage = LOG_PAGE_COUNT - 1;
+    LOG_Sequence = 0xFFFFFFFFUL;
+    LOG_NextSlot = LOG_SLOTS_PER_PAGE;
+
+    for (Local_Page = 0; Local_Page < LOG_PAGE_COUNT; Local_Page++)
+    {
+        if (LOG_ReadHeader(Local_Page, &Local_Sequence) != E_OK)
+        {
+            continue;
+        }
+
+        if (!Local_Found || ((s32)(Local_Sequence - LOG_Sequence) > 0))
+        {
+            LOG_HeadPage = Local_Page;
+            LOG_Sequence = Local_Sequence;
+            Local_Found = 1;
+        }
+    }
+
+    if (Local_Found)
+    {
+        LOG_NextSlot = LOG_FindFreeSlot(LOG_HeadPage);
+    }
+
+    LOG_Failed = (MCAL_FLASH_Unlock() == E_OK) ? 0 : 1;
+
+    return LOG_Failed ? E_NOT_OK : E_OK;
+}
+
+Std_ReturnType LOG_Append(u8 Copy_Id, u8 Copy_Arg, u16 Copy_Value, u32 Copy_Time)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u32 Local_PriMask;
+    LOG_Record_t *Local_Record;
+
+    if (LOG_Failed)
+    {
+        return E_NOT_OK;
+    }
+
+    Local_PriMask = SCB_EnterCritical();
+
+    if ((LOG_QueueHead - LOG_QueueTail) < LOG_QUEUE_SIZE)
+    {
+        Local_Record = &LOG_Queue[LOG_QueueHead & LOG_QUEUE_MASK];
+        Local_Record->Time = Copy_Time;
+        Local_Record->Id = Copy_Id;
+        Local_Record->Arg = Copy_Arg;
+        Local_Record->Value = Copy_Value;
+        LOG_QueueHead++;
+        Local_FunctionStatus = E_OK;
+    }
+    else
+    {
+        LOG_Dropped++;
+    }
+
+    SCB_ExitCritical(Local_PriMask);
+
+    return Local_FunctionStatus;
+}
+
+void LOG_Drain(LOG_StallCheck_t Copy_MayStall)
+{
+    u32 Local_PriMask;
+
+    if (LOG_Failed || (LOG_QueueHead == LOG_QueueTail) || (Copy_MayStall == NULL))
+    {
+        return;
+    }
+
+    /**< An interrupt due after the check waits for the flash anyway; masked, it cannot change what was checked */
+    Local_PriMask = SCB_EnterCritical();
+    if (Copy_MayStall())
+    {
+        LOG_WriteStep();
+    }
+    SCB_ExitCritical(Local_PriMask);
+}
+
+u8 LOG_IsIdle(void)
+{
+    return (LOG_Failed || (LOG_QueueHead == LOG_QueueTail)) ? 1 : 0;
+}
+
+Std_ReturnType LOG_Read(u32 *Copy_Cursor, LOG_Record_t *Copy_Record)
+{
+    const volatile u16 *Local_Slot;
+    u16 Local_Data[LOG_RECORD_HALFWORDS];
+    u32 Local_Sequence;
+    u32 Local_Offset;
+    u32 Local_SlotIndex;
+    u8 Local_Page;
+    u8 Local_Index;
+
+    if ((Copy_Cursor == NULL) || (Copy_Record == NULL))
+    {
+        return E_NOT_OK;
+    }
+
+    /**< The cursor counts slots starting at the page after the head, which is the oldest one */
+    for (; *Copy_Cursor < (LOG_PAGE_COUNT * LOG_SLOTS_PER_PAGE); (*Copy_Cursor)++)
+    {
+        Local_Offset = *Copy_Cursor / LOG_SLOTS_PER_PAGE;
+        Local_SlotIndex = *Copy_Cursor % LOG_SLOTS_PER_PAGE;
+        Local_Page = (u8)((LOG_HeadPage + 1 + Local_Offset) % LOG_PAGE_COUNT);
+
+        if (LOG_ReadHeader(Local_Page, &Local_Sequence) != E_OK)
+        {
+            /**< Never written or torn: skip the whole page */
+            *Copy_Cursor = ((Local_Offset + 1) * LOG_SLOTS_PER_PAGE) - 1;
+            continue;
+        }
+
+        Local_Slot = LOG_HALFWORDS(LOG_SLOT_ADDRESS(Local_Page, Local_SlotIndex));
+        for (Local_Index = 0; Local_Index < LOG_RECORD_HALFWORDS; Local_Index++)
+        {
+            Local_Data[Local_Index] = Local_Slot[Local_Index];
+        }
+
+        /**< Free, torn and partly erased slots fail the check */
+        if (Local_Data[LOG_RECORD_CHECK] == LOG_Check(&Local_Data[LOG_RECORD_ID_ARG]))
+        {
+            Copy_Record->Id = (u8)Local_Data[LOG_RECORD_ID_ARG];
+            Copy_Record->Arg = (u8)(Local_Data[LOG_RECORD_ID_ARG] >> 8);
+            Copy_Record->Value = Local_Data[LOG_RECORD_VALUE];
+            Copy_Record->Time = Local_Data[LOG_RECORD_TIME_LOW] | ((u32)Local_Data[LOG_RECORD_TIME_HIGH] << 16);
+            (*Copy_Cursor)++;
+            return E_OK;
+        }
+    }
+
+    return E_NOT_OK;
+}
+
+u32 LOG_GetDroppedCount(void)
+{
+    return LOG_Dropped;
+}
+/*****************************< End of Function Implementations *****************************/
@@ -0,0 +1,42 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : NIGHT_config.h            *****************/
+/****************************************************************/
+#ifndef NIGHT_CONFIG_H_
+#define NIGHT_CONFIG_H_
+
+/**
+ * @brief Quiet time in milliseconds that starts low-demand operation.
+ *
+ * Low demand begins after this long without a pedestrian request, and ends when two
+ * requests come closer together than this. Time spent in STOP counts as quiet.
+ */
+#define NIGHT_QUIET_MS              600000
+
+/**
+ * @brief Bound in microseconds from the button edge to the first signal change after STOP.
+ *
+ * A wake-up that takes longer disables STOP; the controller then idles in WFI sleep only.
+ */
+#define NIGHT_WAKE_BOUND_US         1000
+
+/**
+ * @brief Time in microseconds from the edge to the first instruction of the button interrupt.
+ *
+ * Not measurable by the cycle counter: tWUSTOP (5.4 us with the low-power regulator) plus
+ * the HSI, SysTick and tick grid restart that runs before the interrupt is taken.
+ */
+#define NIGHT_STOP_EXIT_US          20
+
+/**
+ * @brief Lamp brightness in percent by day and under low demand.
+ *
+ * The PWM timers stop with the clocks, so the parked lamps shine at full level on GPIO
+ * while in STOP and are dimmed again once awake.
+ */
+#define NIGHT_DAY_BRIGHTNESS        100
+#define NIGHT_LOW_DEMAND_BRIGHTNESS 30
+
+#endif /**< NIGHT_CONFIG_H_ */
@@ -0,0 +1,99 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : NIGHT_interface.h         *****************/
+/****************************************************************/
+#ifndef NIGHT_INTERFACE_H_
+#define NIGHT_INTERFACE_H_
+
+/**
+ * @defgroup NIGHT_Functions NIGHT Functions
+ * @brief Low-demand operation: park the signals and wait for a request in STOP.
+ *
+ * After NIGHT_QUIET_MS without a pedestrian request the engine holds its park phase
+ * (PHASE_SetLowDemand). While it is parked and nothing else is pending the main loop
+ * enters STOP through NIGHT_Stop, and the button EXTI line wakes the chip. The first
+ * control step then runs on HSI, before the main loop restores the configured clock,
+ * so the wake-up latency does not include the HSE start-up. Each wake-up by the button
+ * is timed from the edge to the first signal change and checked against NIGHT_WAKE_BOUND_US.
+ * @{
+ */
+
+/**
+ * @brief Start in normal operation.
+ *
+ * @return None.
+ */
+void NIGHT_Init(void);
+
+/**
+ * @brief Advance the quiet time. Call once per control tick, before PHASE_Tick.
+ *
+ * @return None.
+ */
+void NIGHT_Tick(void);
+
+/**
+ * @brief Note a pedestrian request. Called from the button interrupt.
+ *
+ * @param[in] Copy_EntryCycles DWT cycle count at the interrupt entry.
+ *
+ * @return None.
+ */
+void NIGHT_OnRequest(u32 Copy_EntryCycles);
+
+/**
+ * @brief Check whether the main loop may enter STOP now.
+ *
+ * @return 1 under low demand while parked, STOP has met its bound so far and no wake-up is
+ *         being timed; 0 otherwise.
+ */
+u8 NIGHT_CanStop(void);
+
+/**
+ * @brief Enter STOP through TICK_Stop.
+ *
+ * @param[in] Copy_HasWork Work check passed to TICK_Stop.
+ *
+ * @return E_OK after a wake-up (the core runs from HSI), E_NOT_OK if STOP was not entered.
+ */
+Std_ReturnType NIGHT_Stop(TICK_WorkCheck_t Copy_HasWork);
+
+/**
+ * @brief Note that the signal image changed. Call after the new image reached the pins.
+ *
+ * Completes the timing of a wake-up by the button.
+ *
+ * @return E_NOT_OK if this change ended a wake-up that missed NIGHT_WAKE_BOUND_US (STOP is
+ *         disabled from then on), E_OK otherwise.
+ */
+Std_ReturnType NIGHT_OnSignalsChanged(void);
+
+/**
+ * @brief Get the wake-up latencies measured so far.
+ *
+ * @param[out] Copy_LastUs The latest, 0 before the first wake-up by the button.
+ * @param[out] Copy_MaxUs The longest.
+ *
+ * @return E_OK on success, E_NOT_OK for a NULL pointer.
+ */
+Std_ReturnType NIGHT_GetWakeLatency(u32 *Copy_LastUs, u32 *Copy_MaxUs);
+
+/**
+ * @brief Check whether low-demand operation is active.
+ *
+ * @return 1 under low demand, 0 otherwise.
+ */
+u8 NIGHT_IsLowDemand(void);
+
+/**
+ * @brief Get the lamp brightness for the current demand.
+ *
+ * @return NIGHT_LOW_DEMAND_BRIGHTNESS under low demand, NIGHT_DAY_BRIGHTNESS otherwise.
+ */
+u8 NIGHT_GetBrightness(void);
+
+/** @} */ // End of NIGHT_Functions
+
+#endif /**< NIGHT_INTERFACE_H_ */
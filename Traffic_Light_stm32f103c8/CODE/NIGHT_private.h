@@ -0,0 +1,13 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : NIGHT_private.h           *****************/
+/****************************************************************/
+#ifndef NIGHT_PRIVATE_H_
+#define NIGHT_PRIVATE_H_
+
+/**< Quiet time in control ticks */
+#define NIGHT_QUIET_TICKS           ((u32)(NIGHT_QUIET_MS / PHASE_TICK_MS))
+
+#endif /**< NIGHT_PRIVATE_H_ */
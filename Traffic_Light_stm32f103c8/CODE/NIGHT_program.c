@@ -0,0 +1,162 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : NIGHT_program.c           *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "DWT_interface.h"
+#include "RCC_interface.h"
+/*****************************< SERVICE *****************************/
+#include "TICK_interface.h"
+/*****************************< APP *****************************/
+#include "PHASE_interface.h"
+#include "PHASE_config.h"
+#include "NIGHT_interface.h"
+#include "NIGHT_config.h"
+#include "NIGHT_private.h"
+/*****************************< Private Variables *****************************/
+static u32 NIGHT_QuietTicks = 0;            /**< Control ticks since the last request */
+static u8 NIGHT_LowDemand = 0;
+static u8 NIGHT_StopAllowed = 1;            /**< Cleared for good by a wake-up over the bound */
+static volatile u8 NIGHT_RequestSeen = 0;   /**< Set by the button interrupt, taken by NIGHT_Tick */
+static volatile u8 NIGHT_Stopped = 0;       /**< STOP entered and not yet woken by the button */
+static volatile u8 NIGHT_Measuring = 0;     /**< A wake-up is being timed */
+static volatile u32 NIGHT_EdgeCycles = 0;   /**< Cycle count at the interrupt of that wake-up */
+static volatile u32 NIGHT_EdgeHclkFreq = 0; /**< Core clock at that moment */
+static u32 NIGHT_LastLatencyUs = 0;
+static u32 NIGHT_MaxLatencyUs = 0;
+/*****************************< Function Implementations *****************************/
+void NIGHT_Init(void)
+{
+    NIGHT_QuietTicks = 0;
+    NIGHT_LowDemand = 0;
+    NIGHT_StopAllowed = 1;
+    NIGHT_RequestSeen = 0;
+    NIGHT_Stopped = 0;
+    NIGHT_Measuring = 0;
+    PHASE_SetLowDemand(0);
+}
+
+void NIGHT_Tick(void)
+{
+    if (NIGHT_RequestSeen)
+    {
+        NIGHT_RequestSeen = 0;
+
+        /**< Requests closer together than the quiet time mean demand is back */
+        if (NIGHT_LowDemand && (NIGHT_QuietTicks < NIGHT_QUIET_TICKS))
+        {
+            NIGHT_LowDemand = 0;
+            PHASE_SetLowDemand(0);
+        }
+        NIGHT_QuietTicks = 0;
+    }
+    else if (NIGHT_QuietTicks < NIGHT_QUIET_TICKS)
+    {
+        NIGHT_QuietTicks++;
+    }
+    else if (!NIGHT_LowDemand)
+    {
+        NIGHT_LowDemand = 1;
+        PHASE_SetLowDemand(1);
+    }
+}
+
+void NIGHT_OnRequest(u32 Copy_EntryCycles)
+{
+    if (NIGHT_Stopped)
+    {
+        NIGHT_Stopped = 0;
+        NIGHT_EdgeCycles = Copy_EntryCycles;
+        NIGHT_EdgeHclkFreq = MCAL_RCC_GetSysClockFreq();
+        NIGHT_Measuring = 1;
+    }
+
+    NIGHT_RequestSeen = 1;
+}
+
+u8 NIGHT_CanStop(void)
+{
+    return (NIGHT_LowDemand && NIGHT_StopAllowed && !NIGHT_Measuring && PHASE_IsParked()) ? 1 : 0;
+}
+
+Std_ReturnType NIGHT_Stop(TICK_WorkCheck_t Copy_HasWork)
+{
+    Std_ReturnType Local_Status;
+
+    NIGHT_Stopped = 1;
+    Local_Status = TICK_Stop(Copy_HasWork);
+    NIGHT_Stopped = 0;
+
+    if (Local_Status == E_OK)
+    {
+        /**< No ticks counted while stopped; the time asleep was quiet */
+        NIGHT_QuietTicks = NIGHT_QUIET_TICKS;
+    }
+
+    return Local_Status;
+}
+
+Std_ReturnType NIGHT_OnSignalsChanged(void)
+{
+    u32 Local_HclkFreq;
+    u32 Local_LatencyUs;
+
+    if (!NIGHT_Measuring)
+    {
+        return E_OK;
+    }
+    NIGHT_Measuring = 0;
+
+    /**< Converted at the slower clock if it changed in between, which can only overstate */
+    Local_HclkFreq = MCAL_RCC_GetSysClockFreq();
+    if (NIGHT_EdgeHclkFreq < Local_HclkFreq)
+    {
+        Local_HclkFreq = NIGHT_EdgeHclkFreq;
+    }
+    Local_HclkFreq = (Local_HclkFreq >= 1000000) ? (Local_HclkFreq / 1000000) : 1;
+
+    Local_LatencyUs = ((MCAL_DWT_GetCycles() - NIGHT_EdgeCycles) / Local_HclkFreq) + NIGHT_STOP_EXIT_US;
+    NIGHT_LastLatencyUs = Local_LatencyUs;
+    if (Local_LatencyUs > NIGHT_MaxLatencyUs)
+    {
+        NIGHT_MaxLatencyUs = Local_LatencyUs;
+    }
+
+    if (Local_LatencyUs > NIGHT_WAKE_BOUND_US)
+    {
+        NIGHT_StopAllowed = 0;
+        return E_NOT_OK;
+    }
+
+    return E_OK;
+}
+
+Std_ReturnType NIGHT_GetWakeLatency(u32 *Copy_LastUs, u32 *Copy_MaxUs)
+{
+    if ((Copy_LastUs == NULL) || (Copy_MaxUs == NULL))
+    {
+        return E_NOT_OK;
+    }
+
+    *Copy_LastUs = NIGHT_LastLatencyUs;
+    *Copy_MaxUs = NIGHT_MaxLatencyUs;
+
+    return E_OK;
+}
+
+u8 NIGHT_IsLowDemand(void)
+{
+    return NIGHT_LowDemand;
+}
+
+u8 NIGHT_GetBrightness(void)
+{
+    return NIGHT_LowDemand ? NIGHT_LOW_DEMAND_BRIGHTNESS : NIGHT_DAY_BRIGHTNESS;
+}
+/*****************************< End of Function Implementations *****************************/
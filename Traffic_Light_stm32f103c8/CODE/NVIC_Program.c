@@ -258,11 +258,13 @@ Std_ReturnType MCAL_NVIC_vSetPriority(IRQn_Type Copy_IRQn, u8 Copy_GroupPriority
     /**< Clear the bits that control the priority for the given interrupt */
     RegValue &= ~(0xFF << BitPosition);
 
-    /**< Set the priority in the appropriate IPRx register */
-    RegValue |= (Local_Priority << BitPosition);
+    /**< Set the priority in the appropriate IPRx register, only the upper 4 bits of each byte are implemented */
+    RegValue |= ((u32)(Local_Priority << 4) << BitPosition);
 
     /**< Write the modified value back to the IPR register */
-    NVIC_IPR_BASE_ADDRESS[RegisterIndex] = (RegValue << 4);
+    NVIC_IPR_BASE_ADDRESS[RegisterIndex] = RegValue;
+
+    Local_FunctionStatus = E_OK;
 
     return Local_FunctionStatus;
 }
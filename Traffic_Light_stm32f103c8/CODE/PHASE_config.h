@@ -0,0 +1,111 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : PHASE_config.h             *****************/
+/****************************************************************/
+#ifndef PHASE_CONFIG_H_
+#define PHASE_CONFIG_H_
+
+/**
+ * @defgroup PHASE_Timing_Config Phase Timing Configuration
+ * @brief Durations of the controller phases. All values must be multiples of PHASE_TICK_MS.
+ * @{
+ */
+
+/**
+ * @brief Period of PHASE_Tick in milliseconds.
+ */
+#define PHASE_TICK_MS                   50
+
+/**
+ * @brief Phase durations of the default plan (PLAN_DEFAULT_PHASES in PLAN_config.h).
+ */
+
+/**< Pedestrians cross: cars red, pedestrians green */
+#define PHASE_PED_WALK_MS               5000
+
+/**< Change interval after the walk: both heads yellow */
+#define PHASE_CAR_CHANGE_MS             5000
+
+/**< Cars go: cars green, pedestrians red (the max green when actuated) */
+#define PHASE_CAR_GO_MS                 5000
+
+/**< Shortest car green before a pedestrian request may end it */
+#define PHASE_CAR_MIN_GO_MS             1000
+
+/**< Clearance after a full car green without request: both heads yellow */
+#define PHASE_CLEARANCE_MS              5000
+
+/**< Warning after a pedestrian request: both heads flashing yellow */
+#define PHASE_WARNING_MS                10000
+
+/**< Longest pedestrian wait a plan may allow; PHASE_CheckTable rejects plans above it */
+#define PHASE_MAX_PED_WAIT_MS           30000
+
+/**
+ * @brief Press-to-walk histogram: PHASE_PED_WAIT_BINS bins of PHASE_PED_WAIT_BIN_MS, the last one open-ended.
+ */
+#define PHASE_PED_WAIT_BINS             16
+#define PHASE_PED_WAIT_BIN_MS           2000
+
+/**< Passage time: an actuated green is kept this long after each vehicle detection */
+#define PHASE_PASSAGE_MS                2000
+
+/**
+ * @brief Run the car green of the default plan actuated (PHASE_FLAG_ACTUATED).
+ *
+ * It then lasts from PHASE_CAR_MIN_GO_MS to PHASE_CAR_GO_MS depending on the detector.
+ * Without a detector fitted it always gaps out at the minimum: disable it then.
+ */
+#define PHASE_ACTUATION_ENABLED         1
+#define PHASE_ACTUATION_DISABLED        0
+#define PHASE_CAR_GO_ACTUATION          PHASE_ACTUATION_ENABLED
+
+/**
+ * @brief Emergency vehicle preemption (see PHASE_Preempt).
+ *
+ * Conflicting greens end with a shortened clearance, then all heads show red, then the
+ * preempt green is held while the input stays asserted, for at least the minimum and at
+ * most the maximum green. CLEAR + ALL_RED must cover SAFETY_MIN_CLEARANCE_MS, or the
+ * safety monitor latches flashing red on the preempt green.
+ */
+#define PHASE_PREEMPT_CLEAR_MS          2000
+#define PHASE_PREEMPT_ALL_RED_MS        1500
+#define PHASE_PREEMPT_MIN_GREEN_MS      5000
+#define PHASE_PREEMPT_MAX_GREEN_MS      60000
+
+/**< Half period of the flashing yellow */
+#define PHASE_FLASH_HALF_PERIOD_MS      100
+
+/** @} */ // End of PHASE_Timing_Config
+
+/**
+ * @brief Number of crossings run by the engine, each with its own state and plan (1 .. 2).
+ *
+ * PHASE_Tick steps all of them, so its cost grows linearly with this count. The limit is the
+ * board, not the engine: the pin map in main.c and the signal groups in SAFETY_config.h are
+ * written out for two crossings, and a third needs both extended.
+ */
+#define PHASE_INTERSECTION_COUNT        1
+
+/**
+ * @brief Cycle boundary: a table installed with PHASE_InstallTable takes over when this phase is entered.
+ */
+#define PHASE_CYCLE_START               PHASE_CAR_GO
+
+/**
+ * @brief Steady phase held under low demand until a pedestrian request (see PHASE_SetLowDemand).
+ */
+#define PHASE_PARK                      PHASE_CAR_GO
+
+/**
+ * @brief Signals of the preempt green, and the phase the crossing resumes with after it.
+ *
+ * The resume phase is entered straight from the preempt green, so PHASE_CheckTable rejects
+ * plans where it shows any other green.
+ */
+#define PHASE_PREEMPT_SIGNALS           (PHASE_SIG_CAR_GREEN | PHASE_SIG_PED_RED)
+#define PHASE_PREEMPT_EXIT              PHASE_CAR_GO
+
+#endif /**< PHASE_CONFIG_H_ */
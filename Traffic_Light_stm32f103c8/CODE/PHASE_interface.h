@@ -0,0 +1,365 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : PHASE_interface.h          *****************/
+/****************************************************************/
+#ifndef PHASE_INTERFACE_H_
+#define PHASE_INTERFACE_H_
+
+/**
+ * @defgroup PHASE_Parameters PHASE Parameters
+ * @{
+ */
+
+/**
+ * @name Signal Image Bits
+ * @brief One bit per lamp, independent of the pins the lamps are wired to.
+ * @{
+ */
+#define PHASE_SIG_CAR_RED       0x01 /**< Car head red */
+#define PHASE_SIG_CAR_YELLOW    0x02 /**< Car head yellow */
+#define PHASE_SIG_CAR_GREEN     0x04 /**< Car head green */
+#define PHASE_SIG_PED_RED       0x08 /**< Pedestrian head red */
+#define PHASE_SIG_PED_YELLOW    0x10 /**< Pedestrian head yellow */
+#define PHASE_SIG_PED_GREEN     0x20 /**< Pedestrian head green */
+#define PHASE_SIG_PED_WAIT      0x40 /**< "Wait" indicator: a request is latched and not served yet */
+/** @} */
+
+/**
+ * @name Phases
+ * @{
+ */
+#define PHASE_PED_WALK          0 /**< Cars red, pedestrians green */
+#define PHASE_CAR_CHANGE        1 /**< Both heads yellow after the walk */
+#define PHASE_CAR_GO            2 /**< Cars green, pedestrians red */
+#define PHASE_CLEARANCE         3 /**< Both heads yellow after a full car green */
+#define PHASE_WARNING           4 /**< Both heads flashing yellow after a pedestrian request */
+#define PHASE_COUNT             5
+/** @} */
+
+/**
+ * @name Preemption Steps
+ * @{
+ */
+#define PHASE_PREEMPT_NONE      0 /**< Normal operation */
+#define PHASE_PREEMPT_CLEAR     1 /**< Shortened clearance of the conflicting greens */
+#define PHASE_PREEMPT_ALL_RED   2 /**< All heads red */
+#define PHASE_PREEMPT_GREEN     3 /**< Preempt green (PHASE_PREEMPT_SIGNALS) */
+/** @} */
+
+/**
+ * @name Phase Descriptor Flags
+ * @{
+ */
+#define PHASE_FLAG_NONE                 0x00
+#define PHASE_FLAG_FLASHING             0x01    /**< Signals blink with PHASE_FLASH_HALF_PERIOD_MS */
+#define PHASE_FLAG_SERVES_PED           0x02    /**< Entering the phase serves a pending pedestrian request */
+#define PHASE_FLAG_ENDS_ON_REQUEST      0x04    /**< A pending request ends the phase once MinTicks elapsed */
+#define PHASE_FLAG_ACTUATED             0x08    /**< Detections extend the phase by PHASE_PASSAGE_MS; it ends on gap-out after
+                                                     MinTicks or at DurationTicks (max-out), to NextOnRequest if a request
+                                                     is pending and the phase ends on request */
+/** @} */
+
+/**
+ * @brief Returned by PHASE_GetTicksToNextEvent when only a request can change the signals.
+ */
+#define PHASE_NO_EVENT                  0xFFFF
+
+/**
+ * @brief Description of one phase. A timing plan is an array of PHASE_COUNT descriptors.
+ */
+typedef struct
+{
+    u8 Signals;         /**< Signal image shown during the phase (PHASE_SIG_xxx bits) */
+    u8 Flags;           /**< PHASE_FLAG_xxx */
+    u16 DurationTicks;  /**< Length of the phase */
+    u16 MinTicks;       /**< Earliest termination on request or gap-out (PHASE_FLAG_ENDS_ON_REQUEST, PHASE_FLAG_ACTUATED) */
+    u8 Next;            /**< Phase entered when the duration expires */
+    u8 NextOnRequest;   /**< Phase entered when a request ends the phase */
+} PHASE_Descriptor_t;
+
+/** @} */ // End of PHASE_Parameters
+
+/**
+ * @defgroup PHASE_Functions PHASE Functions
+ * @brief Tick-driven phase engine of the pedestrian crossing.
+ *
+ * The engine does not touch any hardware: the application feeds it ticks and
+ * button requests and writes the returned signal image to the lamps. This keeps
+ * every decision in one place and lets host builds drive it with arbitrary
+ * interleavings of requests and ticks.
+ *
+ * One engine runs PHASE_INTERSECTION_COUNT independent crossings, each with its own
+ * state, requests and plan; Copy_Intersection selects one (0 .. PHASE_INTERSECTION_COUNT - 1).
+ * Low demand, parking and the next event are properties of the whole cabinet.
+ * @{
+ */
+
+/**
+ * @brief Reset every crossing to the start of the pedestrian walk on the default plan.
+ *
+ * @return None.
+ */
+void PHASE_Init(void);
+
+/**
+ * @brief Advance every crossing by one tick of PHASE_TICK_MS.
+ *
+ * Each crossing costs the same bounded work, so the time taken grows linearly with
+ * PHASE_INTERSECTION_COUNT.
+ *
+ * @return None.
+ */
+void PHASE_Tick(void);
+
+/**
+ * @brief Latch a pedestrian request.
+ *
+ * A single byte store, safe to call from the button interrupt. Requests made while
+ * pedestrians already have green are ignored.
+ *
+ * @param[in] Copy_Intersection The crossing whose button was pressed.
+ *
+ * @return None.
+ */
+void PHASE_RequestPedestrian(u8 Copy_Intersection);
+
+/**
+ * @brief Get the state of the pending request of a crossing.
+ *
+ * The bound is fixed on the tick after the press, which also lights PHASE_SIG_PED_WAIT, and
+ * only grows if a new plan takes over before the walk.
+ *
+ * @param[in]  Copy_Intersection The crossing.
+ * @param[out] Copy_WaitedTicks Ticks waited so far.
+ * @param[out] Copy_BoundTicks Ticks within which the walk starts.
+ *
+ * @return E_OK while a request is pending, E_NOT_OK otherwise or for an invalid crossing.
+ */
+Std_ReturnType PHASE_GetPedWait(u8 Copy_Intersection, u16 *Copy_WaitedTicks, u16 *Copy_BoundTicks);
+
+/**
+ * @brief Copy the press-to-walk histogram of a crossing.
+ *
+ * Bin n counts the served requests that waited n * PHASE_PED_WAIT_BIN_MS up to the next
+ * bin; the last bin also holds all longer waits. Counts saturate at 0xFFFF.
+ *
+ * @param[in]  Copy_Intersection The crossing.
+ * @param[out] Copy_Bins Receives PHASE_PED_WAIT_BINS counts.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid crossing or NULL buffer.
+ */
+Std_ReturnType PHASE_GetPedWaitHistogram(u8 Copy_Intersection, u16 *Copy_Bins);
+
+/**
+ * @brief Latch a vehicle detection.
+ *
+ * A single byte store, safe to call from the detector interrupt. The next tick restarts the
+ * passage time of the crossing, which keeps an actuated phase from gapping out.
+ *
+ * @param[in] Copy_Intersection The crossing whose detector fired.
+ *
+ * @return None.
+ */
+void PHASE_DetectVehicle(u8 Copy_Intersection);
+
+/**
+ * @brief Preempt a crossing for an emergency vehicle.
+ *
+ * Two byte stores, safe to call from the preemption interrupt at any priority. An asserted
+ * input latches a call: from then on PHASE_GetSignals shows every green conflicting with
+ * the preempt green as yellow, so the interrupt can write the heads at once, and the next
+ * tick runs the shortened clearance, the all-red and the preempt green. A preempt green
+ * already showing is held without clearance. The preempt green ends once the input is
+ * released and PHASE_PREEMPT_MIN_GREEN_MS has passed, or after PHASE_PREEMPT_MAX_GREEN_MS
+ * whatever the input, and the crossing resumes with PHASE_PREEMPT_EXIT.
+ *
+ * @param[in] Copy_Intersection The crossing.
+ * @param[in] Copy_Asserted Level of the preemption input: 1 on the assert edge, 0 on release.
+ *
+ * @return None.
+ */
+void PHASE_Preempt(u8 Copy_Intersection, u8 Copy_Asserted);
+
+/**
+ * @brief Run the cycle of a crossing against an external time reference (coordination).
+ *
+ * While enabled, an actuated PHASE_CYCLE_START phase does not gap out: it runs to its duration
+ * unless PHASE_ForceOff ends it earlier, so the force-off points set where each cycle starts.
+ * A pending request leaves it along Next rather than NextOnRequest when Next reaches the walk
+ * as soon (in the default plan the walk follows the clearance in every cycle), so a request
+ * does not change the length of the cycle. The duration stays the max-out and the walk comes
+ * no later than on the request path, so the pedestrian wait bound of the plan still holds.
+ *
+ * @param[in] Copy_Intersection The crossing.
+ * @param[in] Copy_Enable 1 to coordinate, 0 to run free.
+ *
+ * @return None.
+ */
+void PHASE_SetCoordinated(u8 Copy_Intersection, u8 Copy_Enable);
+
+/**
+ * @brief Force off the PHASE_CYCLE_START phase of a crossing on the next tick.
+ *
+ * Taken by the next PHASE_Tick, from the same context: the phase ends as it would on expiry if
+ * its minimum has run, otherwise the force-off is dropped. Ignored in any other phase, while
+ * parked under low demand and while preempted.
+ *
+ * @param[in] Copy_Intersection The crossing.
+ *
+ * @return None.
+ */
+void PHASE_ForceOff(u8 Copy_Intersection);
+
+/**
+ * @brief Get the preemption step of a crossing.
+ *
+ * @param[in] Copy_Intersection The crossing.
+ *
+ * @return One of PHASE_PREEMPT_NONE .. PHASE_PREEMPT_GREEN, PHASE_PREEMPT_NONE for an invalid crossing.
+ */
+u8 PHASE_GetPreemptStep(u8 Copy_Intersection);
+
+/**
+ * @brief Get the signal image of a crossing to show until the next tick.
+ *
+ * @param[in] Copy_Intersection The crossing.
+ *
+ * @return A combination of PHASE_SIG_xxx bits, 0 for an invalid crossing.
+ */
+u8 PHASE_GetSignals(u8 Copy_Intersection);
+
+/**
+ * @brief Get the current phase of a crossing.
+ *
+ * @param[in] Copy_Intersection The crossing.
+ *
+ * @return One of PHASE_PED_WALK .. PHASE_WARNING, PHASE_COUNT for an invalid crossing.
+ */
+u8 PHASE_GetCurrentPhase(u8 Copy_Intersection);
+
+/**
+ * @brief Get the phase a force-off of the current phase of a crossing would lead to now.
+ *
+ * @param[in] Copy_Intersection The crossing.
+ *
+ * @return Next or NextOnRequest of the current phase, PHASE_COUNT for an invalid crossing.
+ */
+u8 PHASE_GetForceOffNext(u8 Copy_Intersection);
+
+/**
+ * @brief Get the time left until the pedestrian green of a crossing ends.
+ *
+ * Follows the successors on expiry while they keep the pedestrian green. A preemption or an
+ * early end on request can still cut the walk short.
+ *
+ * @param[in] Copy_Intersection The crossing.
+ *
+ * @return Ticks left, 0 while pedestrians do not walk or for an invalid crossing.
+ */
+u16 PHASE_GetWalkTicksLeft(u8 Copy_Intersection);
+
+/**
+ * @brief Get the number of ticks until the signals of any crossing can change next.
+ *
+ * Counts the ticks until the phase expires, the flashing toggles, a pending request ends
+ * the phase or is acknowledged, or an actuated phase gaps out. A request latched later can only shorten the
+ * wait and a detection can only lengthen it; the caller must re-evaluate after either.
+ *
+ * @return Ticks until the next change, at least 1; PHASE_NO_EVENT while every crossing is parked.
+ */
+u16 PHASE_GetTicksToNextEvent(void);
+
+/**
+ * @brief Enable or disable low-demand operation.
+ *
+ * Under low demand the park phase (PHASE_PARK) is held past its duration as long as no
+ * pedestrian request is pending, instead of cycling, so the signals stay steady. Only a
+ * park phase that ends on request is held, and a pending plan still gets its cycle boundary.
+ *
+ * @param[in] Copy_Enable 1 to enable, 0 to cycle normally again.
+ *
+ * @return None.
+ */
+void PHASE_SetLowDemand(u8 Copy_Enable);
+
+/**
+ * @brief Check whether every crossing is holding the park phase.
+ *
+ * While parked the signals change only after PHASE_RequestPedestrian.
+ *
+ * @return 1 if all crossings are parked, 0 otherwise.
+ */
+u8 PHASE_IsParked(void);
+
+/**
+ * @brief Check the safety invariants of the current state of a crossing.
+ *
+ * - Cars and pedestrians never have green at the same time.
+ * - A green is never shown together with red or yellow on the same head.
+ * - A pending pedestrian request never waits longer than the bound computed when it was
+ *   acknowledged, from the remaining time of the phase it was latched in and the request path.
+ *   A preemption suspends the bound; it is recomputed from PHASE_PREEMPT_EXIT afterwards.
+ *
+ * @param[in] Copy_Intersection The crossing.
+ *
+ * @return E_OK if all invariants hold, E_NOT_OK otherwise or for an invalid crossing.
+ */
+Std_ReturnType PHASE_CheckInvariants(u8 Copy_Intersection);
+
+/**
+ * @brief Check the structure of a timing plan.
+ *
+ * - every successor index is a valid phase,
+ * - every duration is nonzero and MinTicks never exceeds DurationTicks,
+ * - the walk is reached from every phase with a request pending, within PHASE_MAX_PED_WAIT_MS,
+ * - PHASE_PREEMPT_EXIT shows no green conflicting with the preempt green,
+ * - PHASE_CYCLE_START is reached from every phase without requests.
+ *
+ * The signal images themselves are not judged here; that is the job of the safety monitor.
+ *
+ * @param[in]  Copy_Table         PHASE_COUNT descriptors.
+ * @param[out] Copy_MaxPedWaitTicks Receives the worst-case pedestrian wait of the plan. May be NULL.
+ *
+ * @return E_OK if the plan can run, E_NOT_OK otherwise.
+ */
+Std_ReturnType PHASE_CheckTable(const PHASE_Descriptor_t *Copy_Table, u16 *Copy_MaxPedWaitTicks);
+
+/**
+ * @brief Install a new timing plan on a crossing at its next cycle boundary.
+ *
+ * The engine keeps running on the active plan and swaps to the new one, with a single pointer
+ * store, the next time it enters PHASE_CYCLE_START. A plan installed while another one is still
+ * pending replaces it. The caller owns the storage and must not modify it until
+ * PHASE_GetActiveTable returns a different plan. Must be called from the context running
+ * PHASE_Tick.
+ *
+ * @param[in] Copy_Intersection The crossing.
+ * @param[in] Copy_Table PHASE_COUNT descriptors, or NULL to cancel a pending plan.
+ *
+ * @return E_OK if the plan was accepted, E_NOT_OK if PHASE_CheckTable rejected it or the crossing is invalid.
+ */
+Std_ReturnType PHASE_InstallTable(u8 Copy_Intersection, const PHASE_Descriptor_t *Copy_Table);
+
+/**
+ * @brief Get the plan a crossing currently runs.
+ *
+ * @param[in] Copy_Intersection The crossing.
+ *
+ * @return Pointer to PHASE_COUNT descriptors, NULL for an invalid crossing.
+ */
+const PHASE_Descriptor_t *PHASE_GetActiveTable(u8 Copy_Intersection);
+
+/**
+ * @brief Get the plan of a crossing waiting for its next cycle boundary.
+ *
+ * @param[in] Copy_Intersection The crossing.
+ *
+ * @return Pointer to PHASE_COUNT descriptors, or NULL if none is pending.
+ */
+const PHASE_Descriptor_t *PHASE_GetPendingTable(u8 Copy_Intersection);
+
+/** @} */ // End of PHASE_Functions
+
+#endif /**< PHASE_INTERFACE_H_ */
@@ -0,0 +1,72 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : PHASE_private.h            *****************/
+/****************************************************************/
+#ifndef PHASE_PRIVATE_H_
+#define PHASE_PRIVATE_H_
+
+/**< Convert a configured duration to ticks */
+#define PHASE_MS_TO_TICKS(MS)           ((u16)((MS) / PHASE_TICK_MS))
+
+#define PHASE_FLASH_HALF_PERIOD_TICKS   PHASE_MS_TO_TICKS(PHASE_FLASH_HALF_PERIOD_MS)
+
+#define PHASE_PASSAGE_TICKS             PHASE_MS_TO_TICKS(PHASE_PASSAGE_MS)
+
+#define PHASE_MAX_PED_WAIT_TICKS        PHASE_MS_TO_TICKS(PHASE_MAX_PED_WAIT_MS)
+#define PHASE_PED_WAIT_BIN_TICKS        PHASE_MS_TO_TICKS(PHASE_PED_WAIT_BIN_MS)
+
+#define PHASE_PREEMPT_CLEAR_TICKS       PHASE_MS_TO_TICKS(PHASE_PREEMPT_CLEAR_MS)
+#define PHASE_PREEMPT_ALL_RED_TICKS     PHASE_MS_TO_TICKS(PHASE_PREEMPT_ALL_RED_MS)
+#define PHASE_PREEMPT_MIN_GREEN_TICKS   PHASE_MS_TO_TICKS(PHASE_PREEMPT_MIN_GREEN_MS)
+#define PHASE_PREEMPT_MAX_GREEN_TICKS   PHASE_MS_TO_TICKS(PHASE_PREEMPT_MAX_GREEN_MS)
+
+/**< Greens in the signal image */
+#define PHASE_SIG_GREENS                (PHASE_SIG_CAR_GREEN | PHASE_SIG_PED_GREEN)
+/**< Greens that conflict with the preempt green */
+#define PHASE_PREEMPT_CONFLICTS         (PHASE_SIG_GREENS & (u8)~(PHASE_PREEMPT_SIGNALS))
+
+#if (PHASE_PREEMPT_SIGNALS & PHASE_SIG_GREENS) == 0
+    #error "PHASE_PREEMPT_SIGNALS must show a green"
+#endif
+
+/**< Returned by PHASE_PathWait when a request never reaches the walk */
+#define PHASE_NO_PATH                   0xFFFFFFFFUL
+
+/**< A walk along the successors that has not reached its target after this many phases loops forever */
+#define PHASE_MAX_HOPS                  PHASE_COUNT
+
+/**< Crossings wired on the board: main.c and SAFETY_config.h have tables for this many */
+#if (PHASE_INTERSECTION_COUNT < 1) || (PHASE_INTERSECTION_COUNT > 2)
+    #error "PHASE_INTERSECTION_COUNT must be 1 or 2"
+#endif
+
+/**
+ * @brief Run-time state of one crossing.
+ */
+typedef struct
+{
+    const PHASE_Descriptor_t *ActiveTable;  /**< Plan the crossing runs */
+    const PHASE_Descriptor_t *PendingTable; /**< Plan taking over at the next cycle boundary, or NULL */
+    u16 ElapsedTicks;       /**< Ticks spent in the current phase */
+    u16 PedWaitTicks;       /**< Ticks the pending request has waited so far */
+    u16 ActiveMaxPedWait;   /**< Worst-case pedestrian wait of the active plan */
+    u16 PendingMaxPedWait;  /**< Worst-case pedestrian wait of the pending plan */
+    u16 PedWaitLimit;       /**< Bound checked against the request pending right now */
+    u16 PassageTicks;       /**< Ticks left before an actuated phase gaps out, restarted by each detection */
+    u16 PedWaitHist[PHASE_PED_WAIT_BINS];   /**< Served requests by press-to-walk time, saturating */
+    u16 PreemptTicks;       /**< Ticks spent in the current preemption step */
+    u8 Phase;               /**< Current phase (PHASE_xxx), left as it was while preempted */
+    u8 Preempt;             /**< Preemption step (PHASE_PREEMPT_xxx) */
+    u8 PreemptClear;        /**< Signals shown during PHASE_PREEMPT_CLEAR */
+    u8 Coordinated;         /**< PHASE_CYCLE_START ends on force-off or expiry only */
+    u8 ForceOff;            /**< Set by PHASE_ForceOff, taken by the next tick */
+    u8 Signals;             /**< Image computed by the last tick */
+    volatile u8 PedRequest; /**< Set from the button interrupt */
+    volatile u8 VehicleCall;    /**< Set from the detector interrupt */
+    volatile u8 PreemptCall;    /**< Set from the preemption interrupt, taken by the next tick */
+    volatile u8 PreemptInput;   /**< Level of the preemption input */
+} PHASE_State_t;
+
+#endif /**< PHASE_PRIVATE_H_ */
@@ -0,0 +1,831 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : PHASE_program.c            *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< APP *****************************/
+#include "PHASE_interface.h"
+#include "PHASE_config.h"
+#include "PHASE_private.h"
+#include "PLAN_interface.h"
+/*****************************< Private Variables *****************************/
+static PHASE_State_t PHASE_States[PHASE_INTERSECTION_COUNT];
+static volatile u8 PHASE_LowDemand = 0;
+/*****************************< Private Functions *****************************/
+/**< Under low demand the park phase is held past its duration until a request ends it */
+static u8 PHASE_Holds(const PHASE_State_t *Copy_State, const PHASE_Descriptor_t *Copy_Phase, u8 Copy_Request)
+{
+    return (PHASE_LowDemand && (Copy_State->Phase == PHASE_PARK) && !Copy_Request &&
+            (Copy_Phase->Flags & PHASE_FLAG_ENDS_ON_REQUEST) && (Copy_State->PendingTable == NULL)) ? 1 : 0;
+}
+
+static u8 PHASE_StateIsParked(const PHASE_State_t *Copy_State)
+{
+    const PHASE_Descriptor_t *Local_Phase = &Copy_State->ActiveTable[Copy_State->Phase];
+
+    if ((Copy_State->Preempt != PHASE_PREEMPT_NONE) || Copy_State->PreemptCall)
+    {
+        return 0;
+    }
+
+    return ((Copy_State->ElapsedTicks >= Local_Phase->DurationTicks) && PHASE_Holds(Copy_State, Local_Phase, Copy_State->PedRequest)) ? 1 : 0;
+}
+
+static void PHASE_Enter(PHASE_State_t *Copy_State, u8 Copy_Phase)
+{
+    u8 Local_Bin;
+
+    /**< Cycle boundary: take over a pending plan with a single pointer store */
+    if ((Copy_Phase == PHASE_CYCLE_START) && (Copy_State->PendingTable != NULL))
+    {
+        Copy_State->ActiveTable = Copy_State->PendingTable;
+        Copy_State->PendingTable = NULL;
+        Copy_State->ActiveMaxPedWait = Copy_State->PendingMaxPedWait;
+
+        /**< A request latched under the old plan may see the rest of both plans */
+        Copy_State->PedWaitLimit = (Copy_State->PedRequest) ? (Copy_State->PedWaitLimit + Copy_State->ActiveMaxPedWait) : Copy_State->ActiveMaxPedWait;
+    }
+
+    Copy_State->Phase = Copy_Phase;
+    Copy_State->ElapsedTicks = 0;
+    Copy_State->PassageTicks = 0;
+
+    if (Copy_State->ActiveTable[Copy_Phase].Flags & PHASE_FLAG_SERVES_PED)
+    {
+        if (Copy_State->PedRequest)
+        {
+            Local_Bin = (u8)((Copy_State->PedWaitTicks / PHASE_PED_WAIT_BIN_TICKS < PHASE_PED_WAIT_BINS) ?
+                             (Copy_State->PedWaitTicks / PHASE_PED_WAIT_BIN_TICKS) : (PHASE_PED_WAIT_BINS - 1));
+            if (Copy_State->PedWaitHist[Local_Bin] != 0xFFFF)
+            {
+                Copy_State->PedWaitHist[Local_Bin]++;
+            }
+        }
+        Copy_State->PedRequest = 0;
+        Copy_State->PedWaitTicks = 0;
+        Copy_State->PedWaitLimit = Copy_State->ActiveMaxPedWait;
+    }
+}
+
+static void PHASE_UpdateSignals(PHASE_State_t *Copy_State)
+{
+    const PHASE_Descriptor_t *Local_Phase = &Copy_State->ActiveTable[Copy_State->Phase];
+
+    switch (Copy_State->Preempt)
+    {
+    case PHASE_PREEMPT_CLEAR:
+        Copy_State->Signals = Copy_State->PreemptClear;
+        break;
+
+    case PHASE_PREEMPT_ALL_RED:
+        Copy_State->Signals = PHASE_SIG_CAR_RED | PHASE_SIG_PED_RED;
+        break;
+
+    case PHASE_PREEMPT_GREEN:
+        Copy_State->Signals = (u8)(PHASE_PREEMPT_SIGNALS) & (u8)~PHASE_SIG_PED_WAIT;
+        break;
+
+    default:
+        Copy_State->Signals = Local_Phase->Signals & (u8)~PHASE_SIG_PED_WAIT;
+
+        /**< Dark during every odd half period of a flashing phase */
+        if ((Local_Phase->Flags & PHASE_FLAG_FLASHING) &&
+            ((Copy_State->ElapsedTicks / PHASE_FLASH_HALF_PERIOD_TICKS) & 1))
+        {
+            Copy_State->Signals = 0;
+        }
+        break;
+    }
+
+    /**< The wait indicator stays steady until the walk */
+    if (Copy_State->PedRequest)
+    {
+        Copy_State->Signals |= PHASE_SIG_PED_WAIT;
+    }
+}
+
+/**< An actuated phase that gaps out or maxes out serves a pending request on the way */
+static u8 PHASE_ActuatedNext(const PHASE_Descriptor_t *Copy_Phase, u8 Copy_Request)
+{
+    return (Copy_Request && (Copy_Phase->Flags & PHASE_FLAG_ENDS_ON_REQUEST)) ? Copy_Phase->NextOnRequest : Copy_Phase->Next;
+}
+
+/**< Ticks until a request latched Copy_Elapsed ticks into the phase ends it, and the phase it leads to */
+static u16 PHASE_RemainingOnRequest(const PHASE_Descriptor_t *Copy_Phase, u16 Copy_Elapsed, u8 *Copy_Next)
+{
+    u16 Local_End;
+    u16 Local_Remaining;
+
+    if (Copy_Phase->Flags & PHASE_FLAG_ACTUATED)
+    {
+        /**< Steady detections hold the phase up to its max-out */
+        Local_End = Copy_Phase->DurationTicks;
+        *Copy_Next = PHASE_ActuatedNext(Copy_Phase, 1);
+    }
+    else if ((Copy_Phase->Flags & PHASE_FLAG_ENDS_ON_REQUEST) && (Copy_Phase->MinTicks < Copy_Phase->DurationTicks))
+    {
+        Local_End = Copy_Phase->MinTicks;
+        *Copy_Next = Copy_Phase->NextOnRequest;
+    }
+    else
+    {
+        Local_End = Copy_Phase->DurationTicks;
+        *Copy_Next = Copy_Phase->Next;
+    }
+
+    Local_Remaining = (Copy_Elapsed < Local_End) ? (u16)(Local_End - Copy_Elapsed) : 1;
+
+    /**< Expiry is checked first, so a phase that runs out on the same tick takes its normal successor */
+    if (!(Copy_Phase->Flags & PHASE_FLAG_ACTUATED) && ((u32)Copy_Elapsed + Local_Remaining >= Copy_Phase->DurationTicks))
+    {
+        *Copy_Next = Copy_Phase->Next;
+    }
+
+    return Local_Remaining;
+}
+
+/**< Ticks from entering Copy_Phase with a request pending until the walk */
+static u32 PHASE_PathWait(const PHASE_Descriptor_t *Copy_Table, u8 Copy_Phase)
+{
+    u32 Local_Wait = 0;
+    u8 Local_Hops;
+
+    for (Local_Hops = 0; !(Copy_Table[Copy_Phase].Flags & PHASE_FLAG_SERVES_PED); Local_Hops++)
+    {
+        if (Local_Hops >= PHASE_MAX_HOPS)
+        {
+            return PHASE_NO_PATH;
+        }
+        Local_Wait += PHASE_RemainingOnRequest(&Copy_Table[Copy_Phase], 0, &Copy_Phase);
+    }
+
+    return Local_Wait;
+}
+
+/**< Successor of an actuated phase ending now. A coordinated cycle start serves a request along Next when that
+     path reaches the walk as soon, so the cycle is as long with the request as without it */
+static u8 PHASE_ExitNext(const PHASE_State_t *Copy_State, const PHASE_Descriptor_t *Copy_Phase, u8 Copy_Request)
+{
+    if (Copy_Request && Copy_State->Coordinated && (Copy_State->Phase == PHASE_CYCLE_START) &&
+        (PHASE_PathWait(Copy_State->ActiveTable, Copy_Phase->Next) <=
+         PHASE_PathWait(Copy_State->ActiveTable, Copy_Phase->NextOnRequest)))
+    {
+        return Copy_Phase->Next;
+    }
+
+    return PHASE_ActuatedNext(Copy_Phase, Copy_Request);
+}
+
+/**< Signals with every green conflicting with the preempt green turned into the yellow of its head */
+static u8 PHASE_PreemptClearance(u8 Copy_Signals)
+{
+    u8 Local_Signals = Copy_Signals & (u8)~PHASE_PREEMPT_CONFLICTS;
+
+    if (Copy_Signals & PHASE_PREEMPT_CONFLICTS & PHASE_SIG_CAR_GREEN)
+    {
+        Local_Signals |= PHASE_SIG_CAR_YELLOW;
+    }
+    if (Copy_Signals & PHASE_PREEMPT_CONFLICTS & PHASE_SIG_PED_GREEN)
+    {
+        Local_Signals |= PHASE_SIG_PED_YELLOW;
+    }
+
+    return Local_Signals;
+}
+
+/**< Runs a preemption in place of the plan: clearance, all-red, preempt green, then back to PHASE_PREEMPT_EXIT */
+static void PHASE_PreemptStep(PHASE_State_t *Copy_State)
+{
+    u8 Local_Signals = Copy_State->ActiveTable[Copy_State->Phase].Signals & (u8)~PHASE_SIG_PED_WAIT;
+    u32 Local_Limit;
+
+    Copy_State->PreemptTicks++;
+
+    /**< A request keeps waiting through the preemption */
+    if (Copy_State->PedRequest)
+    {
+        Copy_State->PedWaitTicks++;
+    }
+
+    /**< Calls while a preemption runs are absorbed by it: only the input level holds the green */
+    if (Copy_State->PreemptCall)
+    {
+        Copy_State->PreemptCall = 0;
+        if (Copy_State->Preempt == PHASE_PREEMPT_NONE)
+        {
+            /**< A preempt green already showing is held, anything else is cleared first */
+            if ((Local_Signals & PHASE_SIG_GREENS) == (PHASE_PREEMPT_SIGNALS & PHASE_SIG_GREENS))
+            {
+                Copy_State->Preempt = PHASE_PREEMPT_GREEN;
+            }
+            else
+            {
+                Copy_State->Preempt = PHASE_PREEMPT_CLEAR;
+                Copy_State->PreemptClear = PHASE_PreemptClearance(Local_Signals);
+            }
+            Copy_State->PreemptTicks = 0;
+        }
+    }
+
+    switch (Copy_State->Preempt)
+    {
+    case PHASE_PREEMPT_CLEAR:
+        if (Copy_State->PreemptTicks >= PHASE_PREEMPT_CLEAR_TICKS)
+        {
+            Copy_State->Preempt = PHASE_PREEMPT_ALL_RED;
+            Copy_State->PreemptTicks = 0;
+        }
+        break;
+
+    case PHASE_PREEMPT_ALL_RED:
+        if (Copy_State->PreemptTicks >= PHASE_PREEMPT_ALL_RED_TICKS)
+        {
+            Copy_State->Preempt = PHASE_PREEMPT_GREEN;
+            Copy_State->PreemptTicks = 0;
+        }
+        break;
+
+    case PHASE_PREEMPT_GREEN:
+        if (((Copy_State->PreemptTicks >= PHASE_PREEMPT_MIN_GREEN_TICKS) && !Copy_State->PreemptInput) ||
+            (Copy_State->PreemptTicks >= PHASE_PREEMPT_MAX_GREEN_TICKS))
+        {
+            Copy_State->Preempt = PHASE_PREEMPT_NONE;
+            PHASE_Enter(Copy_State, PHASE_PREEMPT_EXIT);
+
+            /**< Bound the rest of a pending request from the resume phase */
+            if (Copy_State->PedRequest)
+            {
+                Local_Limit = Copy_State->PedWaitTicks + PHASE_PathWait(Copy_State->ActiveTable, PHASE_PREEMPT_EXIT);
+                Copy_State->PedWaitLimit = (Local_Limit > 0xFFFF) ? 0xFFFF : (u16)Local_Limit;
+            }
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**< Fixed work per crossing: no loop depends on the plan or the state */
+static void PHASE_Step(PHASE_State_t *Copy_State)
+{
+    const PHASE_Descriptor_t *Local_Phase = &Copy_State->ActiveTable[Copy_State->Phase];
+    u8 Local_Request = Copy_State->PedRequest;
+    u8 Local_ForceOff = Copy_State->ForceOff;
+    u8 Local_Next;
+    u32 Local_Bound;
+
+    Copy_State->ForceOff = 0;
+
+    if ((Copy_State->Preempt != PHASE_PREEMPT_NONE) || Copy_State->PreemptCall)
+    {
+        PHASE_PreemptStep(Copy_State);
+        PHASE_UpdateSignals(Copy_State);
+        return;
+    }
+
+    /**< First tick of a request: bound it by what is left of this phase and the request path */
+    if (Local_Request && (Copy_State->PedWaitTicks == 0))
+    {
+        Local_Bound = PHASE_RemainingOnRequest(Local_Phase, Copy_State->ElapsedTicks, &Local_Next);
+        Local_Bound += PHASE_PathWait(Copy_State->ActiveTable, Local_Next);
+        if (Local_Bound < Copy_State->PedWaitLimit)
+        {
+            Copy_State->PedWaitLimit = (u16)Local_Bound;
+        }
+    }
+
+    Copy_State->ElapsedTicks++;
+
+    if (Local_Request)
+    {
+        Copy_State->PedWaitTicks++;
+    }
+
+    /**< Each detection restarts the passage time, without one it runs down to the gap */
+    if (Copy_State->VehicleCall)
+    {
+        Copy_State->VehicleCall = 0;
+        Copy_State->PassageTicks = PHASE_PASSAGE_TICKS;
+    }
+    else if (Copy_State->PassageTicks != 0)
+    {
+        Copy_State->PassageTicks--;
+    }
+
+    if (Copy_State->ElapsedTicks >= Local_Phase->DurationTicks)
+    {
+        if (PHASE_Holds(Copy_State, Local_Phase, Local_Request))
+        {
+            Copy_State->ElapsedTicks = Local_Phase->DurationTicks;
+        }
+        else
+        {
+            PHASE_Enter(Copy_State, (Local_Phase->Flags & PHASE_FLAG_ACTUATED) ?
+                                    PHASE_ExitNext(Copy_State, Local_Phase, Local_Request) : Local_Phase->Next);
+        }
+    }
+    else if (Local_ForceOff && (Copy_State->Phase == PHASE_CYCLE_START) &&
+             (Copy_State->ElapsedTicks >= Local_Phase->MinTicks) && !PHASE_Holds(Copy_State, Local_Phase, Local_Request))
+    {
+        /**< Force-off: ends the phase as its expiry would */
+        PHASE_Enter(Copy_State, PHASE_ExitNext(Copy_State, Local_Phase, Local_Request));
+    }
+    else if (Local_Phase->Flags & PHASE_FLAG_ACTUATED)
+    {
+        /**< Gap-out: the minimum is served and no vehicle came within the passage time; a coordinated cycle start waits for its force-off */
+        if ((Copy_State->ElapsedTicks >= Local_Phase->MinTicks) && (Copy_State->PassageTicks == 0) &&
+            !(Copy_State->Coordinated && (Copy_State->Phase == PHASE_CYCLE_START)))
+        {
+            if (PHASE_Holds(Copy_State, Local_Phase, Local_Request))
+            {
+                Copy_State->ElapsedTicks = Local_Phase->DurationTicks;
+            }
+            else
+            {
+                PHASE_Enter(Copy_State, PHASE_ActuatedNext(Local_Phase, Local_Request));
+            }
+        }
+    }
+    else if ((Local_Phase->Flags & PHASE_FLAG_ENDS_ON_REQUEST) && Local_Request &&
+             (Copy_State->ElapsedTicks >= Local_Phase->MinTicks))
+    {
+        PHASE_Enter(Copy_State, Local_Phase->NextOnRequest);
+    }
+
+    PHASE_UpdateSignals(Copy_State);
+}
+
+static u16 PHASE_TicksToNextEvent(const PHASE_State_t *Copy_State)
+{
+    const PHASE_Descriptor_t *Local_Phase = &Copy_State->ActiveTable[Copy_State->Phase];
+    u16 Local_Ticks = Local_Phase->DurationTicks - Copy_State->ElapsedTicks;
+    u16 Local_Toggle;
+    u16 Local_Gap;
+
+    if (PHASE_StateIsParked(Copy_State))
+    {
+        return PHASE_NO_EVENT;
+    }
+
+    /**< A fresh request is acknowledged on the next tick */
+    if (Copy_State->PedRequest && (Copy_State->PedWaitTicks == 0))
+    {
+        return 1;
+    }
+
+    /**< A preemption call is taken on the next tick, then each step runs for its own time */
+    if (Copy_State->PreemptCall)
+    {
+        return 1;
+    }
+    switch (Copy_State->Preempt)
+    {
+    case PHASE_PREEMPT_CLEAR:
+        return (u16)(PHASE_PREEMPT_CLEAR_TICKS - Copy_State->PreemptTicks);
+
+    case PHASE_PREEMPT_ALL_RED:
+        return (u16)(PHASE_PREEMPT_ALL_RED_TICKS - Copy_State->PreemptTicks);
+
+    case PHASE_PREEMPT_GREEN:
+        if (Copy_State->PreemptInput)
+        {
+            return (u16)(PHASE_PREEMPT_MAX_GREEN_TICKS - Copy_State->PreemptTicks);
+        }
+        return (Copy_State->PreemptTicks < PHASE_PREEMPT_MIN_GREEN_TICKS) ?
+               (u16)(PHASE_PREEMPT_MIN_GREEN_TICKS - Copy_State->PreemptTicks) : 1;
+
+    default:
+        break;
+    }
+
+    if (Local_Phase->Flags & PHASE_FLAG_FLASHING)
+    {
+        Local_Toggle = PHASE_FLASH_HALF_PERIOD_TICKS - (Copy_State->ElapsedTicks % PHASE_FLASH_HALF_PERIOD_TICKS);
+        if (Local_Toggle < Local_Ticks)
+        {
+            Local_Ticks = Local_Toggle;
+        }
+    }
+
+    if ((Local_Phase->Flags & PHASE_FLAG_ACTUATED) && !(Copy_State->Coordinated && (Copy_State->Phase == PHASE_CYCLE_START)))
+    {
+        /**< Gap-out once both the minimum and the passage time have run down */
+        Local_Gap = (Copy_State->ElapsedTicks < Local_Phase->MinTicks) ? (u16)(Local_Phase->MinTicks - Copy_State->ElapsedTicks) : 0;
+        if (Copy_State->PassageTicks > Local_Gap)
+        {
+            Local_Gap = Copy_State->PassageTicks;
+        }
+        if (Local_Gap < Local_Ticks)
+        {
+            Local_Ticks = Local_Gap;
+        }
+    }
+    else if ((Local_Phase->Flags & PHASE_FLAG_ENDS_ON_REQUEST) && Copy_State->PedRequest)
+    {
+        Local_Ticks = (Copy_State->ElapsedTicks < Local_Phase->MinTicks) ?
+                      (u16)(Local_Phase->MinTicks - Copy_State->ElapsedTicks) : 1;
+    }
+
+    return (Local_Ticks != 0) ? Local_Ticks : 1;
+}
+/*****************************< Function Implementations *****************************/
+void PHASE_Init(void)
+{
+    u8 Local_Index;
+    u16 Local_MaxPedWait = 0;
+    u8 Local_Bin;
+    const PHASE_Descriptor_t *Local_Default = PLAN_GetTable(PLAN_DEFAULT);
+    PHASE_State_t *Local_State;
+
+    (void)PHASE_CheckTable(Local_Default, &Local_MaxPedWait);
+
+    for (Local_Index = 0; Local_Index < PHASE_INTERSECTION_COUNT; Local_Index++)
+    {
+        Local_State = &PHASE_States[Local_Index];
+        Local_State->ActiveTable = Local_Default;
+        Local_State->PendingTable = NULL;
+        Local_State->ActiveMaxPedWait = Local_MaxPedWait;
+        Local_State->PedWaitLimit = Local_MaxPedWait;
+        Local_State->PedRequest = 0;
+        Local_State->PedWaitTicks = 0;
+        Local_State->Preempt = PHASE_PREEMPT_NONE;
+        Local_State->PreemptTicks = 0;
+        Local_State->PreemptCall = 0;
+        Local_State->PreemptInput = 0;
+        Local_State->Coordinated = 0;
+        Local_State->ForceOff = 0;
+        for (Local_Bin = 0; Local_Bin < PHASE_PED_WAIT_BINS; Local_Bin++)
+        {
+            Local_State->PedWaitHist[Local_Bin] = 0;
+        }
+        PHASE_Enter(Local_State, PHASE_PED_WALK);
+        PHASE_UpdateSignals(Local_State);
+    }
+}
+
+void PHASE_Tick(void)
+{
+    u8 Local_Index;
+
+    for (Local_Index = 0; Local_Index < PHASE_INTERSECTION_COUNT; Local_Index++)
+    {
+        PHASE_Step(&PHASE_States[Local_Index]);
+    }
+}
+
+void PHASE_RequestPedestrian(u8 Copy_Intersection)
+{
+    PHASE_State_t *Local_State;
+
+    if (Copy_Intersection >= PHASE_INTERSECTION_COUNT)
+    {
+        return;
+    }
+
+    Local_State = &PHASE_States[Copy_Intersection];
+    if (!(Local_State->ActiveTable[Local_State->Phase].Flags & PHASE_FLAG_SERVES_PED) ||
+        (Local_State->Preempt != PHASE_PREEMPT_NONE))
+    {
+        Local_State->PedRequest = 1;
+    }
+}
+
+void PHASE_Preempt(u8 Copy_Intersection, u8 Copy_Asserted)
+{
+    if (Copy_Intersection >= PHASE_INTERSECTION_COUNT)
+    {
+        return;
+    }
+
+    PHASE_States[Copy_Intersection].PreemptInput = Copy_Asserted ? 1 : 0;
+    if (Copy_Asserted)
+    {
+        PHASE_States[Copy_Intersection].PreemptCall = 1;
+    }
+}
+
+void PHASE_SetCoordinated(u8 Copy_Intersection, u8 Copy_Enable)
+{
+    if (Copy_Intersection < PHASE_INTERSECTION_COUNT)
+    {
+        PHASE_States[Copy_Intersection].Coordinated = Copy_Enable ? 1 : 0;
+    }
+}
+
+void PHASE_ForceOff(u8 Copy_Intersection)
+{
+    if (Copy_Intersection < PHASE_INTERSECTION_COUNT)
+    {
+        PHASE_States[Copy_Intersection].ForceOff = 1;
+    }
+}
+
+u8 PHASE_GetPreemptStep(u8 Copy_Intersection)
+{
+    return (Copy_Intersection < PHASE_INTERSECTION_COUNT) ? PHASE_States[Copy_Intersection].Preempt : PHASE_PREEMPT_NONE;
+}
+
+Std_ReturnType PHASE_GetPedWait(u8 Copy_Intersection, u16 *Copy_WaitedTicks, u16 *Copy_BoundTicks)
+{
+    if ((Copy_Intersection >= PHASE_INTERSECTION_COUNT) || (Copy_WaitedTicks == NULL) || (Copy_BoundTicks == NULL) ||
+        !PHASE_States[Copy_Intersection].PedRequest)
+    {
+        return E_NOT_OK;
+    }
+
+    *Copy_WaitedTicks = PHASE_States[Copy_Intersection].PedWaitTicks;
+    *Copy_BoundTicks = PHASE_States[Copy_Intersection].PedWaitLimit;
+
+    return E_OK;
+}
+
+Std_ReturnType PHASE_GetPedWaitHistogram(u8 Copy_Intersection, u16 *Copy_Bins)
+{
+    u8 Local_Bin;
+
+    if ((Copy_Intersection >= PHASE_INTERSECTION_COUNT) || (Copy_Bins == NULL))
+    {
+        return E_NOT_OK;
+    }
+
+    for (Local_Bin = 0; Local_Bin < PHASE_PED_WAIT_BINS; Local_Bin++)
+    {
+        Copy_Bins[Local_Bin] = PHASE_States[Copy_Intersection].PedWaitHist[Local_Bin];
+    }
+
+    return E_OK;
+}
+
+void PHASE_DetectVehicle(u8 Copy_Intersection)
+{
+    if (Copy_Intersection < PHASE_INTERSECTION_COUNT)
+    {
+        PHASE_States[Copy_Intersection].VehicleCall = 1;
+    }
+}
+
+u8 PHASE_GetSignals(u8 Copy_Intersection)
+{
+    u8 Local_Signals;
+
+    if (Copy_Intersection >= PHASE_INTERSECTION_COUNT)
+    {
+        return 0;
+    }
+
+    Local_Signals = PHASE_States[Copy_Intersection].Signals;
+
+    /**< A call not taken by a tick yet already ends the conflicting greens */
+    if (PHASE_States[Copy_Intersection].PreemptCall && (PHASE_States[Copy_Intersection].Preempt == PHASE_PREEMPT_NONE))
+    {
+        Local_Signals = PHASE_PreemptClearance(Local_Signals);
+    }
+
+    return Local_Signals;
+}
+
+u8 PHASE_GetCurrentPhase(u8 Copy_Intersection)
+{
+    return (Copy_Intersection < PHASE_INTERSECTION_COUNT) ? PHASE_States[Copy_Intersection].Phase : PHASE_COUNT;
+}
+
+u8 PHASE_GetForceOffNext(u8 Copy_Intersection)
+{
+    const PHASE_State_t *Local_State;
+
+    if (Copy_Intersection >= PHASE_INTERSECTION_COUNT)
+    {
+        return PHASE_COUNT;
+    }
+
+    Local_State = &PHASE_States[Copy_Intersection];
+
+    return PHASE_ExitNext(Local_State, &Local_State->ActiveTable[Local_State->Phase], Local_State->PedRequest);
+}
+
+u16 PHASE_GetWalkTicksLeft(u8 Copy_Intersection)
+{
+    const PHASE_State_t *Local_State;
+    const PHASE_Descriptor_t *Local_Phase;
+    u32 Local_Ticks;
+    u8 Local_Hops;
+
+    if (Copy_Intersection >= PHASE_INTERSECTION_COUNT)
+    {
+        return 0;
+    }
+
+    Local_State = &PHASE_States[Copy_Intersection];
+    Local_Phase = &Local_State->ActiveTable[Local_State->Phase];
+
+    /**< The plan's signals, not the image: a flashing walk keeps counting through its dark half */
+    if ((Local_State->Preempt != PHASE_PREEMPT_NONE) || !(Local_Phase->Signals & PHASE_SIG_PED_GREEN))
+    {
+        return 0;
+    }
+
+    Local_Ticks = (Local_State->ElapsedTicks < Local_Phase->DurationTicks) ?
+                  (u32)(Local_Phase->DurationTicks - Local_State->ElapsedTicks) : 0;
+
+    for (Local_Hops = 1; (Local_Hops < PHASE_MAX_HOPS) && (Local_State->ActiveTable[Local_Phase->Next].Signals & PHASE_SIG_PED_GREEN); Local_Hops++)
+    {
+        Local_Phase = &Local_State->ActiveTable[Local_Phase->Next];
+        Local_Ticks += Local_Phase->DurationTicks;
+    }
+
+    return (Local_Ticks < PHASE_NO_EVENT) ? (u16)Local_Ticks : (PHASE_NO_EVENT - 1);
+}
+
+void PHASE_SetLowDemand(u8 Copy_Enable)
+{
+    PHASE_LowDemand = Copy_Enable ? 1 : 0;
+}
+
+u8 PHASE_IsParked(void)
+{
+    u8 Local_Index;
+
+    for (Local_Index = 0; Local_Index < PHASE_INTERSECTION_COUNT; Local_Index++)
+    {
+        if (!PHASE_StateIsParked(&PHASE_States[Local_Index]))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+u16 PHASE_GetTicksToNextEvent(void)
+{
+    u8 Local_Index;
+    u16 Local_Ticks;
+    u16 Local_Min = PHASE_NO_EVENT;
+
+    for (Local_Index = 0; Local_Index < PHASE_INTERSECTION_COUNT; Local_Index++)
+    {
+        Local_Ticks = PHASE_TicksToNextEvent(&PHASE_States[Local_Index]);
+        if (Local_Ticks < Local_Min)
+        {
+            Local_Min = Local_Ticks;
+        }
+    }
+
+    return Local_Min;
+}
+
+Std_ReturnType PHASE_CheckInvariants(u8 Copy_Intersection)
+{
+    u8 Local_Signals;
+
+    if (Copy_Intersection >= PHASE_INTERSECTION_COUNT)
+    {
+        return E_NOT_OK;
+    }
+
+    Local_Signals = PHASE_States[Copy_Intersection].Signals;
+
+    /**< Conflicting greens */
+    if ((Local_Signals & PHASE_SIG_CAR_GREEN) && (Local_Signals & PHASE_SIG_PED_GREEN))
+    {
+        return E_NOT_OK;
+    }
+
+    /**< Green together with another aspect on the same head */
+    if ((Local_Signals & PHASE_SIG_CAR_GREEN) && (Local_Signals & (PHASE_SIG_CAR_RED | PHASE_SIG_CAR_YELLOW)))
+    {
+        return E_NOT_OK;
+    }
+    if ((Local_Signals & PHASE_SIG_PED_GREEN) && (Local_Signals & (PHASE_SIG_PED_RED | PHASE_SIG_PED_YELLOW)))
+    {
+        return E_NOT_OK;
+    }
+
+    /**< Bounded pedestrian wait, suspended while preempted */
+    if ((PHASE_States[Copy_Intersection].Preempt == PHASE_PREEMPT_NONE) &&
+        (PHASE_States[Copy_Intersection].PedWaitTicks > PHASE_States[Copy_Intersection].PedWaitLimit))
+    {
+        return E_NOT_OK;
+    }
+
+    return E_OK;
+}
+
+Std_ReturnType PHASE_CheckTable(const PHASE_Descriptor_t *Copy_Table, u16 *Copy_MaxPedWaitTicks)
+{
+    const PHASE_Descriptor_t *Local_Phase;
+    u32 Local_Wait;
+    u32 Local_MaxWait = 0;
+    u8 Local_Start;
+    u8 Local_Current;
+    u8 Local_Hops;
+
+    if (Copy_Table == NULL)
+    {
+        return E_NOT_OK;
+    }
+
+    for (Local_Start = 0; Local_Start < PHASE_COUNT; Local_Start++)
+    {
+        Local_Phase = &Copy_Table[Local_Start];
+
+        if ((Local_Phase->Next >= PHASE_COUNT) || (Local_Phase->NextOnRequest >= PHASE_COUNT) ||
+            (Local_Phase->DurationTicks == 0) || (Local_Phase->MinTicks > Local_Phase->DurationTicks))
+        {
+            return E_NOT_OK;
+        }
+
+        /**< A request must be able to end the phase at the latest one tick after it is entered */
+        if ((Local_Phase->Flags & PHASE_FLAG_ENDS_ON_REQUEST) && (Local_Phase->MinTicks == 0))
+        {
+            return E_NOT_OK;
+        }
+    }
+
+    /**< The preempt green hands over to the resume phase without clearance */
+    if (Copy_Table[PHASE_PREEMPT_EXIT].Signals & PHASE_PREEMPT_CONFLICTS)
+    {
+        return E_NOT_OK;
+    }
+
+    for (Local_Start = 0; Local_Start < PHASE_COUNT; Local_Start++)
+    {
+        /**< Request latched as the phase is entered: follow the request path to the walk */
+        Local_Wait = PHASE_PathWait(Copy_Table, Local_Start);
+        if (Local_Wait == PHASE_NO_PATH)
+        {
+            return E_NOT_OK;
+        }
+
+        if (Local_Wait > Local_MaxWait)
+        {
+            Local_MaxWait = Local_Wait;
+        }
+
+        /**< Without requests the plan must still come back to the cycle boundary */
+        Local_Current = Local_Start;
+        for (Local_Hops = 0; Local_Current != PHASE_CYCLE_START; Local_Hops++)
+        {
+            if (Local_Hops >= PHASE_MAX_HOPS)
+            {
+                return E_NOT_OK;
+            }
+            Local_Current = Copy_Table[Local_Current].Next;
+        }
+    }
+
+    if (Local_MaxWait > PHASE_MAX_PED_WAIT_TICKS)
+    {
+        return E_NOT_OK;
+    }
+
+    if (Copy_MaxPedWaitTicks != NULL)
+    {
+        *Copy_MaxPedWaitTicks = (u16)Local_MaxWait;
+    }
+
+    return E_OK;
+}
+
+Std_ReturnType PHASE_InstallTable(u8 Copy_Intersection, const PHASE_Descriptor_t *Copy_Table)
+{
+    u16 Local_MaxPedWait;
+
+    if (Copy_Intersection >= PHASE_INTERSECTION_COUNT)
+    {
+        return E_NOT_OK;
+    }
+
+    if (Copy_Table == NULL)
+    {
+        PHASE_States[Copy_Intersection].PendingTable = NULL;
+        return E_OK;
+    }
+
+    if (PHASE_CheckTable(Copy_Table, &Local_MaxPedWait) != E_OK)
+    {
+        return E_NOT_OK;
+    }
+
+    PHASE_States[Copy_Intersection].PendingMaxPedWait = Local_MaxPedWait;
+    PHASE_States[Copy_Intersection].PendingTable = Copy_Table;
+
+    return E_OK;
+}
+
+const PHASE_Descriptor_t *PHASE_GetActiveTable(u8 Copy_Intersection)
+{
+    return (Copy_Intersection < PHASE_INTERSECTION_COUNT) ? PHASE_States[Copy_Intersection].ActiveTable : NULL;
+}
+
+const PHASE_Descriptor_t *PHASE_GetPendingTable(u8 Copy_Intersection)
+{
+    return (Copy_Intersection < PHASE_INTERSECTION_COUNT) ? PHASE_States[Copy_Intersection].PendingTable : NULL;
+}
+/*****************************< End of Function Implementations *****************************/
@@ -0,0 +1,52 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : PLAN_config.h              *****************/
+/****************************************************************/
+#ifndef PLAN_CONFIG_H_
+#define PLAN_CONFIG_H_
+
+/**
+ * @brief Signals never lit together, one X(S, PHASE_SIG_x, PHASE_SIG_y) per pair (S is passed through).
+ *
+ * Pairs of greens also may not follow each other directly.
+ */
+#define PLAN_CONFLICTS(X, S) \
+    X(S, PHASE_SIG_CAR_GREEN, PHASE_SIG_PED_GREEN) \
+    X(S, PHASE_SIG_CAR_RED, PHASE_SIG_CAR_GREEN) \
+    X(S, PHASE_SIG_PED_RED, PHASE_SIG_PED_GREEN)
+
+/**
+ * @brief Shortest phase between conflicting greens, in milliseconds.
+ *
+ * At least SAFETY_MIN_CLEARANCE_MS, or the safety monitor trips on a plan that built.
+ */
+#define PLAN_MIN_CLEARANCE_MS           3000
+
+/**
+ * @brief Phases of a plan, one line per PHASE_x (P is passed through):
+ *        X(P, Phase, Signals, Flags, DurationMs, MinMs, Next, NextOnRequest).
+ *
+ * Phase, Next and NextOnRequest are PHASE_x names without the prefix. Durations are multiples
+ * of PHASE_TICK_MS. MinMs only matters with PHASE_FLAG_ENDS_ON_REQUEST or PHASE_FLAG_ACTUATED.
+ */
+
+/**< The plan every crossing boots with, on the durations of PHASE_config.h */
+#define PLAN_DEFAULT_PHASES(X, P) \
+    X(P, PED_WALK,   PHASE_SIG_CAR_RED | PHASE_SIG_PED_GREEN,     PHASE_FLAG_SERVES_PED, PHASE_PED_WALK_MS,   0,                   CAR_CHANGE, CAR_CHANGE) \
+    X(P, CAR_CHANGE, PHASE_SIG_CAR_YELLOW | PHASE_SIG_PED_YELLOW, PHASE_FLAG_NONE,       PHASE_CAR_CHANGE_MS, 0,                   CAR_GO,     CAR_GO) \
+    X(P, CAR_GO,     PHASE_SIG_CAR_GREEN | PHASE_SIG_PED_RED,     PLAN_CAR_GO_FLAGS,     PHASE_CAR_GO_MS,     PHASE_CAR_MIN_GO_MS, CLEARANCE,  WARNING) \
+    X(P, CLEARANCE,  PHASE_SIG_CAR_YELLOW | PHASE_SIG_PED_YELLOW, PHASE_FLAG_NONE,       PHASE_CLEARANCE_MS,  0,                   PED_WALK,   PED_WALK) \
+    X(P, WARNING,    PHASE_SIG_CAR_YELLOW | PHASE_SIG_PED_YELLOW, PHASE_FLAG_FLASHING,   PHASE_WARNING_MS,    0,                   PED_WALK,   PED_WALK)
+
+/**< Rush hours: a long car green (max-out when actuated). An actuated green counts with its max-out in the
+     pedestrian wait, so CAR_CHANGE + CAR_GO + WARNING stays within PHASE_MAX_PED_WAIT_MS */
+#define PLAN_PEAK_PHASES(X, P) \
+    X(P, PED_WALK,   PHASE_SIG_CAR_RED | PHASE_SIG_PED_GREEN,     PHASE_FLAG_SERVES_PED, 5000,  0,    CAR_CHANGE, CAR_CHANGE) \
+    X(P, CAR_CHANGE, PHASE_SIG_CAR_YELLOW | PHASE_SIG_PED_YELLOW, PHASE_FLAG_NONE,       5000,  0,    CAR_GO,     CAR_GO) \
+    X(P, CAR_GO,     PHASE_SIG_CAR_GREEN | PHASE_SIG_PED_RED,     PLAN_CAR_GO_FLAGS,     15000, 5000, CLEARANCE,  WARNING) \
+    X(P, CLEARANCE,  PHASE_SIG_CAR_YELLOW | PHASE_SIG_PED_YELLOW, PHASE_FLAG_NONE,       5000,  0,    PED_WALK,   PED_WALK) \
+    X(P, WARNING,    PHASE_SIG_CAR_YELLOW | PHASE_SIG_PED_YELLOW, PHASE_FLAG_FLASHING,   10000, 0,    PED_WALK,   PED_WALK)
+
+#endif /**< PLAN_CONFIG_H_ */
@@ -0,0 +1,50 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : PLAN_interface.h           *****************/
+/****************************************************************/
+#ifndef PLAN_INTERFACE_H_
+#define PLAN_INTERFACE_H_
+
+/**
+ * @defgroup PLAN_Plans PLAN Plans
+ * @{
+ */
+#define PLAN_DEFAULT            0   /**< Boot plan of every crossing */
+#define PLAN_PEAK               1   /**< Longer car green for the rush hours */
+#define PLAN_COUNT              2
+/** @} */
+
+/**
+ * @defgroup PLAN_Functions PLAN Functions
+ * @brief Timing plans compiled into flash from the description in PLAN_config.h.
+ *
+ * Each plan is written down once as a list of phases with their signals, flags, durations in
+ * milliseconds and successors. The preprocessor expands the list into a const table of
+ * PHASE_Descriptor_t with the tick counts worked out for PHASE_TICK_MS, and into checks that
+ * stop the build when a plan is malformed:
+ * - a phase is missing or listed twice,
+ * - a duration is zero, too long for a u16 tick count or not a multiple of PHASE_TICK_MS,
+ * - a minimum exceeds its duration,
+ * - a phase lights signals of a PLAN_CONFLICTS pair together,
+ * - a green is followed by a conflicting green without a phase in between, or that phase can
+ *   end before PLAN_MIN_CLEARANCE_MS,
+ * - two phases without a green follow each other.
+ * A misspelt successor does not name a phase and does not compile either. The pedestrian wait
+ * bound depends on the whole cycle and is still worked out by PHASE_CheckTable.
+ * @{
+ */
+
+/**
+ * @brief Get a compiled plan.
+ *
+ * @param[in] Copy_Plan PLAN_x.
+ *
+ * @return PHASE_COUNT descriptors in flash, NULL for an unknown plan.
+ */
+const PHASE_Descriptor_t *PLAN_GetTable(u8 Copy_Plan);
+
+/** @} */ // End of PLAN_Functions
+
+#endif /**< PLAN_INTERFACE_H_ */
@@ -0,0 +1,91 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : PLAN_private.h             *****************/
+/****************************************************************/
+#ifndef PLAN_PRIVATE_H_
+#define PLAN_PRIVATE_H_
+
+#define PLAN_MS_TO_TICKS(MS)            ((u16)((MS) / PHASE_TICK_MS))
+
+/**< Greens in the signal image */
+#define PLAN_SIG_GREENS                 (PHASE_SIG_CAR_GREEN | PHASE_SIG_PED_GREEN)
+
+/**< Flags that let a phase end at MinMs; the cycle start can also be forced off there */
+#define PLAN_FLAG_SHORTENS              (PHASE_FLAG_ENDS_ON_REQUEST | PHASE_FLAG_ACTUATED)
+
+#if PHASE_CAR_GO_ACTUATION == PHASE_ACTUATION_ENABLED
+    #define PLAN_CAR_GO_FLAGS           (PHASE_FLAG_ENDS_ON_REQUEST | PHASE_FLAG_ACTUATED)
+#elif PHASE_CAR_GO_ACTUATION == PHASE_ACTUATION_DISABLED
+    #define PLAN_CAR_GO_FLAGS           PHASE_FLAG_ENDS_ON_REQUEST
+#else
+    #error "You chose a wrong car green actuation mode"
+#endif
+
+/**< Stops the build with a negative array size when COND is false; NAME tells which check */
+#define PLAN_ASSERT(COND, NAME)         typedef char PLAN_Assert_##NAME[(COND) ? 1 : -1]
+
+/**
+ * @name Conflict Bitmap
+ * @brief Two signal images packed in one constant, A in the high byte, checked against every PLAN_CONFLICTS pair.
+ * @{
+ */
+#define PLAN_PAIR(A, B)                 ((((A) & 0xFF) << 8) | ((B) & 0xFF))
+#define PLAN_CONFLICT_HIT(S, X, Y) \
+    | (((((S) >> 8) & (X)) && ((S) & (Y))) || ((((S) >> 8) & (Y)) && ((S) & (X))))
+#define PLAN_CONFLICTING(A, B)          (0 PLAN_CONFLICTS(PLAN_CONFLICT_HIT, PLAN_PAIR(A, B)))
+/** @} */
+
+/**
+ * @name Plan Expanders
+ * @brief Callbacks for the X(P, Phase, Signals, Flags, DurationMs, MinMs, Next, NextOnRequest) lists of PLAN_config.h.
+ * @{
+ */
+
+/**< Descriptor of one phase, ticks at PHASE_TICK_MS */
+#define PLAN_DESCRIPTOR(P, PH, SIG, FLAGS, MS, MIN_MS, NX, NXR) \
+    [PHASE_##PH] = { \
+        .Signals = (SIG), \
+        .Flags = (FLAGS), \
+        .DurationTicks = PLAN_MS_TO_TICKS(MS), \
+        .MinTicks = PLAN_MS_TO_TICKS(MIN_MS), \
+        .Next = PHASE_##NX, \
+        .NextOnRequest = PHASE_##NXR, \
+    },
+
+/**< Build-time facts of a phase that the checks of other phases look up by name */
+#define PLAN_FACTS(P, PH, SIG, FLAGS, MS, MIN_MS, NX, NXR) \
+    PLAN_##P##_SIG_##PH = (SIG), \
+    PLAN_##P##_SHORTEST_##PH = ((((FLAGS) & PLAN_FLAG_SHORTENS) || (PHASE_##PH == PHASE_CYCLE_START)) ? (MIN_MS) : (MS)),
+#define PLAN_NEXT_FACTS(P, PH, SIG, FLAGS, MS, MIN_MS, NX, NXR) \
+    PLAN_##P##_NEXT_SIG_##PH = PLAN_##P##_SIG_##NX, \
+    PLAN_##P##_REQ_SIG_##PH = PLAN_##P##_SIG_##NXR,
+
+/**< Counts the phases and marks the ones listed */
+#define PLAN_ONE(P, PH, SIG, FLAGS, MS, MIN_MS, NX, NXR)        + 1
+#define PLAN_BIT(P, PH, SIG, FLAGS, MS, MIN_MS, NX, NXR)        | (1UL << PHASE_##PH)
+#define PLAN_ALL_PHASES                 ((1UL << PHASE_COUNT) - 1)
+
+/**< Greens of SIG reach a conflicting green through phase B */
+#define PLAN_BRIDGES(P, SIG, B) \
+    (!(PLAN_##P##_SIG_##B & PLAN_SIG_GREENS) && \
+     (PLAN_CONFLICTING((SIG) & PLAN_SIG_GREENS, PLAN_##P##_NEXT_SIG_##B & PLAN_SIG_GREENS) || \
+      PLAN_CONFLICTING((SIG) & PLAN_SIG_GREENS, PLAN_##P##_REQ_SIG_##B & PLAN_SIG_GREENS)))
+
+/**< The checks of one phase */
+#define PLAN_CHECK(P, PH, SIG, FLAGS, MS, MIN_MS, NX, NXR) \
+    PLAN_ASSERT((((MS) % PHASE_TICK_MS) == 0) && (((MIN_MS) % PHASE_TICK_MS) == 0), P##_##PH##_NotTickMultiple); \
+    PLAN_ASSERT(((MS) >= PHASE_TICK_MS) && (((MS) / PHASE_TICK_MS) <= 0xFFFFUL), P##_##PH##_BadDuration); \
+    PLAN_ASSERT((MIN_MS) <= (MS), P##_##PH##_MinAboveDuration); \
+    PLAN_ASSERT(!PLAN_CONFLICTING(SIG, SIG), P##_##PH##_ConflictingSignals); \
+    PLAN_ASSERT(!PLAN_CONFLICTING((SIG) & PLAN_SIG_GREENS, PLAN_##P##_NEXT_SIG_##PH & PLAN_SIG_GREENS) && \
+                !PLAN_CONFLICTING((SIG) & PLAN_SIG_GREENS, PLAN_##P##_REQ_SIG_##PH & PLAN_SIG_GREENS), P##_##PH##_NoClearance); \
+    PLAN_ASSERT(((SIG) & PLAN_SIG_GREENS) || \
+                ((PLAN_##P##_NEXT_SIG_##PH & PLAN_SIG_GREENS) && (PLAN_##P##_REQ_SIG_##PH & PLAN_SIG_GREENS)), P##_##PH##_NoGreenTwice); \
+    PLAN_ASSERT(!PLAN_BRIDGES(P, SIG, NX) || (PLAN_##P##_SHORTEST_##NX >= PLAN_MIN_CLEARANCE_MS), P##_##PH##_ShortClearance); \
+    PLAN_ASSERT(!PLAN_BRIDGES(P, SIG, NXR) || (PLAN_##P##_SHORTEST_##NXR >= PLAN_MIN_CLEARANCE_MS), P##_##PH##_ShortClearanceOnRequest);
+
+/** @} */
+
+#endif /**< PLAN_PRIVATE_H_ */
@@ -0,0 +1,54 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : PLAN_program.c             *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< APP *****************************/
+#include "PHASE_interface.h"
+#include "PHASE_config.h"
+#include "PLAN_interface.h"
+#include "PLAN_config.h"
+#include "PLAN_private.h"
+/*****************************< Build-Time Checks *****************************/
+enum
+{
+    PLAN_DEFAULT_PHASES(PLAN_FACTS, DEFAULT)
+    PLAN_PEAK_PHASES(PLAN_FACTS, PEAK)
+    PLAN_FACTS_END
+};
+
+enum
+{
+    PLAN_DEFAULT_PHASES(PLAN_NEXT_FACTS, DEFAULT)
+    PLAN_PEAK_PHASES(PLAN_NEXT_FACTS, PEAK)
+    PLAN_NEXT_FACTS_END
+};
+
+PLAN_ASSERT(((0 PLAN_DEFAULT_PHASES(PLAN_ONE, DEFAULT)) == PHASE_COUNT) &&
+            ((0 PLAN_DEFAULT_PHASES(PLAN_BIT, DEFAULT)) == PLAN_ALL_PHASES), DEFAULT_PhaseMissingOrTwice);
+PLAN_DEFAULT_PHASES(PLAN_CHECK, DEFAULT)
+
+PLAN_ASSERT(((0 PLAN_PEAK_PHASES(PLAN_ONE, PEAK)) == PHASE_COUNT) &&
+            ((0 PLAN_PEAK_PHASES(PLAN_BIT, PEAK)) == PLAN_ALL_PHASES), PEAK_PhaseMissingOrTwice);
+PLAN_PEAK_PHASES(PLAN_CHECK, PEAK)
+/*****************************< Private Variables *****************************/
+static const PHASE_Descriptor_t PLAN_Tables[PLAN_COUNT][PHASE_COUNT] = {
+    [PLAN_DEFAULT] = { PLAN_DEFAULT_PHASES(PLAN_DESCRIPTOR, DEFAULT) },
+    [PLAN_PEAK] = { PLAN_PEAK_PHASES(PLAN_DESCRIPTOR, PEAK) },
+};
+/*****************************< Function Implementations *****************************/
+const PHASE_Descriptor_t *PLAN_GetTable(u8 Copy_Plan)
+{
+    if (Copy_Plan >= PLAN_COUNT)
+    {
+        return NULL;
+    }
+
+    return PLAN_Tables[Copy_Plan];
+}
+/*****************************< End of Function Implementations *****************************/
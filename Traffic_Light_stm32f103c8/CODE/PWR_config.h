@@ -0,0 +1,18 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : PWR_config.h              *****************/
+/****************************************************************/
+#ifndef PWR_CONFIG_H_
+#define PWR_CONFIG_H_
+
+/**
+ * @brief Voltage regulator state during STOP.
+ *
+ * @param PWR_REGULATOR_ON        Regulator stays in run mode: faster wake-up (tWUSTOP 3.6 us typ.).
+ * @param PWR_REGULATOR_LOW_POWER Regulator in low-power mode: lower current, wake-up 5.4 us typ.
+ */
+#define PWR_STOP_REGULATOR      PWR_REGULATOR_LOW_POWER
+
+#endif /**< PWR_CONFIG_H_ */
@@ -0,0 +1,40 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : PWR_interface.h           *****************/
+/****************************************************************/
+#ifndef PWR_INTERFACE_H_
+#define PWR_INTERFACE_H_
+
+/**
+ * @defgroup PWR_Functions PWR Functions
+ * @brief Low-power modes. The PWR clock (RCC_APB1ENR_PWREN) must be enabled before use.
+ * @{
+ */
+
+/**
+ * @brief Enter STOP mode and return after the wake-up.
+ *
+ * All clocks of the 1.8 V domain stop; SRAM, registers and the GPIO output levels are kept.
+ * Only EXTI lines wake the core, so every other interrupt source is deaf until then. Call
+ * with interrupts disabled (see SCB_WaitForInterrupt): the wake-up interrupt then runs once
+ * the caller leaves its critical section. The core resumes on HSI; see MCAL_RCC_ExitStop.
+ *
+ * @return None.
+ */
+void MCAL_PWR_EnterStop(void);
+
+/**
+ * @brief Allow writes to the backup domain (RTC, RCC_BDCR and the backup registers).
+ *
+ * The backup domain is write-protected after reset. The BKP clock (RCC_APB1ENR_BKPEN) must be
+ * enabled as well before the backup registers can be accessed.
+ *
+ * @return None.
+ */
+void MCAL_PWR_EnableBackupAccess(void);
+
+/** @} */ // End of PWR_Functions
+
+#endif /**< PWR_INTERFACE_H_ */
@@ -0,0 +1,36 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : PWR_private.h             *****************/
+/****************************************************************/
+#ifndef PWR_PRIVATE_H_
+#define PWR_PRIVATE_H_
+
+/**< Power control base address */
+#define PWR_BASE_ADDRESS        0x40007000U
+
+/**< PWR register structure */
+typedef struct
+{
+    volatile u32 CR;    /**< Power Control Register */
+    volatile u32 CSR;   /**< Power Control/Status Register */
+} PWR_RegDef_t;
+
+/**< Pointer to the PWR register structure */
+#define PWR     ((PWR_RegDef_t *)PWR_BASE_ADDRESS)
+
+/**< CR bits */
+#define PWR_CR_LPDS             0   /**< Low-power regulator in STOP */
+#define PWR_CR_PDDS             1   /**< STANDBY instead of STOP on deep sleep */
+#define PWR_CR_CWUF             2   /**< Clear the wake-up flag */
+#define PWR_CR_DBP              8   /**< Disable backup domain write protection */
+
+#define PWR_REGULATOR_ON        0
+#define PWR_REGULATOR_LOW_POWER 1
+
+#if (PWR_STOP_REGULATOR != PWR_REGULATOR_ON) && (PWR_STOP_REGULATOR != PWR_REGULATOR_LOW_POWER)
+#error "Invalid PWR_STOP_REGULATOR value. Please choose PWR_REGULATOR_ON or PWR_REGULATOR_LOW_POWER."
+#endif
+
+#endif /**< PWR_PRIVATE_H_ */
@@ -0,0 +1,39 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : PWR_program.c             *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "SCB_interface.h"
+#include "PWR_interface.h"
+#include "PWR_config.h"
+#include "PWR_private.h"
+/*****************************< Function Implementations *****************************/
+void MCAL_PWR_EnterStop(void)
+{
+    /**< Deep sleep means STOP, not STANDBY */
+    CLR_BIT(PWR->CR, PWR_CR_PDDS);
+#if PWR_STOP_REGULATOR == PWR_REGULATOR_LOW_POWER
+    SET_BIT(PWR->CR, PWR_CR_LPDS);
+#else
+    CLR_BIT(PWR->CR, PWR_CR_LPDS);
+#endif
+    SET_BIT(PWR->CR, PWR_CR_CWUF);
+
+    SCB_SetDeepSleep(1);
+    SCB_WaitForInterrupt();
+
+    /**< Later WFIs are plain sleeps again */
+    SCB_SetDeepSleep(0);
+}
+
+void MCAL_PWR_EnableBackupAccess(void)
+{
+    SET_BIT(PWR->CR, PWR_CR_DBP);
+}
+/*****************************< End of Function Implementations *****************************/
@@ -14,11 +14,99 @@
 #include "RCC_private.h"
 #include "RCC_config.h"
 
+/*****************************< Private Macros *****************************/
+/**< Frequencies produced by the configuration in RCC_config.h */
+/**< PLLMUL[3:0] = n multiplies by n + 2; the driver leaves the bits cleared (x2) for RCC_CFGR_MULT_CLR */
+#if CLK_SYS_MULTP_FACTOR == RCC_CFGR_MULT_CLR
+#define RCC_PLL_MULT 2
+#else
+#define RCC_PLL_MULT (CLK_SYS_MULTP_FACTOR + 2)
+#endif
+
+#if RCC_SYSCLK == RCC_HSE
+#define RCC_SYSCLK_FREQ RCC_HSE_FREQ
+#elif RCC_SYSCLK == RCC_HSI
+#define RCC_SYSCLK_FREQ RCC_HSI_FREQ
+#elif RCC_SYSCLK == RCC_PLL
+#if RCC_CLK_PLL_INPUT == RCC_HSE
+#define RCC_SYSCLK_FREQ (RCC_HSE_FREQ * RCC_PLL_MULT)
+#else
+#define RCC_SYSCLK_FREQ ((RCC_HSI_FREQ / 2) * RCC_PLL_MULT)
+#endif
+#endif /**< RCC_SYSCLK */
+
+/**< AHB clock for a given SYSCLK: HPRE 0xxx = /1, 1000..1011 = /2../16, 1100..1111 = /64../512 */
+#if CLK_SYS_DIVIDE_FACTOR < RCC_CFGR_SYSCLK_DV_BY_2
+#define RCC_HCLK_FREQ(SYSCLK) (SYSCLK)
+#elif CLK_SYS_DIVIDE_FACTOR < RCC_CFGR_SYSCLK_DV_BY_64
+#define RCC_HCLK_FREQ(SYSCLK) ((SYSCLK) / (2 << (CLK_SYS_DIVIDE_FACTOR - RCC_CFGR_SYSCLK_DV_BY_2)))
+#else
+#define RCC_HCLK_FREQ(SYSCLK) ((SYSCLK) / (64 << (CLK_SYS_DIVIDE_FACTOR - RCC_CFGR_SYSCLK_DV_BY_64)))
+#endif
+
+/*****************************< Private Variables *****************************/
+static u32 RCC_HclkFreq = RCC_HSI_FREQ; /**< Core clock actually running, HSI until InitSysClock succeeds */
+
 /*****************************< Function Implementations *****************************/
+static Std_ReturnType RCC_WaitReady(u8 Copy_ReadyBit)
+{
+    u32 Local_Polls = 0;
+
+    /**< Poll the ready flag a bounded number of times. */
+    while (!GET_BIT(RCC_CR, Copy_ReadyBit))
+    {
+        Local_Polls++;
+        if (Local_Polls >= RCC_STARTUP_TIMEOUT)
+        {
+            return E_NOT_OK;
+        }
+    }
+
+    return E_OK;
+}
+
+static void RCC_SwitchSysClock(u8 Copy_Source)
+{
+    /**< Only SW[1:0] changes, the prescalers and PLL settings already in RCC_CFGR are kept. */
+    RCC_CFGR = (RCC_CFGR & ~(RCC_CFGR_SW_MASK << RCC_CFGR_SW_SHIFT)) | (Copy_Source << RCC_CFGR_SW_SHIFT);
+}
+
+static void RCC_FallbackToHsi(void)
+{
+    /**< HSI is enabled by hardware after reset, make sure it is still running before switching to it. */
+    SET_BIT(RCC_CR, RCC_CR_HSION);
+    (void)RCC_WaitReady(RCC_CR_HSIRDY);
+
+    /**< Select HSI as the system clock source, then stop whatever failed to start. */
+    RCC_SwitchSysClock(RCC_CFGR_SW_HSI);
+    CLR_BIT(RCC_CR, RCC_CR_PLLON);
+    CLR_BIT(RCC_CR, RCC_CR_HSEON);
+
+    RCC_HclkFreq = RCC_HCLK_FREQ(RCC_HSI_FREQ);
+}
+
+static void RCC_ApplyPrescalers(void)
+{
+    // main clk Divide factor
+    MCAL_RCC_PLL_Divide_Pheripheral_CLK(CLK_SYS_DIVIDE_FACTOR, RCC_CFGR_SYSCLK_NOT_DV, RCC_CFGR_AHB_PRESCALER_SHIFT);
+
+    // PCLK1 Divide factor clock
+    MCAL_RCC_PLL_Divide_Pheripheral_CLK(RCC_CFGR_PPRE1_DIVIDE_FACTOR, RCC_CFGR_PPRE1_CLR, RCC_CFGR_PPRE1_PRESCALER_SHIFT);
+
+    // PCLK2 Divide factor clock
+    MCAL_RCC_PLL_Divide_Pheripheral_CLK(RCC_CFGR_PPRE2_DIVIDE_FACTOR, RCC_CFGR_PPRE2_CLR, RCC_CFGR_PPRE2_PRESCALER_SHIFT);
+
+    // ADC Clock Divide factor
+    MCAL_RCC_PLL_Divide_Pheripheral_CLK(RCC_CFGR_ADC_DIVIDE_FACTOR, RCC_CFGR_ADC_PRESCALER_CLR, RCC_CFGR_ADC_PRESCALER_SHIFT);
+}
+
 Std_ReturnType MCAL_RCC_InitSysClock(void)
 {
     Std_ReturnType Local_FunctionStatus = E_NOT_OK;
 
+    /**< Bus prescalers first, so the new source never runs the buses out of range. */
+    RCC_ApplyPrescalers();
+
 #if RCC_SYSCLK == RCC_HSE
 
 /**< Enable the external clock to be the source for the system clock. */
@@ -33,28 +121,36 @@ Std_ReturnType MCAL_RCC_InitSysClock(void)
     /**< Enable the High-Speed External clock. */
     SET_BIT(RCC_CR, RCC_CR_HSEON);
 
-    /**< Wait until the High-Speed External clock is stable. */
-    while (!GET_BIT(RCC_CR, RCC_CR_HSERDY))
-        ;
-
-    /**< Select High-Speed External clock as the system clock source. */
-    RCC_CFGR = 0x00000001;
-
-    Local_FunctionStatus = E_OK;
+    /**< Wait until the High-Speed External clock is stable, keep running from HSI if it never is. */
+    if (RCC_WaitReady(RCC_CR_HSERDY) == E_OK)
+    {
+        /**< Select High-Speed External clock as the system clock source. */
+        RCC_SwitchSysClock(RCC_CFGR_SW_HSE);
+        RCC_HclkFreq = RCC_HCLK_FREQ(RCC_SYSCLK_FREQ);
+        Local_FunctionStatus = E_OK;
+    }
+    else
+    {
+        RCC_FallbackToHsi();
+    }
 
 #elif RCC_SYSCLK == RCC_HSI
 
-    /**< Enable the High-Speed Internal clock. */
-    SET_BIT(RCC_CR, RCC_CR_HSION);
+    /**< HSI is already the reset clock: only wait if something turned it off. */
+    if (!GET_BIT(RCC_CR, RCC_CR_HSIRDY))
+    {
+        /**< Enable the High-Speed Internal clock. */
+        SET_BIT(RCC_CR, RCC_CR_HSION);
+    }
 
     /**< Wait until the High-Speed Internal clock is stable. */
-    while (!GET_BIT(RCC_CR, RCC_CR_HSIRDY))
-        ;
-
-    /**< Select High-Speed Internal clock as the system clock source. */
-    RCC_CFGR = 0x00000000;
-
-    Local_FunctionStatus = E_OK;
+    if (RCC_WaitReady(RCC_CR_HSIRDY) == E_OK)
+    {
+        /**< Select High-Speed Internal clock as the system clock source. */
+        RCC_SwitchSysClock(RCC_CFGR_SW_HSI);
+        RCC_HclkFreq = RCC_HCLK_FREQ(RCC_SYSCLK_FREQ);
+        Local_FunctionStatus = E_OK;
+    }
 
 #elif RCC_SYSCLK == RCC_PLL
 #if RCC_CLK_PLL_INPUT == RCC_HSI
@@ -80,32 +176,33 @@ Std_ReturnType MCAL_RCC_InitSysClock(void)
 #endif /*choosing source for PLL*/
 
     /* Choose the multply factor of clock system*/
-    MCAL_RCC_PLL_CLK_SYS_MULTP_Factor(CLK_SYS_MULTP_FACTOR);
-    /*choose the divide factor of Each prephiral*/
-
-    // main clk Divide factor
-    MCAL_RCC_PLL_Divide_Pheripheral_CLK(CLK_SYS_DIVIDE_FACTOR, RCC_CFGR_SYSCLK_NOT_DV, RCC_CFGR_AHB_PRESCALER_SHIFT);
-
-    // PCLK1 Divide factor clock
-    MCAL_RCC_PLL_Divide_Pheripheral_CLK(RCC_CFGR_PPRE1_DIVIDE_FACTOR, RCC_CFGR_PPRE1_CLR, RCC_CFGR_PPRE1_PRESCALER_SHIFT);
-
-    // PCLK2 Divide factor clock
+    MCAL_RCC_PLL_CLK_SYS_MULTP_Factor(CLK_SYS_MULTP_FACTOR, RCC_CFGR_MULT_FACTOR_SHIFT);
 
-    MCAL_RCC_PLL_Divide_Pheripheral_CLK(RCC_CFGR_PPRE2_DIVIDE_FACTOR, RCC_CFGR_PPRE2_CLR, RCC_CFGR_PPRE2_PRESCALER_SHIFT);
-
-    // ADC Clock Divide factor
-
-    MCAL_RCC_PLL_Divide_Pheripheral_CLK(RCC_CFGR_ADC_DIVIDE_FACTOR, RCC_CFGR_ADC_PRESCALER_SHIFT, RCC_CFGR_ADC_PRESCALER_SHIFT);
+    /**< Raise the flash wait states before the core runs faster than the flash. */
+#if RCC_SYSCLK_FREQ > RCC_FLASH_ACR_LATENCY_1WS_MAX
+    RCC_FLASH_ACR = (RCC_FLASH_ACR & ~RCC_FLASH_ACR_LATENCY_MASK) | 2;
+#elif RCC_SYSCLK_FREQ > RCC_FLASH_ACR_LATENCY_0WS_MAX
+    RCC_FLASH_ACR = (RCC_FLASH_ACR & ~RCC_FLASH_ACR_LATENCY_MASK) | 1;
+#endif
 
     /**< Enable the PLL. */
     SET_BIT(RCC_CR, RCC_CR_PLLON);
-    /**< Wait until the PLL clock is stable. */
-    while (!GET_BIT(RCC_CR, RCC_CR_PLLRDY))
-        ;
-    /**< Select PLL clock as the system clock source. */
-    RCC_CFGR = 0x00000010;
-    // Placeholder for PLL configuration
-    Local_FunctionStatus = E_OK;
+    /**< Wait until the PLL clock (and its HSE input, if any) is stable, fall back to HSI if it never is. */
+#if RCC_CLK_PLL_INPUT == RCC_HSE
+    if ((RCC_WaitReady(RCC_CR_HSERDY) == E_OK) && (RCC_WaitReady(RCC_CR_PLLRDY) == E_OK))
+#else
+    if (RCC_WaitReady(RCC_CR_PLLRDY) == E_OK)
+#endif
+    {
+        /**< Select PLL clock as the system clock source. */
+        RCC_SwitchSysClock(RCC_CFGR_SW_PLL);
+        RCC_HclkFreq = RCC_HCLK_FREQ(RCC_SYSCLK_FREQ);
+        Local_FunctionStatus = E_OK;
+    }
+    else
+    {
+        RCC_FallbackToHsi();
+    }
 
 #else
 #error "Wrong Choice !!"
@@ -115,6 +212,17 @@ Std_ReturnType MCAL_RCC_InitSysClock(void)
     return Local_FunctionStatus;
 }
 
+void MCAL_RCC_ExitStop(void)
+{
+    /**< Leaving STOP the hardware has switched to HSI and turned HSE and the PLL off. */
+    RCC_HclkFreq = RCC_HCLK_FREQ(RCC_HSI_FREQ);
+}
+
+u32 MCAL_RCC_GetSysClockFreq(void)
+{
+    return RCC_HclkFreq;
+}
+
 Std_ReturnType MCAL_RCC_EnablePeripheral(u8 Copy_BusId, u8 Copy_PeripheralId)
 {
     Std_ReturnType Local_FunctionStatus = E_NOT_OK;
@@ -183,12 +291,13 @@ Std_ReturnType MCAL_RCC_PLL_CLK_SYS_MULTP_Factor(u8 Copy_Multply_Factor, u8 Copy
 {
     Std_ReturnType Local_FunctionStatus = E_OK;
     // make sure that bits of Multplying is cleared
-    RCC_CFGR &= ~(RCC_CFGR_MULT_CLR << RCC_CFGR_MULT_FACTOR_SHIFT);
+    RCC_CFGR &= ~(RCC_CFGR_MULT_CLR << Copy_Shift_Value);
     // if he want  multply factor he will  go into this if
-#if CLK_SYS_MULTP_FACTOR != RCC_CFGR_MULT_CLR
-    // Set bits as the multply factor we need
-    RCC_CFGR |= (Copy_Multply_Factor << RCC_CFGR_MULT_FACTOR_SHIFT);
-#endif /*< multply factor setting*/
+    if (Copy_Multply_Factor != RCC_CFGR_MULT_CLR)
+    {
+        // Set bits as the multply factor we need
+        RCC_CFGR |= (Copy_Multply_Factor << Copy_Shift_Value);
+    }
     return Local_FunctionStatus;
 }
 // edit the shift
@@ -199,10 +308,11 @@ Std_ReturnType MCAL_RCC_PLL_Divide_Pheripheral_CLK(u8 Copy_Peripheral_Divide_Fac
     RCC_CFGR &= ~(Copy_Peripheral_Clr_Value << Copy_Shift_Value);
 
 // setting the divide value
-#if Copy_Peripheral_Divide_Factor != Copy_Peripheral_Clr_Value
-    // Set bits as the divide factor we need
-    RCC_CFGR |= (Copy_Peripheral_Divide_Factor << Copy_Shift_Value);
-#endif /*< multply factor setting*/
+    if (Copy_Peripheral_Divide_Factor != Copy_Peripheral_Clr_Value)
+    {
+        // Set bits as the divide factor we need
+        RCC_CFGR |= (Copy_Peripheral_Divide_Factor << Copy_Shift_Value);
+    }
 
     return Local_FunctionStatus;
 }
@@ -67,6 +67,18 @@
 
 #endif /**<RCC_SYSCLK_PLL_SOURCE*/
 
+/**
+ * @brief Frequency of the external oscillator in Hz (8 MHz crystal on the Blue Pill).
+ */
+#define RCC_HSE_FREQ 8000000
+
+/**
+ * @brief Maximum number of polls of a ready flag (HSERDY, HSIRDY, PLLRDY) before giving up.
+ * @note On timeout the driver switches the system clock back to HSI and reports E_NOT_OK,
+ *       so a missing or dead crystal can never hang the boot. Each poll takes a few core cycles.
+ */
+#define RCC_STARTUP_TIMEOUT 0x5000
+
 /** @} */ // end of RCC_System_Clock_Config
 
 /**
@@ -120,13 +120,36 @@
  *
  * This function initializes the system clock configuration according to the desired settings.
  * It should be called early in the program to properly configure the clock system.
+ * Every oscillator wait is bounded by RCC_STARTUP_TIMEOUT; when HSE or the PLL does not become
+ * ready in time the system clock is left on HSI.
  *
  * @return Std_ReturnType
  * @retval E_OK     Clock initialization successful.
- * @retval E_NOT_OK Clock initialization failed.
+ * @retval E_NOT_OK Clock initialization failed, the system runs from HSI.
  */
 Std_ReturnType MCAL_RCC_InitSysClock(void);
 
+/**
+ * @brief Record that the core runs from HSI again after a wake-up from STOP.
+ *
+ * STOP turns HSE and the PLL off and wakes up on HSI. Call this first thing after the
+ * wake-up, then MCAL_RCC_InitSysClock when the configured clock is needed again.
+ *
+ * @return None.
+ */
+void MCAL_RCC_ExitStop(void);
+
+/**
+ * @brief Get the core (AHB) clock frequency that is actually running.
+ *
+ * The value follows MCAL_RCC_InitSysClock: the configured frequency on success, the HSI
+ * frequency before the call or after a fallback. Drivers that derive timing from the core
+ * clock (e.g. STK) must be given this value instead of assuming one.
+ *
+ * @return The HCLK frequency in Hz.
+ */
+u32 MCAL_RCC_GetSysClockFreq(void);
+
 /**
  * @brief Enable a specific peripheral on a specific bus.
  *
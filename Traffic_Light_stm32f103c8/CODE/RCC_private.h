@@ -87,6 +87,13 @@
  */
 #define RCC_CSR (*((volatile u32 *)0x40021024))
 
+/**
+ * @brief Flash Access Control Register (ACR)
+ *
+ * The flash wait states must be raised before the system clock goes above 24 MHz.
+ */
+#define RCC_FLASH_ACR (*((volatile u32 *)0x40022000))
+
 /** @} */ // end of RCC Control Register (CR)
 
 /**
@@ -111,6 +118,11 @@
  * @defgroup RCC_CFGR_Bit_Definitions Clock configuration register (RCC_CFGR) Bit Definitions
  * @{
  */
+#define RCC_CFGR_SW_SHIFT 0    // System clock switch
+#define RCC_CFGR_SW_MASK 0b11  // SW[1:0] bits
+#define RCC_CFGR_SW_HSI 0b00   // HSI selected as system clock
+#define RCC_CFGR_SW_HSE 0b01   // HSE selected as system clock
+#define RCC_CFGR_SW_PLL 0b10   // PLL selected as system clock
 #define PLL_SRC 16 // choose the source of PLL HSI/2 or HSE and it should be choosen before enabling PLL
 /** @} */          // end of RCC_CFGR_Bit_Definitions
 
@@ -209,4 +221,17 @@
 
 /** @} */ // end of RCC_Clock_Type
 
+/**
+ * @defgroup RCC_Flash_Latency Oscillator and Flash Latency Macros
+ * @{
+ */
+
+#define RCC_HSI_FREQ 8000000 /**< Internal RC oscillator frequency */
+
+#define RCC_FLASH_ACR_LATENCY_MASK 0b111 /**< LATENCY[2:0] bits */
+#define RCC_FLASH_ACR_LATENCY_0WS_MAX 24000000 /**< Highest SYSCLK with zero wait states */
+#define RCC_FLASH_ACR_LATENCY_1WS_MAX 48000000 /**< Highest SYSCLK with one wait state */
+
+/** @} */ // end of RCC_Flash_Latency
+
 #endif /* RCC_PRIVATE_H_ */
@@ -0,0 +1,24 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : RTC_config.h               *****************/
+/****************************************************************/
+#ifndef RTC_CONFIG_H_
+#define RTC_CONFIG_H_
+
+/**
+ * @brief Frequency of the LSE crystal in Hz (32.768 kHz on the Blue Pill).
+ *
+ * The counter advances once per second: the prescaler divides by this value.
+ */
+#define RTC_LSE_FREQ            32768
+
+/**
+ * @brief Maximum number of polls of RTOFF or RSF before giving up.
+ * @note Both take up to three RTC clock periods (about 92 us): far fewer polls than this at
+ *       any core clock. A stopped LSE then fails the access instead of hanging the caller.
+ */
+#define RTC_SYNC_TIMEOUT        0x4000
+
+#endif /**< RTC_CONFIG_H_ */
@@ -0,0 +1,86 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : RTC_interface.h            *****************/
+/****************************************************************/
+#ifndef RTC_INTERFACE_H_
+#define RTC_INTERFACE_H_
+
+/**
+ * @defgroup RTC_Functions RTC Functions
+ * @brief Seconds counter on the LSE crystal, and the backup registers beside it.
+ *
+ * The RTC and the backup registers live in the backup domain: powered from VBAT they keep
+ * counting and keep their contents through resets and power cuts. The PWR and BKP clocks
+ * (RCC_APB1ENR_PWREN, RCC_APB1ENR_BKPEN) must be enabled before MCAL_RTC_Init.
+ * @{
+ */
+
+/**
+ * @brief Take over a running RTC, or start the LSE for a new one.
+ *
+ * An RTC already counting on the LSE keeps its time. Otherwise the backup domain is reset
+ * (which clears the backup registers) and the LSE is started. The crystal needs up to a
+ * couple of seconds, so this does not wait for it: MCAL_RTC_IsRunning finishes the set-up.
+ *
+ * @return None.
+ */
+void MCAL_RTC_Init(void);
+
+/**
+ * @brief Check whether the counter runs, finishing the set-up once the LSE is ready.
+ *
+ * A new RTC starts counting from 0.
+ *
+ * @return 1 if the counter runs, 0 while the LSE is starting (or never starts).
+ */
+u8 MCAL_RTC_IsRunning(void);
+
+/**
+ * @brief Read the seconds counter.
+ *
+ * @return The counter, 0 if it does not run.
+ */
+u32 MCAL_RTC_GetCounter(void);
+
+/**
+ * @brief Load the seconds counter.
+ *
+ * @param[in] Copy_Seconds The new counter value.
+ *
+ * @return E_OK if it was written, E_NOT_OK if the counter does not run or the write timed out.
+ */
+Std_ReturnType MCAL_RTC_SetCounter(u32 Copy_Seconds);
+
+/**
+ * @brief Wait until the RTC registers are synchronized again.
+ *
+ * Needed after the APB1 clock was stopped (STOP mode): until then the counter reads stale.
+ *
+ * @return E_OK once synchronized, E_NOT_OK if the counter does not run or the wait timed out.
+ */
+Std_ReturnType MCAL_RTC_WaitSync(void);
+
+/**
+ * @brief Read a backup data register.
+ *
+ * @param[in] Copy_Register 1 .. 10.
+ *
+ * @return The register value, 0 for an invalid register.
+ */
+u16 MCAL_RTC_ReadBackup(u8 Copy_Register);
+
+/**
+ * @brief Write a backup data register.
+ *
+ * @param[in] Copy_Register 1 .. 10.
+ * @param[in] Copy_Value The value to keep.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid register.
+ */
+Std_ReturnType MCAL_RTC_WriteBackup(u8 Copy_Register, u16 Copy_Value);
+
+/** @} */ // End of RTC_Functions
+
+#endif /**< RTC_INTERFACE_H_ */
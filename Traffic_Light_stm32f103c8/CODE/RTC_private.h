@@ -0,0 +1,65 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : RTC_private.h              *****************/
+/****************************************************************/
+#ifndef RTC_PRIVATE_H_
+#define RTC_PRIVATE_H_
+
+/**< Real-time clock base address */
+#define RTC_BASE_ADDRESS        0x40002800U
+
+/**< RTC register structure, 16 bits used in each word */
+typedef struct
+{
+    volatile u32 CRH;   /**< Interrupt enables */
+    volatile u32 CRL;   /**< Control and flags */
+    volatile u32 PRLH;  /**< Prescaler reload, bits 19:16 */
+    volatile u32 PRLL;  /**< Prescaler reload, bits 15:0 */
+    volatile u32 DIVH;  /**< Prescaler divider, bits 19:16 */
+    volatile u32 DIVL;  /**< Prescaler divider, bits 15:0 */
+    volatile u32 CNTH;  /**< Counter, bits 31:16 */
+    volatile u32 CNTL;  /**< Counter, bits 15:0 */
+    volatile u32 ALRH;  /**< Alarm, bits 31:16 */
+    volatile u32 ALRL;  /**< Alarm, bits 15:0 */
+} RTC_RegDef_t;
+
+/**< Pointer to the RTC register structure */
+#define RTC     ((RTC_RegDef_t *)RTC_BASE_ADDRESS)
+
+/**< CRL bits */
+#define RTC_CRL_RSF             3   /**< Registers synchronized with the RTC clock domain */
+#define RTC_CRL_CNF             4   /**< Configuration mode: counter and prescaler writable */
+#define RTC_CRL_RTOFF           5   /**< Last write to the RTC registers is done */
+
+/**< Backup domain control register of the RCC; only this driver touches it */
+#define RTC_BDCR                (*((volatile u32 *)0x40021020))
+
+/**< BDCR bits */
+#define RTC_BDCR_LSEON          0   /**< External low-speed oscillator enable */
+#define RTC_BDCR_LSERDY         1   /**< External low-speed oscillator ready */
+#define RTC_BDCR_RTCSEL_SHIFT   8   /**< RTC clock source, two bits */
+#define RTC_BDCR_RTCSEL_MASK    0x3
+#define RTC_BDCR_RTCSEL_LSE     0x1
+#define RTC_BDCR_RTCEN          15  /**< RTC clock enable */
+#define RTC_BDCR_BDRST          16  /**< Backup domain software reset */
+
+/**< Backup data registers DR1..DR10, 16 bits used in each word */
+#define RTC_BKP_BASE_ADDRESS    0x40006C00U
+#define RTC_BKP_DR(N)           (*((volatile u32 *)(RTC_BKP_BASE_ADDRESS + (4U * (N)))))
+#define RTC_BKP_REGISTERS       10
+
+/**< Driver states */
+#define RTC_STATE_OFF           0   /**< MCAL_RTC_Init not called yet */
+#define RTC_STATE_STARTING      1   /**< Waiting for the LSE to start */
+#define RTC_STATE_RUNNING       2   /**< Counting seconds */
+
+/**< One tick per second */
+#define RTC_PRESCALER           ((u32)RTC_LSE_FREQ - 1U)
+
+#if (RTC_LSE_FREQ < 1) || (RTC_LSE_FREQ > 0x100000)
+#error "RTC_LSE_FREQ does not fit the 20-bit prescaler"
+#endif
+
+#endif /**< RTC_PRIVATE_H_ */
@@ -0,0 +1,171 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : RTC_program.c              *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "PWR_interface.h"
+#include "RTC_interface.h"
+#include "RTC_config.h"
+#include "RTC_private.h"
+/*****************************< Private Variables *****************************/
+static u8 RTC_State = RTC_STATE_OFF;
+/*****************************< Private Functions *****************************/
+static Std_ReturnType RTC_WaitFlag(u8 Copy_Bit)
+{
+    u32 Local_Polls = 0;
+
+    while (!GET_BIT(RTC->CRL, Copy_Bit))
+    {
+        Local_Polls++;
+        if (Local_Polls >= RTC_SYNC_TIMEOUT)
+        {
+            return E_NOT_OK;
+        }
+    }
+
+    return E_OK;
+}
+
+static Std_ReturnType RTC_Sync(void)
+{
+    CLR_BIT(RTC->CRL, RTC_CRL_RSF);
+
+    return RTC_WaitFlag(RTC_CRL_RSF);
+}
+
+/**< Counter and prescaler are written in configuration mode; the write lands when CNF is cleared */
+static Std_ReturnType RTC_EnterConfig(void)
+{
+    if (RTC_WaitFlag(RTC_CRL_RTOFF) != E_OK)
+    {
+        return E_NOT_OK;
+    }
+    SET_BIT(RTC->CRL, RTC_CRL_CNF);
+
+    return E_OK;
+}
+
+static Std_ReturnType RTC_ExitConfig(void)
+{
+    CLR_BIT(RTC->CRL, RTC_CRL_CNF);
+
+    return RTC_WaitFlag(RTC_CRL_RTOFF);
+}
+/*****************************< Function Implementations *****************************/
+void MCAL_RTC_Init(void)
+{
+    MCAL_PWR_EnableBackupAccess();
+
+    if (GET_BIT(RTC_BDCR, RTC_BDCR_RTCEN) && GET_BIT(RTC_BDCR, RTC_BDCR_LSERDY) &&
+        (((RTC_BDCR >> RTC_BDCR_RTCSEL_SHIFT) & RTC_BDCR_RTCSEL_MASK) == RTC_BDCR_RTCSEL_LSE))
+    {
+        RTC_State = RTC_STATE_RUNNING;
+        if (RTC_Sync() == E_OK)
+        {
+            return;
+        }
+    }
+
+    /**< The clock source can only be changed after a backup domain reset */
+    SET_BIT(RTC_BDCR, RTC_BDCR_BDRST);
+    CLR_BIT(RTC_BDCR, RTC_BDCR_BDRST);
+    SET_BIT(RTC_BDCR, RTC_BDCR_LSEON);
+    RTC_State = RTC_STATE_STARTING;
+}
+
+u8 MCAL_RTC_IsRunning(void)
+{
+    if ((RTC_State == RTC_STATE_STARTING) && GET_BIT(RTC_BDCR, RTC_BDCR_LSERDY))
+    {
+        RTC_BDCR |= (RTC_BDCR_RTCSEL_LSE << RTC_BDCR_RTCSEL_SHIFT);
+        SET_BIT(RTC_BDCR, RTC_BDCR_RTCEN);
+
+        if ((RTC_Sync() == E_OK) && (RTC_EnterConfig() == E_OK))
+        {
+            RTC->PRLH = (RTC_PRESCALER >> 16) & 0xF;
+            RTC->PRLL = RTC_PRESCALER & 0xFFFF;
+            RTC->CNTH = 0;
+            RTC->CNTL = 0;
+            if (RTC_ExitConfig() == E_OK)
+            {
+                RTC_State = RTC_STATE_RUNNING;
+            }
+        }
+    }
+
+    return (RTC_State == RTC_STATE_RUNNING) ? 1 : 0;
+}
+
+u32 MCAL_RTC_GetCounter(void)
+{
+    u32 Local_High;
+    u32 Local_Low;
+
+    if (RTC_State != RTC_STATE_RUNNING)
+    {
+        return 0;
+    }
+
+    /**< The halves are read separately: read again if the low half wrapped in between */
+    Local_High = RTC->CNTH & 0xFFFF;
+    Local_Low = RTC->CNTL & 0xFFFF;
+    if ((RTC->CNTH & 0xFFFF) != Local_High)
+    {
+        Local_High = RTC->CNTH & 0xFFFF;
+        Local_Low = RTC->CNTL & 0xFFFF;
+    }
+
+    return (Local_High << 16) | Local_Low;
+}
+
+Std_ReturnType MCAL_RTC_SetCounter(u32 Copy_Seconds)
+{
+    if ((RTC_State != RTC_STATE_RUNNING) || (RTC_EnterConfig() != E_OK))
+    {
+        return E_NOT_OK;
+    }
+
+    RTC->CNTH = (Copy_Seconds >> 16) & 0xFFFF;
+    RTC->CNTL = Copy_Seconds & 0xFFFF;
+
+    return RTC_ExitConfig();
+}
+
+Std_ReturnType MCAL_RTC_WaitSync(void)
+{
+    if (RTC_State != RTC_STATE_RUNNING)
+    {
+        return E_NOT_OK;
+    }
+
+    return RTC_Sync();
+}
+
+u16 MCAL_RTC_ReadBackup(u8 Copy_Register)
+{
+    if ((Copy_Register < 1) || (Copy_Register > RTC_BKP_REGISTERS))
+    {
+        return 0;
+    }
+
+    return (u16)(RTC_BKP_DR(Copy_Register) & 0xFFFF);
+}
+
+Std_ReturnType MCAL_RTC_WriteBackup(u8 Copy_Register, u16 Copy_Value)
+{
+    if ((Copy_Register < 1) || (Copy_Register > RTC_BKP_REGISTERS))
+    {
+        return E_NOT_OK;
+    }
+
+    RTC_BKP_DR(Copy_Register) = Copy_Value;
+
+    return E_OK;
+}
+/*****************************< End of Function Implementations *****************************/
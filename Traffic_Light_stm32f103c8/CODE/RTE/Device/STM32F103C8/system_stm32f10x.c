@@ -111,7 +111,9 @@
 /* #define SYSCLK_FREQ_36MHz  36000000 */
 /* #define SYSCLK_FREQ_48MHz  48000000 */
 /* #define SYSCLK_FREQ_56MHz  56000000 */
-#define SYSCLK_FREQ_72MHz  72000000
+/* #define SYSCLK_FREQ_72MHz  72000000 */
+/* The clock tree is brought up once by MCAL_RCC_InitSysClock() (RCC_config.h),
+   so SystemInit() leaves the core on HSI. */
 #endif
 
 /*!< Uncomment the following line if you need to use external SRAM mounted
@@ -0,0 +1,72 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : SAFETY_config.h            *****************/
+/****************************************************************/
+#ifndef SAFETY_CONFIG_H_
+#define SAFETY_CONFIG_H_
+
+/**
+ * @brief Period at which SAFETY_ValidateImage is called, in milliseconds.
+ */
+#define SAFETY_TICK_MS                  PHASE_TICK_MS
+
+/**
+ * @brief Minimum time between the end of a green and the start of a conflicting green.
+ */
+#define SAFETY_MIN_CLEARANCE_MS         3000
+
+/**
+ * @brief Half period of the flashing-red fallback.
+ */
+#define SAFETY_FLASH_HALF_PERIOD_MS     500
+
+/**
+ * @brief Signal groups supervised by the monitor (at most 8).
+ */
+#define SAFETY_GROUP_CARS               0
+#define SAFETY_GROUP_PEDS               1
+#define SAFETY_GROUP_CARS_2             2   /**< Second crossing, see PHASE_INTERSECTION_COUNT */
+#define SAFETY_GROUP_PEDS_2             3
+#define SAFETY_GROUP_COUNT              (2 * PHASE_INTERSECTION_COUNT)
+
+/**
+ * @brief Output image bits of the green lamps of each group.
+ */
+static const u32 SAFETY_GroupGreen[SAFETY_GROUP_COUNT] = {
+    [SAFETY_GROUP_CARS] = SAFETY_IMAGE_PORTB_PIN(GPIO_PIN1),
+    [SAFETY_GROUP_PEDS] = SAFETY_IMAGE_PORTA_PIN(GPIO_PIN3),
+#if PHASE_INTERSECTION_COUNT > 1
+    [SAFETY_GROUP_CARS_2] = SAFETY_IMAGE_PORTB_PIN(GPIO_PIN5),
+    [SAFETY_GROUP_PEDS_2] = SAFETY_IMAGE_PORTA_PIN(GPIO_PIN7),
+#endif
+};
+
+/**
+ * @brief Output image bits of the red lamps of each group, driven by the flashing-red fallback.
+ */
+static const u32 SAFETY_GroupRed[SAFETY_GROUP_COUNT] = {
+    [SAFETY_GROUP_CARS] = SAFETY_IMAGE_PORTB_PIN(GPIO_PIN3),
+    [SAFETY_GROUP_PEDS] = SAFETY_IMAGE_PORTA_PIN(GPIO_PIN1),
+#if PHASE_INTERSECTION_COUNT > 1
+    [SAFETY_GROUP_CARS_2] = SAFETY_IMAGE_PORTB_PIN(GPIO_PIN7),
+    [SAFETY_GROUP_PEDS_2] = SAFETY_IMAGE_PORTA_PIN(GPIO_PIN5),
+#endif
+};
+
+/**
+ * @brief Conflict matrix: bit h of entry g is set when groups g and h must never be green together.
+ *
+ * The matrix must be symmetric. Groups of different crossings never conflict.
+ */
+static const u8 SAFETY_ConflictMatrix[SAFETY_GROUP_COUNT] = {
+    [SAFETY_GROUP_CARS] = (1 << SAFETY_GROUP_PEDS),
+    [SAFETY_GROUP_PEDS] = (1 << SAFETY_GROUP_CARS),
+#if PHASE_INTERSECTION_COUNT > 1
+    [SAFETY_GROUP_CARS_2] = (1 << SAFETY_GROUP_PEDS_2),
+    [SAFETY_GROUP_PEDS_2] = (1 << SAFETY_GROUP_CARS_2),
+#endif
+};
+
+#endif /**< SAFETY_CONFIG_H_ */
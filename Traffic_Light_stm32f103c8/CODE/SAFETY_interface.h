@@ -0,0 +1,108 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : SAFETY_interface.h         *****************/
+/****************************************************************/
+#ifndef SAFETY_INTERFACE_H_
+#define SAFETY_INTERFACE_H_
+
+/**
+ * @defgroup SAFETY_Parameters SAFETY Parameters
+ * @{
+ */
+
+/**
+ * @name Output Image Layout
+ * @brief An output image holds the requested levels of PORTA in bits 0..15 and of PORTB in bits 16..31.
+ * @{
+ */
+#define SAFETY_IMAGE_PORTA_PIN(PIN)     (((u32)1) << (PIN))         /**< Image bit of a PORTA pin */
+#define SAFETY_IMAGE_PORTB_PIN(PIN)     (((u32)1) << ((PIN) + 16))  /**< Image bit of a PORTB pin */
+#define SAFETY_IMAGE_PORTA(IMAGE)       ((u16)(IMAGE))              /**< PORTA half of an image */
+#define SAFETY_IMAGE_PORTB(IMAGE)       ((u16)((IMAGE) >> 16))      /**< PORTB half of an image */
+/** @} */
+
+/** @} */ // End of SAFETY_Parameters
+
+/**
+ * @defgroup SAFETY_Functions SAFETY Functions
+ * @brief Run-time monitor validating every output image before it reaches the pins.
+ *
+ * The monitor is configured independently of the phase engine (see SAFETY_config.h): it only
+ * knows which pins are the greens and reds of each signal group and which groups conflict.
+ * @{
+ */
+
+/**
+ * @brief Reset the monitor.
+ *
+ * All groups start with their clearance time already elapsed and no fault latched.
+ *
+ * @return None.
+ */
+void SAFETY_Init(void);
+
+/**
+ * @brief Validate the image about to be written. Call exactly once per SAFETY_TICK_MS.
+ *
+ * Checks, with a fixed number of mask operations:
+ * - no two conflicting groups show green,
+ * - no group shows green and red together,
+ * - a green only starts once every conflicting group has been out of green for SAFETY_MIN_CLEARANCE_MS.
+ *
+ * A violation latches the monitor into flashing-red until the next SAFETY_Init.
+ *
+ * @param[in] Copy_Image The requested output image.
+ *
+ * @return E_OK if the image may be written, E_NOT_OK if the fallback image must be written instead.
+ */
+Std_ReturnType SAFETY_ValidateImage(u32 Copy_Image);
+
+/**
+ * @brief Get the flashing-red image for the current tick.
+ *
+ * @return All reds on during the first half period, all outputs off during the second.
+ */
+u32 SAFETY_GetFallbackImage(void);
+
+/**
+ * @brief Check whether a violation has been latched.
+ *
+ * @return 1 if the monitor is in flashing-red fallback, 0 otherwise.
+ */
+u8 SAFETY_IsFaulted(void);
+
+/**
+ * @brief Check the stateless rules on an image without touching the monitor state.
+ *
+ * Used to vet a timing plan before it is installed: no two conflicting groups green and
+ * no group green and red together. Clearance depends on the sequence of images and is left
+ * to the caller (see SAFETY_GetConflicts and SAFETY_GetMinClearanceMs).
+ *
+ * @param[in]  Copy_Image  The image to check.
+ * @param[out] Copy_Greens Receives the groups showing green (bit g for group g). May be NULL.
+ *
+ * @return E_OK if the image is acceptable, E_NOT_OK otherwise.
+ */
+Std_ReturnType SAFETY_CheckImage(u32 Copy_Image, u8 *Copy_Greens);
+
+/**
+ * @brief Get every group conflicting with at least one of the given groups.
+ *
+ * @param[in] Copy_Groups Group bitmask (bit g for group g).
+ *
+ * @return Bitmask of the conflicting groups.
+ */
+u8 SAFETY_GetConflicts(u8 Copy_Groups);
+
+/**
+ * @brief Get the configured minimum time between a green and a conflicting green.
+ *
+ * @return SAFETY_MIN_CLEARANCE_MS.
+ */
+u32 SAFETY_GetMinClearanceMs(void);
+
+/** @} */ // End of SAFETY_Functions
+
+#endif /**< SAFETY_INTERFACE_H_ */
@@ -0,0 +1,23 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : SAFETY_private.h           *****************/
+/****************************************************************/
+#ifndef SAFETY_PRIVATE_H_
+#define SAFETY_PRIVATE_H_
+
+#if SAFETY_GROUP_COUNT > 8
+#error "The conflict matrix holds at most 8 signal groups"
+#endif
+
+/**< Convert a configured duration to monitor ticks */
+#define SAFETY_MS_TO_TICKS(MS)              ((u16)((MS) / SAFETY_TICK_MS))
+
+#define SAFETY_MIN_CLEARANCE_TICKS          SAFETY_MS_TO_TICKS(SAFETY_MIN_CLEARANCE_MS)
+#define SAFETY_FLASH_HALF_PERIOD_TICKS      SAFETY_MS_TO_TICKS(SAFETY_FLASH_HALF_PERIOD_MS)
+
+/**< Bit of a group in the group bitmasks */
+#define SAFETY_GROUP_BIT(GROUP)             ((u8)(1 << (GROUP)))
+
+#endif /**< SAFETY_PRIVATE_H_ */
@@ -0,0 +1,187 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : SAFETY_program.c           *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "GPIO_Interface.h"
+/*****************************< APP *****************************/
+#include "PHASE_config.h"
+#include "SAFETY_interface.h"
+#include "SAFETY_config.h"
+#include "SAFETY_private.h"
+/*****************************< Private Variables *****************************/
+static u8 SAFETY_ActiveGreens = 0;                          /**< Groups green in the last accepted image */
+static u8 SAFETY_ClearedGroups = 0;                         /**< Groups whose clearance time has elapsed */
+static u16 SAFETY_ClearanceTicks[SAFETY_GROUP_COUNT];       /**< Ticks since each group's green ended */
+static u8 SAFETY_Faulted = 0;
+static u16 SAFETY_FlashTicks = 0;
+static u32 SAFETY_AllReds = 0;
+/*****************************< Private Functions *****************************/
+static u8 SAFETY_ReduceImage(u32 Copy_Image, u8 *Copy_Violation)
+{
+    u8 Local_Greens = 0;
+    u8 Local_Group;
+
+    /**< Reduce the image to one bit per group, with a fixed number of mask operations */
+    for (Local_Group = 0; Local_Group < SAFETY_GROUP_COUNT; Local_Group++)
+    {
+        if (Copy_Image & SAFETY_GroupGreen[Local_Group])
+        {
+            Local_Greens |= SAFETY_GROUP_BIT(Local_Group);
+
+            /**< Green and red together on one head */
+            if (Copy_Image & SAFETY_GroupRed[Local_Group])
+            {
+                *Copy_Violation = 1;
+            }
+        }
+    }
+
+    for (Local_Group = 0; Local_Group < SAFETY_GROUP_COUNT; Local_Group++)
+    {
+        /**< Conflicting greens */
+        if ((Local_Greens & SAFETY_GROUP_BIT(Local_Group)) && (Local_Greens & SAFETY_ConflictMatrix[Local_Group]))
+        {
+            *Copy_Violation = 1;
+        }
+    }
+
+    return Local_Greens;
+}
+/*****************************< Function Implementations *****************************/
+void SAFETY_Init(void)
+{
+    u8 Local_Group;
+
+    SAFETY_ActiveGreens = 0;
+    SAFETY_ClearedGroups = 0;
+    SAFETY_Faulted = 0;
+    SAFETY_FlashTicks = 0;
+    SAFETY_AllReds = 0;
+
+    for (Local_Group = 0; Local_Group < SAFETY_GROUP_COUNT; Local_Group++)
+    {
+        SAFETY_ClearanceTicks[Local_Group] = SAFETY_MIN_CLEARANCE_TICKS;
+        SAFETY_ClearedGroups |= SAFETY_GROUP_BIT(Local_Group);
+        SAFETY_AllReds |= SAFETY_GroupRed[Local_Group];
+    }
+}
+
+Std_ReturnType SAFETY_ValidateImage(u32 Copy_Image)
+{
+    u8 Local_Greens;
+    u8 Local_Violation = 0;
+    u8 Local_Onsets;
+    u8 Local_Group;
+
+    /**< Free-running modulo one flash period */
+    SAFETY_FlashTicks++;
+    if (SAFETY_FlashTicks >= (2 * SAFETY_FLASH_HALF_PERIOD_TICKS))
+    {
+        SAFETY_FlashTicks = 0;
+    }
+
+    if (SAFETY_Faulted)
+    {
+        return E_NOT_OK;
+    }
+
+    Local_Greens = SAFETY_ReduceImage(Copy_Image, &Local_Violation);
+
+    /**< Greens starting with this image */
+    Local_Onsets = Local_Greens & (u8)~SAFETY_ActiveGreens;
+
+    for (Local_Group = 0; Local_Group < SAFETY_GROUP_COUNT; Local_Group++)
+    {
+        /**< A new green needs every conflicting group cleared */
+        if ((Local_Onsets & SAFETY_GROUP_BIT(Local_Group)) &&
+            (SAFETY_ConflictMatrix[Local_Group] & (u8)~SAFETY_ClearedGroups))
+        {
+            Local_Violation = 1;
+        }
+    }
+
+    if (Local_Violation)
+    {
+        SAFETY_Faulted = 1;
+        SAFETY_FlashTicks = 0;
+        return E_NOT_OK;
+    }
+
+    /**< Advance the clearance timers with the accepted image */
+    for (Local_Group = 0; Local_Group < SAFETY_GROUP_COUNT; Local_Group++)
+    {
+        if (Local_Greens & SAFETY_GROUP_BIT(Local_Group))
+        {
+            SAFETY_ClearanceTicks[Local_Group] = 0;
+            SAFETY_ClearedGroups &= (u8)~SAFETY_GROUP_BIT(Local_Group);
+        }
+        else if (SAFETY_ClearanceTicks[Local_Group] < SAFETY_MIN_CLEARANCE_TICKS)
+        {
+            SAFETY_ClearanceTicks[Local_Group]++;
+            if (SAFETY_ClearanceTicks[Local_Group] >= SAFETY_MIN_CLEARANCE_TICKS)
+            {
+                SAFETY_ClearedGroups |= SAFETY_GROUP_BIT(Local_Group);
+            }
+        }
+    }
+    SAFETY_ActiveGreens = Local_Greens;
+
+    return E_OK;
+}
+
+u32 SAFETY_GetFallbackImage(void)
+{
+    if (SAFETY_FlashTicks >= SAFETY_FLASH_HALF_PERIOD_TICKS)
+    {
+        return 0;
+    }
+
+    return SAFETY_AllReds;
+}
+
+u8 SAFETY_IsFaulted(void)
+{
+    return SAFETY_Faulted;
+}
+
+Std_ReturnType SAFETY_CheckImage(u32 Copy_Image, u8 *Copy_Greens)
+{
+    u8 Local_Violation = 0;
+    u8 Local_Greens = SAFETY_ReduceImage(Copy_Image, &Local_Violation);
+
+    if (Copy_Greens != NULL)
+    {
+        *Copy_Greens = Local_Greens;
+    }
+
+    return (Local_Violation == 0) ? E_OK : E_NOT_OK;
+}
+
+u8 SAFETY_GetConflicts(u8 Copy_Groups)
+{
+    u8 Local_Conflicts = 0;
+    u8 Local_Group;
+
+    for (Local_Group = 0; Local_Group < SAFETY_GROUP_COUNT; Local_Group++)
+    {
+        if (Copy_Groups & SAFETY_GROUP_BIT(Local_Group))
+        {
+            Local_Conflicts |= SAFETY_ConflictMatrix[Local_Group];
+        }
+    }
+
+    return Local_Conflicts;
+}
+
+u32 SAFETY_GetMinClearanceMs(void)
+{
+    return SAFETY_MIN_CLEARANCE_MS;
+}
+/*****************************< End of Function Implementations *****************************/
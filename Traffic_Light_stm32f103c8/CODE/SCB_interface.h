@@ -48,6 +48,58 @@ void DisableGlobalInterrupts(void);
  */
 void EnableGlobalInterrupts(void);
 
+/**
+ * @brief Enter a critical section that is safe to nest and to use from interrupts.
+ *
+ * This function saves the current PRIMASK value and then disables global interrupts.
+ * Pass the returned value to `SCB_ExitCritical` to restore the previous state, so
+ * interrupts stay disabled if they already were on entry.
+ *
+ * @return The PRIMASK value before entering the critical section.
+ */
+u32 SCB_EnterCritical(void);
+
+/**
+ * @brief Leave a critical section entered with `SCB_EnterCritical`.
+ *
+ * @param[in] Copy_PriMask The value returned by the matching `SCB_EnterCritical` call.
+ *
+ * @return None
+ */
+void SCB_ExitCritical(u32 Copy_PriMask);
+
+/**
+ * @brief Set the priority of the SysTick exception.
+ *
+ * @param[in] Copy_Priority 0 (highest) to 15, the four implemented priority bits with the
+ *                          group priority in the upper bits as split by the NVIC grouping.
+ *
+ * @return None
+ */
+void SCB_SetSysTickPriority(u8 Copy_Priority);
+
+/**
+ * @brief Sleep until an interrupt is pending (WFI).
+ *
+ * A pending interrupt wakes the core even while PRIMASK is set, so the caller can check
+ * for work inside a critical section and sleep without missing an interrupt that arrives
+ * in between. The handler then runs once the critical section is left.
+ *
+ * @return None
+ */
+void SCB_WaitForInterrupt(void);
+
+/**
+ * @brief Select sleep or deep sleep for the next WFI.
+ *
+ * What deep sleep means (STOP or STANDBY on the STM32F1) is chosen in the PWR registers.
+ *
+ * @param[in] Copy_Enable 1 for deep sleep, 0 for sleep.
+ *
+ * @return None
+ */
+void SCB_SetDeepSleep(u8 Copy_Enable);
+
 /*****************************< Function to enable/disable specific faults *****************************/
 /**
  * @brief Enable the Memory Management Fault in the System Control Block (SCB).
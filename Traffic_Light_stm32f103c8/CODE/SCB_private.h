@@ -12,6 +12,7 @@
 
 /**< SCB Registers */
 #define SCB_AIRCR           (*((volatile u32 *)(SCB_BASE_ADDRESS + 0x00C))) /**< APPLICATION INTERRUPT AND RESET CONTROL REGISTER */
+#define SCB_SCR             (*((volatile u32 *)(SCB_BASE_ADDRESS + 0x010))) /**< SYSTEM CONTROL REGISTER */
 #define SCB_SHCSR           (*((volatile u32 *)(SCB_BASE_ADDRESS + 0x024))) /**< SYSTEM HANDLER CONTROL AND STATE REGISTER */
 #define SCB_SHPR1           (*((volatile u32 *)(SCB_BASE_ADDRESS + 0xD18))) /**< SYSTEM HANDLER PRIORITY REGISTER 1 */
 #define SCB_SHPR2           (*((volatile u32 *)(SCB_BASE_ADDRESS + 0xD1C))) /**< SYSTEM HANDLER PRIORITY REGISTER 2 */
@@ -22,6 +23,13 @@
 #define SCB_SHCSR_BUSFAULTENA_POS    17  /**< Bit position for Bus Fault Enable */
 #define SCB_SHCSR_USGFAULTENA_POS    18  /**< Bit position for Usage Fault Enable */
 
+/**< SysTick priority field of SCB_SHPR3 */
+#define SCB_SHPR3_PRI_SYSTICK_POS   24          /**< Bit position for the SysTick priority */
+#define SCB_SHPR3_PRI_SYSTICK_MASK  0xFF000000  /**< Mask for the SysTick priority */
+
+/**< Bit positions for SCB_SCR register */
+#define SCB_SCR_SLEEPDEEP_POS       2   /**< Bit position for deep sleep on WFI */
+
 /**< Bit positions for SCB_AIRCR register */
 #define SCB_AIRCR_PRIGROUP_POS      8          /**< Bit position for Priority Grouping */
 #define SCB_AIRCR_PRIGROUP_MASK     0x00000700 /**< Mask for Priority Grouping Bits */
@@ -29,6 +29,45 @@ void EnableGlobalInterrupts(void)
     __asm volatile ("cpsie i");
 }
 
+u32 SCB_EnterCritical(void)
+{
+    u32 Local_PriMask;
+
+    __asm volatile ("mrs %0, primask" : "=r" (Local_PriMask));
+    __asm volatile ("cpsid i" : : : "memory");
+
+    return Local_PriMask;
+}
+
+void SCB_ExitCritical(u32 Copy_PriMask)
+{
+    __asm volatile ("msr primask, %0" : : "r" (Copy_PriMask) : "memory");
+}
+
+void SCB_SetSysTickPriority(u8 Copy_Priority)
+{
+    /**< Only the upper 4 bits of the priority byte are implemented */
+    SCB_SHPR3 = (SCB_SHPR3 & ~SCB_SHPR3_PRI_SYSTICK_MASK) | ((u32)((Copy_Priority & 0x0F) << 4) << SCB_SHPR3_PRI_SYSTICK_POS);
+}
+
+void SCB_WaitForInterrupt(void)
+{
+    __asm volatile ("dsb" : : : "memory");
+    __asm volatile ("wfi");
+}
+
+void SCB_SetDeepSleep(u8 Copy_Enable)
+{
+    if (Copy_Enable)
+    {
+        SCB_SCR |= (1 << SCB_SCR_SLEEPDEEP_POS);
+    }
+    else
+    {
+        SCB_SCR &= ~(1 << SCB_SCR_SLEEPDEEP_POS);
+    }
+}
+
 void SCB_EnableMemFault(void)
 {
     /**< Enable the Memory Management Fault */
@@ -41,5 +41,15 @@
  */
 #define STK_CTRL_TICKINT       STK_CTRL_TICKINT_ENABLE
 
+/**
+ * @brief Specifies whether every SysTick wrap is recorded in the trace stream.
+ *
+ * @param STK_TRACE_ENABLE  Each time the counter reaches zero a tick event is appended (see TRACE_interface.h).
+ * @param STK_TRACE_DISABLE No tracing.
+ *
+ * @retval None
+ */
+#define STK_TRACE_WRAPS        STK_TRACE_DISABLE
+
 
 #endif /**< STK_CONFIG_H_ */
\ No newline at end of file
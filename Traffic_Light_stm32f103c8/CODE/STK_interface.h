@@ -7,6 +7,19 @@
 #ifndef STK_INTERFACE_H_
 #define STK_INTERFACE_H_
 
+/**
+ * @brief Tell the SysTick driver which core clock is running.
+ *
+ * All delay conversions derive their tick counts from this value (divided according to
+ * STK_CTRL_CLKSOURCE). Call it with MCAL_RCC_GetSysClockFreq() after the clock bring-up;
+ * until then the HSI frequency is assumed.
+ *
+ * @param[in] Copy_HclkFreq The core (AHB) clock frequency in Hz.
+ *
+ * @return None.
+ */
+void MCAL_STK_SetClockFreq(u32 Copy_HclkFreq);
+
 /**
  * @brief Initializes the SysTick timer with the specified reload value.
  *
@@ -136,6 +149,9 @@ Std_ReturnType MCAL_STK_SetXDelay_ms(f32 Copy_Milliseconds);
  * This function configures the SysTick timer to generate a single-shot interval after the specified number of microseconds.
  * When the interval elapses, the provided callback function will be called.
  *
+ * Intervals longer than one 24-bit reload are split into equal reloads, so the core is
+ * woken briefly every 1.8 s at 72 MHz; the callback runs only at the end.
+ *
  * @param[in] Copy_Microseconds The duration of the interval in microseconds.
  * @param[in] Copy_Callback A pointer to the callback function to execute when the interval elapses.
  *
@@ -156,4 +172,20 @@ Std_ReturnType MCAL_STK_SetIntervalSingle(u32 Copy_Microseconds, void (*Copy_Cal
  */
 Std_ReturnType MCAL_STK_SetIntervalPeriodic(u32 Copy_Microseconds, void (*Copy_Callback)(void));
 
+/**
+ * @brief Get the time elapsed since the running interval (or the current period) started.
+ *
+ * Safe to call inside a critical section: a wrap whose handler has not run yet is counted.
+ *
+ * @return Elapsed microseconds, 0 if no interval runs.
+ */
+u32 MCAL_STK_GetIntervalElapsed_us(void);
+
+/**
+ * @brief Stop the running interval without calling its callback.
+ *
+ * @return None.
+ */
+void MCAL_STK_StopInterval(void);
+
 #endif /**< STK_INTERFACE_H_ */
@@ -55,31 +55,51 @@ typedef struct STK_RegDef_t{
 #define STK_CTRL_TICKINT_DISABLE         0
 
 
+/**
+ * @brief Specifies whether SysTick wraps are recorded in the trace stream.
+ *
+ * @param STK_TRACE_ENABLE  Record a tick event each time the counter reaches zero.
+ * @param STK_TRACE_DISABLE Do not record SysTick wraps.
+ *
+ * @retval None
+ */
+#define STK_TRACE_ENABLE                 1
+#define STK_TRACE_DISABLE                0
+
+
 #define STK_SINGLE_INTERVAL              0
 #define STK_PERIOD_INTERVAL              1
+#define STK_NO_INTERVAL                  2
+
+
+/**< Largest reload value (24-bit counter) */
+#define STK_MAX_RELOAD                   0x00FFFFFF
+
+/**< Interrupt Control and State Register, PENDSTSET shows a wrap whose handler has not run yet */
+#define STK_SCB_ICSR                     (*((volatile u32 *)0xE000ED04U))
+#define STK_SCB_ICSR_PENDSTSET_MASK      0x04000000
+#define STK_SCB_ICSR_PENDSTCLR_MASK      0x02000000
 
 
 /**
- * @brief Sets the system clock frequency for the SysTick peripheral.
- *
- * This function sets the system clock frequency for the SysTick peripheral. It does not allow changes to the values defined by the STK_CTRL_CLKSOURCE constant.
+ * @brief Core clock assumed until MCAL_STK_SetClockFreq is called (HSI after reset).
+ */
+#define STK_DEFAULT_HCLK_FREQ            8000000
+
+/**
+ * @brief Divider between the core clock and the SysTick counter clock.
  *
  * @note
  * The available options for STK_CTRL_CLKSOURCE are:
  * - STK_CTRL_CLKSOURCE_1: Processor clock (AHB clock) divided by 1
  * - STK_CTRL_CLKSOURCE_8: Processor clock (AHB clock) divided by 8
- *
- * @retval None
  */
 #if STK_CTRL_CLKSOURCE == STK_CTRL_CLKSOURCE_1
-    #define STK_AHB_CLK       8000000   /**< Processor clock (AHB clock) divided by 1 */
+    #define STK_CLKSOURCE_DIVIDER       1
 #elif STK_CTRL_CLKSOURCE == STK_CTRL_CLKSOURCE_8
-    #define STK_AHB_CLK       1000000   /**< Processor clock (AHB clock) divided by 8 */
+    #define STK_CLKSOURCE_DIVIDER       8
 #else
     #error "You chose a wrong clock source for the SysTick"
 #endif
 
-
-
-
 #endif /**< STK_PRIVATE_H_ */
\ No newline at end of file
@@ -10,14 +10,48 @@
 #include "BIT_MATH.h"
 /*****************************< MCAL *****************************/
 #include "STK_interface.h"
-#include "STK_private.h"
 #include "STK_config.h"
+#include "STK_private.h"
+#if STK_TRACE_WRAPS == STK_TRACE_ENABLE
+/*****************************< SERVICE *****************************/
+#include "TRACE_interface.h"
+#endif
+
+/*****************************< Private Variables *****************************/
+static u32 STK_HclkFreq = STK_DEFAULT_HCLK_FREQ;                             /**< Core clock published by the clock driver */
+static u32 STK_CounterFreq = STK_DEFAULT_HCLK_FREQ / STK_CLKSOURCE_DIVIDER;  /**< SysTick counter clock */
+static void (*STK_Callback)(void) = NULL;
+static volatile u8 STK_IntervalMode = STK_NO_INTERVAL;
+static u32 STK_ChunkCounts = 0;             /**< Counts per reload of the running interval */
+static volatile u32 STK_ChunksLeft = 0;     /**< Reloads left before a single interval expires */
+static u32 STK_ChunksTotal = 0;             /**< Reloads making up the running interval */
+
+/*****************************< Private Functions *****************************/
+static void STK_StartCounting(u32 Copy_Counts)
+{
+    /**< Writing VAL clears the counter, so the first reload starts a full period */
+    STK->CTRL = 0;
+    STK_SCB_ICSR = STK_SCB_ICSR_PENDSTCLR_MASK;
+    STK->LOAD = Copy_Counts - 1;
+    STK->VAL = 0;
+#if STK_CTRL_CLKSOURCE == STK_CTRL_CLKSOURCE_1
+    STK->CTRL = STK_CTRL_CLKSOURCE_MASK | STK_CTRL_TICKINT_MASK | STK_CTRL_ENABLE_MASK;
+#else
+    STK->CTRL = STK_CTRL_TICKINT_MASK | STK_CTRL_ENABLE_MASK;
+#endif
+}
 
 /**
  * @defgroup Public_Functions STK Driver
  * @{
  */
 
+void MCAL_STK_SetClockFreq(u32 Copy_HclkFreq)
+{
+    STK_HclkFreq = Copy_HclkFreq;
+    STK_CounterFreq = Copy_HclkFreq / STK_CLKSOURCE_DIVIDER;
+}
+
 void MCAL_STK_Init(u32 Copy_Ticks)
 {
     /**< Disable SysTick timer */
@@ -107,7 +141,7 @@ Std_ReturnType MCAL_STK_SetBusyWait(u32 Copy_Microseconds)
     Std_ReturnType Local_FunctionStatus = E_NOT_OK;
 
     /**< Calculate the number of ticks required for the given microseconds */
-    u32 TicksRequired = (Copy_Microseconds * (STK_AHB_CLK / 1000000));
+    u32 TicksRequired = (Copy_Microseconds * (STK_CounterFreq / 1000000));
 
     /**< Check if the ticks required is within the valid range */
     if (TicksRequired <= 0x00FFFFFF)
@@ -122,6 +156,10 @@ Std_ReturnType MCAL_STK_SetBusyWait(u32 Copy_Microseconds)
         while (!(STK->CTRL & STK_CTRL_COUNTFLAG_MASK))
             ;
 
+#if STK_TRACE_WRAPS == STK_TRACE_ENABLE
+        TRACE_RecordTick();
+#endif
+
         /**< Disable the SysTick timer */
         STK->CTRL &= ~STK_CTRL_ENABLE_MASK;
 
@@ -137,7 +175,7 @@ Std_ReturnType MCAL_STK_SetBusyWait(u32 Copy_Microseconds)
 Std_ReturnType MCAL_STK_SetDelay_ms(f32 Copy_Milliseconds)
 {
     /**< Calculate the number of ticks required to wait for the specified number of milliseconds */
-    u32 Local_u32Ticks = (u32)((Copy_Milliseconds * STK_AHB_CLK) / 1000.0);
+    u32 Local_u32Ticks = (u32)((Copy_Milliseconds * STK_CounterFreq) / 1000.0);
 
     /**< Check if TicksRequired is within the valid range */
     if (Local_u32Ticks <= 0x00FFFFFF)
@@ -152,6 +190,10 @@ Std_ReturnType MCAL_STK_SetDelay_ms(f32 Copy_Milliseconds)
         while (!(STK->CTRL & STK_CTRL_COUNTFLAG_MASK))
             ;
 
+#if STK_TRACE_WRAPS == STK_TRACE_ENABLE
+        TRACE_RecordTick();
+#endif
+
         /**< Disable SysTick timer */
         STK->CTRL &= ~STK_CTRL_ENABLE_MASK;
 
@@ -173,7 +215,7 @@ Std_ReturnType MCAL_STK_SetXDelay_ms(f32 Copy_Milliseconds)
     // divide clock by 8
     STK->CTRL &= ~(0x4);
 
-    u32 Local_u32Ticks = (u32)((STK_AHB_CLK) / 1000.0); // number of ticks to make 1 ms
+    u32 Local_u32Ticks = (u32)((STK_HclkFreq / 8) / 1000.0); // number of ticks to make 1 ms
 
     /**< Configure SysTick timer with the calculated number of ticks */
     STK->LOAD = Local_u32Ticks;
@@ -185,6 +227,9 @@ Std_ReturnType MCAL_STK_SetXDelay_ms(f32 Copy_Milliseconds)
         if ((STK->CTRL & STK_CTRL_COUNTFLAG_MASK))
         {
             Time_passed += 1; // in ms
+#if STK_TRACE_WRAPS == STK_TRACE_ENABLE
+            TRACE_RecordTick();
+#endif
         }
         STK->CTRL &= ~(STK_CTRL_COUNTFLAG_MASK);
     }
@@ -200,10 +245,79 @@ Std_ReturnType MCAL_STK_SetXDelay_ms(f32 Copy_Milliseconds)
 
 Std_ReturnType MCAL_STK_SetIntervalSingle(u32 Copy_Microseconds, void (*Copy_Callback)(void))
 {
+    u32 Local_CountsPerUs = STK_CounterFreq / 1000000;
+    u32 Local_Counts;
+    u32 Local_Chunks;
+
+    if ((Copy_Callback == NULL) || (Copy_Microseconds == 0) || (Copy_Microseconds > (0xFFFFFFFFU / Local_CountsPerUs)))
+    {
+        return E_NOT_OK;
+    }
+
+    /**< Longer intervals are split into equal reloads; the remainder is below one count per reload */
+    Local_Counts = Copy_Microseconds * Local_CountsPerUs;
+    Local_Chunks = (Local_Counts / (STK_MAX_RELOAD + 1)) + 1;
+
+    STK_IntervalMode = STK_SINGLE_INTERVAL;
+    STK_Callback = Copy_Callback;
+    STK_ChunkCounts = Local_Counts / Local_Chunks;
+    STK_ChunksTotal = Local_Chunks;
+    STK_ChunksLeft = Local_Chunks;
+    STK_StartCounting(STK_ChunkCounts);
+
+    return E_OK;
 }
 
 Std_ReturnType MCAL_STK_SetIntervalPeriodic(u32 Copy_Microseconds, void (*Copy_Callback)(void))
 {
+    u32 Local_CountsPerUs = STK_CounterFreq / 1000000;
+
+    if ((Copy_Callback == NULL) || (Copy_Microseconds == 0) || (Copy_Microseconds > (STK_MAX_RELOAD / Local_CountsPerUs)))
+    {
+        return E_NOT_OK;
+    }
+
+    STK_IntervalMode = STK_PERIOD_INTERVAL;
+    STK_Callback = Copy_Callback;
+    STK_ChunkCounts = Copy_Microseconds * Local_CountsPerUs;
+    STK_ChunksTotal = 1;
+    STK_ChunksLeft = 1;
+    STK_StartCounting(STK_ChunkCounts);
+
+    return E_OK;
+}
+
+u32 MCAL_STK_GetIntervalElapsed_us(void)
+{
+    u32 Local_Done;
+    u32 Local_Counts;
+
+    if (STK_IntervalMode == STK_NO_INTERVAL)
+    {
+        return 0;
+    }
+
+    Local_Done = STK_ChunksTotal - STK_ChunksLeft;
+    Local_Counts = STK->LOAD - STK->VAL;
+
+    /**< A wrap whose handler is held off by the caller's critical section */
+    if (STK_SCB_ICSR & STK_SCB_ICSR_PENDSTSET_MASK)
+    {
+        Local_Done++;
+        Local_Counts = STK->LOAD - STK->VAL;
+    }
+
+    return ((Local_Done * STK_ChunkCounts) + Local_Counts) / (STK_CounterFreq / 1000000);
+}
+
+void MCAL_STK_StopInterval(void)
+{
+    STK->CTRL = 0;
+    STK_IntervalMode = STK_NO_INTERVAL;
+    STK_ChunksLeft = 0;
+
+    /**< Drop a wrap that is already pending */
+    STK_SCB_ICSR = STK_SCB_ICSR_PENDSTCLR_MASK;
 }
 
 /**
@@ -215,6 +329,35 @@ Std_ReturnType MCAL_STK_SetIntervalPeriodic(u32 Copy_Microseconds, void (*Copy_C
  * @{
  */
 
+void SysTick_Handler(void)
+{
+    /**< Reading CTRL clears COUNTFLAG */
+    (void)STK->CTRL;
+
+#if STK_TRACE_WRAPS == STK_TRACE_ENABLE
+    TRACE_RecordTick();
+#endif
+
+    switch (STK_IntervalMode)
+    {
+    case STK_PERIOD_INTERVAL:
+        STK_Callback();
+        break;
+
+    case STK_SINGLE_INTERVAL:
+        if (--STK_ChunksLeft == 0)
+        {
+            STK->CTRL = 0;
+            STK_IntervalMode = STK_NO_INTERVAL;
+            STK_Callback();
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
 /**
  * @} // End of IRQ_Handlers
  */
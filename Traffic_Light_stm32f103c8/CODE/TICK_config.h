@@ -0,0 +1,32 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : TICK_config.h              *****************/
+/****************************************************************/
+#ifndef TICK_CONFIG_H_
+#define TICK_CONFIG_H_
+
+/**
+ * @brief How the core idles between control ticks.
+ *
+ * @param TICK_MODE_PERIODIC SysTick fires every tick; the core sleeps (WFI) between ticks.
+ * @param TICK_MODE_TICKLESS SysTick is reprogrammed to the next deadline given to TICK_Idle,
+ *                           so the core sleeps through whole phases.
+ */
+#define TICK_MODE                   TICK_MODE_TICKLESS
+
+/**
+ * @brief Longest single tickless sleep in milliseconds.
+ */
+#define TICK_MAX_SLEEP_MS           60000
+
+/**
+ * @brief Supply current while running and while sleeping, for the projected draw.
+ *
+ * Typical values at 72 MHz with the used peripherals clocked, code in flash; adjust for the board.
+ */
+#define TICK_RUN_CURRENT_UA         36000
+#define TICK_SLEEP_CURRENT_UA       14400
+
+#endif /**< TICK_CONFIG_H_ */
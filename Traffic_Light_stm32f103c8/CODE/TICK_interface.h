@@ -0,0 +1,123 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : TICK_interface.h           *****************/
+/****************************************************************/
+#ifndef TICK_INTERFACE_H_
+#define TICK_INTERFACE_H_
+
+/**
+ * @defgroup TICK_Types TICK Type Definitions
+ * @{
+ */
+
+/**
+ * @brief Reports whether the main loop has work besides ticks. Called with interrupts disabled.
+ */
+typedef u8 (*TICK_WorkCheck_t)(void);
+
+/** @} */ // End of TICK_Types
+
+/**
+ * @defgroup TICK_Functions TICK Functions
+ * @brief Control tick timebase and idle path of the main loop.
+ *
+ * SysTick counts ticks in its interrupt; the main loop takes them with TICK_Take and runs
+ * one control step per tick, then calls TICK_Idle. In tickless mode the idle path sleeps up
+ * to the deadline it is given with a single SysTick interval; an earlier wake-up credits the
+ * whole ticks that passed and realigns the next tick to the original grid, so no time is lost.
+ * @{
+ */
+
+/**
+ * @brief Start the tick.
+ *
+ * @param[in] Copy_PeriodMs Tick period in milliseconds.
+ * @param[in] Copy_HclkFreq Core clock in Hz, after MCAL_STK_SetClockFreq.
+ *
+ * @return E_OK if SysTick accepted the period, E_NOT_OK otherwise.
+ */
+Std_ReturnType TICK_Init(u32 Copy_PeriodMs, u32 Copy_HclkFreq);
+
+/**
+ * @brief Take the ticks that elapsed since the last call.
+ *
+ * @return Number of control steps to run.
+ */
+u32 TICK_Take(void);
+
+/**
+ * @brief Sleep until there is work.
+ *
+ * Returns at once if ticks are pending or Copy_HasWork reports work. Otherwise executes
+ * WFI until one of them is true; in tickless mode the tick interrupt is held off for
+ * Copy_IdleTicks ticks in the meantime.
+ *
+ * @param[in] Copy_IdleTicks Ticks without a deadline (1 keeps the periodic tick).
+ * @param[in] Copy_HasWork Work check, or NULL if only ticks end the sleep.
+ *
+ * @return None.
+ */
+void TICK_Idle(u32 Copy_IdleTicks, TICK_WorkCheck_t Copy_HasWork);
+
+/**
+ * @brief Enter STOP until an EXTI line wakes the core.
+ *
+ * Returns E_NOT_OK at once if ticks are pending or Copy_HasWork reports work. Otherwise
+ * SysTick is stopped with the rest of the clocks, and after the wake-up the core runs from
+ * HSI, the tick grid restarts at the wake-up and one tick is credited right away. The time
+ * spent in STOP is not counted by TICK_GetTimeUs. The caller restores the configured clock
+ * (MCAL_RCC_InitSysClock, then TICK_SetClockFreq).
+ *
+ * @param[in] Copy_HasWork Work check, or NULL.
+ *
+ * @return E_OK after a wake-up from STOP, E_NOT_OK if STOP was not entered.
+ */
+Std_ReturnType TICK_Stop(TICK_WorkCheck_t Copy_HasWork);
+
+/**
+ * @brief Follow a change of the core clock without losing the tick grid.
+ *
+ * @param[in] Copy_HclkFreq The new core clock in Hz.
+ *
+ * @return None.
+ */
+void TICK_SetClockFreq(u32 Copy_HclkFreq);
+
+/**
+ * @brief Get the time since TICK_Init, also across sleeps (the DWT cycle counter stops during WFI).
+ *
+ * Safe from any context. Wraps after about 71 minutes; use differences.
+ *
+ * @return Microseconds.
+ */
+u32 TICK_GetTimeUs(void);
+
+/**
+ * @brief Move the tick grid, to steer it onto an external time reference.
+ *
+ * The boundary ending the running tick (or tickless sleep) comes Copy_Us later, or earlier for
+ * a negative value, and so do all boundaries after it. TICK_GetTimeUs steps back by the same
+ * amount, so the time read at a boundary stays a whole number of ticks. A step is limited to
+ * half a tick, and the running interval is never shortened to below TICK_MIN_INTERVAL_US.
+ *
+ * @param[in] Copy_Us Microseconds to delay the grid by (negative: advance).
+ *
+ * @return The microseconds applied; the caller carries the rest over to a later call.
+ */
+s32 TICK_Slew(s32 Copy_Us);
+
+/**
+ * @brief Get the duty cycle since the previous call and the projected supply current.
+ *
+ * @param[out] Copy_DutyPermille Time awake per mille.
+ * @param[out] Copy_CurrentUa Average current from TICK_RUN_CURRENT_UA and TICK_SLEEP_CURRENT_UA.
+ *
+ * @return E_OK if a tick elapsed in the window, E_NOT_OK otherwise.
+ */
+Std_ReturnType TICK_GetDuty(u32 *Copy_DutyPermille, u32 *Copy_CurrentUa);
+
+/** @} */ // End of TICK_Functions
+
+#endif /**< TICK_INTERFACE_H_ */
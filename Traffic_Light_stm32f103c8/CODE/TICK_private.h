@@ -0,0 +1,22 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : TICK_private.h             *****************/
+/****************************************************************/
+#ifndef TICK_PRIVATE_H_
+#define TICK_PRIVATE_H_
+
+#define TICK_MODE_PERIODIC          0
+#define TICK_MODE_TICKLESS          1
+
+#if (TICK_MODE != TICK_MODE_PERIODIC) && (TICK_MODE != TICK_MODE_TICKLESS)
+#error "Invalid TICK_MODE value. Please choose TICK_MODE_PERIODIC or TICK_MODE_TICKLESS."
+#endif
+
+#define TICK_PERMILLE               1000
+
+/**< Shortest interval TICK_Slew leaves running, so the boundary it moves is not missed */
+#define TICK_MIN_INTERVAL_US        50
+
+#endif /**< TICK_PRIVATE_H_ */
@@ -0,0 +1,322 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : TICK_program.c             *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "DWT_interface.h"
+#include "SCB_interface.h"
+#include "STK_interface.h"
+#include "RCC_interface.h"
+#include "PWR_interface.h"
+/*****************************< SERVICE *****************************/
+#include "TICK_interface.h"
+#include "TICK_config.h"
+#include "TICK_private.h"
+/*****************************< Private Variables *****************************/
+static volatile u32 TICK_Pending = 0;       /**< Ticks not taken yet */
+static volatile u32 TICK_WindowTicks = 0;   /**< Ticks credited since the last TICK_GetDuty */
+static volatile u32 TICK_SleepTicks = 0;    /**< Length of the running tickless sleep, 0 when ticking */
+static volatile u32 TICK_TotalTicks = 0;    /**< Tick boundaries passed since TICK_Init */
+static volatile s32 TICK_OffsetUs = 0;      /**< Position within the tick where the running SysTick interval started, below 0 after a delaying slew */
+static u32 TICK_PeriodMs = 1;
+static u32 TICK_PeriodUs = 1000;
+static u32 TICK_CyclesPerUs = 8;
+static u32 TICK_ActiveUs = 0;               /**< Time awake since the last TICK_GetDuty */
+static u32 TICK_AwakeSince = 0;             /**< Cycle stamp of the last wake-up */
+/*****************************< Private Functions *****************************/
+static void TICK_Credit(u32 Copy_Ticks)
+{
+    TICK_Pending += Copy_Ticks;
+    TICK_WindowTicks += Copy_Ticks;
+    TICK_TotalTicks += Copy_Ticks;
+}
+
+static void TICK_PeriodExpired(void)
+{
+    TICK_Credit(1);
+}
+
+static void TICK_Resync(void)
+{
+    TICK_Credit(1);
+    TICK_OffsetUs = 0;
+    (void)MCAL_STK_SetIntervalPeriodic(TICK_PeriodUs, TICK_PeriodExpired);
+}
+
+static void TICK_SleepExpired(void)
+{
+    TICK_Credit(TICK_SleepTicks);
+    TICK_SleepTicks = 0;
+    TICK_OffsetUs = 0;
+    (void)MCAL_STK_SetIntervalPeriodic(TICK_PeriodUs, TICK_PeriodExpired);
+}
+
+#if TICK_MODE == TICK_MODE_TICKLESS
+/**< Replace the periodic tick by one interval ending on the tick boundary Copy_Ticks ahead. Interrupts are disabled. */
+static void TICK_EnterTickless(u32 Copy_Ticks)
+{
+    /**< The running interval may be a resync that started part-way into the tick */
+    s32 Local_ElapsedUs = TICK_OffsetUs + (s32)MCAL_STK_GetIntervalElapsed_us();
+
+    /**< A tick is already due: let it run first */
+    if (Local_ElapsedUs >= (s32)TICK_PeriodUs)
+    {
+        return;
+    }
+
+    if (Copy_Ticks > (TICK_MAX_SLEEP_MS / TICK_PeriodMs))
+    {
+        Copy_Ticks = TICK_MAX_SLEEP_MS / TICK_PeriodMs;
+    }
+
+    TICK_OffsetUs = Local_ElapsedUs;
+    TICK_SleepTicks = Copy_Ticks;
+    if (MCAL_STK_SetIntervalSingle((u32)((s32)(Copy_Ticks * TICK_PeriodUs) - Local_ElapsedUs), TICK_SleepExpired) != E_OK)
+    {
+        /**< Fall back to the periodic tick, realigned to the grid */
+        TICK_SleepTicks = 0;
+        (void)MCAL_STK_SetIntervalSingle((u32)((s32)TICK_PeriodUs - Local_ElapsedUs), TICK_Resync);
+    }
+}
+
+/**< Woken before the deadline: credit the whole ticks and put the next tick back on the grid. Interrupts are disabled. */
+static void TICK_ExitTickless(void)
+{
+    s32 Local_TotalUs = TICK_OffsetUs + (s32)MCAL_STK_GetIntervalElapsed_us();
+    u32 Local_Ticks = (Local_TotalUs > 0) ? ((u32)Local_TotalUs / TICK_PeriodUs) : 0;
+
+    if (Local_Ticks > TICK_SleepTicks)
+    {
+        Local_Ticks = TICK_SleepTicks;
+    }
+
+    TICK_Credit(Local_Ticks);
+    TICK_SleepTicks = 0;
+    TICK_OffsetUs = Local_TotalUs - (s32)(Local_Ticks * TICK_PeriodUs);
+    (void)MCAL_STK_SetIntervalSingle((u32)((s32)TICK_PeriodUs - TICK_OffsetUs), TICK_Resync);
+}
+#endif
+/*****************************< Function Implementations *****************************/
+Std_ReturnType TICK_Init(u32 Copy_PeriodMs, u32 Copy_HclkFreq)
+{
+    if (Copy_PeriodMs == 0)
+    {
+        return E_NOT_OK;
+    }
+
+    TICK_PeriodMs = Copy_PeriodMs;
+    TICK_PeriodUs = Copy_PeriodMs * 1000;
+    TICK_CyclesPerUs = (Copy_HclkFreq >= 1000000) ? (Copy_HclkFreq / 1000000) : 1;
+    TICK_Pending = 0;
+    TICK_WindowTicks = 0;
+    TICK_SleepTicks = 0;
+    TICK_TotalTicks = 0;
+    TICK_OffsetUs = 0;
+    TICK_ActiveUs = 0;
+    TICK_AwakeSince = MCAL_DWT_GetCycles();
+
+    return MCAL_STK_SetIntervalPeriodic(TICK_PeriodUs, TICK_PeriodExpired);
+}
+
+u32 TICK_Take(void)
+{
+    u32 Local_PriMask = SCB_EnterCritical();
+    u32 Local_Ticks = TICK_Pending;
+
+    TICK_Pending = 0;
+
+    SCB_ExitCritical(Local_PriMask);
+
+    return Local_Ticks;
+}
+
+void TICK_Idle(u32 Copy_IdleTicks, TICK_WorkCheck_t Copy_HasWork)
+{
+    u32 Local_PriMask = SCB_EnterCritical();
+
+    if ((TICK_Pending == 0) && ((Copy_HasWork == NULL) || !Copy_HasWork()))
+    {
+#if TICK_MODE == TICK_MODE_TICKLESS
+        if (Copy_IdleTicks > 1)
+        {
+            TICK_EnterTickless(Copy_IdleTicks);
+        }
+#else
+        (void)Copy_IdleTicks;
+#endif
+
+        TICK_ActiveUs += (MCAL_DWT_GetCycles() - TICK_AwakeSince) / TICK_CyclesPerUs;
+
+        /**< Handlers run between the WFIs; intermediate SysTick reloads of a long sleep go back to sleep */
+        do
+        {
+            SCB_WaitForInterrupt();
+            SCB_ExitCritical(Local_PriMask);
+            Local_PriMask = SCB_EnterCritical();
+        } while ((TICK_Pending == 0) && ((Copy_HasWork == NULL) || !Copy_HasWork()));
+
+        TICK_AwakeSince = MCAL_DWT_GetCycles();
+
+#if TICK_MODE == TICK_MODE_TICKLESS
+        if (TICK_SleepTicks != 0)
+        {
+            TICK_ExitTickless();
+        }
+#endif
+    }
+
+    SCB_ExitCritical(Local_PriMask);
+}
+
+Std_ReturnType TICK_Stop(TICK_WorkCheck_t Copy_HasWork)
+{
+    u32 Local_PriMask = SCB_EnterCritical();
+    u32 Local_HclkFreq;
+
+    /**< A tick that is already due would be dropped with the SysTick interrupt */
+    if ((TICK_Pending != 0) || ((TICK_OffsetUs + (s32)MCAL_STK_GetIntervalElapsed_us()) >= (s32)TICK_PeriodUs) ||
+        ((Copy_HasWork != NULL) && Copy_HasWork()))
+    {
+        SCB_ExitCritical(Local_PriMask);
+        return E_NOT_OK;
+    }
+
+    MCAL_STK_StopInterval();
+    TICK_ActiveUs += (MCAL_DWT_GetCycles() - TICK_AwakeSince) / TICK_CyclesPerUs;
+
+    MCAL_PWR_EnterStop();
+
+    /**< Back on HSI; the grid restarts here since nothing counted while stopped */
+    MCAL_RCC_ExitStop();
+    Local_HclkFreq = MCAL_RCC_GetSysClockFreq();
+    MCAL_STK_SetClockFreq(Local_HclkFreq);
+    TICK_CyclesPerUs = (Local_HclkFreq >= 1000000) ? (Local_HclkFreq / 1000000) : 1;
+    TICK_AwakeSince = MCAL_DWT_GetCycles();
+
+    /**< Run one control step at once so the wake-up event is handled without waiting a period */
+    TICK_Credit(1);
+    TICK_OffsetUs = 0;
+    (void)MCAL_STK_SetIntervalPeriodic(TICK_PeriodUs, TICK_PeriodExpired);
+
+    SCB_ExitCritical(Local_PriMask);
+
+    return E_OK;
+}
+
+void TICK_SetClockFreq(u32 Copy_HclkFreq)
+{
+    u32 Local_PriMask = SCB_EnterCritical();
+    u32 Local_Now = MCAL_DWT_GetCycles();
+    s32 Local_ElapsedUs = TICK_OffsetUs + (s32)MCAL_STK_GetIntervalElapsed_us();
+
+    /**< Awake time so far is converted at the old rate */
+    TICK_ActiveUs += (Local_Now - TICK_AwakeSince) / TICK_CyclesPerUs;
+    TICK_AwakeSince = Local_Now;
+    TICK_CyclesPerUs = (Copy_HclkFreq >= 1000000) ? (Copy_HclkFreq / 1000000) : 1;
+
+    /**< Finish the current tick at the new rate, then tick periodically again */
+    if (Local_ElapsedUs >= (s32)TICK_PeriodUs)
+    {
+        Local_ElapsedUs = (s32)TICK_PeriodUs - 1;
+    }
+    MCAL_STK_SetClockFreq(Copy_HclkFreq);
+    TICK_OffsetUs = Local_ElapsedUs;
+    (void)MCAL_STK_SetIntervalSingle((u32)((s32)TICK_PeriodUs - Local_ElapsedUs), TICK_Resync);
+
+    SCB_ExitCritical(Local_PriMask);
+}
+
+u32 TICK_GetTimeUs(void)
+{
+    u32 Local_PriMask = SCB_EnterCritical();
+    u32 Local_TimeUs = (TICK_TotalTicks * TICK_PeriodUs) + (u32)TICK_OffsetUs + MCAL_STK_GetIntervalElapsed_us();
+
+    SCB_ExitCritical(Local_PriMask);
+
+    return Local_TimeUs;
+}
+
+s32 TICK_Slew(s32 Copy_Us)
+{
+    u32 Local_PriMask = SCB_EnterCritical();
+    s32 Local_ElapsedUs = TICK_OffsetUs + (s32)MCAL_STK_GetIntervalElapsed_us();
+    s32 Local_SpanUs = (s32)(((TICK_SleepTicks != 0) ? TICK_SleepTicks : 1) * TICK_PeriodUs);
+    s32 Local_LimitUs = (s32)TICK_PeriodUs / 2;
+
+    /**< A boundary that is already due is left to its handler */
+    if (Local_ElapsedUs >= Local_SpanUs)
+    {
+        SCB_ExitCritical(Local_PriMask);
+        return 0;
+    }
+
+    /**< At most half a tick per call, and the running interval keeps a minimum length */
+    if (Copy_Us > Local_LimitUs)
+    {
+        Copy_Us = Local_LimitUs;
+    }
+    else if (Copy_Us < -Local_LimitUs)
+    {
+        Copy_Us = -Local_LimitUs;
+    }
+    if ((Local_SpanUs - Local_ElapsedUs + Copy_Us) < TICK_MIN_INTERVAL_US)
+    {
+        Copy_Us = TICK_MIN_INTERVAL_US - (Local_SpanUs - Local_ElapsedUs);
+    }
+
+    /**< The boundary ending the running interval moves; the time read at it stays on the grid */
+    TICK_OffsetUs = Local_ElapsedUs - Copy_Us;
+    (void)MCAL_STK_SetIntervalSingle((u32)(Local_SpanUs - Local_ElapsedUs + Copy_Us),
+                                     (TICK_SleepTicks != 0) ? TICK_SleepExpired : TICK_Resync);
+
+    SCB_ExitCritical(Local_PriMask);
+
+    return Copy_Us;
+}
+
+Std_ReturnType TICK_GetDuty(u32 *Copy_DutyPermille, u32 *Copy_CurrentUa)
+{
+    u32 Local_PriMask;
+    u32 Local_Now;
+    u32 Local_ActiveUs;
+    u32 Local_WindowMs;
+    u32 Local_Duty;
+
+    if ((Copy_DutyPermille == NULL) || (Copy_CurrentUa == NULL))
+    {
+        return E_NOT_OK;
+    }
+
+    Local_PriMask = SCB_EnterCritical();
+    Local_Now = MCAL_DWT_GetCycles();
+    Local_ActiveUs = TICK_ActiveUs + ((Local_Now - TICK_AwakeSince) / TICK_CyclesPerUs);
+    Local_WindowMs = TICK_WindowTicks * TICK_PeriodMs;
+    TICK_ActiveUs = 0;
+    TICK_AwakeSince = Local_Now;
+    TICK_WindowTicks = 0;
+    SCB_ExitCritical(Local_PriMask);
+
+    if (Local_WindowMs == 0)
+    {
+        return E_NOT_OK;
+    }
+
+    /**< Microseconds per millisecond is per mille */
+    Local_Duty = Local_ActiveUs / Local_WindowMs;
+    if (Local_Duty > TICK_PERMILLE)
+    {
+        Local_Duty = TICK_PERMILLE;
+    }
+
+    *Copy_DutyPermille = Local_Duty;
+    *Copy_CurrentUa = ((Local_Duty * TICK_RUN_CURRENT_UA) + ((TICK_PERMILLE - Local_Duty) * TICK_SLEEP_CURRENT_UA)) / TICK_PERMILLE;
+
+    return E_OK;
+}
+/*****************************< End of Function Implementations *****************************/
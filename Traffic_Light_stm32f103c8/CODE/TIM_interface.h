@@ -0,0 +1,189 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : TIM_interface.h           *****************/
+/****************************************************************/
+#ifndef TIM_INTERFACE_H_
+#define TIM_INTERFACE_H_
+
+/**
+ * @defgroup TIM_Parameters TIM Parameters
+ * @{
+ */
+
+/**
+ * @name Timers
+ * @{
+ */
+#define TIM_TIMER2          0
+#define TIM_TIMER3          1
+#define TIM_TIMER4          2
+#define TIM_TIMER1          3   /**< Advanced-control timer on APB2 */
+#define TIM_TIMER_COUNT     4
+/** @} */
+
+/**
+ * @name Channels
+ * @{
+ */
+#define TIM_CHANNEL1        0
+#define TIM_CHANNEL2        1
+#define TIM_CHANNEL3        2
+#define TIM_CHANNEL4        3
+#define TIM_CHANNEL_COUNT   4
+/** @} */
+
+/**
+ * @name Capture Inputs
+ * @{
+ */
+#define TIM_CAPTURE_DIRECT      1   /**< Channel x captures its own input TIx */
+#define TIM_CAPTURE_PAIRED      2   /**< Channel x captures the other input of its pair: 1 <-> 2, 3 <-> 4 */
+/** @} */
+
+/**
+ * @name Capture Edges
+ * @{
+ */
+#define TIM_EDGE_RISING         0
+#define TIM_EDGE_FALLING        1
+/** @} */
+
+/**
+ * @name DMA Requests
+ * @brief Events that raise the timer's DMA request; each is wired to a fixed DMA1 channel
+ *        (update: TIM2 channel 2, TIM3 channel 3, TIM4 channel 7, TIM1 channel 5;
+ *        TIM1 CC1 channel 2, CC2 channel 3, CC3 channel 6, CC4 channel 4).
+ * @{
+ */
+#define TIM_DMA_UPDATE      8   /**< Counter update (UDE) */
+#define TIM_DMA_CC1         9   /**< Compare/capture 1 (CC1DE) */
+#define TIM_DMA_CC2         10  /**< Compare/capture 2 (CC2DE) */
+#define TIM_DMA_CC3         11  /**< Compare/capture 3 (CC3DE) */
+#define TIM_DMA_CC4         12  /**< Compare/capture 4 (CC4DE) */
+/** @} */
+
+/** @} */ // End of TIM_Parameters
+
+/**
+ * @defgroup TIM_Functions TIM Functions
+ * @brief PWM output, DMA pacing and input capture on TIM1 .. TIM4.
+ *
+ * The timer clock must be enabled in RCC. For TIM2 .. TIM4 it is PCLK1 when the APB1 prescaler
+ * is 1 and twice PCLK1 otherwise; for TIM1 the same holds with APB2 and PCLK2. Compare values
+ * are preloaded and take effect at the next period, so the waveform never glitches and the CPU
+ * is not involved per period. The pins are routed with MCAL_AFIO_SetTimerRemap and set to
+ * alternate function push-pull for outputs, or to an input mode for capture.
+ * @{
+ */
+
+/**
+ * @brief Set up a timer for PWM and start its counter. All channels stay disabled.
+ *
+ * @param[in] Copy_Timer TIM_TIMERx.
+ * @param[in] Copy_TimerClockFreq Timer clock in Hz.
+ * @param[in] Copy_PwmFreq PWM frequency in Hz.
+ * @param[in] Copy_Steps Counts per period; a compare value of Copy_Steps is always on.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid timer or a frequency the prescaler cannot reach.
+ */
+Std_ReturnType MCAL_TIM_InitPwm(u8 Copy_Timer, u32 Copy_TimerClockFreq, u32 Copy_PwmFreq, u16 Copy_Steps);
+
+/**
+ * @brief Keep the PWM frequency after the timer clock changed.
+ *
+ * @param[in] Copy_Timer TIM_TIMERx.
+ * @param[in] Copy_TimerClockFreq The new timer clock in Hz.
+ * @param[in] Copy_PwmFreq PWM frequency in Hz.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid timer or an unreachable frequency.
+ */
+Std_ReturnType MCAL_TIM_SetClockFreq(u8 Copy_Timer, u32 Copy_TimerClockFreq, u32 Copy_PwmFreq);
+
+/**
+ * @brief Enable a channel as PWM output (mode 1, active high).
+ *
+ * @param[in] Copy_Timer TIM_TIMERx.
+ * @param[in] Copy_Channel TIM_CHANNEL1 .. TIM_CHANNEL4.
+ * @param[in] Copy_Compare Initial on-time in counts, loaded before the output is enabled.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid timer or channel.
+ */
+Std_ReturnType MCAL_TIM_EnablePwmChannel(u8 Copy_Timer, u8 Copy_Channel, u16 Copy_Compare);
+
+/**
+ * @brief Set the on-time of a channel from the next period on.
+ *
+ * @param[in] Copy_Timer TIM_TIMERx.
+ * @param[in] Copy_Channel TIM_CHANNEL1 .. TIM_CHANNEL4.
+ * @param[in] Copy_Compare On-time in counts: 0 is off, the step count or more is on.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid timer or channel.
+ */
+Std_ReturnType MCAL_TIM_SetCompare(u8 Copy_Timer, u8 Copy_Channel, u16 Copy_Compare);
+
+/**
+ * @brief Let a timer event raise its DMA request, e.g. to pace memory-to-GPIO transfers without the CPU.
+ *
+ * Set up the DMA channel first: the request is raised from the next event on.
+ *
+ * @param[in] Copy_Timer TIM_TIMERx.
+ * @param[in] Copy_Request TIM_DMA_UPDATE or TIM_DMA_CCx.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid timer or request.
+ */
+Std_ReturnType MCAL_TIM_EnableDmaRequest(u8 Copy_Timer, u8 Copy_Request);
+
+/**
+ * @brief Start a timer as a free-running 16-bit counter, e.g. as the time base of input capture.
+ *
+ * The counter wraps from 0xFFFF to 0 every 65536 ticks. All channels are disabled.
+ *
+ * @param[in] Copy_Timer TIM_TIMERx.
+ * @param[in] Copy_TimerClockFreq Timer clock in Hz.
+ * @param[in] Copy_TickFreq Counter rate in Hz; the timer clock should be a multiple of it.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid timer or a rate the prescaler cannot reach.
+ */
+Std_ReturnType MCAL_TIM_InitCounter(u8 Copy_Timer, u32 Copy_TimerClockFreq, u32 Copy_TickFreq);
+
+/**
+ * @brief Enable a channel as input capture: each selected edge latches the counter into the channel's CCR.
+ *
+ * Capture is on one edge only. For both edges of an input, capture it on both channels of its
+ * pair, one direct and one paired, with opposite edges. Reading the CCR (by the CPU or by DMA
+ * on TIM_DMA_CCx) takes the value.
+ *
+ * @param[in] Copy_Timer TIM_TIMERx.
+ * @param[in] Copy_Channel TIM_CHANNEL1 .. TIM_CHANNEL4.
+ * @param[in] Copy_Input TIM_CAPTURE_DIRECT or TIM_CAPTURE_PAIRED.
+ * @param[in] Copy_Edge TIM_EDGE_RISING or TIM_EDGE_FALLING.
+ * @param[in] Copy_Filter Input filter ICxF, 0 (none) .. 15 (longest): a level must hold for a number of samples to count.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid timer, channel, input, edge or filter.
+ */
+Std_ReturnType MCAL_TIM_EnableCapture(u8 Copy_Timer, u8 Copy_Channel, u8 Copy_Input, u8 Copy_Edge, u8 Copy_Filter);
+
+/**
+ * @brief Read the counter.
+ *
+ * @param[in] Copy_Timer TIM_TIMERx.
+ *
+ * @return The counter, 0 for an invalid timer.
+ */
+u16 MCAL_TIM_GetCounter(u8 Copy_Timer);
+
+/**
+ * @brief Get the address of a channel's CCR, the peripheral address for DMA on TIM_DMA_CCx.
+ *
+ * @param[in] Copy_Timer TIM_TIMERx.
+ * @param[in] Copy_Channel TIM_CHANNEL1 .. TIM_CHANNEL4.
+ *
+ * @return The register address, 0 for an invalid timer or channel.
+ */
+u32 MCAL_TIM_GetCaptureAddress(u8 Copy_Timer, u8 Copy_Channel);
+
+/** @} */ // End of TIM_Functions
+
+#endif /**< TIM_INTERFACE_H_ */
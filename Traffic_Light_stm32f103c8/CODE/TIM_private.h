@@ -0,0 +1,64 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : TIM_private.h             *****************/
+/****************************************************************/
+#ifndef TIM_PRIVATE_H_
+#define TIM_PRIVATE_H_
+
+/**< Timer base addresses */
+#define TIM2_BASE_ADDRESS       0x40000000U
+#define TIM3_BASE_ADDRESS       0x40000400U
+#define TIM4_BASE_ADDRESS       0x40000800U
+#define TIM1_BASE_ADDRESS       0x40012C00U
+
+/**< Timer register structure; TIM1 adds RCR and BDTR in the general-purpose timers' reserved slots */
+typedef struct
+{
+    volatile u32 CR1;       /**< Control Register 1 */
+    volatile u32 CR2;       /**< Control Register 2 */
+    volatile u32 SMCR;      /**< Slave Mode Control Register */
+    volatile u32 DIER;      /**< DMA/Interrupt Enable Register */
+    volatile u32 SR;        /**< Status Register */
+    volatile u32 EGR;       /**< Event Generation Register */
+    volatile u32 CCMR[2];   /**< Capture/Compare Mode Registers, two channels each */
+    volatile u32 CCER;      /**< Capture/Compare Enable Register */
+    volatile u32 CNT;       /**< Counter */
+    volatile u32 PSC;       /**< Prescaler */
+    volatile u32 ARR;       /**< Auto-Reload Register */
+    volatile u32 RCR;       /**< Repetition Counter Register (TIM1 only) */
+    volatile u32 CCR[TIM_CHANNEL_COUNT];   /**< Capture/Compare Registers 1..4 at index 0..3 */
+    volatile u32 BDTR;      /**< Break and Dead-Time Register (TIM1 only) */
+    volatile u32 DCR;       /**< DMA Control Register */
+    volatile u32 DMAR;      /**< DMA Address for Full Transfer */
+} TIM_RegDef_t;
+
+/**< CR1 bits */
+#define TIM_CR1_CEN             0   /**< Counter enable */
+#define TIM_CR1_ARPE            7   /**< Auto-reload preload enable */
+
+/**< EGR bits */
+#define TIM_EGR_UG              0   /**< Update generation */
+
+/**< Channel field in CCMR1/CCMR2: 8 bits per channel, two channels per register */
+#define TIM_CCMR_INDEX(CHANNEL)     ((CHANNEL) / 2)
+#define TIM_CCMR_SHIFT(CHANNEL)     (((CHANNEL) % 2) * 8)
+#define TIM_CCMR_FIELD_MASK         0xFFU
+#define TIM_CCMR_OCPE               0x08U   /**< Output compare preload enable */
+#define TIM_CCMR_OCM_PWM1           0x60U   /**< Active while CNT < CCR */
+#define TIM_CCMR_ICF_SHIFT          4       /**< Input filter ICxF, capture mode */
+#define TIM_CCMR_ICF_MAX            15
+
+/**< Channel field in CCER: 4 bits per channel */
+#define TIM_CCER_SHIFT(CHANNEL)     ((CHANNEL) * 4)
+#define TIM_CCER_CCE                0x1U    /**< Output enable */
+#define TIM_CCER_CCP                0x2U    /**< Active low, or falling edge in capture mode */
+
+/**< BDTR bits */
+#define TIM_BDTR_MOE                15  /**< Main output enable, gates the TIM1 outputs */
+
+/**< 16-bit prescaler and counter */
+#define TIM_MAX_COUNT           0x10000UL
+
+#endif /**< TIM_PRIVATE_H_ */
@@ -0,0 +1,227 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : TIM_program.c             *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "TIM_interface.h"
+#include "TIM_private.h"
+/*****************************< Private Variables *****************************/
+static TIM_RegDef_t *const TIM_Timers[TIM_TIMER_COUNT] = {
+    (TIM_RegDef_t *)TIM2_BASE_ADDRESS,
+    (TIM_RegDef_t *)TIM3_BASE_ADDRESS,
+    (TIM_RegDef_t *)TIM4_BASE_ADDRESS,
+    (TIM_RegDef_t *)TIM1_BASE_ADDRESS,
+};
+/*****************************< Private Functions *****************************/
+/**< Prescaler for Copy_Steps counts per PWM period, or TIM_MAX_COUNT if out of range */
+static u32 TIM_GetPrescaler(u32 Copy_TimerClockFreq, u32 Copy_PwmFreq, u32 Copy_Steps)
+{
+    u32 Local_Divider;
+
+    if ((Copy_PwmFreq == 0) || (Copy_Steps == 0) || (Copy_PwmFreq > (Copy_TimerClockFreq / Copy_Steps)))
+    {
+        return TIM_MAX_COUNT;
+    }
+
+    Local_Divider = Copy_TimerClockFreq / (Copy_PwmFreq * Copy_Steps);
+
+    return (Local_Divider <= TIM_MAX_COUNT) ? (Local_Divider - 1) : TIM_MAX_COUNT;
+}
+/*****************************< Function Implementations *****************************/
+Std_ReturnType MCAL_TIM_InitPwm(u8 Copy_Timer, u32 Copy_TimerClockFreq, u32 Copy_PwmFreq, u16 Copy_Steps)
+{
+    TIM_RegDef_t *Local_Tim;
+    u32 Local_Prescaler;
+
+    if (Copy_Timer >= TIM_TIMER_COUNT)
+    {
+        return E_NOT_OK;
+    }
+
+    Local_Prescaler = TIM_GetPrescaler(Copy_TimerClockFreq, Copy_PwmFreq, Copy_Steps);
+    if (Local_Prescaler >= TIM_MAX_COUNT)
+    {
+        return E_NOT_OK;
+    }
+
+    Local_Tim = TIM_Timers[Copy_Timer];
+    Local_Tim->CR1 = 0;
+    Local_Tim->CCER = 0;
+    Local_Tim->PSC = Local_Prescaler;
+    Local_Tim->ARR = (u32)Copy_Steps - 1;
+    Local_Tim->CR1 = (1U << TIM_CR1_ARPE);
+
+    /**< Load PSC and ARR into their shadow registers before counting */
+    Local_Tim->EGR = (1U << TIM_EGR_UG);
+    SET_BIT(Local_Tim->CR1, TIM_CR1_CEN);
+
+    return E_OK;
+}
+
+Std_ReturnType MCAL_TIM_SetClockFreq(u8 Copy_Timer, u32 Copy_TimerClockFreq, u32 Copy_PwmFreq)
+{
+    TIM_RegDef_t *Local_Tim;
+    u32 Local_Prescaler;
+
+    if (Copy_Timer >= TIM_TIMER_COUNT)
+    {
+        return E_NOT_OK;
+    }
+
+    Local_Tim = TIM_Timers[Copy_Timer];
+    Local_Prescaler = TIM_GetPrescaler(Copy_TimerClockFreq, Copy_PwmFreq, Local_Tim->ARR + 1);
+    if (Local_Prescaler >= TIM_MAX_COUNT)
+    {
+        return E_NOT_OK;
+    }
+
+    /**< PSC is buffered: the new rate starts with the next period */
+    Local_Tim->PSC = Local_Prescaler;
+
+    return E_OK;
+}
+
+Std_ReturnType MCAL_TIM_EnablePwmChannel(u8 Copy_Timer, u8 Copy_Channel, u16 Copy_Compare)
+{
+    TIM_RegDef_t *Local_Tim;
+    u8 Local_Index;
+    u8 Local_Shift;
+
+    if ((Copy_Timer >= TIM_TIMER_COUNT) || (Copy_Channel >= TIM_CHANNEL_COUNT))
+    {
+        return E_NOT_OK;
+    }
+
+    Local_Tim = TIM_Timers[Copy_Timer];
+    Local_Index = TIM_CCMR_INDEX(Copy_Channel);
+    Local_Shift = TIM_CCMR_SHIFT(Copy_Channel);
+
+    /**< Output, PWM mode 1, preloaded compare */
+    Local_Tim->CCMR[Local_Index] = (Local_Tim->CCMR[Local_Index] & ~(TIM_CCMR_FIELD_MASK << Local_Shift)) |
+                                   ((TIM_CCMR_OCM_PWM1 | TIM_CCMR_OCPE) << Local_Shift);
+
+    /**< With preload on, CCR goes live at the next update; force one so the output starts right */
+    Local_Tim->CCR[Copy_Channel] = Copy_Compare;
+    Local_Tim->EGR = (1U << TIM_EGR_UG);
+
+    Local_Tim->CCER = (Local_Tim->CCER & ~((TIM_CCER_CCE | TIM_CCER_CCP) << TIM_CCER_SHIFT(Copy_Channel))) |
+                      (TIM_CCER_CCE << TIM_CCER_SHIFT(Copy_Channel));
+
+    /**< The TIM1 outputs stay off until the main output is enabled */
+    if (Copy_Timer == TIM_TIMER1)
+    {
+        SET_BIT(Local_Tim->BDTR, TIM_BDTR_MOE);
+    }
+
+    return E_OK;
+}
+
+Std_ReturnType MCAL_TIM_SetCompare(u8 Copy_Timer, u8 Copy_Channel, u16 Copy_Compare)
+{
+    if ((Copy_Timer >= TIM_TIMER_COUNT) || (Copy_Channel >= TIM_CHANNEL_COUNT))
+    {
+        return E_NOT_OK;
+    }
+
+    TIM_Timers[Copy_Timer]->CCR[Copy_Channel] = Copy_Compare;
+
+    return E_OK;
+}
+
+Std_ReturnType MCAL_TIM_EnableDmaRequest(u8 Copy_Timer, u8 Copy_Request)
+{
+    if ((Copy_Timer >= TIM_TIMER_COUNT) || (Copy_Request < TIM_DMA_UPDATE) || (Copy_Request > TIM_DMA_CC4))
+    {
+        return E_NOT_OK;
+    }
+
+    SET_BIT(TIM_Timers[Copy_Timer]->DIER, Copy_Request);
+
+    return E_OK;
+}
+
+Std_ReturnType MCAL_TIM_InitCounter(u8 Copy_Timer, u32 Copy_TimerClockFreq, u32 Copy_TickFreq)
+{
+    TIM_RegDef_t *Local_Tim;
+    u32 Local_Prescaler;
+
+    if (Copy_Timer >= TIM_TIMER_COUNT)
+    {
+        return E_NOT_OK;
+    }
+
+    Local_Prescaler = TIM_GetPrescaler(Copy_TimerClockFreq, Copy_TickFreq, 1);
+    if (Local_Prescaler >= TIM_MAX_COUNT)
+    {
+        return E_NOT_OK;
+    }
+
+    Local_Tim = TIM_Timers[Copy_Timer];
+    Local_Tim->CR1 = 0;
+    Local_Tim->CCER = 0;
+    Local_Tim->PSC = Local_Prescaler;
+    Local_Tim->ARR = TIM_MAX_COUNT - 1;
+
+    /**< Load PSC into its shadow register before counting */
+    Local_Tim->EGR = (1U << TIM_EGR_UG);
+    SET_BIT(Local_Tim->CR1, TIM_CR1_CEN);
+
+    return E_OK;
+}
+
+Std_ReturnType MCAL_TIM_EnableCapture(u8 Copy_Timer, u8 Copy_Channel, u8 Copy_Input, u8 Copy_Edge, u8 Copy_Filter)
+{
+    TIM_RegDef_t *Local_Tim;
+    u8 Local_Index;
+    u8 Local_Shift;
+
+    if ((Copy_Timer >= TIM_TIMER_COUNT) || (Copy_Channel >= TIM_CHANNEL_COUNT) ||
+        ((Copy_Input != TIM_CAPTURE_DIRECT) && (Copy_Input != TIM_CAPTURE_PAIRED)) ||
+        (Copy_Edge > TIM_EDGE_FALLING) || (Copy_Filter > TIM_CCMR_ICF_MAX))
+    {
+        return E_NOT_OK;
+    }
+
+    Local_Tim = TIM_Timers[Copy_Timer];
+    Local_Index = TIM_CCMR_INDEX(Copy_Channel);
+    Local_Shift = TIM_CCMR_SHIFT(Copy_Channel);
+
+    /**< CCxS is writable only while the channel is off */
+    CLR_BIT(Local_Tim->CCER, TIM_CCER_SHIFT(Copy_Channel));
+
+    /**< Input on the selected TI (CCxS), every edge captured (no ICxPSC), filtered */
+    Local_Tim->CCMR[Local_Index] = (Local_Tim->CCMR[Local_Index] & ~(TIM_CCMR_FIELD_MASK << Local_Shift)) |
+                                   (((u32)Copy_Input | ((u32)Copy_Filter << TIM_CCMR_ICF_SHIFT)) << Local_Shift);
+
+    Local_Tim->CCER = (Local_Tim->CCER & ~((TIM_CCER_CCE | TIM_CCER_CCP) << TIM_CCER_SHIFT(Copy_Channel))) |
+                      ((TIM_CCER_CCE | ((Copy_Edge == TIM_EDGE_FALLING) ? TIM_CCER_CCP : 0)) << TIM_CCER_SHIFT(Copy_Channel));
+
+    return E_OK;
+}
+
+u16 MCAL_TIM_GetCounter(u8 Copy_Timer)
+{
+    if (Copy_Timer >= TIM_TIMER_COUNT)
+    {
+        return 0;
+    }
+
+    return (u16)TIM_Timers[Copy_Timer]->CNT;
+}
+
+u32 MCAL_TIM_GetCaptureAddress(u8 Copy_Timer, u8 Copy_Channel)
+{
+    if ((Copy_Timer >= TIM_TIMER_COUNT) || (Copy_Channel >= TIM_CHANNEL_COUNT))
+    {
+        return 0;
+    }
+
+    return (u32)&TIM_Timers[Copy_Timer]->CCR[Copy_Channel];
+}
+/*****************************< End of Function Implementations *****************************/
@@ -0,0 +1,19 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : TLM_config.h               *****************/
+/****************************************************************/
+#ifndef TLM_CONFIG_H_
+#define TLM_CONFIG_H_
+
+/**
+ * @brief Largest unencoded frame in bytes: sequence number + records + CRC (at most 254).
+ *
+ * Records accumulate in the open frame until it is full or TLM_Flush is called, so larger
+ * frames spread the 5 bytes of framing over more records. Keeping a frame below 255 bytes
+ * means COBS never has to insert a code byte, and the frame is encoded in place.
+ */
+#define TLM_FRAME_SIZE      128
+
+#endif /**< TLM_CONFIG_H_ */
@@ -0,0 +1,219 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : TLM_interface.h            *****************/
+/****************************************************************/
+#ifndef TLM_INTERFACE_H_
+#define TLM_INTERFACE_H_
+
+/**
+ * @defgroup TLM_Types TLM Type Definitions
+ *
+ * Wire format. A frame is
+ *
+ *     COBS( sequence:u8  record...  crc16:u16le )  0x00
+ *
+ * where the CRC-16/CCITT-FALSE covers the sequence number and the records. A record is
+ *
+ *     id:u8  delta_us:varint  payload
+ *
+ * with delta_us the time since the previous record (in this or an earlier frame) in
+ * microseconds, and the payload fixed by the message ID (see TLM_MSG_x). Varints are
+ * little-endian groups of 7 bits with the top bit set on all but the last byte. A gap in
+ * the sequence numbers means frames were dropped and absolute time must be re-anchored.
+ * @{
+ */
+
+/**
+ * @name Message IDs
+ * @{
+ */
+#define TLM_MSG_PHASE       0x01    /**< phase:u8 signals:u8 -> Arg = phase, Value = signal bits */
+#define TLM_MSG_INPUT       0x02    /**< (line << 1 | level):u8 -> Arg = EXTI line, Value = level */
+#define TLM_MSG_COUNTER     0x03    /**< counter:u8 value:varint -> Arg = counter ID, Value = value */
+#define TLM_MSG_FAULT       0x04    /**< code:u8 -> Arg = fault code */
+#define TLM_MSG_ACK         0x05    /**< command:u8 status:u8 -> Arg = command ID, Value = status */
+#define TLM_MSG_PED_WAIT    0x06    /**< bin:u8 count:varint -> Arg = press-to-walk bin, Value = served requests */
+/** @} */
+
+/**
+ * @name Counter IDs
+ * @{
+ */
+#define TLM_COUNTER_DROPPED         0   /**< Records lost because the transmit ring was full */
+#define TLM_COUNTER_PED_REQUESTS    1   /**< Pedestrian requests latched */
+#define TLM_COUNTER_ISR_MAX_CYCLES  2   /**< Longest button ISR so far, in core cycles */
+#define TLM_COUNTER_LOG_DROPPED     3   /**< Log records lost because the flash log queue was full */
+#define TLM_COUNTER_DUTY_PERMILLE   4   /**< Share of the last cycle the core was awake, per mille */
+#define TLM_COUNTER_CURRENT_UA      5   /**< Supply current projected from that duty, in microamps */
+#define TLM_COUNTER_WAKE_LATENCY_US 6   /**< Latest button edge to signal change after STOP, in microseconds */
+#define TLM_COUNTER_CONTROL_MAX_CYCLES 7    /**< Longest engine tick of all crossings plus output write, in core cycles */
+#define TLM_COUNTER_VEHICLE_CALLS   8   /**< Vehicle detections latched */
+#define TLM_COUNTER_PREEMPT_MAX_CYCLES 9    /**< Longest preemption ISR entry to signal write, in core cycles */
+#define TLM_COUNTER_CYCLE_MS        10  /**< Cycle length of the last adapted plan, in milliseconds */
+#define TLM_COUNTER_FLOW_VPH        11  /**< Average car flow over the detector, vehicles per hour */
+#define TLM_COUNTER_SYNC_MAX_ERROR_US 12  /**< Largest sync edge error while locked to the master, in microseconds */
+#define TLM_COUNTER_LANE_VEHICLES   13  /**< Vehicles over the loop pair of lane 0 in the last cycle */
+#define TLM_COUNTER_LANE_OCCUPANCY_PERMILLE 14  /**< Share of the last cycle its upstream loop was occupied, per mille */
+#define TLM_COUNTER_LANE_SPEED_KMH_X10 15   /**< Space-mean speed over its loop pair in the last cycle, in 0.1 km/h */
+/** @} */
+
+/**
+ * @name Fault Codes
+ * @{
+ */
+#define TLM_FAULT_SAFETY            1   /**< The safety monitor latched flashing red */
+/** @} */
+
+/**
+ * @brief One decoded record.
+ */
+typedef struct
+{
+    u32 DeltaUs;    /**< Microseconds since the previous record */
+    u8 Id;          /**< TLM_MSG_x */
+    u8 Arg;         /**< First payload field, see TLM_MSG_x */
+    u32 Value;      /**< Second payload field, see TLM_MSG_x */
+} TLM_Record_t;
+
+/**
+ * @brief Free-running counter used for the record time stamps.
+ */
+typedef u32 (*TLM_TimeSource_t)(void);
+
+/** @} */ // End of TLM_Types
+
+/**
+ * @defgroup TLM_Functions TLM Functions
+ * @brief Batch records into COBS frames built in place in the USART transmit ring.
+ *
+ * TLM is the only producer on the USART transmit ring. Records may be added from any
+ * context; the frame under construction lives in an open ring reservation, so finishing
+ * a frame is a CRC, an in-place COBS pass and a commit that hands it to DMA.
+ *
+ * The decoding functions do not touch any hardware and can be built into a host tool.
+ * @{
+ */
+
+/**
+ * @brief Reset the encoder.
+ *
+ * @param[in] Copy_HclkFreq The core clock in Hz, used to turn DWT cycles into microseconds.
+ *
+ * @return None.
+ */
+void TLM_Init(u32 Copy_HclkFreq);
+
+/**
+ * @brief Take the time stamps from another counter than the DWT cycle counter.
+ *
+ * Needed once the core sleeps, since the cycle counter stops during WFI.
+ *
+ * @param[in] Copy_Source The counter.
+ * @param[in] Copy_CountsPerUs Counts per microsecond.
+ *
+ * @return None.
+ */
+void TLM_SetTimeSource(TLM_TimeSource_t Copy_Source, u32 Copy_CountsPerUs);
+
+/**
+ * @brief Add a phase change record.
+ *
+ * @param[in] Copy_Phase The phase entered.
+ * @param[in] Copy_Signals The signal bits it shows.
+ *
+ * @return E_OK if the record was added, E_NOT_OK if it was dropped.
+ */
+Std_ReturnType TLM_RecordPhase(u8 Copy_Phase, u8 Copy_Signals);
+
+/**
+ * @brief Add an input edge record.
+ *
+ * @param[in] Copy_Line The EXTI line (0..15).
+ * @param[in] Copy_Level The pin level after the edge.
+ *
+ * @return E_OK if the record was added, E_NOT_OK if it was dropped.
+ */
+Std_ReturnType TLM_RecordInput(u8 Copy_Line, u8 Copy_Level);
+
+/**
+ * @brief Add a counter record.
+ *
+ * @param[in] Copy_Counter The counter ID (TLM_COUNTER_x).
+ * @param[in] Copy_Value The current value.
+ *
+ * @return E_OK if the record was added, E_NOT_OK if it was dropped.
+ */
+Std_ReturnType TLM_RecordCounter(u8 Copy_Counter, u32 Copy_Value);
+
+/**
+ * @brief Add a fault record.
+ *
+ * @param[in] Copy_Code The fault code.
+ *
+ * @return E_OK if the record was added, E_NOT_OK if it was dropped.
+ */
+Std_ReturnType TLM_RecordFault(u8 Copy_Code);
+
+/**
+ * @brief Add a command acknowledgement record.
+ *
+ * @param[in] Copy_Command The command ID being answered.
+ * @param[in] Copy_Status The outcome of the command.
+ *
+ * @return E_OK if the record was added, E_NOT_OK if it was dropped.
+ */
+Std_ReturnType TLM_RecordAck(u8 Copy_Command, u8 Copy_Status);
+
+/**
+ * @brief Add one bin of the press-to-walk histogram.
+ *
+ * @param[in] Copy_Bin The bin index (see PHASE_GetPedWaitHistogram).
+ * @param[in] Copy_Count The requests served with a wait in that bin.
+ *
+ * @return E_OK if the record was added, E_NOT_OK if it was dropped.
+ */
+Std_ReturnType TLM_RecordPedWait(u8 Copy_Bin, u32 Copy_Count);
+
+/**
+ * @brief Close the open frame and queue it for transmission. Call once per control tick.
+ *
+ * @return None.
+ */
+void TLM_Flush(void);
+
+/**
+ * @brief Get the number of records dropped because the transmit ring was full.
+ *
+ * @return The drop count since TLM_Init.
+ */
+u32 TLM_GetDroppedCount(void);
+
+/**
+ * @brief Decode one frame in place: undo COBS and check the CRC.
+ *
+ * @param[in,out] Copy_Frame The bytes between two 0x00 delimiters (delimiter excluded).
+ * @param[in] Copy_Length Number of bytes.
+ * @param[out] Copy_Sequence The frame sequence number.
+ * @param[out] Copy_RecordsLength Number of record bytes, which start at Copy_Frame[1].
+ *
+ * @return E_OK for a valid frame, E_NOT_OK for a malformed frame or CRC mismatch.
+ */
+Std_ReturnType TLM_DecodeFrame(u8 *Copy_Frame, u32 Copy_Length, u8 *Copy_Sequence, u32 *Copy_RecordsLength);
+
+/**
+ * @brief Decode the record at *Copy_Offset and advance the offset past it.
+ *
+ * @param[in] Copy_Records The record bytes of a decoded frame.
+ * @param[in] Copy_Length Number of record bytes.
+ * @param[in,out] Copy_Offset Offset of the record, updated to the next one.
+ * @param[out] Copy_Record The decoded record.
+ *
+ * @return E_OK if a record was decoded, E_NOT_OK at the end of the records or for an unknown ID.
+ */
+Std_ReturnType TLM_DecodeRecord(const u8 *Copy_Records, u32 Copy_Length, u32 *Copy_Offset, TLM_Record_t *Copy_Record);
+
+/** @} */ // End of TLM_Functions
+
+#endif /**< TLM_INTERFACE_H_ */
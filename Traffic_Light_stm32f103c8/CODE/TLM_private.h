@@ -0,0 +1,39 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : TLM_private.h              *****************/
+/****************************************************************/
+#ifndef TLM_PRIVATE_H_
+#define TLM_PRIVATE_H_
+
+#if (TLM_FRAME_SIZE > 254) || (TLM_FRAME_SIZE < 16)
+#error "TLM_FRAME_SIZE must be between 16 and 254"
+#endif
+
+/**< Bytes around the records: sequence number before, CRC-16 after */
+#define TLM_SEQUENCE_SIZE           1
+#define TLM_CRC_SIZE                2
+
+/**< COBS adds one code byte in front (no more for frames below 255 bytes) and the 0x00 delimiter */
+#define TLM_COBS_OVERHEAD           1
+#define TLM_DELIMITER               0x00
+#define TLM_SLOT_SIZE               (TLM_COBS_OVERHEAD + TLM_FRAME_SIZE + 1)
+
+/**< Varint encoding: 7 payload bits per byte, MSB set on every byte except the last */
+#define TLM_VARINT_MAX_SIZE         5
+#define TLM_VARINT_PAYLOAD_MASK     0x7F
+#define TLM_VARINT_CONTINUE_MASK    0x80
+#define TLM_VARINT_SHIFT            7
+
+/**< Largest record: ID + varint delta + counter ID + varint value */
+#define TLM_RECORD_MAX_SIZE         (1 + TLM_VARINT_MAX_SIZE + 1 + TLM_VARINT_MAX_SIZE)
+
+/**< CRC-16/CCITT-FALSE: polynomial 0x1021, initial value 0xFFFF, no reflection */
+#define TLM_CRC_INIT                0xFFFF
+#define TLM_CRC_POLY                0x1021
+
+/**< Input record payload: EXTI line in bits 4..1, level in bit 0 */
+#define TLM_PACK_INPUT(LINE, LEVEL) ((u8)(((LINE) << 1) | ((LEVEL) & 1)))
+
+#endif /**< TLM_PRIVATE_H_ */
@@ -0,0 +1,399 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : TLM_program.c              *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "DWT_interface.h"
+#include "SCB_interface.h"
+#include "USART_interface.h"
+/*****************************< SERVICE *****************************/
+#include "TLM_interface.h"
+#include "TLM_config.h"
+#include "TLM_private.h"
+/*****************************< Private Variables *****************************/
+static u8 *TLM_Slot = NULL;             /**< Open ring reservation: code byte, then the raw frame */
+static u32 TLM_FrameLength = 0;         /**< Raw bytes written at TLM_Slot[1] */
+static u8 TLM_Sequence = 0;
+static u32 TLM_LastCount = 0;
+static u32 TLM_CountsPerUs = 8;
+static TLM_TimeSource_t TLM_TimeSource = MCAL_DWT_GetCycles;
+static u32 TLM_Dropped = 0;
+/*****************************< Private Functions *****************************/
+static u8 TLM_PutVarint(u8 *Copy_Buffer, u32 Copy_Value)
+{
+    u8 Local_Length = 0;
+
+    while (Copy_Value > TLM_VARINT_PAYLOAD_MASK)
+    {
+        Copy_Buffer[Local_Length++] = (u8)((Copy_Value & TLM_VARINT_PAYLOAD_MASK) | TLM_VARINT_CONTINUE_MASK);
+        Copy_Value >>= TLM_VARINT_SHIFT;
+    }
+    Copy_Buffer[Local_Length++] = (u8)Copy_Value;
+
+    return Local_Length;
+}
+
+static Std_ReturnType TLM_GetVarint(const u8 *Copy_Buffer, u32 Copy_Length, u32 *Copy_Offset, u32 *Copy_Value)
+{
+    u32 Local_Index = *Copy_Offset;
+    u32 Local_Value = 0;
+    u8 Local_Shift = 0;
+    u8 Local_Byte;
+
+    do
+    {
+        if ((Local_Index >= Copy_Length) || (Local_Shift >= (TLM_VARINT_MAX_SIZE * TLM_VARINT_SHIFT)))
+        {
+            return E_NOT_OK;
+        }
+        Local_Byte = Copy_Buffer[Local_Index++];
+        Local_Value |= ((u32)(Local_Byte & TLM_VARINT_PAYLOAD_MASK)) << Local_Shift;
+        Local_Shift += TLM_VARINT_SHIFT;
+    } while (Local_Byte & TLM_VARINT_CONTINUE_MASK);
+
+    *Copy_Offset = Local_Index;
+    *Copy_Value = Local_Value;
+
+    return E_OK;
+}
+
+static u16 TLM_Crc16(const u8 *Copy_Data, u32 Copy_Length)
+{
+    /**< Nibble table: two lookups per byte instead of eight shifts */
+    static const u16 Local_Table[16] = {
+        0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+        0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    };
+    u16 Local_Crc = TLM_CRC_INIT;
+
+    while (Copy_Length--)
+    {
+        Local_Crc = (u16)((Local_Crc << 4) ^ Local_Table[(Local_Crc >> 12) ^ (*Copy_Data >> 4)]);
+        Local_Crc = (u16)((Local_Crc << 4) ^ Local_Table[(Local_Crc >> 12) ^ (*Copy_Data & 0x0F)]);
+        Copy_Data++;
+    }
+
+    return Local_Crc;
+}
+
+/**< Append the CRC, COBS-encode in place and hand the frame to the UART. Runs in a critical section. */
+static void TLM_CloseFrame(void)
+{
+    u16 Local_Crc;
+    u32 Local_Index;
+    u32 Local_Code = 0;
+
+    if (TLM_Slot == NULL)
+    {
+        return;
+    }
+
+    Local_Crc = TLM_Crc16(&TLM_Slot[1], TLM_FrameLength);
+    TLM_Slot[1 + TLM_FrameLength++] = (u8)Local_Crc;
+    TLM_Slot[1 + TLM_FrameLength++] = (u8)(Local_Crc >> 8);
+
+    /**< Each zero becomes the distance to the next zero; frames below 255 bytes need no extra code bytes */
+    for (Local_Index = 1; Local_Index <= TLM_FrameLength; Local_Index++)
+    {
+        if (TLM_Slot[Local_Index] == 0)
+        {
+            TLM_Slot[Local_Code] = (u8)(Local_Index - Local_Code);
+            Local_Code = Local_Index;
+        }
+    }
+    TLM_Slot[Local_Code] = (u8)(Local_Index - Local_Code);
+    TLM_Slot[Local_Index] = TLM_DELIMITER;
+
+    MCAL_USART_TxCommit(TLM_FrameLength + TLM_COBS_OVERHEAD + 1);
+    TLM_Slot = NULL;
+}
+
+static Std_ReturnType TLM_Append(u8 Copy_Id, const u8 *Copy_Payload, u8 Copy_PayloadLength)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u32 Local_PriMask = SCB_EnterCritical();
+    u32 Local_DeltaUs = (TLM_TimeSource() - TLM_LastCount) / TLM_CountsPerUs;
+    u8 Local_Record[TLM_RECORD_MAX_SIZE];
+    u8 Local_Length = 0;
+    u8 Local_Index;
+
+    Local_Record[Local_Length++] = Copy_Id;
+    Local_Length += TLM_PutVarint(&Local_Record[Local_Length], Local_DeltaUs);
+    for (Local_Index = 0; Local_Index < Copy_PayloadLength; Local_Index++)
+    {
+        Local_Record[Local_Length++] = Copy_Payload[Local_Index];
+    }
+
+    /**< Close the frame if the record and the CRC no longer fit */
+    if ((TLM_Slot != NULL) && ((TLM_FrameLength + Local_Length + TLM_CRC_SIZE) > TLM_FRAME_SIZE))
+    {
+        TLM_CloseFrame();
+    }
+
+    if (TLM_Slot == NULL)
+    {
+        TLM_Slot = MCAL_USART_TxReserve(TLM_SLOT_SIZE);
+        if (TLM_Slot != NULL)
+        {
+            TLM_FrameLength = 0;
+            TLM_Slot[1 + TLM_FrameLength++] = TLM_Sequence++;
+        }
+    }
+
+    if (TLM_Slot != NULL)
+    {
+        for (Local_Index = 0; Local_Index < Local_Length; Local_Index++)
+        {
+            TLM_Slot[1 + TLM_FrameLength++] = Local_Record[Local_Index];
+        }
+
+        /**< Advance by whole microseconds so the remainder carries into the next delta */
+        TLM_LastCount += Local_DeltaUs * TLM_CountsPerUs;
+        Local_FunctionStatus = E_OK;
+    }
+    else
+    {
+        TLM_Dropped++;
+    }
+
+    SCB_ExitCritical(Local_PriMask);
+
+    return Local_FunctionStatus;
+}
+/*****************************< Function Implementations *****************************/
+void TLM_Init(u32 Copy_HclkFreq)
+{
+    u32 Local_PriMask = SCB_EnterCritical();
+
+    if (TLM_Slot != NULL)
+    {
+        MCAL_USART_TxCommit(0);
+        TLM_Slot = NULL;
+    }
+    TLM_FrameLength = 0;
+    TLM_Sequence = 0;
+    TLM_Dropped = 0;
+    TLM_TimeSource = MCAL_DWT_GetCycles;
+    TLM_CountsPerUs = (Copy_HclkFreq >= 1000000) ? (Copy_HclkFreq / 1000000) : 1;
+    TLM_LastCount = MCAL_DWT_GetCycles();
+
+    SCB_ExitCritical(Local_PriMask);
+}
+
+void TLM_SetTimeSource(TLM_TimeSource_t Copy_Source, u32 Copy_CountsPerUs)
+{
+    u32 Local_PriMask;
+
+    if ((Copy_Source == NULL) || (Copy_CountsPerUs == 0))
+    {
+        return;
+    }
+
+    Local_PriMask = SCB_EnterCritical();
+    TLM_TimeSource = Copy_Source;
+    TLM_CountsPerUs = Copy_CountsPerUs;
+    TLM_LastCount = Copy_Source();
+    SCB_ExitCritical(Local_PriMask);
+}
+
+Std_ReturnType TLM_RecordPhase(u8 Copy_Phase, u8 Copy_Signals)
+{
+    u8 Local_Payload[2];
+
+    Local_Payload[0] = Copy_Phase;
+    Local_Payload[1] = Copy_Signals;
+
+    return TLM_Append(TLM_MSG_PHASE, Local_Payload, 2);
+}
+
+Std_ReturnType TLM_RecordInput(u8 Copy_Line, u8 Copy_Level)
+{
+    u8 Local_Payload = TLM_PACK_INPUT(Copy_Line, Copy_Level);
+
+    if (Copy_Line > 15)
+    {
+        return E_NOT_OK;
+    }
+
+    return TLM_Append(TLM_MSG_INPUT, &Local_Payload, 1);
+}
+
+Std_ReturnType TLM_RecordCounter(u8 Copy_Counter, u32 Copy_Value)
+{
+    u8 Local_Payload[1 + TLM_VARINT_MAX_SIZE];
+
+    Local_Payload[0] = Copy_Counter;
+
+    return TLM_Append(TLM_MSG_COUNTER, Local_Payload, (u8)(1 + TLM_PutVarint(&Local_Payload[1], Copy_Value)));
+}
+
+Std_ReturnType TLM_RecordFault(u8 Copy_Code)
+{
+    return TLM_Append(TLM_MSG_FAULT, &Copy_Code, 1);
+}
+
+Std_ReturnType TLM_RecordAck(u8 Copy_Command, u8 Copy_Status)
+{
+    u8 Local_Payload[2];
+
+    Local_Payload[0] = Copy_Command;
+    Local_Payload[1] = Copy_Status;
+
+    return TLM_Append(TLM_MSG_ACK, Local_Payload, 2);
+}
+
+Std_ReturnType TLM_RecordPedWait(u8 Copy_Bin, u32 Copy_Count)
+{
+    u8 Local_Payload[1 + TLM_VARINT_MAX_SIZE];
+
+    Local_Payload[0] = Copy_Bin;
+
+    return TLM_Append(TLM_MSG_PED_WAIT, Local_Payload, (u8)(1 + TLM_PutVarint(&Local_Payload[1], Copy_Count)));
+}
+
+void TLM_Flush(void)
+{
+    u32 Local_PriMask = SCB_EnterCritical();
+
+    TLM_CloseFrame();
+
+    SCB_ExitCritical(Local_PriMask);
+}
+
+u32 TLM_GetDroppedCount(void)
+{
+    return TLM_Dropped;
+}
+
+Std_ReturnType TLM_DecodeFrame(u8 *Copy_Frame, u32 Copy_Length, u8 *Copy_Sequence, u32 *Copy_RecordsLength)
+{
+    u32 Local_In = 0;
+    u32 Local_Out = 0;
+    u32 Local_BlockEnd;
+    u8 Local_Code;
+    u16 Local_Crc;
+
+    if ((Copy_Frame == NULL) || (Copy_Sequence == NULL) || (Copy_RecordsLength == NULL))
+    {
+        return E_NOT_OK;
+    }
+
+    /**< Undo COBS in place, the output never overtakes the input */
+    while (Local_In < Copy_Length)
+    {
+        Local_Code = Copy_Frame[Local_In++];
+        Local_BlockEnd = Local_In + Local_Code - 1;
+        if ((Local_Code == 0) || (Local_BlockEnd > Copy_Length))
+        {
+            return E_NOT_OK;
+        }
+        while (Local_In < Local_BlockEnd)
+        {
+            Copy_Frame[Local_Out++] = Copy_Frame[Local_In++];
+        }
+        /**< Every block but the last and the 254-byte ones stood for a zero */
+        if ((Local_Code != 0xFF) && (Local_In < Copy_Length))
+        {
+            Copy_Frame[Local_Out++] = 0;
+        }
+    }
+
+    if (Local_Out < (TLM_SEQUENCE_SIZE + TLM_CRC_SIZE))
+    {
+        return E_NOT_OK;
+    }
+
+    Local_Out -= TLM_CRC_SIZE;
+    Local_Crc = (u16)(Copy_Frame[Local_Out] | (Copy_Frame[Local_Out + 1] << 8));
+    if (Local_Crc != TLM_Crc16(Copy_Frame, Local_Out))
+    {
+        return E_NOT_OK;
+    }
+
+    *Copy_Sequence = Copy_Frame[0];
+    *Copy_RecordsLength = Local_Out - TLM_SEQUENCE_SIZE;
+
+    return E_OK;
+}
+
+Std_ReturnType TLM_DecodeRecord(const u8 *Copy_Records, u32 Copy_Length, u32 *Copy_Offset, TLM_Record_t *Copy_Record)
+{
+    u32 Local_Index;
+
+    if ((Copy_Records == NULL) || (Copy_Offset == NULL) || (Copy_Record == NULL))
+    {
+        return E_NOT_OK;
+    }
+
+    Local_Index = *Copy_Offset;
+    if (Local_Index >= Copy_Length)
+    {
+        return E_NOT_OK;
+    }
+
+    Copy_Record->Id = Copy_Records[Local_Index++];
+    if (TLM_GetVarint(Copy_Records, Copy_Length, &Local_Index, &Copy_Record->DeltaUs) != E_OK)
+    {
+        return E_NOT_OK;
+    }
+
+    switch (Copy_Record->Id)
+    {
+    case TLM_MSG_PHASE:
+    case TLM_MSG_ACK:
+        if ((Local_Index + 2) > Copy_Length)
+        {
+            return E_NOT_OK;
+        }
+        Copy_Record->Arg = Copy_Records[Local_Index];
+        Copy_Record->Value = Copy_Records[Local_Index + 1];
+        Local_Index += 2;
+        break;
+
+    case TLM_MSG_INPUT:
+        if (Local_Index >= Copy_Length)
+        {
+            return E_NOT_OK;
+        }
+        Copy_Record->Arg = (u8)(Copy_Records[Local_Index] >> 1);
+        Copy_Record->Value = Copy_Records[Local_Index] & 1;
+        Local_Index++;
+        break;
+
+    case TLM_MSG_COUNTER:
+    case TLM_MSG_PED_WAIT:
+        if (Local_Index >= Copy_Length)
+        {
+            return E_NOT_OK;
+        }
+        Copy_Record->Arg = Copy_Records[Local_Index++];
+        if (TLM_GetVarint(Copy_Records, Copy_Length, &Local_Index, &Copy_Record->Value) != E_OK)
+        {
+            return E_NOT_OK;
+        }
+        break;
+
+    case TLM_MSG_FAULT:
+        if (Local_Index >= Copy_Length)
+        {
+            return E_NOT_OK;
+        }
+        Copy_Record->Arg = Copy_Records[Local_Index++];
+        Copy_Record->Value = 0;
+        break;
+
+    default:
+        return E_NOT_OK;
+    }
+
+    *Copy_Offset = Local_Index;
+
+    return E_OK;
+}
+/*****************************< End of Function Implementations *****************************/
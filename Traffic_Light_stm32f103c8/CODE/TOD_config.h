@@ -0,0 +1,27 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : TOD_config.h               *****************/
+/****************************************************************/
+#ifndef TOD_CONFIG_H_
+#define TOD_CONFIG_H_
+
+/**
+ * @brief Weekly schedule, entries in any order: { TOD_x days, hour, minute, PLAN_x }.
+ *
+ * Each entry runs its plan from its time until the next transition of the week. Two entries
+ * must not share a day and time.
+ */
+#define TOD_SCHEDULE \
+    { TOD_WORKDAYS, 7, 0, PLAN_PEAK }, \
+    { TOD_WORKDAYS, 9, 30, PLAN_DEFAULT }, \
+    { TOD_WORKDAYS, 16, 30, PLAN_PEAK }, \
+    { TOD_WORKDAYS, 19, 0, PLAN_DEFAULT }
+
+/**
+ * @brief Backup register (1 .. 10) marking that the clock was set.
+ */
+#define TOD_BACKUP_REGISTER         1
+
+#endif /**< TOD_CONFIG_H_ */
@@ -0,0 +1,116 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : TOD_interface.h            *****************/
+/****************************************************************/
+#ifndef TOD_INTERFACE_H_
+#define TOD_INTERFACE_H_
+
+/**
+ * @defgroup TOD_Days TOD Days (bit mask)
+ * @{
+ */
+#define TOD_MONDAY              0x01
+#define TOD_TUESDAY             0x02
+#define TOD_WEDNESDAY           0x04
+#define TOD_THURSDAY            0x08
+#define TOD_FRIDAY              0x10
+#define TOD_SATURDAY            0x20
+#define TOD_SUNDAY              0x40
+#define TOD_WORKDAYS            0x1F
+#define TOD_WEEKEND             0x60
+#define TOD_EVERY_DAY           0x7F
+/** @} */
+
+/**
+ * @brief Returned by TOD_GetPlan while the clock is not set: plans are left alone.
+ */
+#define TOD_PLAN_NONE           0xFF
+
+/**
+ * @defgroup TOD_Types TOD Types
+ * @{
+ */
+
+/**
+ * @brief One line of the weekly schedule: from this time on the listed days, run the plan.
+ */
+typedef struct
+{
+    u8 Days;        /**< TOD_x day mask */
+    u8 Hour;        /**< 0 .. 23 */
+    u8 Minute;      /**< 0 .. 59 */
+    u8 Plan;        /**< PLAN_x */
+} TOD_Entry_t;
+
+/** @} */ // End of TOD_Types
+
+/**
+ * @defgroup TOD_Functions TOD Functions
+ * @brief Time-of-day plan selection from the RTC.
+ *
+ * Time is kept in the RTC as seconds since Monday 1 January 2024, 00:00 local time, and is
+ * set over the command channel. The weekly schedule (TOD_SCHEDULE) is expanded once into a
+ * sorted list of transitions; each tick then only compares the RTC with the next one. A
+ * scheduled plan is installed with PHASE_InstallTable and so takes over at the next cycle
+ * boundary. An uploaded or adapted plan runs until the next transition.
+ * @{
+ */
+
+/**
+ * @brief Build the transition list and, if the clock was set before, select the current plan.
+ *
+ * Call after MCAL_RTC_Init and PHASE_Init, before the first control tick.
+ *
+ * @return E_OK on success, E_NOT_OK if an entry of TOD_SCHEDULE is invalid or names a plan PHASE_CheckTable
+ *         rejects (the scheduler then stays off).
+ */
+Std_ReturnType TOD_Init(void);
+
+/**
+ * @brief Install the scheduled plan once its transition time is reached.
+ *
+ * Call once per control tick before PHASE_Tick, from the same context.
+ *
+ * @return None.
+ */
+void TOD_Tick(void);
+
+/**
+ * @brief Set the clock and select the plan scheduled for that time.
+ *
+ * The clock stays set through resets and power cuts while the backup domain is powered.
+ *
+ * @param[in] Copy_Seconds Seconds since Monday 1 January 2024, 00:00 local time.
+ *
+ * @return E_OK on success, E_NOT_OK if the RTC does not run or the scheduler is off.
+ */
+Std_ReturnType TOD_SetTime(u32 Copy_Seconds);
+
+/**
+ * @brief Get the clock.
+ *
+ * @param[out] Copy_Seconds Receives the seconds since Monday 1 January 2024, 00:00 local time.
+ *
+ * @return E_OK on success, E_NOT_OK if the clock is not set or Copy_Seconds is NULL.
+ */
+Std_ReturnType TOD_GetTime(u32 *Copy_Seconds);
+
+/**
+ * @brief Get the plan selected by the schedule.
+ *
+ * @return PLAN_x, TOD_PLAN_NONE if the clock is not set.
+ */
+u8 TOD_GetPlan(void);
+
+/**
+ * @brief Control ticks until the next transition, for the tickless idle.
+ *
+ * @return Ticks until TOD_Tick has work (at least 1), PHASE_NO_EVENT if the clock is not set.
+ */
+u16 TOD_GetTicksToNextEvent(void);
+
+/** @} */ // End of TOD_Functions
+
+#endif /**< TOD_INTERFACE_H_ */
@@ -0,0 +1,33 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : TOD_private.h              *****************/
+/****************************************************************/
+#ifndef TOD_PRIVATE_H_
+#define TOD_PRIVATE_H_
+
+#define TOD_SECONDS_PER_DAY         86400UL
+#define TOD_DAYS_PER_WEEK           7
+#define TOD_SECONDS_PER_WEEK        (TOD_SECONDS_PER_DAY * TOD_DAYS_PER_WEEK)
+
+/**< Backup register value once the clock was set; a backup domain reset clears it */
+#define TOD_CLOCK_SET_MARK          0x7D5AU
+
+/**< Next transition while the clock is not set: the RTC never reaches it */
+#define TOD_NEVER                   0xFFFFFFFFUL
+
+/**
+ * @brief A schedule entry on one day, as second of the week (Monday 00:00 is 0).
+ */
+typedef struct
+{
+    u32 WeekSecond;
+    u8 Plan;
+} TOD_Transition_t;
+
+#if (TOD_BACKUP_REGISTER < 1) || (TOD_BACKUP_REGISTER > 10)
+#error "TOD_BACKUP_REGISTER is not a backup data register (1 .. 10)"
+#endif
+
+#endif /**< TOD_PRIVATE_H_ */
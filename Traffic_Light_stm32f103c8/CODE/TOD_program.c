@@ -0,0 +1,215 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : TOD_program.c              *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "RTC_interface.h"
+/*****************************< APP *****************************/
+#include "PHASE_interface.h"
+#include "PHASE_config.h"
+#include "PLAN_interface.h"
+#include "TOD_interface.h"
+#include "TOD_config.h"
+#include "TOD_private.h"
+/*****************************< Private Variables *****************************/
+static const TOD_Entry_t TOD_Schedule[] = { TOD_SCHEDULE };
+#define TOD_ENTRY_COUNT     (sizeof(TOD_Schedule) / sizeof(TOD_Schedule[0]))
+
+/**< The schedule, one transition per entry and day, sorted by second of the week */
+static TOD_Transition_t TOD_Transitions[TOD_ENTRY_COUNT * TOD_DAYS_PER_WEEK];
+static u8 TOD_TransitionCount = 0;
+
+static u32 TOD_NextSwitchS = TOD_NEVER;     /**< RTC time of the next transition */
+static u8 TOD_Plan = TOD_PLAN_NONE;
+static u8 TOD_Ready = 0;                    /**< Schedule checked and list built */
+/*****************************< Private Functions *****************************/
+/**< Insertion sort: the list is short and built once */
+static void TOD_BuildTransitions(void)
+{
+    u32 Local_Second;
+    u8 Local_Entry;
+    u8 Local_Day;
+    u8 Local_Index;
+
+    TOD_TransitionCount = 0;
+
+    for (Local_Entry = 0; Local_Entry < TOD_ENTRY_COUNT; Local_Entry++)
+    {
+        for (Local_Day = 0; Local_Day < TOD_DAYS_PER_WEEK; Local_Day++)
+        {
+            if (!GET_BIT(TOD_Schedule[Local_Entry].Days, Local_Day))
+            {
+                continue;
+            }
+
+            Local_Second = (Local_Day * TOD_SECONDS_PER_DAY) + (TOD_Schedule[Local_Entry].Hour * 3600UL) +
+                           (TOD_Schedule[Local_Entry].Minute * 60UL);
+
+            for (Local_Index = TOD_TransitionCount; (Local_Index > 0) && (TOD_Transitions[Local_Index - 1].WeekSecond > Local_Second); Local_Index--)
+            {
+                TOD_Transitions[Local_Index] = TOD_Transitions[Local_Index - 1];
+            }
+            TOD_Transitions[Local_Index].WeekSecond = Local_Second;
+            TOD_Transitions[Local_Index].Plan = TOD_Schedule[Local_Entry].Plan;
+            TOD_TransitionCount++;
+        }
+    }
+}
+
+/**< Plan in force at Copy_Now; sets the time of the transition after it */
+static u8 TOD_Locate(u32 Copy_Now)
+{
+    u32 Local_WeekSecond = Copy_Now % TOD_SECONDS_PER_WEEK;
+    u32 Local_WeekStart = Copy_Now - Local_WeekSecond;
+    u8 Local_Index;
+
+    if (TOD_TransitionCount == 0)
+    {
+        TOD_NextSwitchS = TOD_NEVER;
+        return PLAN_DEFAULT;
+    }
+
+    /**< First transition after now; the one before it (last week's last if none) is in force */
+    for (Local_Index = 0; (Local_Index < TOD_TransitionCount) && (TOD_Transitions[Local_Index].WeekSecond <= Local_WeekSecond); Local_Index++)
+    {
+    }
+
+    if (Local_Index < TOD_TransitionCount)
+    {
+        TOD_NextSwitchS = Local_WeekStart + TOD_Transitions[Local_Index].WeekSecond;
+    }
+    else
+    {
+        TOD_NextSwitchS = Local_WeekStart + TOD_SECONDS_PER_WEEK + TOD_Transitions[0].WeekSecond;
+    }
+
+    return TOD_Transitions[(Local_Index != 0) ? (Local_Index - 1) : (TOD_TransitionCount - 1)].Plan;
+}
+
+/**< Pending plans take over at the next cycle boundary of each crossing */
+static void TOD_Apply(u8 Copy_Plan)
+{
+    const PHASE_Descriptor_t *Local_Table = PLAN_GetTable(Copy_Plan);
+    u8 Local_Index;
+
+    TOD_Plan = Copy_Plan;
+
+    for (Local_Index = 0; Local_Index < PHASE_INTERSECTION_COUNT; Local_Index++)
+    {
+        if (PHASE_GetActiveTable(Local_Index) == Local_Table)
+        {
+            /**< Already running: drop whatever else was pending */
+            (void)PHASE_InstallTable(Local_Index, NULL);
+        }
+        else
+        {
+            /**< Checked by TOD_Init */
+            (void)PHASE_InstallTable(Local_Index, Local_Table);
+        }
+    }
+}
+/*****************************< Function Implementations *****************************/
+Std_ReturnType TOD_Init(void)
+{
+    u8 Local_Index;
+
+    TOD_Ready = 0;
+    TOD_Plan = TOD_PLAN_NONE;
+    TOD_NextSwitchS = TOD_NEVER;
+
+    for (Local_Index = 0; Local_Index < TOD_ENTRY_COUNT; Local_Index++)
+    {
+        if ((TOD_Schedule[Local_Index].Plan >= PLAN_COUNT) || (TOD_Schedule[Local_Index].Hour > 23) ||
+            (TOD_Schedule[Local_Index].Minute > 59) ||
+            (PHASE_CheckTable(PLAN_GetTable(TOD_Schedule[Local_Index].Plan), NULL) != E_OK))
+        {
+            return E_NOT_OK;
+        }
+    }
+
+    TOD_BuildTransitions();
+    TOD_Ready = 1;
+
+    if (MCAL_RTC_IsRunning() && (MCAL_RTC_ReadBackup(TOD_BACKUP_REGISTER) == TOD_CLOCK_SET_MARK))
+    {
+        TOD_Apply(TOD_Locate(MCAL_RTC_GetCounter()));
+    }
+
+    return E_OK;
+}
+
+void TOD_Tick(void)
+{
+    u32 Local_Now = MCAL_RTC_GetCounter();
+
+    /**< One comparison per tick; the list is searched only at a transition */
+    if (Local_Now >= TOD_NextSwitchS)
+    {
+        TOD_Apply(TOD_Locate(Local_Now));
+    }
+}
+
+Std_ReturnType TOD_SetTime(u32 Copy_Seconds)
+{
+    if (!TOD_Ready || !MCAL_RTC_IsRunning() || (MCAL_RTC_SetCounter(Copy_Seconds) != E_OK))
+    {
+        return E_NOT_OK;
+    }
+
+    (void)MCAL_RTC_WriteBackup(TOD_BACKUP_REGISTER, TOD_CLOCK_SET_MARK);
+
+    /**< The clock may have gone back: search again from the new time */
+    TOD_Apply(TOD_Locate(Copy_Seconds));
+
+    return E_OK;
+}
+
+Std_ReturnType TOD_GetTime(u32 *Copy_Seconds)
+{
+    if ((Copy_Seconds == NULL) || (TOD_Plan == TOD_PLAN_NONE))
+    {
+        return E_NOT_OK;
+    }
+
+    *Copy_Seconds = MCAL_RTC_GetCounter();
+
+    return E_OK;
+}
+
+u8 TOD_GetPlan(void)
+{
+    return TOD_Plan;
+}
+
+u16 TOD_GetTicksToNextEvent(void)
+{
+    u32 Local_Now;
+    u32 Local_Seconds;
+
+    if (TOD_NextSwitchS == TOD_NEVER)
+    {
+        return PHASE_NO_EVENT;
+    }
+
+    Local_Now = MCAL_RTC_GetCounter();
+    if (Local_Now >= TOD_NextSwitchS)
+    {
+        return 1;
+    }
+
+    /**< Capped below the transition: a cap rounded to whole seconds would sleep past it */
+    Local_Seconds = TOD_NextSwitchS - Local_Now;
+    if (Local_Seconds > ((PHASE_NO_EVENT - 1UL) * PHASE_TICK_MS) / 1000UL)
+    {
+        return PHASE_NO_EVENT - 1;
+    }
+
+    return (u16)((Local_Seconds * 1000UL) / PHASE_TICK_MS);
+}
+/*****************************< End of Function Implementations *****************************/
@@ -0,0 +1,22 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : TRACE_config.h             *****************/
+/****************************************************************/
+#ifndef TRACE_CONFIG_H_
+#define TRACE_CONFIG_H_
+
+/**
+ * @brief Size in bytes of the trace buffer. Must be a power of two.
+ *
+ * Input edges take 2 to 6 bytes, output changes 4 to 8 bytes and SysTick wraps 2 to 6
+ * bytes (varint time delta + header + payload).
+ *
+ * Without a sink the buffer is a linear recording that stops once full, so the start of
+ * a burst is never overwritten. With a sink (see TRACE_SetSink) it becomes a ring that
+ * TRACE_Flush drains, and the whole run streams out through this fixed amount of RAM.
+ */
+#define TRACE_BUFFER_SIZE      1024
+
+#endif /**< TRACE_CONFIG_H_ */
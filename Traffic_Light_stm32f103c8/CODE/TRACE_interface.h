@@ -0,0 +1,182 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : TRACE_interface.h          *****************/
+/****************************************************************/
+#ifndef TRACE_INTERFACE_H_
+#define TRACE_INTERFACE_H_
+
+/**
+ * @defgroup TRACE_Types TRACE Type Definitions
+ * @{
+ */
+
+/**
+ * @name Trace Event Kinds
+ * @{
+ */
+#define TRACE_KIND_INPUT    0   /**< EXTI edge: Source = line, Value = pin level */
+#define TRACE_KIND_OUTPUT   1   /**< GPIO output change: Source = port, Value = new ODR */
+#define TRACE_KIND_TICK     2   /**< SysTick wrap: Source and Value unused */
+/** @} */
+
+/**
+ * @brief One decoded trace event.
+ *
+ * On the wire an event is a varint-encoded time delta (time since the previous event,
+ * or since TRACE_Init for the first one), a header byte holding the kind and the
+ * source, and for output changes the 16-bit port image. Timestamps come from
+ * TICK_GetTimeUs, which keeps counting through WFI sleep (the DWT cycle counter does
+ * not), so the deltas hold the real time between events, and the event stream maps one
+ * to one onto value changes in a VCD file. Time spent in STOP is not counted.
+ */
+typedef struct
+{
+    u32 DeltaUs;     /**< Microseconds since the previous event */
+    u8 Kind;         /**< One of TRACE_KIND_INPUT, TRACE_KIND_OUTPUT, TRACE_KIND_TICK */
+    u8 Source;       /**< EXTI line for inputs, GPIO port for outputs */
+    u16 Value;       /**< Pin level for inputs, ODR image for outputs */
+} TRACE_Event_t;
+
+/**
+ * @brief Sink receiving drained trace bytes (e.g. a UART or debugger buffer).
+ */
+typedef void (*TRACE_Sink_t)(const u8 *Copy_Data, u32 Copy_Length);
+
+/** @} */ // End of TRACE_Types
+
+/**
+ * @defgroup TRACE_Functions TRACE Functions
+ * @brief Record, stream, decode and re-inject trace events.
+ * @{
+ */
+
+/**
+ * @brief Start a new recording.
+ *
+ * Clears the event buffer and the ISR cost statistics and takes the current time as the
+ * reference for the first event. Call after TICK_Init.
+ *
+ * @return None.
+ */
+void TRACE_Init(void);
+
+/**
+ * @brief Append one input event to the recording.
+ *
+ * Intended to be called first thing in the input interrupt path. Costs a handful of
+ * cycles: one time read, a varint encode and a few byte stores. Safe to call from
+ * any priority level.
+ *
+ * @param[in] Copy_Line  The EXTI line that fired.
+ * @param[in] Copy_Level The level of the corresponding pin.
+ *
+ * @return E_OK if the event was stored, E_NOT_OK if the line is invalid or the buffer is full.
+ */
+Std_ReturnType TRACE_RecordInput(u8 Copy_Line, u8 Copy_Level);
+
+/**
+ * @brief Append a GPIO output change to the recording.
+ *
+ * @param[in] Copy_PortId The GPIO port that was written (GPIO_PORTA .. GPIO_PORTC).
+ * @param[in] Copy_Odr    The port output data register after the write.
+ *
+ * @return E_OK if the event was stored, E_NOT_OK if the port is invalid or the buffer is full.
+ */
+Std_ReturnType TRACE_RecordOutput(u8 Copy_PortId, u16 Copy_Odr);
+
+/**
+ * @brief Append a SysTick wrap to the recording.
+ *
+ * @return E_OK if the event was stored, E_NOT_OK if the buffer is full.
+ */
+Std_ReturnType TRACE_RecordTick(void);
+
+/**
+ * @brief Account the cost of one pass through the input interrupt path.
+ *
+ * @param[in] Copy_Cycles Number of core clock cycles spent in the handler.
+ *
+ * @return None.
+ */
+void TRACE_RecordIsrCost(u32 Copy_Cycles);
+
+/**
+ * @brief Get the cost statistics of the input interrupt path.
+ *
+ * @param[out] Copy_LastCycles Cycles spent in the most recent pass.
+ * @param[out] Copy_MaxCycles  Worst case since TRACE_Init.
+ *
+ * @return E_OK on success, E_NOT_OK if a pointer is NULL.
+ */
+Std_ReturnType TRACE_GetIsrCost(u32 *Copy_LastCycles, u32 *Copy_MaxCycles);
+
+/**
+ * @brief Get the recorded trace.
+ *
+ * Only meaningful while no sink is installed, when the buffer is a linear recording.
+ *
+ * @param[out] Copy_Buffer Pointer set to the first byte of the encoded trace.
+ * @param[out] Copy_Length Number of valid bytes in the trace.
+ *
+ * @return E_OK if the trace is complete, E_NOT_OK if a pointer is NULL, a sink is installed or
+ *         events were dropped because the buffer overflowed (the returned bytes are still a valid prefix).
+ */
+Std_ReturnType TRACE_GetBuffer(const u8 **Copy_Buffer, u32 *Copy_Length);
+
+/**
+ * @brief Install a sink and switch the buffer to streaming mode.
+ *
+ * @param[in] Copy_Sink The function receiving drained bytes, or NULL to return to linear recording.
+ *
+ * @return None.
+ */
+void TRACE_SetSink(TRACE_Sink_t Copy_Sink);
+
+/**
+ * @brief Drain all complete events to the installed sink.
+ *
+ * Call from the main loop. The sink is handed at most two contiguous chunks per call
+ * (before and after the ring wraps); producers keep recording meanwhile.
+ *
+ * @return E_OK if no event has been dropped since the previous flush, E_NOT_OK otherwise
+ *         or when no sink is installed.
+ */
+Std_ReturnType TRACE_Flush(void);
+
+/**
+ * @brief Decode the next event of an encoded trace.
+ *
+ * Does not touch any hardware, so the same routine serves the firmware and host-side
+ * tools that read a trace dumped from the target.
+ *
+ * @param[in]     Copy_Buffer The encoded trace.
+ * @param[in]     Copy_Length Number of bytes in the trace.
+ * @param[in,out] Copy_Offset Read position, advanced past the decoded event.
+ * @param[out]    Copy_Event  The decoded event.
+ *
+ * @return E_OK if an event was decoded, E_NOT_OK at the end of the trace or on a truncated event.
+ */
+Std_ReturnType TRACE_DecodeEvent(const u8 *Copy_Buffer, u32 Copy_Length, u32 *Copy_Offset, TRACE_Event_t *Copy_Event);
+
+/**
+ * @brief Re-inject a decoded event into the input path.
+ *
+ * Raises an input event's EXTI line through the software interrupt register, so the
+ * unmodified interrupt handler and callback run exactly as for a hardware edge.
+ * The caller is responsible for waiting Copy_Event->DeltaUs beforehand.
+ *
+ * @note The pin level cannot be forced from software; handlers that sample the pin see
+ *       its real state.
+ *
+ * @param[in] Copy_Event The event to replay.
+ *
+ * @return E_OK on success, E_NOT_OK if the pointer is NULL, the event is not an input
+ *         or the line is invalid.
+ */
+Std_ReturnType TRACE_InjectEvent(const TRACE_Event_t *Copy_Event);
+
+/** @} */ // End of TRACE_Functions
+
+#endif /**< TRACE_INTERFACE_H_ */
@@ -0,0 +1,48 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : TRACE_private.h            *****************/
+/****************************************************************/
+#ifndef TRACE_PRIVATE_H_
+#define TRACE_PRIVATE_H_
+
+#if (TRACE_BUFFER_SIZE & (TRACE_BUFFER_SIZE - 1)) != 0
+#error "TRACE_BUFFER_SIZE must be a power of two"
+#endif
+
+/**< Wrap a free-running index into the buffer */
+#define TRACE_INDEX_MASK            (TRACE_BUFFER_SIZE - 1)
+
+/**< Maximum number of bytes a 32-bit varint can take */
+#define TRACE_VARINT_MAX_SIZE       5
+
+/**< Maximum size of one encoded event: varint delta + header + 16-bit port image */
+#define TRACE_EVENT_MAX_SIZE        (TRACE_VARINT_MAX_SIZE + 1 + 2)
+
+/**< Varint encoding: 7 payload bits per byte, MSB set on every byte except the last */
+#define TRACE_VARINT_PAYLOAD_MASK   0x7F
+#define TRACE_VARINT_CONTINUE_MASK  0x80
+#define TRACE_VARINT_SHIFT          7
+
+/**
+ * @brief Event header byte.
+ *
+ * Bits 7..6 hold the event kind.
+ * - Input : bits 4..1 hold the EXTI line, bit 0 the level.
+ * - Output: bits 1..0 hold the GPIO port, followed by the 16-bit ODR (little endian).
+ * - Tick  : no payload.
+ */
+#define TRACE_HEADER_KIND_SHIFT     6
+#define TRACE_HEADER_PAYLOAD_MASK   0x3F
+
+#define TRACE_PACK_INPUT(LINE, LEVEL)   ((u8)((TRACE_KIND_INPUT << TRACE_HEADER_KIND_SHIFT) | ((LINE) << 1) | ((LEVEL) & 1)))
+#define TRACE_PACK_OUTPUT(PORT)         ((u8)((TRACE_KIND_OUTPUT << TRACE_HEADER_KIND_SHIFT) | ((PORT) & 0x03)))
+#define TRACE_PACK_TICK()               ((u8)(TRACE_KIND_TICK << TRACE_HEADER_KIND_SHIFT))
+
+#define TRACE_UNPACK_KIND(BYTE)         ((u8)((BYTE) >> TRACE_HEADER_KIND_SHIFT))
+#define TRACE_UNPACK_LINE(BYTE)         ((u8)(((BYTE) & TRACE_HEADER_PAYLOAD_MASK) >> 1))
+#define TRACE_UNPACK_LEVEL(BYTE)        ((u8)((BYTE) & 1))
+#define TRACE_UNPACK_PORT(BYTE)         ((u8)((BYTE) & 0x03))
+
+#endif /**< TRACE_PRIVATE_H_ */
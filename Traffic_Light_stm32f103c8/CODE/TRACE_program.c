@@ -0,0 +1,265 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : TRACE_program.c            *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "EXTI_interface.h"
+#include "GPIO_interface.h"
+#include "SCB_interface.h"
+/*****************************< SERVICE *****************************/
+#include "TICK_interface.h"
+#include "TRACE_interface.h"
+#include "TRACE_config.h"
+#include "TRACE_private.h"
+/*****************************< Private Variables *****************************/
+static u8 TRACE_Buffer[TRACE_BUFFER_SIZE];
+static volatile u32 TRACE_Head = 0;     /**< Free-running write index, published per complete event */
+static volatile u32 TRACE_Tail = 0;     /**< Free-running read index, advanced by TRACE_Flush */
+static volatile u8 TRACE_Overflow = 0;
+static u32 TRACE_LastTimestamp = 0;
+static TRACE_Sink_t TRACE_Sink = NULL;
+static u32 TRACE_IsrLastCycles = 0;
+static u32 TRACE_IsrMaxCycles = 0;
+/*****************************< Private Functions *****************************/
+static Std_ReturnType TRACE_Append(u8 Copy_Header, u16 Copy_Payload, u8 Copy_PayloadSize)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u32 Local_PriMask = SCB_EnterCritical();
+    u32 Local_Timestamp = TICK_GetTimeUs();
+    u32 Local_Index = TRACE_Head;
+    u32 Local_Delta;
+
+    /**< An event either fits completely or is dropped, so the stream stays decodable */
+    if ((Local_Index - TRACE_Tail + TRACE_EVENT_MAX_SIZE) > TRACE_BUFFER_SIZE)
+    {
+        TRACE_Overflow = 1;
+    }
+    else
+    {
+        Local_Delta = Local_Timestamp - TRACE_LastTimestamp;
+        TRACE_LastTimestamp = Local_Timestamp;
+
+        /**< Varint encode the time delta, least significant group first */
+        while (Local_Delta > TRACE_VARINT_PAYLOAD_MASK)
+        {
+            TRACE_Buffer[Local_Index++ & TRACE_INDEX_MASK] = (u8)((Local_Delta & TRACE_VARINT_PAYLOAD_MASK) | TRACE_VARINT_CONTINUE_MASK);
+            Local_Delta >>= TRACE_VARINT_SHIFT;
+        }
+        TRACE_Buffer[Local_Index++ & TRACE_INDEX_MASK] = (u8)Local_Delta;
+
+        TRACE_Buffer[Local_Index++ & TRACE_INDEX_MASK] = Copy_Header;
+
+        while (Copy_PayloadSize--)
+        {
+            TRACE_Buffer[Local_Index++ & TRACE_INDEX_MASK] = (u8)Copy_Payload;
+            Copy_Payload >>= 8;
+        }
+
+        /**< Publish the event only once it is complete */
+        TRACE_Head = Local_Index;
+        Local_FunctionStatus = E_OK;
+    }
+
+    SCB_ExitCritical(Local_PriMask);
+
+    return Local_FunctionStatus;
+}
+/*****************************< Function Implementations *****************************/
+void TRACE_Init(void)
+{
+    u32 Local_PriMask = SCB_EnterCritical();
+
+    TRACE_Head = 0;
+    TRACE_Tail = 0;
+    TRACE_Overflow = 0;
+    TRACE_IsrLastCycles = 0;
+    TRACE_IsrMaxCycles = 0;
+    TRACE_LastTimestamp = TICK_GetTimeUs();
+
+    SCB_ExitCritical(Local_PriMask);
+}
+
+Std_ReturnType TRACE_RecordInput(u8 Copy_Line, u8 Copy_Level)
+{
+    if (Copy_Line > EXTI_LINE15)
+    {
+        return E_NOT_OK;
+    }
+
+    return TRACE_Append(TRACE_PACK_INPUT(Copy_Line, Copy_Level), 0, 0);
+}
+
+Std_ReturnType TRACE_RecordOutput(u8 Copy_PortId, u16 Copy_Odr)
+{
+    if (Copy_PortId > GPIO_PORTC)
+    {
+        return E_NOT_OK;
+    }
+
+    return TRACE_Append(TRACE_PACK_OUTPUT(Copy_PortId), Copy_Odr, 2);
+}
+
+Std_ReturnType TRACE_RecordTick(void)
+{
+    return TRACE_Append(TRACE_PACK_TICK(), 0, 0);
+}
+
+void TRACE_RecordIsrCost(u32 Copy_Cycles)
+{
+    TRACE_IsrLastCycles = Copy_Cycles;
+    if (Copy_Cycles > TRACE_IsrMaxCycles)
+    {
+        TRACE_IsrMaxCycles = Copy_Cycles;
+    }
+}
+
+Std_ReturnType TRACE_GetIsrCost(u32 *Copy_LastCycles, u32 *Copy_MaxCycles)
+{
+    if ((Copy_LastCycles == NULL) || (Copy_MaxCycles == NULL))
+    {
+        return E_NOT_OK;
+    }
+
+    *Copy_LastCycles = TRACE_IsrLastCycles;
+    *Copy_MaxCycles = TRACE_IsrMaxCycles;
+
+    return E_OK;
+}
+
+Std_ReturnType TRACE_GetBuffer(const u8 **Copy_Buffer, u32 *Copy_Length)
+{
+    if ((Copy_Buffer == NULL) || (Copy_Length == NULL) || (TRACE_Sink != NULL))
+    {
+        return E_NOT_OK;
+    }
+
+    /**< Without a sink the tail never moves, so the recording is linear from index 0 */
+    *Copy_Buffer = TRACE_Buffer;
+    *Copy_Length = TRACE_Head;
+
+    return (TRACE_Overflow == 0) ? E_OK : E_NOT_OK;
+}
+
+void TRACE_SetSink(TRACE_Sink_t Copy_Sink)
+{
+    TRACE_Sink = Copy_Sink;
+}
+
+Std_ReturnType TRACE_Flush(void)
+{
+    u32 Local_Head = TRACE_Head;
+    u32 Local_Tail = TRACE_Tail;
+    u32 Local_Chunk;
+    Std_ReturnType Local_FunctionStatus = E_OK;
+
+    if (TRACE_Sink == NULL)
+    {
+        return E_NOT_OK;
+    }
+
+    while (Local_Tail != Local_Head)
+    {
+        /**< Hand over the largest contiguous run before the end of the ring */
+        Local_Chunk = TRACE_BUFFER_SIZE - (Local_Tail & TRACE_INDEX_MASK);
+        if (Local_Chunk > (Local_Head - Local_Tail))
+        {
+            Local_Chunk = Local_Head - Local_Tail;
+        }
+
+        TRACE_Sink(&TRACE_Buffer[Local_Tail & TRACE_INDEX_MASK], Local_Chunk);
+        Local_Tail += Local_Chunk;
+        TRACE_Tail = Local_Tail;
+    }
+
+    if (TRACE_Overflow != 0)
+    {
+        TRACE_Overflow = 0;
+        Local_FunctionStatus = E_NOT_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType TRACE_DecodeEvent(const u8 *Copy_Buffer, u32 Copy_Length, u32 *Copy_Offset, TRACE_Event_t *Copy_Event)
+{
+    u32 Local_Index;
+    u32 Local_Delta = 0;
+    u8 Local_Shift = 0;
+    u8 Local_Byte;
+
+    if ((Copy_Buffer == NULL) || (Copy_Offset == NULL) || (Copy_Event == NULL))
+    {
+        return E_NOT_OK;
+    }
+
+    Local_Index = *Copy_Offset;
+
+    /**< Varint decode the time delta */
+    do
+    {
+        if ((Local_Index >= Copy_Length) || (Local_Shift >= (TRACE_VARINT_MAX_SIZE * TRACE_VARINT_SHIFT)))
+        {
+            return E_NOT_OK;
+        }
+        Local_Byte = Copy_Buffer[Local_Index++];
+        Local_Delta |= ((u32)(Local_Byte & TRACE_VARINT_PAYLOAD_MASK)) << Local_Shift;
+        Local_Shift += TRACE_VARINT_SHIFT;
+    } while (Local_Byte & TRACE_VARINT_CONTINUE_MASK);
+
+    /**< Header byte */
+    if (Local_Index >= Copy_Length)
+    {
+        return E_NOT_OK;
+    }
+    Local_Byte = Copy_Buffer[Local_Index++];
+
+    Copy_Event->DeltaUs = Local_Delta;
+    Copy_Event->Kind = TRACE_UNPACK_KIND(Local_Byte);
+
+    switch (Copy_Event->Kind)
+    {
+    case TRACE_KIND_INPUT:
+        Copy_Event->Source = TRACE_UNPACK_LINE(Local_Byte);
+        Copy_Event->Value = TRACE_UNPACK_LEVEL(Local_Byte);
+        break;
+
+    case TRACE_KIND_OUTPUT:
+        if ((Local_Index + 2) > Copy_Length)
+        {
+            return E_NOT_OK;
+        }
+        Copy_Event->Source = TRACE_UNPACK_PORT(Local_Byte);
+        Copy_Event->Value = (u16)(Copy_Buffer[Local_Index] | (Copy_Buffer[Local_Index + 1] << 8));
+        Local_Index += 2;
+        break;
+
+    case TRACE_KIND_TICK:
+        Copy_Event->Source = 0;
+        Copy_Event->Value = 0;
+        break;
+
+    default:
+        return E_NOT_OK;
+    }
+
+    *Copy_Offset = Local_Index;
+
+    return E_OK;
+}
+
+Std_ReturnType TRACE_InjectEvent(const TRACE_Event_t *Copy_Event)
+{
+    if ((Copy_Event == NULL) || (Copy_Event->Kind != TRACE_KIND_INPUT))
+    {
+        return E_NOT_OK;
+    }
+
+    return EXTI_GenerateSoftwareInterrupt(Copy_Event->Source);
+}
+/*****************************< End of Function Implementations *****************************/
@@ -0,0 +1,30 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : USART_config.h             *****************/
+/****************************************************************/
+#ifndef USART_CONFIG_H_
+#define USART_CONFIG_H_
+
+/**
+ * @brief USART1 baud rate (8N1).
+ */
+#define USART_BAUD_RATE         115200
+
+/**
+ * @brief Size in bytes of the transmit ring. Producers reserve contiguous slots in it.
+ *
+ * At 115200 baud the line drains about 11.5 bytes per millisecond.
+ */
+#define USART_TX_BUFFER_SIZE    512
+
+/**
+ * @brief Size in bytes of the circular receive buffer filled by DMA.
+ *
+ * Received bytes are handed over on idle line, half transfer and transfer complete, so the
+ * buffer must hold what arrives during the longest interrupt latency plus one half.
+ */
+#define USART_RX_BUFFER_SIZE    128
+
+#endif /**< USART_CONFIG_H_ */
@@ -0,0 +1,109 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : USART_interface.h          *****************/
+/****************************************************************/
+#ifndef USART_INTERFACE_H_
+#define USART_INTERFACE_H_
+
+/**
+ * @defgroup USART_Parameters USART Parameters
+ * @{
+ */
+
+/**
+ * @brief Callback receiving bytes straight from the DMA receive buffer.
+ *
+ * Called from interrupt context; the data must be consumed before returning.
+ */
+typedef void (*USART_RxCallback_t)(const u8 *Copy_Data, u32 Copy_Length);
+
+/** @} */ // End of USART_Parameters
+
+/**
+ * @defgroup USART_Functions USART Functions
+ * @brief USART1 (TX PA9, RX PA10) with DMA in both directions.
+ *
+ * Transmit: producers reserve a contiguous slot in the transmit ring, build their data in
+ * place and commit it; DMA channel 4 sends each committed run without the CPU touching the
+ * bytes. Receive: DMA channel 5 fills a circular buffer and new bytes are handed to the
+ * receive callback on idle line, half transfer and transfer complete.
+ *
+ * The caller enables the USART1, DMA1 and GPIOA clocks, configures PA9 as alternate function
+ * push-pull and PA10 as floating input, and enables NVIC_USART1_IRQn, NVIC_DMA1_Channel4_IRQn
+ * and NVIC_DMA1_Channel5_IRQn at the same priority.
+ * @{
+ */
+
+/**
+ * @brief Initialize USART1 and both DMA channels, and start reception.
+ *
+ * @param[in] Copy_PclkFreq The APB2 clock frequency in Hz.
+ *
+ * @return E_OK on success, E_NOT_OK if the baud rate cannot be derived from the clock.
+ */
+Std_ReturnType MCAL_USART_Init(u32 Copy_PclkFreq);
+
+/**
+ * @brief Recompute the baud rate after the APB2 clock changed. Call while the transmitter is idle.
+ *
+ * @param[in] Copy_PclkFreq The new APB2 clock frequency in Hz.
+ *
+ * @return E_OK on success, E_NOT_OK if the baud rate cannot be derived from the clock.
+ */
+Std_ReturnType MCAL_USART_SetClockFreq(u32 Copy_PclkFreq);
+
+/**
+ * @brief Reserve a contiguous slot in the transmit ring.
+ *
+ * Nothing is sent until MCAL_USART_TxCommit is called. Only one reservation may be open at a
+ * time, so producers must either run in one context (the main loop) or be serialized by the
+ * caller, as the TLM service does.
+ *
+ * @param[in] Copy_Length Number of bytes to reserve.
+ *
+ * @return Pointer to the slot, or NULL if the ring has no contiguous room for it.
+ */
+u8 *MCAL_USART_TxReserve(u32 Copy_Length);
+
+/**
+ * @brief Publish the first bytes of the open reservation and start DMA if it is idle.
+ *
+ * @param[in] Copy_Length Number of bytes written into the slot (at most the reserved length, 0 to cancel).
+ *
+ * @return E_OK on success, E_NOT_OK if there is no open reservation or the length exceeds it.
+ */
+Std_ReturnType MCAL_USART_TxCommit(u32 Copy_Length);
+
+/**
+ * @brief Copy a block into the transmit ring and send it.
+ *
+ * Convenience wrapper around reserve/copy/commit for data that already lives elsewhere.
+ *
+ * @param[in] Copy_Data The bytes to send.
+ * @param[in] Copy_Length Number of bytes.
+ *
+ * @return E_OK if the block was queued, E_NOT_OK if it does not fit (nothing is queued).
+ */
+Std_ReturnType MCAL_USART_Write(const u8 *Copy_Data, u32 Copy_Length);
+
+/**
+ * @brief Check whether every committed byte is on the wire.
+ *
+ * @return 1 if the ring is empty, DMA is idle and the last byte has been shifted out (TC), 0 otherwise.
+ */
+u8 MCAL_USART_IsTxIdle(void);
+
+/**
+ * @brief Register the function receiving incoming bytes.
+ *
+ * @param[in] Copy_Callback The callback, or NULL to discard received bytes.
+ *
+ * @return None.
+ */
+void MCAL_USART_SetRxCallback(USART_RxCallback_t Copy_Callback);
+
+/** @} */ // End of USART_Functions
+
+#endif /**< USART_INTERFACE_H_ */
@@ -0,0 +1,51 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : USART_private.h            *****************/
+/****************************************************************/
+#ifndef USART_PRIVATE_H_
+#define USART_PRIVATE_H_
+
+#if (USART_TX_BUFFER_SIZE > 0xFFFF) || (USART_RX_BUFFER_SIZE > 0xFFFF)
+#error "USART buffers must fit in one DMA transfer (65535 bytes)"
+#endif
+
+/**< USART1 base address */
+#define USART1_BASE_ADDRESS     0x40013800U
+
+/**< USART register structure */
+typedef struct
+{
+    volatile u32 SR;    /**< Status Register */
+    volatile u32 DR;    /**< Data Register */
+    volatile u32 BRR;   /**< Baud Rate Register */
+    volatile u32 CR1;   /**< Control Register 1 */
+    volatile u32 CR2;   /**< Control Register 2 */
+    volatile u32 CR3;   /**< Control Register 3 */
+    volatile u32 GTPR;  /**< Guard Time and Prescaler Register */
+} USART_RegDef_t;
+
+/**< Pointer to USART1 register structure */
+#define USART1   ((USART_RegDef_t *)USART1_BASE_ADDRESS)
+
+/**< SR bits */
+#define USART_SR_ORE        3   /**< Overrun error */
+#define USART_SR_IDLE       4   /**< Idle line detected */
+#define USART_SR_TC         6   /**< Transmission complete */
+
+/**< CR1 bits */
+#define USART_CR1_RE        2   /**< Receiver enable */
+#define USART_CR1_TE        3   /**< Transmitter enable */
+#define USART_CR1_IDLEIE    4   /**< Idle interrupt enable */
+#define USART_CR1_UE        13  /**< USART enable */
+
+/**< CR3 bits */
+#define USART_CR3_DMAR      6   /**< DMA enable receiver */
+#define USART_CR3_DMAT      7   /**< DMA enable transmitter */
+
+/**< DMA1 request mapping of USART1 */
+#define USART_TX_DMA_CHANNEL    DMA_CHANNEL4
+#define USART_RX_DMA_CHANNEL    DMA_CHANNEL5
+
+#endif /**< USART_PRIVATE_H_ */
@@ -0,0 +1,296 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : USART_program.c            *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "DMA_interface.h"
+#include "SCB_interface.h"
+#include "USART_interface.h"
+#include "USART_config.h"
+#include "USART_private.h"
+/*****************************< Private Variables *****************************/
+/**
+ * Transmit ring (bip buffer): committed data is [Tail, Head) or, once the producer has
+ * wrapped, [Tail, End) followed by [0, Head). Head and the open reservation belong to the
+ * producer, Tail and InFlight to the DMA completion interrupt.
+ */
+static u8 USART_TxBuffer[USART_TX_BUFFER_SIZE];
+static volatile u32 USART_TxHead = 0;
+static volatile u32 USART_TxTail = 0;
+static volatile u32 USART_TxEnd = USART_TX_BUFFER_SIZE;
+static volatile u32 USART_TxInFlight = 0;          /**< Bytes handed to DMA, 0 when idle */
+static u32 USART_TxReservedLength = 0;
+static u8 USART_TxReservedWrap = 0;                 /**< The open reservation starts at index 0 */
+
+static u8 USART_RxBuffer[USART_RX_BUFFER_SIZE];
+static u32 USART_RxRead = 0;                        /**< First byte not yet handed to the callback */
+static USART_RxCallback_t USART_RxCallback = NULL;
+/*****************************< Private Functions *****************************/
+/**< Start DMA on the next contiguous run. Runs with the DMA interrupt masked or from it. */
+static void USART_TxKick(void)
+{
+    u32 Local_Head = USART_TxHead;
+    u32 Local_Tail = USART_TxTail;
+    u32 Local_Chunk;
+
+    if ((USART_TxInFlight != 0) || (Local_Tail == Local_Head))
+    {
+        return;
+    }
+
+    /**< Everything before the producer's wrap point has been sent */
+    if ((Local_Head < Local_Tail) && (Local_Tail >= USART_TxEnd))
+    {
+        Local_Tail = 0;
+        USART_TxTail = 0;
+        USART_TxEnd = USART_TX_BUFFER_SIZE;
+    }
+
+    Local_Chunk = (Local_Head >= Local_Tail) ? (Local_Head - Local_Tail) : (USART_TxEnd - Local_Tail);
+    if (Local_Chunk != 0)
+    {
+        USART_TxInFlight = Local_Chunk;
+        /**< TC (rc_w0) is set again only after the last byte of this run has left the shift register */
+        USART1->SR = ~(1UL << USART_SR_TC);
+        MCAL_DMA_StartTransfer(USART_TX_DMA_CHANNEL, (u32)&USART1->DR, &USART_TxBuffer[Local_Tail], (u16)Local_Chunk);
+    }
+}
+
+static void USART_TxDmaCallback(u8 Copy_Flags)
+{
+    if (Copy_Flags & DMA_IT_COMPLETE)
+    {
+        USART_TxTail = USART_TxTail + USART_TxInFlight;
+        USART_TxInFlight = 0;
+        USART_TxKick();
+    }
+}
+
+/**< Hand everything DMA wrote since the last call to the callback, straight from the buffer */
+static void USART_RxProcess(void)
+{
+    u32 Local_Write = USART_RX_BUFFER_SIZE - MCAL_DMA_GetRemainingCount(USART_RX_DMA_CHANNEL);
+
+    if (Local_Write >= USART_RX_BUFFER_SIZE)
+    {
+        Local_Write = 0;
+    }
+
+    if (Local_Write == USART_RxRead)
+    {
+        return;
+    }
+
+    if (USART_RxCallback != NULL)
+    {
+        if (Local_Write > USART_RxRead)
+        {
+            USART_RxCallback(&USART_RxBuffer[USART_RxRead], Local_Write - USART_RxRead);
+        }
+        else
+        {
+            USART_RxCallback(&USART_RxBuffer[USART_RxRead], USART_RX_BUFFER_SIZE - USART_RxRead);
+            if (Local_Write != 0)
+            {
+                USART_RxCallback(USART_RxBuffer, Local_Write);
+            }
+        }
+    }
+
+    USART_RxRead = Local_Write;
+}
+
+static void USART_RxDmaCallback(u8 Copy_Flags)
+{
+    if (Copy_Flags & (DMA_IT_HALF | DMA_IT_COMPLETE))
+    {
+        USART_RxProcess();
+    }
+}
+/*****************************< Function Implementations *****************************/
+Std_ReturnType MCAL_USART_Init(u32 Copy_PclkFreq)
+{
+    DMA_ChannelConfig_t Local_TxConfig = {
+        .Direction = DMA_MEMORY_TO_PERIPHERAL,
+        .Mode = DMA_MODE_NORMAL,
+        .PeripheralSize = DMA_SIZE_8BIT,
+        .MemorySize = DMA_SIZE_8BIT,
+        .PeripheralIncrement = 0,
+        .MemoryIncrement = 1,
+        .Priority = DMA_PRIORITY_MEDIUM,
+        .Interrupts = DMA_IT_COMPLETE,
+    };
+    DMA_ChannelConfig_t Local_RxConfig = {
+        .Direction = DMA_PERIPHERAL_TO_MEMORY,
+        .Mode = DMA_MODE_CIRCULAR,
+        .PeripheralSize = DMA_SIZE_8BIT,
+        .MemorySize = DMA_SIZE_8BIT,
+        .PeripheralIncrement = 0,
+        .MemoryIncrement = 1,
+        .Priority = DMA_PRIORITY_HIGH,
+        .Interrupts = DMA_IT_HALF | DMA_IT_COMPLETE,
+    };
+
+    /**< BRR holds PCLK / baud in 12.4 fixed point, rounded */
+    if ((Copy_PclkFreq / USART_BAUD_RATE) < 16)
+    {
+        return E_NOT_OK;
+    }
+
+    USART1->CR1 = 0;
+    USART1->BRR = (Copy_PclkFreq + (USART_BAUD_RATE / 2)) / USART_BAUD_RATE;
+
+    USART_TxHead = 0;
+    USART_TxTail = 0;
+    USART_TxEnd = USART_TX_BUFFER_SIZE;
+    USART_TxInFlight = 0;
+    USART_TxReservedLength = 0;
+    USART_RxRead = 0;
+
+    MCAL_DMA_ConfigChannel(USART_TX_DMA_CHANNEL, &Local_TxConfig);
+    MCAL_DMA_SetCallback(USART_TX_DMA_CHANNEL, USART_TxDmaCallback);
+    MCAL_DMA_ConfigChannel(USART_RX_DMA_CHANNEL, &Local_RxConfig);
+    MCAL_DMA_SetCallback(USART_RX_DMA_CHANNEL, USART_RxDmaCallback);
+    MCAL_DMA_StartTransfer(USART_RX_DMA_CHANNEL, (u32)&USART1->DR, USART_RxBuffer, USART_RX_BUFFER_SIZE);
+
+    USART1->CR3 = (1 << USART_CR3_DMAT) | (1 << USART_CR3_DMAR);
+    USART1->CR1 = (1 << USART_CR1_UE) | (1 << USART_CR1_TE) | (1 << USART_CR1_RE) | (1 << USART_CR1_IDLEIE);
+
+    return E_OK;
+}
+
+Std_ReturnType MCAL_USART_SetClockFreq(u32 Copy_PclkFreq)
+{
+    if ((Copy_PclkFreq / USART_BAUD_RATE) < 16)
+    {
+        return E_NOT_OK;
+    }
+
+    USART1->BRR = (Copy_PclkFreq + (USART_BAUD_RATE / 2)) / USART_BAUD_RATE;
+
+    return E_OK;
+}
+
+u8 *MCAL_USART_TxReserve(u32 Copy_Length)
+{
+    u32 Local_Head = USART_TxHead;
+    u32 Local_Tail = USART_TxTail;
+
+    if ((Copy_Length == 0) || (Copy_Length >= USART_TX_BUFFER_SIZE))
+    {
+        return NULL;
+    }
+
+    /**< Head never catches up with Tail from behind, so Head == Tail always means empty */
+    if (Local_Head >= Local_Tail)
+    {
+        if ((USART_TX_BUFFER_SIZE - Local_Head) >= Copy_Length)
+        {
+            USART_TxReservedWrap = 0;
+        }
+        else if (Local_Tail > Copy_Length)
+        {
+            USART_TxReservedWrap = 1;
+            Local_Head = 0;
+        }
+        else
+        {
+            return NULL;
+        }
+    }
+    else if ((Local_Tail - Local_Head) > Copy_Length)
+    {
+        USART_TxReservedWrap = 0;
+    }
+    else
+    {
+        return NULL;
+    }
+
+    USART_TxReservedLength = Copy_Length;
+
+    return &USART_TxBuffer[Local_Head];
+}
+
+Std_ReturnType MCAL_USART_TxCommit(u32 Copy_Length)
+{
+    u32 Local_PriMask;
+
+    if ((USART_TxReservedLength == 0) || (Copy_Length > USART_TxReservedLength))
+    {
+        return E_NOT_OK;
+    }
+
+    USART_TxReservedLength = 0;
+    if (Copy_Length == 0)
+    {
+        return E_OK;
+    }
+
+    Local_PriMask = SCB_EnterCritical();
+
+    if (USART_TxReservedWrap)
+    {
+        USART_TxEnd = USART_TxHead;
+        USART_TxHead = 0;
+    }
+    USART_TxHead = USART_TxHead + Copy_Length;
+    USART_TxKick();
+
+    SCB_ExitCritical(Local_PriMask);
+
+    return E_OK;
+}
+
+Std_ReturnType MCAL_USART_Write(const u8 *Copy_Data, u32 Copy_Length)
+{
+    u8 *Local_Slot;
+    u32 Local_Index;
+
+    if (Copy_Data == NULL)
+    {
+        return E_NOT_OK;
+    }
+
+    Local_Slot = MCAL_USART_TxReserve(Copy_Length);
+    if (Local_Slot == NULL)
+    {
+        return E_NOT_OK;
+    }
+
+    for (Local_Index = 0; Local_Index < Copy_Length; Local_Index++)
+    {
+        Local_Slot[Local_Index] = Copy_Data[Local_Index];
+    }
+
+    return MCAL_USART_TxCommit(Copy_Length);
+}
+
+u8 MCAL_USART_IsTxIdle(void)
+{
+    /**< DMA is done once the last byte is in DR; TC tells it has also left the shift register */
+    return ((USART_TxInFlight == 0) && (USART_TxHead == USART_TxTail) && GET_BIT(USART1->SR, USART_SR_TC)) ? 1 : 0;
+}
+
+void MCAL_USART_SetRxCallback(USART_RxCallback_t Copy_Callback)
+{
+    USART_RxCallback = Copy_Callback;
+}
+/*****************************< IRQ Handlers *****************************/
+void USART1_IRQHandler(void)
+{
+    u32 Local_Status = USART1->SR;
+
+    if (Local_Status & ((1 << USART_SR_IDLE) | (1 << USART_SR_ORE)))
+    {
+        /**< IDLE and ORE are cleared by reading SR then DR */
+        (void)USART1->DR;
+        USART_RxProcess();
+    }
+}
@@ -7,128 +7,752 @@
 #include "AFIO_interface.h"
 #include "EXTI_interface.h"
 #include "NVIC_Interface.h"
+#include "SCB_interface.h"
 #include "EXTI_private.h"
+#include "DWT_interface.h"
+#include "DMA_interface.h"
+#include "USART_interface.h"
+#include "FLASH_interface.h"
+#include "PWR_interface.h"
+#include "TIM_interface.h"
+#include "RTC_interface.h"
 /***********<HAL*********/
 #include "LED.h"
+/***********<Service*****/
+#include "TRACE_interface.h"
+#include "TLM_interface.h"
+#include "LOG_interface.h"
+#include "TICK_interface.h"
+/***********<APP*********/
+#include "PHASE_interface.h"
+#include "PHASE_config.h"
+#include "SAFETY_interface.h"
+#include "CMD_interface.h"
+#include "CMD_config.h"
+#include "NIGHT_interface.h"
+#include "ADAPT_interface.h"
+#include "COORD_interface.h"
+#include "COORD_config.h"
+#include "TOD_interface.h"
+#include "DISP_interface.h"
+#include "DET_interface.h"
 
-#define Button_Pin GPIO_PIN4
+/* Emergency vehicle preemption input on PA0 (EXTI0), preempting every crossing */
+#define Preempt_Pin GPIO_PIN0
 
-#define Red_Ped_Led GPIO_PIN1
-#define Green_Cars_Led GPIO_PIN1
-#define Yellow_Ped_Led GPIO_PIN2
-#define Yellow_Cars_Led GPIO_PIN2
-#define Green_Ped_Led GPIO_PIN3
-#define Red_Cars_Led GPIO_PIN3
-u8 x=0,flag=1,yellow=1;
-void interrupt(void);
+/* Green-wave sync line between controllers: the master drives PB12, slaves listen on PB11 (EXTI15_10) */
+#define Sync_In_Pin GPIO_PIN11
+#define Sync_Out_Pin GPIO_PIN12
+
+/* NVIC groups (NVIC_4GROUP_4SUB): the preemption input alone in the top group, every other interrupt and
+   SysTick one below, so nothing but a critical section delays the first output change */
+#define Preempt_Group 0
+#define Other_Group 1
+
+/* Telemetry link to the cabinet computer on USART1 */
+#define Uart_Tx_Pin GPIO_PIN9
+#define Uart_Rx_Pin GPIO_PIN10
+
+/* Wiring of one crossing: pedestrian head and its "wait" lamp on PORTA, car head, request button and
+   vehicle detector on PORTB */
+typedef struct
+{
+	u8 ped_red,ped_yellow,ped_green,wait;
+	u8 car_green,car_yellow,car_red;
+	u8 button;	/* also its EXTI line */
+	u8 detector;	/* also its EXTI line */
+} Crossing_Wiring_t;
+
+/* Crossing 0 is the original board (PA1..PA3, wait PA4, PB1..PB3, button PB4, detector PB9); crossing 1 the
+   same heads four pins up with its wait lamp on PA8. Only crossing 0 is dimmed: LED_PWM_MAP covers its pins alone */
+const Crossing_Wiring_t Crossings[]={
+	{GPIO_PIN1,GPIO_PIN2,GPIO_PIN3,GPIO_PIN4,GPIO_PIN1,GPIO_PIN2,GPIO_PIN3,GPIO_PIN4,GPIO_PIN9},
+	{GPIO_PIN5,GPIO_PIN6,GPIO_PIN7,GPIO_PIN8,GPIO_PIN5,GPIO_PIN6,GPIO_PIN7,GPIO_PIN8,GPIO_PIN10},
+};
+#if PHASE_INTERSECTION_COUNT > 2
+#error "Crossings[] wires only two crossings"
+#endif
+
+/* Pedestrian countdown of crossing 0 on a 2-digit 7-segment display (DISP_config.h); it takes the PORTB pins
+   of crossing 1, so it only runs with one crossing */
+#define Countdown_Enabled (PHASE_INTERSECTION_COUNT==1)
+#define Countdown_Crossing 0
+#define Ticks_Per_Second (1000/PHASE_TICK_MS)
+#if (1000%PHASE_TICK_MS)!=0
+#error "The countdown needs whole ticks per second"
+#endif
+
+/* Counts, occupancy and speed of one lane from a loop pair, upstream on PA8 and downstream on PA11, time-stamped
+   by TIM1 input capture (DET_config.h); PA8 is the wait lamp of crossing 1, so it only runs with one crossing */
+#define Loops_Enabled (PHASE_INTERSECTION_COUNT==1)
+#define Loop_Up_Pin GPIO_PIN8
+#define Loop_Down_Pin GPIO_PIN11
+
+/* Pins owned by the signal heads of all crossings, filled by Crossings_Init; the buttons are never written */
+LED_Group_t Signal_Heads;
+
+/* Longest control step (engine tick of all crossings, image merge and write), in core cycles */
+u32 Control_MaxCycles;
+
+/* Image on the heads, and writes done by the preemption ISR so a control step it interrupted drops its image */
+u32 Signals_Image;
+volatile u32 Preempt_Writes;
+
+/* Greens that conflict with the preempt green, one entry per head, and the yellow that replaces each: the
+   preemption ISR only ever swaps these on the image already written, never lights a green. Left zero when the
+   swapped image fails the safety rules, so the ISR then writes nothing and the next step clears */
+#define Preempt_Heads (PHASE_INTERSECTION_COUNT*2)
+u32 Preempt_Green[Preempt_Heads];
+u32 Preempt_Yellow[Preempt_Heads];
+
+/* Longest preemption ISR entry to signal write, in core cycles; the edge itself is 12 cycles of exception entry
+   earlier, and both the edge and the port write are time-stamped in the trace */
+u32 Preempt_MaxCycles;
+
+/* Boot marker on PC13: high from the first safe output until the controller is running */
+#define Boot_Marker_Pin GPIO_PIN13
+
+/* After boot PC13 is the status LED (active low on the Blue Pill), played by the LED sequencer */
+#define Status_Seq_Slot 0
+#define Status_Led_Mask (1<<LED_PIN13)
+const LED_SeqStep_t Status_Heartbeat_Steps[]={{1,1},{0,39}};
+const LED_SeqStep_t Status_Fault_Steps[]={{1,2},{0,2}};
+const LED_SeqPattern_t Status_Heartbeat={Status_Heartbeat_Steps,2,LED_SEQ_FOREVER};
+const LED_SeqPattern_t Status_Fault={Status_Fault_Steps,2,LED_SEQ_FOREVER};
+
+/* Cycle stamps of the boot (inspect in the debugger, scope the marker for time from reset) */
+volatile u32 Boot_SafeOutputCycles;
+volatile u32 Boot_ReadyCycles;
+volatile Std_ReturnType Boot_ClockStatus;
+
+/* Pedestrian requests and vehicle detections seen by the input ISR */
+volatile u32 Ped_Requests;
+volatile u32 Vehicle_Calls;
+
+/* Control ticks since boot, the time stamp of the flash log */
+u32 Uptime_Ticks;
+
+/* Set by the input ISR so the idle loop does not go back to sleep before the request or detection is planned */
+volatile u8 Input_Pending;
+
+/* Set after a wake-up from STOP: the core runs from HSI until the first control step is done */
+u8 Clock_Restore_Pending;
+
+void Inputs_Isr(void);
+void Preempt_Isr(void);
+void Crossings_Init(void);
+u32 Crossing_ToImage(u8 crossing,u8 signals);
+u32 Plan_ToImage(u8 signals);
+void Signals_Write(u32 image);
+void Signals_Apply(void);
+void Telemetry_Report(void);
+void Control_Tick(void);
+void Status_Update(void);
+u8 Work_Pending(void);
+u8 Flash_MayStall(void);
+void Clock_Restore(void);
+Std_ReturnType Enter_Stop(void);
+void Countdown_Update(void);
+u16 Countdown_TicksToNextStep(void);
 int main(void)
-{MCAL_RCC_InitSysClock();
+{
+	u32 safe_image;
+	MCAL_DWT_Init();
+	/********<Drive a safe all-red image from HSI before anything else*******/
 	MCAL_RCC_EnablePeripheral(RCC_APB2,RCC_APB2ENR_IOPAEN);
 	MCAL_RCC_EnablePeripheral(RCC_APB2,RCC_APB2ENR_IOPBEN);
+	MCAL_RCC_EnablePeripheral(RCC_APB2,RCC_APB2ENR_IOPCEN);
+	SAFETY_Init();
+	safe_image=SAFETY_GetFallbackImage();
+	/* Levels are latched before the pins become outputs so no lamp glitches on */
+	Crossings_Init();
+	Signals_Write(safe_image);
+	/********<Set pin modes of the heads of every crossing*******/
+	for(u8 i=0;i<PHASE_INTERSECTION_COUNT;i++)
+	{
+		MCAL_GPIO_SetPinMode(GPIO_PORTA,Crossings[i].ped_red,GPIO_OUTPUT_PUSH_PULL_2MHZ);
+		MCAL_GPIO_SetPinMode(GPIO_PORTA,Crossings[i].ped_yellow,GPIO_OUTPUT_PUSH_PULL_2MHZ);
+		MCAL_GPIO_SetPinMode(GPIO_PORTA,Crossings[i].ped_green,GPIO_OUTPUT_PUSH_PULL_2MHZ);
+		MCAL_GPIO_SetPinMode(GPIO_PORTA,Crossings[i].wait,GPIO_OUTPUT_PUSH_PULL_2MHZ);
+		MCAL_GPIO_SetPinMode(GPIO_PORTB,Crossings[i].car_green,GPIO_OUTPUT_PUSH_PULL_2MHZ);
+		MCAL_GPIO_SetPinMode(GPIO_PORTB,Crossings[i].car_yellow,GPIO_OUTPUT_PUSH_PULL_2MHZ);
+		MCAL_GPIO_SetPinMode(GPIO_PORTB,Crossings[i].car_red,GPIO_OUTPUT_PUSH_PULL_2MHZ);
+	}
+	MCAL_GPIO_SetPinValue(GPIO_PORTC,Boot_Marker_Pin,GPIO_HIGH);
+	MCAL_GPIO_SetPinMode(GPIO_PORTC,Boot_Marker_Pin,GPIO_OUTPUT_PUSH_PULL_2MHZ);
+	Boot_SafeOutputCycles=MCAL_DWT_GetCycles();
+	/********<The only clock bring-up: RCC_config.h, bounded waits, stays on HSI on failure*******/
+	Boot_ClockStatus=MCAL_RCC_InitSysClock();
+	MCAL_STK_SetClockFreq(MCAL_RCC_GetSysClockFreq());
+	/* Control ticks come from SysTick; between phase events the core sleeps in WFI */
+	TICK_Init(PHASE_TICK_MS,MCAL_RCC_GetSysClockFreq());
 	MCAL_RCC_EnablePeripheral(RCC_APB2,RCC_APB2ENR_AFIOEN);
-	/********<Set pin modes PORT A*******/
-	MCAL_GPIO_SetPinMode(GPIO_PORTA,Red_Ped_Led,GPIO_OUTPUT_PUSH_PULL_2MHZ);
-	
-	MCAL_GPIO_SetPinMode(GPIO_PORTA,Yellow_Ped_Led,GPIO_OUTPUT_PUSH_PULL_2MHZ);
-	
-		MCAL_GPIO_SetPinMode(GPIO_PORTA,Green_Ped_Led,GPIO_OUTPUT_PUSH_PULL_2MHZ);
-		/********<Set pin modes PORT B*******/
-	MCAL_GPIO_SetPinMode(GPIO_PORTB,Green_Cars_Led,GPIO_OUTPUT_PUSH_PULL_2MHZ);
-		MCAL_GPIO_SetPinMode(GPIO_PORTB,Yellow_Cars_Led,GPIO_OUTPUT_PUSH_PULL_2MHZ);
-		MCAL_GPIO_SetPinMode(GPIO_PORTB,Red_Cars_Led,GPIO_OUTPUT_PUSH_PULL_2MHZ);
-		MCAL_GPIO_SetPinMode(GPIO_PORTB,Button_Pin,GPIO_INPUT_PULL_DOWN_MOD);
-	 void (*function_ptr)(void);
-	function_ptr=interrupt;
+	MCAL_RCC_EnablePeripheral(RCC_APB1,RCC_APB1ENR_PWREN);
+	/* Wall clock on the LSE in the backup domain; a set clock survives resets while VBAT is powered */
+	MCAL_RCC_EnablePeripheral(RCC_APB1,RCC_APB1ENR_BKPEN);
+	MCAL_RTC_Init();
+	/********<Dimming: PA1..PA3 on TIM2 CH2..CH4, PB1 on TIM3 CH4 (PB2 has no channel, PB3 only TIM2 CH2 under remap)*******/
+	/* The timers run at HCLK: PCLK1 when APB1 is undivided, 2 x PCLK1 when it is divided */
+	MCAL_RCC_EnablePeripheral(RCC_APB1,RCC_APB1ENR_TIM2EN);
+	MCAL_RCC_EnablePeripheral(RCC_APB1,RCC_APB1ENR_TIM3EN);
+	HAL_LED_InitPwm(MCAL_RCC_GetSysClockFreq());
+	for(u8 i=0;i<PHASE_INTERSECTION_COUNT;i++)
+	{
+		MCAL_GPIO_SetPinMode(GPIO_PORTB,Crossings[i].button,GPIO_INPUT_PULL_DOWN_MOD);
+		MCAL_GPIO_SetPinMode(GPIO_PORTB,Crossings[i].detector,GPIO_INPUT_PULL_DOWN_MOD);
+	}
+	MCAL_GPIO_SetPinMode(GPIO_PORTB,Sync_In_Pin,GPIO_INPUT_PULL_DOWN_MOD);
+	MCAL_GPIO_SetPinValue(GPIO_PORTB,Sync_Out_Pin,GPIO_LOW);
+	MCAL_GPIO_SetPinMode(GPIO_PORTB,Sync_Out_Pin,GPIO_OUTPUT_PUSH_PULL_2MHZ);
+	/********<Telemetry: USART1 with DMA (APB2 runs undivided, PCLK2 = HCLK)*******/
+	MCAL_RCC_EnablePeripheral(RCC_AHB,RCC_AHBENR_DMA1EN);
+	MCAL_RCC_EnablePeripheral(RCC_APB2,RCC_APB2ENR_USART1EN);
+	MCAL_GPIO_SetPinMode(GPIO_PORTA,Uart_Tx_Pin,GPIO_OUTPUT_AF_PUSH_PULL_2MHZ);
+	MCAL_GPIO_SetPinMode(GPIO_PORTA,Uart_Rx_Pin,GPIO_INPUT_FLOATING_MOD);
+	MCAL_USART_Init(MCAL_RCC_GetSysClockFreq());
+	MCAL_NVIC_EnableIRQ(NVIC_DMA1_Channel4_IRQn);
+	MCAL_NVIC_EnableIRQ(NVIC_DMA1_Channel5_IRQn);
+	MCAL_NVIC_EnableIRQ(NVIC_USART1_IRQn);
+	TLM_Init(MCAL_RCC_GetSysClockFreq());
+	/* The DWT cycle counter stops in WFI; stamp the records from the tick time instead */
+	TLM_SetTimeSource(TICK_GetTimeUs,1);
+	/* Timing plans uploaded over the same link are judged on the images that would reach the pins */
+	CMD_Init(Plan_ToImage);
+	MCAL_USART_SetRxCallback(CMD_ReceiveBytes);
+	TRACE_Init();
+	/* History that survives power cycles; written only from the idle end of the loop */
+	LOG_Init();
+	LOG_Append(LOG_EVT_BOOT,Boot_ClockStatus,0,0);
+	PHASE_Init();
+	/* Low demand at night: park the signals and wait for the button in STOP */
+	NIGHT_Init();
+	/* Cycle length and green splits follow the detector and button counts */
+	ADAPT_Init();
+	/* Cycle starts locked to the other controllers; a coordinated crossing keeps the fixed cycle */
+	COORD_Init();
+#if COORD_ROLE != COORD_ROLE_NONE
+	ADAPT_SetEnabled(0);
+#endif
+	/* Peak and off-peak plans by the time of day, once the clock is set over the command channel */
+	TOD_Init();
+#if Countdown_Enabled
+	/* Scanned by TIM4 and DMA1 channel 7 into the BSRR of PORTB, no CPU per digit */
+	MCAL_RCC_EnablePeripheral(RCC_APB1,RCC_APB1ENR_TIM4EN);
+	DISP_Init(MCAL_RCC_GetSysClockFreq());
+#endif
+#if Loops_Enabled
+	/* Edges go by DMA1 channels 2, 3 and 6 into rings, no interrupt per vehicle; APB2 is undivided, TIM1 runs on HCLK */
+	MCAL_RCC_EnablePeripheral(RCC_APB2,RCC_APB2ENR_TIM1EN);
+	MCAL_GPIO_SetPinMode(GPIO_PORTA,Loop_Up_Pin,GPIO_INPUT_PULL_DOWN_MOD);
+	MCAL_GPIO_SetPinMode(GPIO_PORTA,Loop_Down_Pin,GPIO_INPUT_PULL_DOWN_MOD);
+	DET_Init(MCAL_RCC_GetSysClockFreq());
+#endif
+	Signals_Apply();
+	void (*function_ptr)(void);
+	function_ptr=Inputs_Isr;
 	EXTI_Callback(function_ptr);
+	/********<Interrupt priorities: preemption above everything else*******/
+	MCAL_NVIC_vSetPriority(NVIC_EXTI0_IRQn,Preempt_Group,0);
+	MCAL_NVIC_vSetPriority(NVIC_EXTI4_IRQn,Other_Group,0);
+	MCAL_NVIC_vSetPriority(NVIC_EXTI9_5_IRQn,Other_Group,0);
+	MCAL_NVIC_vSetPriority(NVIC_EXTI15_10_IRQn,Other_Group,0);
+	MCAL_NVIC_vSetPriority(NVIC_USART1_IRQn,Other_Group,0);
+	MCAL_NVIC_vSetPriority(NVIC_DMA1_Channel4_IRQn,Other_Group,0);
+	MCAL_NVIC_vSetPriority(NVIC_DMA1_Channel5_IRQn,Other_Group,0);
+	SCB_SetSysTickPriority(Other_Group<<2);
 	MCAL_NVIC_EnableIRQ(NVIC_EXTI4_IRQn);
 	EXTI_vInit();
+	/* Buttons of the further crossings (EXTI_config.h sets up PB4 of crossing 0) and both edges of each detector (arrival and occupancy) */
+	for(u8 i=0;i<PHASE_INTERSECTION_COUNT;i++)
+	{
+		if(i>0)
+		{
+			EXTI_InitForGPIO(Crossings[i].button,GPIO_PORTB);
+			EXTI_SetTrigger(Crossings[i].button,EXTI_RISING_EDGE);
+			EXTI_EnableLine(Crossings[i].button);
+		}
+		EXTI_InitForGPIO(Crossings[i].detector,GPIO_PORTB);
+		EXTI_SetTrigger(Crossings[i].detector,EXTI_BOTH_EDGES);
+		EXTI_EnableLine(Crossings[i].detector);
+	}
+	/* Both edges of the sync line: the rise is the boundary, the width tells the cycle start */
+	EXTI_InitForGPIO(Sync_In_Pin,GPIO_PORTB);
+	EXTI_SetTrigger(Sync_In_Pin,EXTI_BOTH_EDGES);
+	EXTI_EnableLine(Sync_In_Pin);
+	MCAL_NVIC_EnableIRQ(NVIC_EXTI9_5_IRQn);
+	MCAL_NVIC_EnableIRQ(NVIC_EXTI15_10_IRQn);
+	/* Preemption: assert and release both matter, the release ends the preempt green */
+	MCAL_GPIO_SetPinMode(GPIO_PORTA,Preempt_Pin,GPIO_INPUT_PULL_DOWN_MOD);
+	EXTI_Line0Callback(Preempt_Isr);
+	EXTI_InitForGPIO(Preempt_Pin,GPIO_PORTA);
+	EXTI_SetTrigger(Preempt_Pin,EXTI_BOTH_EDGES);
+	EXTI_EnableLine(Preempt_Pin);
+	MCAL_NVIC_EnableIRQ(NVIC_EXTI0_IRQn);
+	Boot_ReadyCycles=MCAL_DWT_GetCycles();
+	MCAL_GPIO_SetPinValue(GPIO_PORTC,Boot_Marker_Pin,GPIO_LOW);
 	while(1)
-	{ u8 i=5;
-		
-		  MCAL_GPIO_SetPinValue(GPIO_PORTA,Red_Cars_Led,GPIO_HIGH);
-					MCAL_GPIO_SetPinValue(GPIO_PORTB,Green_Ped_Led,GPIO_HIGH);
-					MCAL_STK_SetDelay_ms(5000);
-				 MCAL_GPIO_SetPinValue(GPIO_PORTA,Green_Ped_Led,GPIO_LOW);
-					MCAL_GPIO_SetPinValue(GPIO_PORTB,Red_Cars_Led,GPIO_LOW);
-		yellow=1;
-		  
-		if(yellow){
-			yellow=2;
-			i=10;
-while(i--)
-{	
-			MCAL_GPIO_SetPinValue(GPIO_PORTA,Yellow_Cars_Led,GPIO_HIGH);
-					MCAL_GPIO_SetPinValue(GPIO_PORTB,Yellow_Ped_Led,GPIO_HIGH);
-					MCAL_STK_SetDelay_ms(500);
-				 MCAL_GPIO_SetPinValue(GPIO_PORTA,Yellow_Cars_Led,GPIO_LOW);
-					MCAL_GPIO_SetPinValue(GPIO_PORTB,Yellow_Ped_Led,GPIO_LOW);
-	if(yellow==0)
-	{flag=0;
-	break;}
-}		
-		}
-
-					x=1;
-				u32 j=0;
-				while( (x && j<20) && yellow)
-				{ yellow=1;
-					 MCAL_GPIO_SetPinValue(GPIO_PORTA,Red_Ped_Led,GPIO_HIGH);
-					MCAL_GPIO_SetPinValue(GPIO_PORTB,Green_Cars_Led,GPIO_HIGH);
-					MCAL_STK_SetDelay_ms(250);
-				 MCAL_GPIO_SetPinValue(GPIO_PORTA,Red_Ped_Led,GPIO_LOW);
-					MCAL_GPIO_SetPinValue(GPIO_PORTB,Green_Cars_Led,GPIO_LOW);
-					j=j+1;
-				}
-	x=0;
-				yellow=1;
-				if(flag==0 && yellow)
-				{	i=50;
-			
-				while(i--)
-				{ 
-					HAL_LED_BlinkOnce(LED_PORTA,LED_PIN2,100);
-					HAL_LED_BlinkOnce(LED_PORTB,LED_PIN2,100);
-				
+	{
+		u32 ticks=TICK_Take();
+		/* Ticks slept through are replayed; nothing but the counters changes before the last one */
+		while(ticks--)
+		{
+			Control_Tick();
+		}
+		/* The signals reacted to the wake-up on HSI; the configured clock comes back before any output */
+		if(Clock_Restore_Pending)
+		{
+			Clock_Restore_Pending=0;
+			Clock_Restore();
+		}
+		Input_Pending=0;
+		CMD_Process();
+		TLM_Flush();
+		LOG_Drain(Flash_MayStall);
+		/* STOP needs an idle link, no LED pattern and a dark countdown: the UART, the DMA and the timers stop with the clocks */
+		if(!SAFETY_IsFaulted() && NIGHT_CanStop() && COORD_CanStop() && DISP_CanStop() && MCAL_USART_IsTxIdle() &&
+		   HAL_LED_SeqGetTicksToNextStep()==LED_SEQ_NO_STEP && Enter_Stop()==E_OK)
+		{
+			Clock_Restore_Pending=1;
+		}
+		else
+		{
+			/* A latched fault keeps the 1-tick cadence; otherwise sleep up to the next phase, sync, plan, countdown, loop drain
+			   or LED event */
+			u16 idle=PHASE_GetTicksToNextEvent();
+			if(COORD_GetTicksToNextEvent()<idle)
+			{
+				idle=COORD_GetTicksToNextEvent();
+			}
+			if(TOD_GetTicksToNextEvent()<idle)
+			{
+				idle=TOD_GetTicksToNextEvent();
+			}
+			if(Countdown_TicksToNextStep()<idle)
+			{
+				idle=Countdown_TicksToNextStep();
+			}
+			if(DET_GetTicksToNextDrain()<idle)
+			{
+				idle=DET_GetTicksToNextDrain();
+			}
+			if(HAL_LED_SeqGetTicksToNextStep()<idle)
+			{
+				idle=HAL_LED_SeqGetTicksToNextStep();
+			}
+			TICK_Idle(SAFETY_IsFaulted()?1:idle,Work_Pending);
+		}
+	}
+}
+
+/* The dimming PWM stops with the clocks: the parked lamps go back to GPIO at full level for the time in STOP,
+   and return to their timers with the configured clock in Clock_Restore */
+Std_ReturnType Enter_Stop(void)
+{
+	Std_ReturnType status;
+	HAL_LED_SetPwmOutputs(0);
+	status=NIGHT_Stop(Work_Pending);
+	if(status!=E_OK)
+	{
+		HAL_LED_SetPwmOutputs(1);
+	}
+	return status;
+}
+
+void Clock_Restore(void)
+{
+	u32 hclk;
+	MCAL_RCC_InitSysClock();
+	hclk=MCAL_RCC_GetSysClockFreq();
+	TICK_SetClockFreq(hclk);
+	MCAL_USART_SetClockFreq(hclk);
+	HAL_LED_SetClockFreq(hclk);
+	HAL_LED_SetPwmOutputs(1);
+	DISP_SetClockFreq(hclk);
+	/* APB1 stopped in STOP: the RTC counter reads stale until resynchronized (a stale read only delays a plan change) */
+	MCAL_RTC_WaitSync();
+}
+
+void Control_Tick(void)
+{
+	u32 start;
+	NIGHT_Tick();
+	/* Dimmed lamps at night, in hardware from the next PWM period */
+	if(HAL_LED_GetBrightness()!=NIGHT_GetBrightness())
+	{
+		HAL_LED_SetBrightness(NIGHT_GetBrightness());
+	}
+	start=MCAL_DWT_GetCycles();
+	/* Scheduled plans and force-offs are placed before the engine steps */
+	TOD_Tick();
+	COORD_Tick();
+	MCAL_GPIO_SetPinValue(GPIO_PORTB,Sync_Out_Pin,COORD_GetSyncOutput()?GPIO_HIGH:GPIO_LOW);
+	PHASE_Tick();
+	ADAPT_Tick();
+	Signals_Apply();
+	Countdown_Update();
+	start=MCAL_DWT_GetCycles()-start;
+	if(start>Control_MaxCycles)
+	{
+		Control_MaxCycles=start;
+	}
+	/* Loop captures older than a counter wrap would be ambiguous */
+	DET_Tick();
+	Telemetry_Report();
+	/* Steps first, so a pattern started below keeps its first step for the full duration */
+	HAL_LED_SeqTick();
+	Status_Update();
+	Uptime_Ticks++;
+}
+
+/* Heartbeat while running, fast flash on a latched fault, dark under low demand so STOP is not held off */
+void Status_Update(void)
+{
+	static const LED_SeqPattern_t *shown;
+	const LED_SeqPattern_t *pattern=SAFETY_IsFaulted()?&Status_Fault:(NIGHT_IsLowDemand()?NULL:&Status_Heartbeat);
+	if(pattern==shown)
+	{
+		return;
+	}
+	shown=pattern;
+	if(pattern==NULL)
+	{
+		HAL_LED_SeqStop(Status_Seq_Slot,0);
+	}
+	else
+	{
+		HAL_LED_SeqStart(Status_Seq_Slot,LED_PORTC,Status_Led_Mask,Status_Led_Mask,pattern);
+	}
+}
+
+/* Seconds of walk left, rounded up so the last second shows 1; dark while pedestrians do not walk. The frame
+   is written only when the second changes */
+void Countdown_Update(void)
+{
+	u16 left=PHASE_GetWalkTicksLeft(Countdown_Crossing);
+	DISP_Show(left?(u16)((left+Ticks_Per_Second-1)/Ticks_Per_Second):DISP_BLANK);
+}
+
+/* The tickless idle wakes when the shown second changes */
+u16 Countdown_TicksToNextStep(void)
+{
+	u16 left=PHASE_GetWalkTicksLeft(Countdown_Crossing);
+	if(!Countdown_Enabled || left==0)
+	{
+		return PHASE_NO_EVENT;
+	}
+	return (u16)(((left-1)%Ticks_Per_Second)+1);
+}
+
+/* Anything the loop must handle before the next tick keeps the core awake */
+u8 Work_Pending(void)
+{
+	return (Input_Pending || CMD_IsPending() || (!LOG_IsIdle() && Flash_MayStall()))?1:0;
+}
+
+/* A flash program or erase stalls every fetch, Preempt_Isr included, for up to about 40 ms. The log writes only
+   while the preemption input is released, no crossing is preempted and no head shows a green the interrupt would
+   swap: an edge landing in the stall then finds nothing to write, and its call is latched before the loop runs the
+   next tick, so the outputs change exactly as they would have. Called with interrupts disabled. A crossing resting
+   in a conflicting green holds the records in the queue until its clearance */
+u8 Flash_MayStall(void)
+{
+	u8 level;
+	MCAL_GPIO_GetPinValue(GPIO_PORTA,Preempt_Pin,&level);
+	if(level || Input_Pending)
+	{
+		return 0;
+	}
+	for(u8 i=0;i<PHASE_INTERSECTION_COUNT;i++)
+	{
+		if(PHASE_GetPreemptStep(i)!=PHASE_PREEMPT_NONE)
+		{
+			return 0;
+		}
+	}
+	for(u8 h=0;h<Preempt_Heads;h++)
+	{
+		if(Signals_Image & Preempt_Green[h])
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/* Collects the pins of all heads into the group written by Signals_Write, and the preemption clearance */
+void Crossings_Init(void)
+{
+	u8 conflicts=(PHASE_SIG_CAR_GREEN|PHASE_SIG_PED_GREEN) & (u8)~(PHASE_PREEMPT_SIGNALS);
+	u32 cleared=0;
+	for(u8 i=0;i<PHASE_INTERSECTION_COUNT;i++)
+	{
+		u32 all=Crossing_ToImage(i,0xFF);
+		Signal_Heads.Mask[LED_PORTA]|=SAFETY_IMAGE_PORTA(all);
+		Signal_Heads.Mask[LED_PORTB]|=SAFETY_IMAGE_PORTB(all);
+		Preempt_Green[2*i]=Crossing_ToImage(i,conflicts & PHASE_SIG_CAR_GREEN);
+		Preempt_Yellow[2*i]=Preempt_Green[2*i]?Crossing_ToImage(i,PHASE_SIG_CAR_YELLOW):0;
+		Preempt_Green[2*i+1]=Crossing_ToImage(i,conflicts & PHASE_SIG_PED_GREEN);
+		Preempt_Yellow[2*i+1]=Preempt_Green[2*i+1]?Crossing_ToImage(i,PHASE_SIG_PED_YELLOW):0;
+		cleared|=Preempt_Yellow[2*i]|Preempt_Yellow[2*i+1];
+	}
+	/* All swaps at once must pass the stateless rules; they only turn a green head yellow, so any subset on a
+	   valid image passes too */
+	if(SAFETY_CheckImage(cleared,0)!=E_OK)
+	{
+		for(u8 h=0;h<Preempt_Heads;h++)
+		{
+			Preempt_Green[h]=0;
+			Preempt_Yellow[h]=0;
+		}
+	}
+}
+
+/* Maps the engine's signals of one crossing to the output image of its two heads */
+u32 Crossing_ToImage(u8 crossing,u8 signals)
+{
+	const Crossing_Wiring_t *w=&Crossings[crossing];
+	u32 image=0;
+	if(signals & PHASE_SIG_PED_RED)     image|=SAFETY_IMAGE_PORTA_PIN(w->ped_red);
+	if(signals & PHASE_SIG_PED_YELLOW)  image|=SAFETY_IMAGE_PORTA_PIN(w->ped_yellow);
+	if(signals & PHASE_SIG_PED_GREEN)   image|=SAFETY_IMAGE_PORTA_PIN(w->ped_green);
+	if(signals & PHASE_SIG_PED_WAIT)    image|=SAFETY_IMAGE_PORTA_PIN(w->wait);
+	if(signals & PHASE_SIG_CAR_GREEN)   image|=SAFETY_IMAGE_PORTB_PIN(w->car_green);
+	if(signals & PHASE_SIG_CAR_YELLOW)  image|=SAFETY_IMAGE_PORTB_PIN(w->car_yellow);
+	if(signals & PHASE_SIG_CAR_RED)     image|=SAFETY_IMAGE_PORTB_PIN(w->car_red);
+	return image;
+}
+
+/* Uploaded plans are judged on the pins of the crossing they are installed on */
+u32 Plan_ToImage(u8 signals)
+{
+	return Crossing_ToImage(CMD_PLAN_INTERSECTION,signals);
+}
+
+/* Writes the heads of all crossings in lockstep, one store per port */
+void Signals_Write(u32 image)
+{
+	LED_Group_t levels={{SAFETY_IMAGE_PORTA(image),SAFETY_IMAGE_PORTB(image),0}};
+	HAL_LED_GroupWrite(&Signal_Heads,&levels);
+}
+
+/* Merges the crossings into one image and lets the safety monitor veto it; the heads are written only when
+   it changes, so flashing yellow and flashing red cost one store per port per half period */
+void Signals_Apply(void)
+{
+	u32 writes=Preempt_Writes;
+	u32 image=0;
+	u32 primask;
+	u8 changed=0;
+	u32 last_us,max_us;
+	for(u8 i=0;i<PHASE_INTERSECTION_COUNT;i++)
+	{
+		image|=Crossing_ToImage(i,PHASE_GetSignals(i));
+	}
+	if(SAFETY_ValidateImage(image)!=E_OK)
+	{
+		image=SAFETY_GetFallbackImage();
+	}
+	/* Both port stores at once: a preemption since the merge has written newer levels, the next step
+	   catches up (the monitor then counts a green that was already out, which only lengthens clearance) */
+	primask=SCB_EnterCritical();
+	if(writes==Preempt_Writes && image!=Signals_Image)
+	{
+		Signals_Image=image;
+		Signals_Write(image);
+		changed=1;
+	}
+	SCB_ExitCritical(primask);
+	if(changed)
+	{
+		/* Ends the timing of a wake-up from STOP; one over the bound is logged and disables STOP */
+		if(NIGHT_OnSignalsChanged()!=E_OK)
+		{
+			NIGHT_GetWakeLatency(&last_us,&max_us);
+			LOG_Append(LOG_EVT_WAKE_SLOW,0,(last_us>0xFFFF)?0xFFFF:last_us,Uptime_Ticks);
+		}
+	}
+}
+
+/* Reports phase changes, once per cycle the counters, and a latched safety fault and plan changes once (also to the flash log) */
+void Telemetry_Report(void)
+{
+	static u8 last_phase=PHASE_COUNT;
+	static u8 fault_reported=0;
+	static const PHASE_Descriptor_t *last_plan=NULL;
+	static u8 last_preempt=PHASE_PREEMPT_NONE;
+	/* Records carry no crossing number: telemetry follows crossing 0 */
+	u8 phase=PHASE_GetCurrentPhase(0);
+	u32 isr_last,isr_max;
+	u32 duty,current;
+	u32 wake_last,wake_max;
+	u16 ped_wait[PHASE_PED_WAIT_BINS];
+	ADAPT_Estimate_t estimate;
+	COORD_Status_t sync;
+	DET_Batch_t lane;
+	if(phase!=last_phase)
+	{
+		last_phase=phase;
+		TLM_RecordPhase(phase,PHASE_GetSignals(0));
+		if(phase==PHASE_CAR_GO)
+		{
+			TRACE_GetIsrCost(&isr_last,&isr_max);
+			TLM_RecordCounter(TLM_COUNTER_DROPPED,TLM_GetDroppedCount());
+			TLM_RecordCounter(TLM_COUNTER_PED_REQUESTS,Ped_Requests);
+			TLM_RecordCounter(TLM_COUNTER_ISR_MAX_CYCLES,isr_max);
+			TLM_RecordCounter(TLM_COUNTER_LOG_DROPPED,LOG_GetDroppedCount());
+			if(TICK_GetDuty(&duty,&current)==E_OK)
+			{
+				TLM_RecordCounter(TLM_COUNTER_DUTY_PERMILLE,duty);
+				TLM_RecordCounter(TLM_COUNTER_CURRENT_UA,current);
+			}
+			NIGHT_GetWakeLatency(&wake_last,&wake_max);
+			TLM_RecordCounter(TLM_COUNTER_WAKE_LATENCY_US,wake_last);
+			TLM_RecordCounter(TLM_COUNTER_CONTROL_MAX_CYCLES,Control_MaxCycles);
+			TLM_RecordCounter(TLM_COUNTER_VEHICLE_CALLS,Vehicle_Calls);
+			TLM_RecordCounter(TLM_COUNTER_PREEMPT_MAX_CYCLES,Preempt_MaxCycles);
+			if(ADAPT_GetEstimate(0,&estimate)==E_OK)
+			{
+				TLM_RecordCounter(TLM_COUNTER_CYCLE_MS,(u32)estimate.CycleTicks*PHASE_TICK_MS);
+				TLM_RecordCounter(TLM_COUNTER_FLOW_VPH,estimate.FlowQ16>>16);
+			}
+			if(COORD_GetStatus(&sync)==E_OK && sync.Locked)
+			{
+				TLM_RecordCounter(TLM_COUNTER_SYNC_MAX_ERROR_US,sync.MaxErrorUs);
+			}
+#if Loops_Enabled
+			/* One batch of loop statistics per cycle */
+			DET_CloseBatch();
+			if(DET_GetBatch(0,&lane)==E_OK)
+			{
+				TLM_RecordCounter(TLM_COUNTER_LANE_VEHICLES,lane.Vehicles);
+				TLM_RecordCounter(TLM_COUNTER_LANE_OCCUPANCY_PERMILLE,lane.OccupancyPermille);
+				if(lane.SpeedSamples!=0)
+				{
+					TLM_RecordCounter(TLM_COUNTER_LANE_SPEED_KMH_X10,lane.SpeedKmhX10);
 				}
-				flag=1;
 			}
-				else if(flag==1 && yellow)
+#endif
+			/* Empty bins are implied */
+			PHASE_GetPedWaitHistogram(0,ped_wait);
+			for(u8 i=0;i<PHASE_PED_WAIT_BINS;i++)
+			{
+				if(ped_wait[i]!=0)
 				{
-						 MCAL_GPIO_SetPinValue(GPIO_PORTA,Yellow_Ped_Led,GPIO_HIGH);
-					MCAL_GPIO_SetPinValue(GPIO_PORTB,Yellow_Cars_Led,GPIO_HIGH);
-					MCAL_STK_SetDelay_ms(5000);
-				 MCAL_GPIO_SetPinValue(GPIO_PORTA,Yellow_Ped_Led,GPIO_LOW);
-					MCAL_GPIO_SetPinValue(GPIO_PORTB,Yellow_Cars_Led,GPIO_LOW);
+					TLM_RecordPedWait(i,ped_wait[i]);
 				}
-		
-}
-}
-
-
-
-void interrupt(void)
- { if(yellow==2)
-	 {yellow=0;
-	 return;}
-	 if(x==0)
-	 return;
-	 flag=0;
-	 u8 z;
-	 u8 *ptr=&z;
-	 
-	 for(u32 i=0;i<5000;i++)
-	 {MCAL_GPIO_GetPinValue(GPIO_PORTB,Button_Pin,ptr);
-	 if(*ptr==0)
-		 break;
-	 }
-	 if(*ptr==1)	 
-	 { flag=1;
-		 x=1;	 return;
-	 }
-	 else 
-		 {
-	 x=0; return ;}
-
-	 return;
- }
- 
+			}
+		}
+	}
+	if(PHASE_GetPreemptStep(0)!=last_preempt)
+	{
+		if(last_preempt==PHASE_PREEMPT_NONE)
+		{
+			LOG_Append(LOG_EVT_PREEMPT,0,0,Uptime_Ticks);
+		}
+		last_preempt=PHASE_GetPreemptStep(0);
+	}
+	if(SAFETY_IsFaulted() && !fault_reported)
+	{
+		fault_reported=1;
+		TLM_RecordFault(TLM_FAULT_SAFETY);
+		LOG_Append(LOG_EVT_SAFETY_FAULT,0,0,Uptime_Ticks);
+	}
+	if(PHASE_GetActiveTable(CMD_PLAN_INTERSECTION)!=last_plan)
+	{
+		/* The default plan at boot is not an event, and neither are the greens adapted every cycle */
+		if(last_plan!=NULL && !ADAPT_IsOwnPlan(CMD_PLAN_INTERSECTION,PHASE_GetActiveTable(CMD_PLAN_INTERSECTION)))
+		{
+			LOG_Append(LOG_EVT_PLAN,0,0,Uptime_Ticks);
+		}
+		last_plan=PHASE_GetActiveTable(CMD_PLAN_INTERSECTION);
+	}
+}
+
+/* Records every button edge (time delta + level) and latches the request of its crossing, latches vehicle
+   detections (counted only, one per car would flood the trace), stamps sync edges, and records the cost of handling them */
+void Inputs_Isr(void)
+{
+	u32 entry=MCAL_DWT_GetCycles();
+	u8 level;
+	for(u8 i=0;i<PHASE_INTERSECTION_COUNT;i++)
+	{
+		if(EXTI_GetPendingFlag(Crossings[i].button))
+		{
+			MCAL_GPIO_GetPinValue(GPIO_PORTB,Crossings[i].button,&level);
+			TRACE_RecordInput(Crossings[i].button,level);
+			TLM_RecordInput(Crossings[i].button,level);
+			NIGHT_OnRequest(entry);
+			PHASE_RequestPedestrian(i);
+			ADAPT_OnPedestrian(i);
+			Input_Pending=1;
+			Ped_Requests++;
+			EXTI_CLR_PendingFLag(Crossings[i].button);
+		}
+		if(EXTI_GetPendingFlag(Crossings[i].detector))
+		{
+			MCAL_GPIO_GetPinValue(GPIO_PORTB,Crossings[i].detector,&level);
+			ADAPT_OnDetector(i,level);
+			if(level)
+			{
+				PHASE_DetectVehicle(i);
+				Input_Pending=1;
+				Vehicle_Calls++;
+			}
+			EXTI_CLR_PendingFLag(Crossings[i].detector);
+		}
+	}
+	if(EXTI_GetPendingFlag(Sync_In_Pin))
+	{
+		MCAL_GPIO_GetPinValue(GPIO_PORTB,Sync_In_Pin,&level);
+		COORD_OnSyncEdge(level);
+		Input_Pending=1;
+		EXTI_CLR_PendingFLag(Sync_In_Pin);
+	}
+	TRACE_RecordIsrCost(MCAL_DWT_GetCycles()-entry);
+}
+
+/* Top-priority preemption input: latches the call on every crossing and, on assert, swaps the conflicting
+   greens on the heads for yellow before returning, so the first output change does not wait for the next
+   control step. It works only on the image already written and the masks checked by Crossings_Init, never on
+   engine state a tick may be halfway through; the next step writes the rest. A latched fault keeps flashing
+   red. Response is Preempt_MaxCycles plus the longest critical section the edge may land in (TRACE, TLM, the
+   write in Signals_Apply). The flash log stalls the core only while this would write nothing (Flash_MayStall) */
+void Preempt_Isr(void)
+{
+	u32 entry=MCAL_DWT_GetCycles();
+	u32 image;
+	u32 cycles;
+	u8 level;
+	MCAL_GPIO_GetPinValue(GPIO_PORTA,Preempt_Pin,&level);
+	/* Stamped before the write, so edge to output change reads straight off a trace dump */
+	TRACE_RecordInput(Preempt_Pin,level);
+	for(u8 i=0;i<PHASE_INTERSECTION_COUNT;i++)
+	{
+		PHASE_Preempt(i,level);
+	}
+	if(level && !SAFETY_IsFaulted())
+	{
+		image=Signals_Image;
+		for(u8 h=0;h<Preempt_Heads;h++)
+		{
+			if(image & Preempt_Green[h])
+			{
+				image=(image & ~Preempt_Green[h])|Preempt_Yellow[h];
+			}
+		}
+		if(image!=Signals_Image)
+		{
+			Signals_Image=image;
+			Signals_Write(image);
+		}
+		Preempt_Writes++;
+		cycles=MCAL_DWT_GetCycles()-entry;
+		if(cycles>Preempt_MaxCycles)
+		{
+			Preempt_MaxCycles=cycles;
+		}
+	}
+	TLM_RecordInput(Preempt_Pin,level);
+	Input_Pending=1;
+	EXTI_CLR_PendingFLag(Preempt_Pin);
+}
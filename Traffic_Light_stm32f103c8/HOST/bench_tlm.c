@@ -0,0 +1,419 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : bench_tlm.c                *****************/
+/****************************************************************/
+
+/*
+ * Telemetry throughput benchmark: TLM_program.c, USART_program.c and DMA_program.c, unmodified,
+ * on the emu_usart model, with the line decoded by tlm_host as it leaves the TX pin.
+ *
+ *   bench_tlm [-n records] [-s seed] [-t seconds] [-w capture]
+ *
+ * Round trip: random records of every type, with deltas from a few microseconds to tens of
+ * milliseconds, go out at 115200 baud. Each one TLM accepted must come back from the decoder
+ * with the same fields and the same absolute time, in order; the wire bytes per record are
+ * reported. -w saves the line as a capture for tlm_decode.
+ *
+ * Throughput: at each common baud rate, input records (one per detector or button edge) arrive
+ * at a steady rate for a few virtual seconds, with TLM_Flush once per 50 ms tick as in main.
+ * A rate is sustainable if no record is dropped and the line still catches up: when the events
+ * stop, no more than two frames wait in the TX ring. Otherwise the ring would only be absorbing a
+ * backlog that a longer run would overflow. The highest such rate is found by bisection and set
+ * against one ASCII line per event. The model's line runs in character times, so the baud rate only sets how many
+ * characters leave per virtual microsecond; the divider programmed by MCAL_USART_Init is not used.
+ */
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "DWT_interface.h"
+#include "SCB_interface.h"
+#include "USART_interface.h"
+/*****************************< APP *****************************/
+#include "TLM_interface.h"
+#include "TLM_config.h"
+/*****************************< HOST *****************************/
+#include "emu_usart.h"
+#include "tlm_host.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_PCLK_HZ           72000000UL
+#define BENCH_TICK_US           50000UL     /**< main flushes once per engine tick */
+#define BENCH_CHAR_BITS         10UL
+#define BENCH_ROUND_TRIP_BAUD   115200UL
+#define BENCH_BACKLOG_MAX       (2UL * (TLM_FRAME_SIZE + 2UL))  /**< Two encoded frames with delimiters */
+#define BENCH_PENDING_SIZE      4096        /**< Records accepted but not yet decoded; the TX ring holds far fewer */
+
+/*****************************< Private Variables *****************************/
+static const u32 Bench_Bauds[] = { 9600UL, 57600UL, 115200UL, 230400UL, 460800UL, 921600UL };
+
+static u32 Bench_NowUs = 0;                         /**< Virtual time, the TLM time source */
+static unsigned long long Bench_LineChars = 0;      /**< Character times run so far */
+static u32 Bench_Baud = BENCH_ROUND_TRIP_BAUD;
+static unsigned long long Bench_WireBytes = 0;
+static FILE *Bench_Capture = NULL;
+
+static TLM_Record_t Bench_Pending[BENCH_PENDING_SIZE];
+static unsigned long long Bench_PendingTimeUs[BENCH_PENDING_SIZE];
+static u32 Bench_PendingHead = 0;
+static u32 Bench_PendingTail = 0;
+static unsigned long long Bench_Decoded = 0;
+static unsigned long Bench_Failures = 0;
+/*****************************< Host MCAL *****************************/
+u32 MCAL_DWT_GetCycles(void)
+{
+    return Bench_NowUs;
+}
+
+u32 SCB_EnterCritical(void)
+{
+    return 0;
+}
+
+void SCB_ExitCritical(u32 Copy_PriMask)
+{
+    (void)Copy_PriMask;
+}
+/*****************************< Private Functions *****************************/
+static u32 Bench_Clock(void)
+{
+    return Bench_NowUs;
+}
+
+static void Bench_Fail(const char *Copy_What)
+{
+    if (Bench_Failures++ < 10)
+    {
+        fprintf(stderr, "bench_tlm: %s at record %llu\n", Copy_What, Bench_Decoded);
+    }
+}
+
+static void Bench_Check(u8 Copy_Sequence, unsigned long long Copy_TimeUs, const TLM_Record_t *Copy_Record)
+{
+    const TLM_Record_t *Local_Expected;
+
+    (void)Copy_Sequence;
+    if (Bench_PendingTail == Bench_PendingHead)
+    {
+        Bench_Fail("decoded a record that was never accepted");
+        return;
+    }
+    Local_Expected = &Bench_Pending[Bench_PendingTail % BENCH_PENDING_SIZE];
+    if ((Local_Expected->Id != Copy_Record->Id) || (Local_Expected->Arg != Copy_Record->Arg) ||
+        (Local_Expected->Value != Copy_Record->Value))
+    {
+        Bench_Fail("decoded record differs from the one accepted");
+    }
+    if (Bench_PendingTimeUs[Bench_PendingTail % BENCH_PENDING_SIZE] != Copy_TimeUs)
+    {
+        Bench_Fail("decoded time differs from the time of the record");
+    }
+    Bench_PendingTail++;
+    Bench_Decoded++;
+}
+
+static void Bench_TxSink(u8 Copy_Byte)
+{
+    Bench_WireBytes++;
+    TLMH_Feed(&Copy_Byte, 1);
+    if (Bench_Capture != NULL)
+    {
+        fputc(Copy_Byte, Bench_Capture);
+    }
+}
+
+/**< Run the line up to the current virtual time */
+static void Bench_RunLine(void)
+{
+    unsigned long long Local_Due = ((unsigned long long)Bench_NowUs * Bench_Baud) / (BENCH_CHAR_BITS * 1000000ULL);
+
+    if (Local_Due > Bench_LineChars)
+    {
+        EMU_UsartStep((u32)(Local_Due - Bench_LineChars));
+        Bench_LineChars = Local_Due;
+    }
+}
+
+/**< Advance virtual time, taking the 50 ms flushes on the way */
+static void Bench_Advance(u32 Copy_ToUs)
+{
+    u32 Local_Tick = ((Bench_NowUs / BENCH_TICK_US) + 1UL) * BENCH_TICK_US;
+
+    while (Local_Tick <= Copy_ToUs)
+    {
+        Bench_NowUs = Local_Tick;
+        Bench_RunLine();
+        TLM_Flush();
+        EMU_UsartSync();
+        Local_Tick += BENCH_TICK_US;
+    }
+    Bench_NowUs = Copy_ToUs;
+    Bench_RunLine();
+}
+
+/**< Remember a record TLM accepted so the decoder output can be checked against it */
+static void Bench_Expect(Std_ReturnType Copy_Status, u8 Copy_Id, u8 Copy_Arg, u32 Copy_Value)
+{
+    TLM_Record_t *Local_Record;
+
+    EMU_UsartSync();
+    if (Copy_Status != E_OK)
+    {
+        return;
+    }
+    if ((Bench_PendingHead - Bench_PendingTail) >= BENCH_PENDING_SIZE)
+    {
+        Bench_Fail("more records in flight than the TX ring can hold");
+        return;
+    }
+    Local_Record = &Bench_Pending[Bench_PendingHead % BENCH_PENDING_SIZE];
+    Local_Record->Id = Copy_Id;
+    Local_Record->Arg = Copy_Arg;
+    Local_Record->Value = Copy_Value;
+    Bench_PendingTimeUs[Bench_PendingHead % BENCH_PENDING_SIZE] = Bench_NowUs;
+    Bench_PendingHead++;
+}
+
+static u8 Bench_Input(u8 Copy_Line, u8 Copy_Level)
+{
+    Std_ReturnType Local_Status = TLM_RecordInput(Copy_Line, Copy_Level);
+
+    Bench_Expect(Local_Status, TLM_MSG_INPUT, Copy_Line, Copy_Level);
+    return (Local_Status == E_OK) ? 1 : 0;
+}
+
+/**< One record of a random type with random fields; counters and waits span every varint length */
+static u8 Bench_RandomRecord(void)
+{
+    u8 Local_Arg = (u8)rand();
+    u32 Local_Value = (u32)rand() >> (rand() % 31);
+    Std_ReturnType Local_Status;
+
+    switch (rand() % 10)
+    {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+        return Bench_Input((u8)(rand() % 16), (u8)(rand() & 1));
+    case 4:
+    case 5:
+        Local_Status = TLM_RecordPhase(Local_Arg, (u8)Local_Value);
+        Bench_Expect(Local_Status, TLM_MSG_PHASE, Local_Arg, (u8)Local_Value);
+        break;
+    case 6:
+    case 7:
+        Local_Arg %= 16;
+        Local_Status = TLM_RecordCounter(Local_Arg, Local_Value);
+        Bench_Expect(Local_Status, TLM_MSG_COUNTER, Local_Arg, Local_Value);
+        break;
+    case 8:
+        Local_Status = TLM_RecordPedWait(Local_Arg, Local_Value);
+        Bench_Expect(Local_Status, TLM_MSG_PED_WAIT, Local_Arg, Local_Value);
+        break;
+    default:
+        if (rand() & 1)
+        {
+            Local_Status = TLM_RecordAck(Local_Arg, (u8)Local_Value);
+            Bench_Expect(Local_Status, TLM_MSG_ACK, Local_Arg, (u8)Local_Value);
+        }
+        else
+        {
+            Local_Status = TLM_RecordFault(Local_Arg);
+            Bench_Expect(Local_Status, TLM_MSG_FAULT, Local_Arg, 0);
+        }
+        break;
+    }
+    return (Local_Status == E_OK) ? 1 : 0;
+}
+
+/**< Fresh line, driver, encoder and decoder at virtual time 0 */
+static void Bench_Start(u32 Copy_Baud)
+{
+    Bench_NowUs = 0;
+    Bench_LineChars = 0;
+    Bench_Baud = Copy_Baud;
+    Bench_WireBytes = 0;
+    Bench_PendingHead = 0;
+    Bench_PendingTail = 0;
+    Bench_Decoded = 0;
+
+    EMU_UsartInit(Bench_TxSink);
+    if (MCAL_USART_Init(BENCH_PCLK_HZ) != E_OK)
+    {
+        Bench_Fail("MCAL_USART_Init failed");
+    }
+    EMU_UsartSync();
+    TLM_Init(BENCH_PCLK_HZ);
+    TLM_SetTimeSource(Bench_Clock, 1);
+    TLMH_Init(Bench_Check);
+}
+
+/**< Close the last frame and run the line until the driver reports idle; returns the characters it took */
+static u32 Bench_Drain(void)
+{
+    u32 Local_Steps;
+
+    TLM_Flush();
+    EMU_UsartSync();
+    for (Local_Steps = 0; (Local_Steps < 1000000UL) && !MCAL_USART_IsTxIdle(); Local_Steps++)
+    {
+        EMU_UsartStep(1);
+    }
+    EMU_UsartStep(2);
+
+    if (Bench_PendingTail != Bench_PendingHead)
+    {
+        Bench_Fail("records accepted but never decoded");
+    }
+    if ((TLMH_GetStats()->BadFrames != 0) || (TLMH_GetStats()->SequenceGaps != 0))
+    {
+        Bench_Fail("bad or missing frames on the line");
+    }
+    return Local_Steps;
+}
+
+static void Bench_RoundTrip(unsigned long Copy_Records)
+{
+    unsigned long Local_Index;
+    unsigned long Local_Accepted = 0;
+    u32 Local_Gap;
+
+    Bench_Start(BENCH_ROUND_TRIP_BAUD);
+    for (Local_Index = 0; Local_Index < Copy_Records; Local_Index++)
+    {
+        /**< Mostly bursts of closely spaced records, with the odd long pause */
+        Local_Gap = ((rand() % 16) == 0) ? ((u32)rand() % 20000U) : ((u32)rand() % 400U);
+        Bench_Advance(Bench_NowUs + Local_Gap);
+        Local_Accepted += Bench_RandomRecord();
+    }
+    Bench_Drain();
+
+    printf("round trip at %lu baud: %lu records, %lu accepted, %llu decoded, %lu dropped by TLM\n",
+           (unsigned long)BENCH_ROUND_TRIP_BAUD, Copy_Records, Local_Accepted, Bench_Decoded,
+           (unsigned long)TLM_GetDroppedCount());
+    printf("  %llu wire bytes, %.2f B/record, %lu frames\n", Bench_WireBytes,
+           (double)Bench_WireBytes / (double)(Local_Accepted ? Local_Accepted : 1UL), TLMH_GetStats()->Frames);
+}
+
+/**< Input records at a steady rate; returns 1 if the line kept up */
+static u8 Bench_Rate(u32 Copy_Baud, u32 Copy_Rate, u32 Copy_Seconds, double *Copy_BytesPerEvent)
+{
+    unsigned long Local_Events = (unsigned long)Copy_Rate * Copy_Seconds;
+    unsigned long Local_Index;
+    unsigned long Local_Accepted = 0;
+    u32 Local_Backlog;
+
+    Bench_Start(Copy_Baud);
+    for (Local_Index = 0; Local_Index < Local_Events; Local_Index++)
+    {
+        Bench_Advance((u32)(((unsigned long long)Local_Index * 1000000ULL) / Copy_Rate));
+        Local_Accepted += Bench_Input((u8)(Local_Index % 16), (u8)((Local_Index / 16) & 1));
+    }
+    Local_Backlog = Bench_Drain();
+
+    *Copy_BytesPerEvent = (double)Bench_WireBytes / (double)(Local_Accepted ? Local_Accepted : 1UL);
+    return ((Local_Accepted == Local_Events) && (Local_Backlog <= BENCH_BACKLOG_MAX)) ? 1 : 0;
+}
+
+/**< Mean length of the ASCII line a text protocol would send for the same input events */
+static double Bench_AsciiLength(u32 Copy_Rate, u32 Copy_Seconds)
+{
+    char Local_Line[64];
+    unsigned long Local_Events = (unsigned long)Copy_Rate * Copy_Seconds;
+    unsigned long Local_Index;
+    unsigned long long Local_Bytes = 0;
+
+    for (Local_Index = 0; Local_Index < Local_Events; Local_Index++)
+    {
+        Local_Bytes += (unsigned long long)snprintf(Local_Line, sizeof(Local_Line), "%llu IN %lu %lu\r\n",
+                                                    ((unsigned long long)Local_Index * 1000000ULL) / Copy_Rate,
+                                                    Local_Index % 16, (Local_Index / 16) & 1);
+    }
+    return (double)Local_Bytes / (double)(Local_Events ? Local_Events : 1UL);
+}
+/*****************************< Function Implementations *****************************/
+int main(int argc, char **argv)
+{
+    unsigned long Local_Records = 3000000UL;
+    unsigned long Local_Seed = 1UL;
+    u32 Local_Seconds = 10;
+    u32 Local_Index;
+    u32 Local_Low;
+    u32 Local_High;
+    u32 Local_Mid;
+    double Local_BytesPerEvent = 0;
+    double Local_Ascii;
+    int Local_Arg;
+
+    for (Local_Arg = 1; Local_Arg + 1 < argc; Local_Arg += 2)
+    {
+        if (!strcmp(argv[Local_Arg], "-n"))
+        {
+            Local_Records = strtoul(argv[Local_Arg + 1], NULL, 0);
+        }
+        else if (!strcmp(argv[Local_Arg], "-s"))
+        {
+            Local_Seed = strtoul(argv[Local_Arg + 1], NULL, 0);
+        }
+        else if (!strcmp(argv[Local_Arg], "-t"))
+        {
+            Local_Seconds = (u32)strtoul(argv[Local_Arg + 1], NULL, 0);
+        }
+        else if (!strcmp(argv[Local_Arg], "-w"))
+        {
+            Bench_Capture = fopen(argv[Local_Arg + 1], "wb");
+            if (Bench_Capture == NULL)
+            {
+                perror(argv[Local_Arg + 1]);
+                return 1;
+            }
+        }
+    }
+    if (Local_Seconds == 0)
+    {
+        Local_Seconds = 1;
+    }
+    srand((unsigned)Local_Seed);
+
+    Bench_RoundTrip(Local_Records);
+    if (Bench_Capture != NULL)
+    {
+        fclose(Bench_Capture);
+        Bench_Capture = NULL;
+    }
+
+    printf("sustained input events per second, %lu s per rate, flush every %lu ms:\n",
+           (unsigned long)Local_Seconds, BENCH_TICK_US / 1000UL);
+    printf("  %8s %10s %8s %10s %8s\n", "baud", "TLM ev/s", "B/event", "ASCII ev/s", "B/event");
+    for (Local_Index = 0; Local_Index < (sizeof(Bench_Bauds) / sizeof(Bench_Bauds[0])); Local_Index++)
+    {
+        /**< An input record is never under 3 bytes, so the line caps the rate at baud / 30 */
+        Local_Low = 1;
+        Local_High = Bench_Bauds[Local_Index] / (BENCH_CHAR_BITS * 3UL) + 1UL;
+        while ((Local_High - Local_Low) > 1)
+        {
+            Local_Mid = Local_Low + (Local_High - Local_Low) / 2;
+            if (Bench_Rate(Bench_Bauds[Local_Index], Local_Mid, Local_Seconds, &Local_BytesPerEvent))
+            {
+                Local_Low = Local_Mid;
+            }
+            else
+            {
+                Local_High = Local_Mid;
+            }
+        }
+        (void)Bench_Rate(Bench_Bauds[Local_Index], Local_Low, Local_Seconds, &Local_BytesPerEvent);
+        Local_Ascii = Bench_AsciiLength(Local_Low, Local_Seconds);
+        printf("  %8lu %10lu %8.2f %10.0f %8.2f\n", (unsigned long)Bench_Bauds[Local_Index], (unsigned long)Local_Low,
+               Local_BytesPerEvent, (double)Bench_Bauds[Local_Index] / (BENCH_CHAR_BITS * Local_Ascii), Local_Ascii);
+    }
+
+    printf("  %lu failures, %lu model violations\n", Bench_Failures, (unsigned long)EMU_UsartErrors());
+    return ((Bench_Failures == 0) && (EMU_UsartErrors() == 0)) ? 0 : 1;
+}
@@ -0,0 +1,198 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : emu_flash.c                *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "FLASH_interface.h"
+#include "FLASH_private.h"
+/*****************************< HOST *****************************/
+#include "emu_flash.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#define EMU_MAIN_SIZE           (FLASH_MAIN_END - FLASH_MAIN_START)
+
+/*****************************< Private Variables *****************************/
+static u8 *EMU_Main = NULL;
+static EMU_CutHandler_t EMU_CutHandler = NULL;
+static u8 EMU_CutArmed = 0;
+static u32 EMU_CutBudget = 0;               /**< Operations left before the torn one */
+
+static u32 EMU_EraseCount[FLASH_PAGE_COUNT];
+static u32 EMU_Programs = 0;
+static u32 EMU_Erases = 0;
+static u32 EMU_Errors = 0;
+/*****************************< Private Functions *****************************/
+static void EMU_Error(const char *Copy_What, u32 Copy_Address)
+{
+    if (EMU_Errors++ < 10)
+    {
+        fprintf(stderr, "emu_flash: %s at 0x%08lX\n", Copy_What, (unsigned long)Copy_Address);
+    }
+}
+
+/**< Returns 1 if this operation is the one the power cut tears */
+static u8 EMU_CutNow(void)
+{
+    if (!EMU_CutArmed)
+    {
+        return 0;
+    }
+    if (EMU_CutBudget > 0)
+    {
+        EMU_CutBudget--;
+        return 0;
+    }
+    EMU_CutArmed = 0;
+    return 1;
+}
+
+static void EMU_Cut(void)
+{
+    if (EMU_CutHandler != NULL)
+    {
+        EMU_CutHandler();
+    }
+    fprintf(stderr, "emu_flash: power cut handler returned\n");
+    exit(1);
+}
+/*****************************< Host MCAL *****************************/
+Std_ReturnType MCAL_FLASH_Unlock(void)
+{
+    return E_OK;
+}
+
+void MCAL_FLASH_Lock(void)
+{
+}
+
+Std_ReturnType MCAL_FLASH_ErasePage(u32 Copy_PageAddress)
+{
+    u32 Local_Page;
+    u8 *Local_Bytes;
+    u32 Local_Index;
+
+    if ((Copy_PageAddress < FLASH_MAIN_START) || (Copy_PageAddress >= FLASH_MAIN_END))
+    {
+        EMU_Error("erase outside main memory", Copy_PageAddress);
+        return E_NOT_OK;
+    }
+
+    Local_Page = (Copy_PageAddress - FLASH_MAIN_START) / FLASH_PAGE_SIZE;
+    Local_Bytes = &EMU_Main[Local_Page * FLASH_PAGE_SIZE];
+    EMU_EraseCount[Local_Page]++;
+    EMU_Erases++;
+
+    if (EMU_CutNow())
+    {
+        /**< Erasing only ever sets bits */
+        for (Local_Index = 0; Local_Index < FLASH_PAGE_SIZE; Local_Index++)
+        {
+            Local_Bytes[Local_Index] |= (u8)rand();
+        }
+        EMU_Cut();
+    }
+
+    memset(Local_Bytes, 0xFF, FLASH_PAGE_SIZE);
+
+    return E_OK;
+}
+
+Std_ReturnType MCAL_FLASH_ProgramHalfWords(u32 Copy_Address, const u16 *Copy_Data, u32 Copy_Count)
+{
+    u16 *Local_Target;
+
+    if ((Copy_Data == NULL) || (Copy_Address & 1) || (Copy_Address < FLASH_MAIN_START) ||
+        ((Copy_Address + (Copy_Count * 2)) > FLASH_MAIN_END))
+    {
+        EMU_Error("program outside main memory", Copy_Address);
+        return E_NOT_OK;
+    }
+
+    Local_Target = (u16 *)&EMU_Main[Copy_Address - FLASH_MAIN_START];
+    while (Copy_Count--)
+    {
+        EMU_Programs++;
+        if ((*Local_Target != FLASH_ERASED_HALFWORD) && (*Copy_Data != 0x0000))
+        {
+            EMU_Error("PGERR: program over a half-word that is not erased", Copy_Address);
+            return E_NOT_OK;
+        }
+
+        if (EMU_CutNow())
+        {
+            /**< Programming only ever clears bits, and only those the data clears */
+            *Local_Target &= (u16)(*Copy_Data | (u16)rand());
+            EMU_Cut();
+        }
+
+        *Local_Target &= *Copy_Data;
+        Local_Target++;
+        Copy_Data++;
+        Copy_Address += 2;
+    }
+
+    return E_OK;
+}
+/*****************************< Function Implementations *****************************/
+void EMU_FlashInit(u8 Copy_Fill, EMU_CutHandler_t Copy_Handler)
+{
+    void *Local_Base = (void *)(unsigned long)FLASH_MAIN_START;
+
+    if (EMU_Main == NULL)
+    {
+        if (mmap(Local_Base, EMU_MAIN_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0) != Local_Base)
+        {
+            perror("emu_flash: cannot map main memory");
+            exit(1);
+        }
+        EMU_Main = (u8 *)Local_Base;
+    }
+
+    memset(EMU_Main, Copy_Fill, EMU_MAIN_SIZE);
+    memset(EMU_EraseCount, 0, sizeof(EMU_EraseCount));
+    EMU_CutHandler = Copy_Handler;
+    EMU_CutArmed = 0;
+    EMU_Programs = 0;
+    EMU_Erases = 0;
+    EMU_Errors = 0;
+}
+
+void EMU_FlashArmCut(u32 Copy_Operations)
+{
+    EMU_CutBudget = Copy_Operations;
+    EMU_CutArmed = 1;
+}
+
+void EMU_FlashDisarmCut(void)
+{
+    EMU_CutArmed = 0;
+}
+
+u32 EMU_FlashEraseCount(u32 Copy_Page)
+{
+    return (Copy_Page < FLASH_PAGE_COUNT) ? EMU_EraseCount[Copy_Page] : 0;
+}
+
+u32 EMU_FlashPrograms(void)
+{
+    return EMU_Programs;
+}
+
+u32 EMU_FlashErases(void)
+{
+    return EMU_Erases;
+}
+
+u32 EMU_FlashErrors(void)
+{
+    return EMU_Errors;
+}
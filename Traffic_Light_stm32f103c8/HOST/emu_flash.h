@@ -0,0 +1,57 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : emu_flash.h                *****************/
+/****************************************************************/
+#ifndef EMU_FLASH_H_
+#define EMU_FLASH_H_
+
+/*
+ * Host model of the STM32F103 main flash behind the FLASH_interface.h functions, which it
+ * implements in place of FLASH_program.c. Main memory is mapped at its real address, so code
+ * that reads flash directly (LOG) runs unmodified; build with -no-pie as for emu_usart.
+ *
+ * Programming follows NOR rules: a half-word can be programmed if it is erased or if the new
+ * value is 0x0000, otherwise the FPEC raises PGERR and leaves it alone. An erase sets the whole
+ * page to 0xFF. Each erase and each half-word program is one operation, and a power cut can be
+ * armed to tear the Nth one: a torn erase sets only some bits, a torn program clears only some
+ * of the bits it should. The cut handler is then called and must not return (longjmp back to
+ * the harness, which reboots the code under test).
+ */
+
+/**< Called at a power cut, in place of returning to the code under test */
+typedef void (*EMU_CutHandler_t)(void);
+
+/**
+ * @brief Map main memory (first call only), fill it with a byte and clear the counters.
+ */
+void EMU_FlashInit(u8 Copy_Fill, EMU_CutHandler_t Copy_Handler);
+
+/**
+ * @brief Let a number of operations complete, then tear the next one and call the cut handler.
+ */
+void EMU_FlashArmCut(u32 Copy_Operations);
+
+/**
+ * @brief Cancel an armed power cut.
+ */
+void EMU_FlashDisarmCut(void);
+
+/**
+ * @brief Number of erases of a main memory page since EMU_FlashInit, torn ones included.
+ */
+u32 EMU_FlashEraseCount(u32 Copy_Page);
+
+/**
+ * @brief Number of half-word programs and of page erases since EMU_FlashInit.
+ */
+u32 EMU_FlashPrograms(void);
+u32 EMU_FlashErases(void);
+
+/**
+ * @brief Number of programs refused with PGERR, or outside main memory; each is also printed.
+ */
+u32 EMU_FlashErrors(void);
+
+#endif /**< EMU_FLASH_H_ */
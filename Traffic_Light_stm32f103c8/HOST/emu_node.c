@@ -0,0 +1,203 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : emu_node.c                 *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "STK_interface.h"
+#include "DWT_interface.h"
+#include "SCB_interface.h"
+#include "PWR_interface.h"
+#include "RCC_interface.h"
+/*****************************< SERVICE *****************************/
+#include "TICK_interface.h"
+/*****************************< APP *****************************/
+#include "PHASE_interface.h"
+#include "PHASE_config.h"
+#include "COORD_interface.h"
+/*****************************< HOST *****************************/
+#include "emu_node.h"
+
+#define EMU_HCLK_FREQ           72000000UL
+#define EMU_STK_COUNTS_PER_US   9.0         /**< HCLK / 8, nominal */
+
+/*****************************< Private Variables *****************************/
+static const EMU_Time_t *EMU_Now = NULL;
+static double EMU_CountsPerNs = EMU_STK_COUNTS_PER_US / 1000.0;    /**< Actual counter rate */
+static EMU_Time_t EMU_IntervalStart = 0;
+static double EMU_IntervalCounts = 0;
+static u8 EMU_IntervalActive = 0;
+static u8 EMU_IntervalPeriodic = 0;
+static void (*EMU_IntervalCallback)(void) = NULL;
+static u8 EMU_LastPhase = PHASE_COUNT;
+/*****************************< Host MCAL *****************************/
+static Std_ReturnType EMU_StartInterval(u32 Copy_Microseconds, void (*Copy_Callback)(void), u8 Copy_Periodic)
+{
+    if ((Copy_Microseconds == 0) || (Copy_Callback == NULL))
+    {
+        return E_NOT_OK;
+    }
+
+    EMU_IntervalStart = *EMU_Now;
+    EMU_IntervalCounts = Copy_Microseconds * EMU_STK_COUNTS_PER_US;
+    EMU_IntervalCallback = Copy_Callback;
+    EMU_IntervalPeriodic = Copy_Periodic;
+    EMU_IntervalActive = 1;
+
+    return E_OK;
+}
+
+Std_ReturnType MCAL_STK_SetIntervalSingle(u32 Copy_Microseconds, void (*Copy_Callback)(void))
+{
+    return EMU_StartInterval(Copy_Microseconds, Copy_Callback, 0);
+}
+
+Std_ReturnType MCAL_STK_SetIntervalPeriodic(u32 Copy_Microseconds, void (*Copy_Callback)(void))
+{
+    return EMU_StartInterval(Copy_Microseconds, Copy_Callback, 1);
+}
+
+u32 MCAL_STK_GetIntervalElapsed_us(void)
+{
+    if (!EMU_IntervalActive)
+    {
+        return 0;
+    }
+
+    return (u32)(((double)(*EMU_Now - EMU_IntervalStart) * EMU_CountsPerNs) / EMU_STK_COUNTS_PER_US);
+}
+
+void MCAL_STK_StopInterval(void)
+{
+    EMU_IntervalActive = 0;
+}
+
+void MCAL_STK_SetClockFreq(u32 Copy_HclkFreq)
+{
+    (void)Copy_HclkFreq;
+}
+
+u32 MCAL_DWT_GetCycles(void)
+{
+    return (u32)((*EMU_Now * (EMU_HCLK_FREQ / 1000000UL)) / 1000ULL);
+}
+
+u32 SCB_EnterCritical(void)
+{
+    return 0;
+}
+
+void SCB_ExitCritical(u32 Copy_PriMask)
+{
+    (void)Copy_PriMask;
+}
+
+void SCB_WaitForInterrupt(void)
+{
+}
+
+void MCAL_PWR_EnterStop(void)
+{
+}
+
+void MCAL_RCC_ExitStop(void)
+{
+}
+
+u32 MCAL_RCC_GetSysClockFreq(void)
+{
+    return EMU_HCLK_FREQ;
+}
+/*****************************< Private Functions *****************************/
+static void EMU_NodeInit(double Copy_ErrorPpm, const EMU_Time_t *Copy_Now)
+{
+    EMU_Now = Copy_Now;
+    EMU_CountsPerNs = (EMU_STK_COUNTS_PER_US / 1000.0) * (1.0 + (Copy_ErrorPpm * 1e-6));
+    EMU_IntervalActive = 0;
+    EMU_LastPhase = PHASE_COUNT;
+
+    (void)TICK_Init(PHASE_TICK_MS, MCAL_RCC_GetSysClockFreq());
+    PHASE_Init();
+    COORD_Init();
+}
+
+static EMU_Time_t EMU_NodeNextExpiry(void)
+{
+    if (!EMU_IntervalActive)
+    {
+        return ~0ULL;
+    }
+
+    return EMU_IntervalStart + (EMU_Time_t)((EMU_IntervalCounts / EMU_CountsPerNs) + 0.5);
+}
+
+static void EMU_NodeExpire(void)
+{
+    EMU_Time_t Local_End = EMU_NodeNextExpiry();
+
+    /**< A periodic interval reloads at its own end, not when the handler runs */
+    if (EMU_IntervalPeriodic)
+    {
+        EMU_IntervalStart = Local_End;
+    }
+    else
+    {
+        EMU_IntervalActive = 0;
+    }
+    EMU_IntervalCallback();
+}
+
+static u8 EMU_NodeRunLoop(void)
+{
+    u32 Local_Ticks = TICK_Take();
+    u8 Local_Started = 0;
+    u8 Local_Phase;
+
+    /**< Control_Tick of main, reduced to the modules that place the cycle */
+    while (Local_Ticks--)
+    {
+        COORD_Tick();
+        PHASE_Tick();
+        Local_Phase = PHASE_GetCurrentPhase(0);
+        if ((Local_Phase == PHASE_CYCLE_START) && (EMU_LastPhase != PHASE_CYCLE_START))
+        {
+            Local_Started = 1;
+        }
+        EMU_LastPhase = Local_Phase;
+    }
+
+    return Local_Started;
+}
+
+static void EMU_NodeGetStatus(COORD_Status_t *Copy_Status)
+{
+    (void)COORD_GetStatus(Copy_Status);
+}
+
+static void EMU_NodeDetectVehicle(void)
+{
+    PHASE_DetectVehicle(0);
+}
+
+static void EMU_NodeRequestPedestrian(void)
+{
+    PHASE_RequestPedestrian(0);
+}
+/*****************************< Function Implementations *****************************/
+const EMU_Node_t EMU_Node =
+{
+    EMU_NodeInit,
+    EMU_NodeNextExpiry,
+    EMU_NodeExpire,
+    EMU_NodeRunLoop,
+    COORD_GetSyncOutput,
+    COORD_OnSyncEdge,
+    EMU_NodeGetStatus,
+    EMU_NodeDetectVehicle,
+    EMU_NodeRequestPedestrian,
+};
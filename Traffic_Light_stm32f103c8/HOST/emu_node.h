@@ -0,0 +1,39 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : emu_node.h                 *****************/
+/****************************************************************/
+#ifndef EMU_NODE_H_
+#define EMU_NODE_H_
+
+/*
+ * One controller on the sync line: TICK_program.c, PHASE_program.c, PLAN_program.c and
+ * COORD_program.c, unmodified, over a SysTick model whose counter runs from a drifting crystal.
+ * Each node is built into its own shared object with the COORD_config.h of its role, so that
+ * several of them, each with its own module state, run in one process (see sim_coord.c). The
+ * only exported symbol is EMU_Node.
+ *
+ * Time is the simulator's, in nanoseconds. The SysTick counter runs at HCLK / 8 scaled by the
+ * crystal error, and the modules convert its counts to microseconds at the nominal rate, as
+ * on target; that is the error COORD has to learn.
+ */
+
+/**< Simulated time in ns, owned by the simulator */
+typedef unsigned long long EMU_Time_t;
+
+/**< Entry points of a node */
+typedef struct
+{
+    void (*Init)(double Copy_ErrorPpm, const EMU_Time_t *Copy_Now);        /**< Power up: TICK, PHASE and COORD init as in main */
+    EMU_Time_t (*NextExpiry)(void);     /**< End of the running SysTick interval, ~0 when none runs */
+    void (*Expire)(void);               /**< Run the SysTick handler of the interval ending now */
+    u8 (*RunLoop)(void);                /**< One main loop pass over the ticks taken; 1 when crossing 0 started a cycle */
+    u8 (*GetSyncOutput)(void);
+    void (*OnSyncEdge)(u8 Copy_Level);
+    void (*GetStatus)(COORD_Status_t *Copy_Status);
+    void (*DetectVehicle)(void);
+    void (*RequestPedestrian)(void);
+} EMU_Node_t;
+
+#endif /**< EMU_NODE_H_ */
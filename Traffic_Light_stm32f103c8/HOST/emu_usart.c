@@ -0,0 +1,304 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : emu_usart.c                *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "DMA_interface.h"
+#include "DMA_private.h"
+#include "USART_interface.h"
+#include "USART_config.h"
+#include "USART_private.h"
+/*****************************< HOST *****************************/
+#include "emu_usart.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+/**< Vector table entries of the drivers, defined in DMA_program.c and USART_program.c */
+void DMA1_Channel4_IRQHandler(void);
+void DMA1_Channel5_IRQHandler(void);
+void USART1_IRQHandler(void);
+
+#define EMU_PAGE_MASK           0xFFFU
+#define EMU_RX_QUEUE_SIZE       (1UL << 16)
+
+#define EMU_SR_RXNE             5
+#define EMU_CCR_CIRC_MASK       (1U << DMA_CCR_CIRC)
+
+/**< Flags of one channel in ISR */
+#define EMU_DMA_FLAGS(CHANNEL, FLAGS)   ((u32)(FLAGS) << DMA_FLAGS_SHIFT(CHANNEL))
+
+/**< What the model knows of one DMA channel beyond its registers */
+typedef struct
+{
+    u8 Enabled;
+    u32 Cmar;           /**< Latched at enable */
+    u32 Count;          /**< Latched at enable, reloaded from it in circular mode */
+    u32 Remaining;      /**< Last CNDTR the model wrote */
+} EMU_Channel_t;
+
+/*****************************< Private Variables *****************************/
+static EMU_TxSink_t EMU_Sink = NULL;
+static u8 EMU_Mapped = 0;
+
+static u32 EMU_Sr;                          /**< SR as the hardware holds it */
+static u8 EMU_Dr;
+static u8 EMU_DrFull;
+static u8 EMU_Shift;
+static u8 EMU_ShiftFull;
+
+static EMU_Channel_t EMU_Tx;
+static EMU_Channel_t EMU_Rx;
+
+static u8 EMU_RxQueue[EMU_RX_QUEUE_SIZE];
+static u32 EMU_RxHead = 0;
+static u32 EMU_RxTail = 0;
+static u8 EMU_RxSinceIdle = 0;              /**< A byte arrived since the last IDLE */
+
+static u32 EMU_Errors = 0;
+/*****************************< Private Functions *****************************/
+static void EMU_Error(const char *Copy_What)
+{
+    fprintf(stderr, "emu_usart: %s\n", Copy_What);
+    EMU_Errors++;
+}
+
+static void EMU_Map(u32 Copy_Address)
+{
+    void *Local_Page = (void *)(unsigned long)(Copy_Address & ~EMU_PAGE_MASK);
+
+    if (mmap(Local_Page, EMU_PAGE_MASK + 1U, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0) != Local_Page)
+    {
+        perror("emu_usart: cannot map the register page");
+        exit(1);
+    }
+}
+
+static void EMU_SyncChannel(u8 Copy_Channel, EMU_Channel_t *Copy_State)
+{
+    volatile DMA_ChannelRegDef_t *Local_Ch = &DMA1->CH[Copy_Channel];
+    u8 Local_Enabled = (u8)GET_BIT(Local_Ch->CCR, DMA_CCR_EN);
+
+    if (!Local_Enabled)
+    {
+        Copy_State->Enabled = 0;
+        return;
+    }
+
+    /**< Enabled, or disabled and enabled again with a new address or count since the last look */
+    if (!Copy_State->Enabled || (Local_Ch->CMAR != Copy_State->Cmar) || (Local_Ch->CNDTR != Copy_State->Remaining))
+    {
+        if (Copy_State->Enabled && (Copy_State->Remaining != 0) && !(Local_Ch->CCR & EMU_CCR_CIRC_MASK))
+        {
+            EMU_Error("DMA restarted over a transfer in progress");
+        }
+        Copy_State->Enabled = 1;
+        Copy_State->Cmar = Local_Ch->CMAR;
+        Copy_State->Count = Local_Ch->CNDTR;
+        Copy_State->Remaining = Local_Ch->CNDTR;
+    }
+}
+
+static void EMU_DmaIrq(u8 Copy_Channel)
+{
+    void (*const Local_Handlers[DMA_CHANNEL_COUNT])(void) = {
+        NULL, NULL, NULL, DMA1_Channel4_IRQHandler, DMA1_Channel5_IRQHandler, NULL, NULL,
+    };
+
+    Local_Handlers[Copy_Channel]();
+    EMU_UsartSync();
+}
+
+/**< Moves one item on a channel, raises its flags and takes its interrupt if enabled */
+static void EMU_DmaItem(u8 Copy_Channel, EMU_Channel_t *Copy_State, u8 *Copy_Byte, u8 Copy_ToMemory)
+{
+    volatile DMA_ChannelRegDef_t *Local_Ch = &DMA1->CH[Copy_Channel];
+    u8 *Local_Memory = (u8 *)(unsigned long)(Copy_State->Cmar + (Copy_State->Count - Copy_State->Remaining));
+    u32 Local_Flags = 0;
+    u32 Local_Irq;
+
+    if (Copy_ToMemory)
+    {
+        *Local_Memory = *Copy_Byte;
+    }
+    else
+    {
+        *Copy_Byte = *Local_Memory;
+    }
+
+    Copy_State->Remaining--;
+    if (Copy_State->Remaining == (Copy_State->Count / 2U))
+    {
+        Local_Flags |= DMA_FLAG_HTIF;
+    }
+    if (Copy_State->Remaining == 0)
+    {
+        Local_Flags |= DMA_FLAG_TCIF;
+        if (Local_Ch->CCR & EMU_CCR_CIRC_MASK)
+        {
+            Copy_State->Remaining = Copy_State->Count;
+        }
+    }
+    Local_Ch->CNDTR = Copy_State->Remaining;
+
+    if (Local_Flags)
+    {
+        DMA1->ISR |= EMU_DMA_FLAGS(Copy_Channel, Local_Flags | DMA_FLAG_GIF);
+        /**< TCIE/HTIE sit at the same bit positions as TCIF/HTIF */
+        Local_Irq = Local_Ch->CCR & Local_Flags;
+        if (Local_Irq)
+        {
+            EMU_DmaIrq(Copy_Channel);
+        }
+    }
+}
+
+static void EMU_StepTx(void)
+{
+    if (EMU_ShiftFull)
+    {
+        if (EMU_Sink != NULL)
+        {
+            EMU_Sink(EMU_Shift);
+        }
+        EMU_ShiftFull = 0;
+    }
+    if (EMU_DrFull)
+    {
+        EMU_Shift = EMU_Dr;
+        EMU_ShiftFull = 1;
+        EMU_DrFull = 0;
+    }
+    if (!EMU_DrFull && EMU_Tx.Enabled && EMU_Tx.Remaining && GET_BIT(USART1->CR3, USART_CR3_DMAT) &&
+        GET_BIT(USART1->CR1, USART_CR1_TE))
+    {
+        EMU_DmaItem(DMA_CHANNEL4, &EMU_Tx, &EMU_Dr, 0);
+        EMU_DrFull = 1;
+    }
+    if (!EMU_ShiftFull && !EMU_DrFull)
+    {
+        SET_BIT(EMU_Sr, USART_SR_TC);
+        USART1->SR = EMU_Sr;
+    }
+}
+
+static void EMU_StepRx(void)
+{
+    u8 Local_Byte;
+
+    if (!GET_BIT(USART1->CR1, USART_CR1_RE))
+    {
+        return;
+    }
+
+    if (EMU_RxHead == EMU_RxTail)
+    {
+        /**< One character of silence after traffic */
+        if (EMU_RxSinceIdle)
+        {
+            EMU_RxSinceIdle = 0;
+            SET_BIT(EMU_Sr, USART_SR_IDLE);
+            USART1->SR = EMU_Sr;
+            if (GET_BIT(USART1->CR1, USART_CR1_IDLEIE))
+            {
+                USART1_IRQHandler();
+                /**< Cleared by the SR read then DR read the handler makes */
+                CLR_BIT(EMU_Sr, USART_SR_IDLE);
+                USART1->SR = EMU_Sr;
+                EMU_UsartSync();
+            }
+        }
+        return;
+    }
+
+    Local_Byte = EMU_RxQueue[EMU_RxTail++ & (EMU_RX_QUEUE_SIZE - 1U)];
+    EMU_RxSinceIdle = 1;
+    if (EMU_Rx.Enabled && EMU_Rx.Remaining && GET_BIT(USART1->CR3, USART_CR3_DMAR))
+    {
+        EMU_DmaItem(DMA_CHANNEL5, &EMU_Rx, &Local_Byte, 1);
+    }
+    else
+    {
+        EMU_Error("RX byte with no DMA to take it (overrun)");
+    }
+}
+/*****************************< Function Implementations *****************************/
+void EMU_UsartInit(EMU_TxSink_t Copy_Sink)
+{
+    if (!EMU_Mapped)
+    {
+        EMU_Map(USART1_BASE_ADDRESS);
+        EMU_Map(DMA1_BASE_ADDRESS);
+        EMU_Mapped = 1;
+    }
+    memset((void *)USART1, 0, sizeof(USART_RegDef_t));
+    memset((void *)DMA1, 0, sizeof(DMA_RegDef_t));
+
+    /**< Reset value of SR: TXE and TC set */
+    EMU_Sr = (1UL << 7) | (1UL << USART_SR_TC);
+    USART1->SR = EMU_Sr;
+
+    EMU_Sink = Copy_Sink;
+    EMU_DrFull = 0;
+    EMU_ShiftFull = 0;
+    memset(&EMU_Tx, 0, sizeof(EMU_Tx));
+    memset(&EMU_Rx, 0, sizeof(EMU_Rx));
+    EMU_RxHead = 0;
+    EMU_RxTail = 0;
+    EMU_RxSinceIdle = 0;
+    EMU_Errors = 0;
+}
+
+void EMU_UsartSync(void)
+{
+    /**< SR is rc_w0: a 0 written clears the bit, a 1 leaves it */
+    EMU_Sr &= USART1->SR;
+    USART1->SR = EMU_Sr;
+
+    /**< IFCR is write-1-to-clear and reads as 0 */
+    DMA1->ISR &= ~DMA1->IFCR;
+    DMA1->IFCR = 0;
+
+    EMU_SyncChannel(DMA_CHANNEL4, &EMU_Tx);
+    EMU_SyncChannel(DMA_CHANNEL5, &EMU_Rx);
+}
+
+void EMU_UsartStep(u32 Copy_Chars)
+{
+    EMU_UsartSync();
+    while (Copy_Chars--)
+    {
+        EMU_StepTx();
+        EMU_StepRx();
+    }
+}
+
+void EMU_UsartRxInject(const u8 *Copy_Data, u32 Copy_Length)
+{
+    while (Copy_Length--)
+    {
+        if ((EMU_RxHead - EMU_RxTail) >= EMU_RX_QUEUE_SIZE)
+        {
+            EMU_Error("RX queue of the model full");
+            return;
+        }
+        EMU_RxQueue[EMU_RxHead++ & (EMU_RX_QUEUE_SIZE - 1U)] = *Copy_Data++;
+    }
+}
+
+u8 EMU_UsartTxDrained(void)
+{
+    return (!EMU_DrFull && !EMU_ShiftFull && (!EMU_Tx.Enabled || (EMU_Tx.Remaining == 0))) ? 1 : 0;
+}
+
+u32 EMU_UsartErrors(void)
+{
+    return EMU_Errors;
+}
@@ -0,0 +1,62 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : emu_usart.h                *****************/
+/****************************************************************/
+#ifndef EMU_USART_H_
+#define EMU_USART_H_
+
+/*
+ * Host model of USART1 and DMA1 channels 4 (TX) and 5 (RX) under USART_program.c and DMA_program.c.
+ *
+ * The register blocks are mapped at their real addresses, so the drivers run unmodified. Build with
+ * -no-pie: the drivers keep buffer addresses in the 32-bit CMAR, so their static buffers must sit
+ * below 4 GB.
+ *
+ * Plain memory cannot act on a store, so the model applies the side effects of register writes
+ * in EMU_UsartSync. These are rc_w0 on SR, write-1-to-clear on IFCR, and channel enable and
+ * restart on CCR/CMAR/CNDTR. The harness calls it after every driver call. Interrupts are taken
+ * only inside EMU_UsartStep, between two driver calls, and the handlers run to completion as on
+ * the Cortex-M3.
+ */
+
+/**< Receives every byte that leaves the TX pin */
+typedef void (*EMU_TxSink_t)(u8 Copy_Byte);
+
+/**
+ * @brief Map the registers (first call only) and reset them and the model to the power-on state.
+ */
+void EMU_UsartInit(EMU_TxSink_t Copy_Sink);
+
+/**
+ * @brief Apply the side effects of the register writes the drivers made since the last call.
+ */
+void EMU_UsartSync(void);
+
+/**
+ * @brief Run the line for a number of character times (10 bits each at the configured baud).
+ *
+ * Each character time moves the shift register out, DR into the shift register, the next TX
+ * byte into DR by DMA, and one queued RX byte into memory by DMA. Flags are raised and the
+ * enabled interrupts are taken. An RX line silent for one character after a byte raises IDLE.
+ */
+void EMU_UsartStep(u32 Copy_Chars);
+
+/**
+ * @brief Queue bytes to arrive back to back on the RX pin.
+ */
+void EMU_UsartRxInject(const u8 *Copy_Data, u32 Copy_Length);
+
+/**
+ * @brief Check whether the transmitter is empty: nothing in DR, the shift register or TX DMA.
+ */
+u8 EMU_UsartTxDrained(void);
+
+/**
+ * @brief Number of model violations seen so far (a DMA restart over a transfer in progress,
+ *        an RX overrun); each is also printed.
+ */
+u32 EMU_UsartErrors(void);
+
+#endif /**< EMU_USART_H_ */
@@ -0,0 +1,388 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : eval_adapt.c               *****************/
+/****************************************************************/
+
+/*
+ * Evaluation of the Webster optimizer (ADAPT) against fixed-time control on a queue model.
+ *
+ *   eval_adapt [-h hours] [-s seed]
+ *
+ * PHASE_program.c, PLAN_program.c and ADAPT_program.c run unmodified for crossing 0, one call
+ * of PHASE_Tick and ADAPT_Tick per virtual control tick, as in main. The baseline is the
+ * default plan made fixed-time with a 10 s car green. The adaptive run starts from the same
+ * plan with ADAPT enabled, so only the greens it computes differ.
+ *
+ * Queue model, per tick:
+ *   - cars arrive as a Poisson stream. One that finds the green with no queue passes at once,
+ *     any other joins the queue;
+ *   - on green the queue discharges at EVAL_SAT_FLOW_VPH, the first car as the green
+ *     starts;
+ *   - the stop-line detector is occupied while a queue stands on red, and for a short pulse
+ *     under each car that crosses it. Its edges go to ADAPT_OnDetector and its rising edges
+ *     to PHASE_DetectVehicle, as in main;
+ *   - pedestrians arrive as a Poisson stream. The first of a waiting group presses the button,
+ *     and the walk serves all of them.
+ *
+ * Delay is the time spent queued, averaged over the cars and the pedestrians that arrived.
+ * Both modes see the same arrivals. A run marked '*' ended with a queue that was still
+ * growing, so the crossing was oversaturated and its delay depends on the run length.
+ *
+ * The adaptive runs are also checked against their demand. Over the second half of each
+ * run, the flow estimate must average within EVAL_FLOW_TOLERANCE of the cars that arrived,
+ * and the car green and walk ADAPT planned must average within EVAL_SPLIT_TOLERANCE_MS of
+ * the Webster split for the true car flow and button presses, under the limits of
+ * ADAPT_config.h. The flow is checked up to EVAL_TRACKED_VPH: above it the longest plan
+ * ADAPT may run is close to saturation. Any miss makes the exit status 1.
+ */
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "SCB_interface.h"
+/*****************************< APP *****************************/
+#include "PHASE_interface.h"
+#include "PHASE_config.h"
+#include "ADAPT_interface.h"
+#include "ADAPT_config.h"
+/*****************************< HOST *****************************/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define EVAL_SAT_FLOW_VPH       2000UL      /**< Discharge rate of a queue on green */
+#define EVAL_PULSE_MS           600UL       /**< Detector occupied by a crossing car */
+#define EVAL_FIXED_GREEN_MS     10000UL     /**< Car green of the fixed-time baseline */
+#define EVAL_TICKS_PER_HOUR     (3600000UL / PHASE_TICK_MS)
+#define EVAL_OVERSATURATED      50          /**< Queue growth over the second half of a run that marks it oversaturated */
+#define EVAL_FLOW_TOLERANCE     0.10        /**< Largest error of the average flow estimate, relative */
+#define EVAL_TRACKED_VPH        800UL       /**< Highest car flow whose estimate is checked */
+#define EVAL_SPLIT_TOLERANCE_MS 1500.0      /**< Largest error of the average car green and walk */
+
+/**< Outcome of one run */
+typedef struct
+{
+    double CarDelayS;
+    double PedDelayS;
+    u8 Oversaturated;       /**< The queue was still growing at the end */
+    double CarVph;          /**< Cars that arrived over the second half, per hour */
+    double PressPh;         /**< Button presses over the second half, per hour */
+    double FlowVph;         /**< Average flow estimate over the second half */
+    double Occupancy;       /**< Average green occupancy over the second half */
+    double CarGreenMs;      /**< Average planned car green over the second half */
+    double WalkMs;          /**< Average planned walk over the second half */
+    double LostMs;          /**< Lost time of the plan: the phases between the two greens */
+    double MinCarGreenMs;   /**< Shortest car green ADAPT may plan */
+    u16 Rejected;           /**< Adapted plans PHASE_InstallTable refused */
+} Eval_Result_t;
+
+/*****************************< Private Variables *****************************/
+static const u32 Eval_CarFlows[] = { 200, 400, 600, 800, 1000 };
+static const u32 Eval_PedFlows[] = { 30, 150, 400 };
+
+static u32 Eval_Ticks = 0;              /**< Virtual time */
+static PHASE_Descriptor_t Eval_Fixed[PHASE_COUNT];     /**< Default plan with a fixed car green */
+/*****************************< Host MCAL *****************************/
+u32 SCB_EnterCritical(void)
+{
+    return 0;
+}
+
+void SCB_ExitCritical(u32 Copy_PriMask)
+{
+    (void)Copy_PriMask;
+}
+
+/*****************************< Private Functions *****************************/
+static u8 Eval_Arrives(double Copy_PerTick)
+{
+    return ((rand() / (RAND_MAX + 1.0)) < Copy_PerTick) ? 1 : 0;
+}
+
+static void Eval_Run(u8 Copy_Adaptive, u32 Copy_CarFlow, u32 Copy_PedFlow, u32 Copy_Hours, unsigned Copy_Seed,
+                     Eval_Result_t *Copy_Result)
+{
+    const PHASE_Descriptor_t *Local_Default;
+    double Local_CarPerTick = (double)Copy_CarFlow / EVAL_TICKS_PER_HOUR;
+    double Local_PedPerTick = (double)Copy_PedFlow / EVAL_TICKS_PER_HOUR;
+    double Local_Discharge = 0;
+    double Local_CarQueued = 0;
+    double Local_PedQueued = 0;
+    unsigned long Local_Cars = 0;
+    unsigned long Local_Peds = 0;
+    unsigned long Local_LateCars = 0;
+    unsigned long Local_LatePresses = 0;
+    unsigned long Local_Samples = 0;
+    ADAPT_Estimate_t Local_Estimate;
+    u32 Local_Queue = 0;
+    u32 Local_PedQueue = 0;
+    u32 Local_Pulse = 0;
+    u32 Local_End = Copy_Hours * EVAL_TICKS_PER_HOUR;
+    u32 Local_HalfQueue = 0;
+    u8 Local_Green;
+    u8 Local_WasGreen = 0;
+    u8 Local_Detector = 0;
+    u8 Local_Level;
+    u8 Local_Index;
+    u8 Local_Phase;
+
+    PHASE_Init();
+    ADAPT_Init();
+    ADAPT_SetEnabled(Copy_Adaptive);
+    srand(Copy_Seed);
+
+    Local_Default = PHASE_GetActiveTable(0);
+    for (Local_Index = 0; Local_Index < PHASE_COUNT; Local_Index++)
+    {
+        Eval_Fixed[Local_Index] = Local_Default[Local_Index];
+    }
+    Eval_Fixed[PHASE_CAR_GO].Flags &= (u8)~(PHASE_FLAG_ACTUATED | PHASE_FLAG_ENDS_ON_REQUEST);
+    Eval_Fixed[PHASE_CAR_GO].DurationTicks = (u16)(EVAL_FIXED_GREEN_MS / PHASE_TICK_MS);
+
+    /**< What ADAPT plans around: the lost time and the shortest car green of the default plan */
+    memset(Copy_Result, 0, sizeof(*Copy_Result));
+    Copy_Result->MinCarGreenMs = Local_Default[ADAPT_CAR_PHASE].MinTicks * (double)PHASE_TICK_MS;
+    if (Copy_Result->MinCarGreenMs < ADAPT_MIN_CAR_GREEN_MS)
+    {
+        Copy_Result->MinCarGreenMs = ADAPT_MIN_CAR_GREEN_MS;
+    }
+    for (Local_Phase = Local_Default[ADAPT_CAR_PHASE].Next; Local_Phase != ADAPT_CAR_PHASE; Local_Phase = Local_Default[Local_Phase].Next)
+    {
+        if (Local_Phase != ADAPT_PED_PHASE)
+        {
+            Copy_Result->LostMs += Local_Default[Local_Phase].DurationTicks * (double)PHASE_TICK_MS;
+        }
+    }
+    if (PHASE_InstallTable(0, Eval_Fixed) != E_OK)
+    {
+        fprintf(stderr, "eval_adapt: the fixed-time plan was refused\n");
+        exit(1);
+    }
+
+    for (Eval_Ticks = 0; Eval_Ticks < Local_End; Eval_Ticks++)
+    {
+        Local_Green = (PHASE_GetSignals(0) & PHASE_SIG_CAR_GREEN) ? 1 : 0;
+
+        if (Eval_Arrives(Local_CarPerTick))
+        {
+            Local_Cars++;
+            Local_LateCars += (Eval_Ticks >= (Local_End / 2)) ? 1 : 0;
+            if (Local_Green && (Local_Queue == 0))
+            {
+                Local_Pulse = EVAL_PULSE_MS / PHASE_TICK_MS;
+            }
+            else
+            {
+                Local_Queue++;
+            }
+        }
+        if (Eval_Arrives(Local_PedPerTick))
+        {
+            if (Local_PedQueue == 0)
+            {
+                PHASE_RequestPedestrian(0);
+                ADAPT_OnPedestrian(0);
+                Local_LatePresses += (Eval_Ticks >= (Local_End / 2)) ? 1 : 0;
+            }
+            Local_PedQueue++;
+            Local_Peds++;
+        }
+
+        /**< The first car goes as the green starts, then one per saturation headway */
+        if (Local_Green)
+        {
+            Local_Discharge += Local_WasGreen ? ((double)EVAL_SAT_FLOW_VPH / EVAL_TICKS_PER_HOUR) : 1.0;
+            while ((Local_Discharge >= 1.0) && (Local_Queue > 0))
+            {
+                Local_Queue--;
+                Local_Discharge -= 1.0;
+                Local_Pulse = EVAL_PULSE_MS / PHASE_TICK_MS;
+            }
+            if (Local_Queue == 0)
+            {
+                Local_Discharge = 0;
+            }
+        }
+        else
+        {
+            Local_Discharge = 0;
+        }
+        Local_WasGreen = Local_Green;
+
+        Local_Level = ((Local_Pulse > 0) || ((Local_Queue > 0) && !Local_Green)) ? 1 : 0;
+        if (Local_Pulse > 0)
+        {
+            Local_Pulse--;
+        }
+        if (Local_Level != Local_Detector)
+        {
+            Local_Detector = Local_Level;
+            ADAPT_OnDetector(0, Local_Level);
+            if (Local_Level)
+            {
+                PHASE_DetectVehicle(0);
+            }
+        }
+
+        PHASE_Tick();
+        ADAPT_Tick();
+        if (PHASE_CheckInvariants(0) != E_OK)
+        {
+            fprintf(stderr, "eval_adapt: phase invariants broken at tick %lu\n", (unsigned long)Eval_Ticks);
+            exit(1);
+        }
+
+        if (PHASE_GetSignals(0) & PHASE_SIG_PED_GREEN)
+        {
+            Local_PedQueue = 0;
+        }
+        Local_CarQueued += Local_Queue;
+        Local_PedQueued += Local_PedQueue;
+        if (Eval_Ticks == (Local_End / 2))
+        {
+            Local_HalfQueue = Local_Queue;
+        }
+        if (Eval_Ticks >= (Local_End / 2))
+        {
+            ADAPT_GetEstimate(0, &Local_Estimate);
+            Copy_Result->FlowVph += Local_Estimate.FlowQ16 / 65536.0;
+            Copy_Result->Occupancy += Local_Estimate.OccupancyQ16 / 65536.0;
+            Copy_Result->CarGreenMs += Local_Estimate.CarGreenTicks * (double)PHASE_TICK_MS;
+            Copy_Result->WalkMs += Local_Estimate.WalkTicks * (double)PHASE_TICK_MS;
+            Local_Samples++;
+        }
+    }
+
+    Copy_Result->CarDelayS = Local_CarQueued * (PHASE_TICK_MS / 1000.0) / (double)(Local_Cars ? Local_Cars : 1UL);
+    Copy_Result->PedDelayS = Local_PedQueued * (PHASE_TICK_MS / 1000.0) / (double)(Local_Peds ? Local_Peds : 1UL);
+    Copy_Result->Oversaturated = (Local_Queue > (Local_HalfQueue + EVAL_OVERSATURATED)) ? 1 : 0;
+    Copy_Result->CarVph = (double)Local_LateCars * EVAL_TICKS_PER_HOUR / Local_Samples;
+    Copy_Result->PressPh = (double)Local_LatePresses * EVAL_TICKS_PER_HOUR / Local_Samples;
+    Copy_Result->FlowVph /= Local_Samples;
+    Copy_Result->Occupancy /= Local_Samples;
+    Copy_Result->CarGreenMs /= Local_Samples;
+    Copy_Result->WalkMs /= Local_Samples;
+    Copy_Result->Rejected = Local_Estimate.Rejected;
+}
+
+static double Eval_Clamp(double Copy_Value, double Copy_Min, double Copy_Max)
+{
+    return (Copy_Value < Copy_Min) ? Copy_Min : ((Copy_Value > Copy_Max) ? Copy_Max : Copy_Value);
+}
+
+/**< The split ADAPT should reach for the true demand of a run, in floating point */
+static void Eval_Webster(const Eval_Result_t *Copy_Result, double *Copy_CarGreenMs, double *Copy_WalkMs)
+{
+    double Local_CarRatio = Eval_Clamp(Copy_Result->CarVph / ADAPT_SAT_FLOW_VPH, 0, 1);
+    double Local_PedRatio = Eval_Clamp(Copy_Result->PressPh / ADAPT_PED_SAT_FLOW_PH, 0, 1);
+    double Local_Ratio = Eval_Clamp(Local_CarRatio + Local_PedRatio, 0, ADAPT_MAX_RATIO_Q16 / 65536.0);
+    double Local_Cycle = Eval_Clamp((1.5 * Copy_Result->LostMs + 5000.0) / (1.0 - Local_Ratio), ADAPT_MIN_CYCLE_MS, ADAPT_MAX_CYCLE_MS);
+    double Local_Green = Local_Cycle - Copy_Result->LostMs;
+    double Local_CarGreen = ((Local_CarRatio + Local_PedRatio) > 0) ?
+                            (Local_Green * Local_CarRatio / (Local_CarRatio + Local_PedRatio)) : (Local_Green / 2);
+
+    *Copy_WalkMs = Eval_Clamp(Local_Green - Eval_Clamp(Local_CarGreen, 0, Local_Green), ADAPT_MIN_WALK_MS, ADAPT_MAX_GREEN_MS);
+    *Copy_CarGreenMs = Eval_Clamp(Local_CarGreen, Copy_Result->MinCarGreenMs, ADAPT_MAX_GREEN_MS);
+}
+
+/**< Whether an adaptive run followed its demand; prints what it missed */
+static u8 Eval_Tracks(u32 Copy_CarFlow, const Eval_Result_t *Copy_Result)
+{
+    double Local_CarGreenMs;
+    double Local_WalkMs;
+    u8 Local_Tracks = 1;
+
+    Eval_Webster(Copy_Result, &Local_CarGreenMs, &Local_WalkMs);
+
+    if ((Copy_CarFlow <= EVAL_TRACKED_VPH) &&
+        (fabs(Copy_Result->FlowVph - Copy_Result->CarVph) > (EVAL_FLOW_TOLERANCE * Copy_Result->CarVph)))
+    {
+        printf("  flow estimate %.0f veh/h off the %.0f veh/h that arrived\n", Copy_Result->FlowVph, Copy_Result->CarVph);
+        Local_Tracks = 0;
+    }
+    if ((fabs(Copy_Result->CarGreenMs - Local_CarGreenMs) > EVAL_SPLIT_TOLERANCE_MS) ||
+        (fabs(Copy_Result->WalkMs - Local_WalkMs) > EVAL_SPLIT_TOLERANCE_MS))
+    {
+        printf("  split %.1f s / %.1f s off Webster %.1f s / %.1f s\n", Copy_Result->CarGreenMs / 1000.0,
+               Copy_Result->WalkMs / 1000.0, Local_CarGreenMs / 1000.0, Local_WalkMs / 1000.0);
+        Local_Tracks = 0;
+    }
+
+    return Local_Tracks;
+}
+
+static void Eval_PrintDelay(const Eval_Result_t *Copy_Result)
+{
+    printf(" %7.1f%c %6.1f", Copy_Result->CarDelayS, Copy_Result->Oversaturated ? '*' : ' ', Copy_Result->PedDelayS);
+}
+/*****************************< Function Implementations *****************************/
+int main(int argc, char **argv)
+{
+    u32 Local_Hours = 8;
+    unsigned long Local_Seed = 11UL;
+    Eval_Result_t Local_Fixed;
+    Eval_Result_t Local_Adaptive;
+    double Local_CarGreenMs;
+    double Local_WalkMs;
+    unsigned long Local_Misses = 0;
+    u8 Local_Car;
+    u8 Local_Ped;
+    int Local_Arg;
+
+    for (Local_Arg = 1; Local_Arg + 1 < argc; Local_Arg += 2)
+    {
+        if (!strcmp(argv[Local_Arg], "-h"))
+        {
+            Local_Hours = (u32)strtoul(argv[Local_Arg + 1], NULL, 0);
+        }
+        else if (!strcmp(argv[Local_Arg], "-s"))
+        {
+            Local_Seed = strtoul(argv[Local_Arg + 1], NULL, 0);
+        }
+    }
+    if (Local_Hours == 0)
+    {
+        Local_Hours = 1;
+    }
+
+    printf("eval_adapt: %lu h per run, seed %lu, saturation %lu veh/h, fixed-time car green %lu s\n",
+           (unsigned long)Local_Hours, Local_Seed, EVAL_SAT_FLOW_VPH, EVAL_FIXED_GREEN_MS / 1000UL);
+    printf("average delay in s ('*' oversaturated); over the second half, the adapted split against\n");
+    printf("Webster for the true demand, and the flow estimate against the cars that arrived:\n");
+    printf("  %5s %5s | %8s %6s | %8s %6s | %6s %7s %6s %7s | %7s %7s %5s\n", "car/h", "ped/h", "fixed", "ped",
+           "adaptive", "ped", "green", "webster", "walk", "webster", "est/h", "cars/h", "occ");
+    for (Local_Car = 0; Local_Car < (sizeof(Eval_CarFlows) / sizeof(Eval_CarFlows[0])); Local_Car++)
+    {
+        for (Local_Ped = 0; Local_Ped < (sizeof(Eval_PedFlows) / sizeof(Eval_PedFlows[0])); Local_Ped++)
+        {
+            Eval_Run(0, Eval_CarFlows[Local_Car], Eval_PedFlows[Local_Ped], Local_Hours, (unsigned)Local_Seed, &Local_Fixed);
+            Eval_Run(1, Eval_CarFlows[Local_Car], Eval_PedFlows[Local_Ped], Local_Hours, (unsigned)Local_Seed, &Local_Adaptive);
+
+            printf("  %5lu %5lu |", (unsigned long)Eval_CarFlows[Local_Car], (unsigned long)Eval_PedFlows[Local_Ped]);
+            Eval_PrintDelay(&Local_Fixed);
+            printf(" |");
+            Eval_PrintDelay(&Local_Adaptive);
+            Eval_Webster(&Local_Adaptive, &Local_CarGreenMs, &Local_WalkMs);
+            printf(" | %5.1fs %6.1fs %5.1fs %6.1fs | %7.0f %7.0f %5.2f\n", Local_Adaptive.CarGreenMs / 1000.0,
+                   Local_CarGreenMs / 1000.0, Local_Adaptive.WalkMs / 1000.0, Local_WalkMs / 1000.0,
+                   Local_Adaptive.FlowVph, Local_Adaptive.CarVph, Local_Adaptive.Occupancy);
+            if (Local_Adaptive.Rejected != 0)
+            {
+                printf("  (%u adapted plans refused by PHASE_InstallTable)\n", Local_Adaptive.Rejected);
+            }
+            if (!Eval_Tracks(Eval_CarFlows[Local_Car], &Local_Adaptive))
+            {
+                Local_Misses++;
+            }
+        }
+    }
+
+    printf("eval_adapt: %lu of %lu adaptive runs off their demand\n", Local_Misses,
+           (unsigned long)((sizeof(Eval_CarFlows) / sizeof(Eval_CarFlows[0])) * (sizeof(Eval_PedFlows) / sizeof(Eval_PedFlows[0]))));
+
+    return (Local_Misses == 0) ? 0 : 1;
+}
@@ -0,0 +1,247 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : fuzz_phase.c               *****************/
+/****************************************************************/
+
+/*
+ * Coverage-guided fuzz target for the phase engine (PHASE_program.c, PLAN_program.c, unmodified).
+ *
+ * Every input byte is one step: the top three bits pick what happens, the low five bits its
+ * argument. Steps are the calls the interrupts make (button, detector, preemption edges), the
+ * calls the main loop makes (ticks, low demand, coordination, plan installs), and runs of ticks.
+ * The invariants are checked after every call and every tick, so any interleaving the firmware
+ * can see between two ticks is covered.
+ *
+ * Built with clang -fsanitize=fuzzer this is a libFuzzer target (make fuzz_phase_libfuzzer).
+ * Built plainly it has its own driver: random inputs, or the files named on the command line.
+ */
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< APP *****************************/
+#include "PHASE_interface.h"
+#include "PHASE_config.h"
+#include "PLAN_interface.h"
+/*****************************< HOST *****************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define FUZZ_OP_TICKS           0   /**< 1 .. 32 ticks */
+#define FUZZ_OP_PED_REQUEST     1
+#define FUZZ_OP_VEHICLE         2
+#define FUZZ_OP_PREEMPT_ON      3
+#define FUZZ_OP_PREEMPT_OFF     4
+#define FUZZ_OP_LOW_DEMAND      5
+#define FUZZ_OP_COORD           6   /**< Coordination on/off or a force-off, or a plan install */
+#define FUZZ_OP_LONG_RUN        7   /**< 8 .. 256 ticks */
+
+/*****************************< Private Variables *****************************/
+/**< Input of the run in progress, saved by the plain driver when an invariant fails */
+static const uint8_t *Fuzz_Input = NULL;
+static size_t Fuzz_InputSize = 0;
+/*****************************< Private Functions *****************************/
+static void Fuzz_Fail(u8 Copy_Intersection, const char *Copy_What)
+{
+    FILE *Local_File;
+
+    fprintf(stderr, "fuzz_phase: crossing %u: %s (phase %u, signals 0x%02X, preempt %u)\n",
+            Copy_Intersection, Copy_What, PHASE_GetCurrentPhase(Copy_Intersection),
+            PHASE_GetSignals(Copy_Intersection), PHASE_GetPreemptStep(Copy_Intersection));
+
+    if (Fuzz_Input != NULL)
+    {
+        Local_File = fopen("crash-fuzz_phase", "wb");
+        if (Local_File != NULL)
+        {
+            fwrite(Fuzz_Input, 1, Fuzz_InputSize, Local_File);
+            fclose(Local_File);
+            fprintf(stderr, "fuzz_phase: input saved to crash-fuzz_phase, rerun with ./fuzz_phase crash-fuzz_phase\n");
+        }
+    }
+    abort();
+}
+
+static void Fuzz_Check(void)
+{
+    u8 Local_Index;
+    u8 Local_Signals;
+
+    for (Local_Index = 0; Local_Index < PHASE_INTERSECTION_COUNT; Local_Index++)
+    {
+        if (PHASE_CheckInvariants(Local_Index) != E_OK)
+        {
+            Fuzz_Fail(Local_Index, "PHASE_CheckInvariants failed");
+        }
+
+        /**< Checked here as well, from the output alone, in case the engine's own check is wrong */
+        Local_Signals = PHASE_GetSignals(Local_Index);
+        if ((Local_Signals & PHASE_SIG_CAR_GREEN) && (Local_Signals & PHASE_SIG_PED_GREEN))
+        {
+            Fuzz_Fail(Local_Index, "cars and pedestrians green together");
+        }
+    }
+}
+
+static void Fuzz_Ticks(u32 Copy_Count)
+{
+    while (Copy_Count--)
+    {
+        PHASE_Tick();
+        Fuzz_Check();
+    }
+}
+
+static void Fuzz_Step(u8 Copy_Byte)
+{
+    u8 Local_Arg = Copy_Byte & 0x1F;
+    u8 Local_Crossing = Local_Arg % PHASE_INTERSECTION_COUNT;
+
+    switch (Copy_Byte >> 5)
+    {
+    case FUZZ_OP_TICKS:
+        Fuzz_Ticks(Local_Arg + 1U);
+        return;
+    case FUZZ_OP_PED_REQUEST:
+        PHASE_RequestPedestrian(Local_Crossing);
+        break;
+    case FUZZ_OP_VEHICLE:
+        PHASE_DetectVehicle(Local_Crossing);
+        break;
+    case FUZZ_OP_PREEMPT_ON:
+        PHASE_Preempt(Local_Crossing, 1);
+        break;
+    case FUZZ_OP_PREEMPT_OFF:
+        PHASE_Preempt(Local_Crossing, 0);
+        break;
+    case FUZZ_OP_LOW_DEMAND:
+        PHASE_SetLowDemand(Local_Arg & 1U);
+        break;
+    case FUZZ_OP_COORD:
+        switch (Local_Arg >> 3)
+        {
+        case 0:
+            PHASE_SetCoordinated(Local_Arg % PHASE_INTERSECTION_COUNT, 1);
+            break;
+        case 1:
+            PHASE_SetCoordinated(Local_Arg % PHASE_INTERSECTION_COUNT, 0);
+            break;
+        case 2:
+            PHASE_ForceOff(Local_Arg % PHASE_INTERSECTION_COUNT);
+            break;
+        default:
+            /**< Plans only change at a cycle boundary, through the same double buffer as an upload */
+            (void)PHASE_InstallTable(Local_Crossing, PLAN_GetTable((Local_Arg >> 1) % PLAN_COUNT));
+            break;
+        }
+        break;
+    default:
+        Fuzz_Ticks((Local_Arg + 1UL) * 8UL);
+        return;
+    }
+
+    Fuzz_Check();
+}
+
+/*****************************< Function Implementations *****************************/
+int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size)
+{
+    size_t Local_Index;
+
+    PHASE_Init();
+    PHASE_SetLowDemand(0);
+    Fuzz_Check();
+
+    for (Local_Index = 0; Local_Index < Size; Local_Index++)
+    {
+        Fuzz_Step(Data[Local_Index]);
+    }
+
+    return 0;
+}
+
+#ifndef HOST_LIBFUZZER
+static int Fuzz_RunFile(const char *Copy_Path)
+{
+    static uint8_t Local_Buffer[1UL << 20];
+    size_t Local_Size;
+    FILE *Local_File = fopen(Copy_Path, "rb");
+
+    if (Local_File == NULL)
+    {
+        perror(Copy_Path);
+        return 1;
+    }
+    Local_Size = fread(Local_Buffer, 1, sizeof(Local_Buffer), Local_File);
+    fclose(Local_File);
+
+    LLVMFuzzerTestOneInput(Local_Buffer, Local_Size);
+    printf("%s: %lu steps, invariants held\n", Copy_Path, (unsigned long)Local_Size);
+    return 0;
+}
+
+/**< Without libFuzzer: fuzz_phase [-n runs] [-s seed] [input files...] */
+int main(int argc, char **argv)
+{
+    uint8_t Local_Input[256];
+    unsigned long Local_Runs = 1000000UL;
+    unsigned long Local_Seed = 1UL;
+    unsigned long Local_Run;
+    unsigned long long Local_Steps = 0;
+    size_t Local_Size;
+    size_t Local_Index;
+    int Local_Arg;
+    int Local_Files = 0;
+    int Local_Status = 0;
+    clock_t Local_Start;
+    double Local_Seconds;
+
+    for (Local_Arg = 1; Local_Arg < argc; Local_Arg++)
+    {
+        if ((argv[Local_Arg][0] == '-') && (argv[Local_Arg][1] == 'n') && (Local_Arg + 1 < argc))
+        {
+            Local_Runs = strtoul(argv[++Local_Arg], NULL, 0);
+        }
+        else if ((argv[Local_Arg][0] == '-') && (argv[Local_Arg][1] == 's') && (Local_Arg + 1 < argc))
+        {
+            Local_Seed = strtoul(argv[++Local_Arg], NULL, 0);
+        }
+        else
+        {
+            Local_Status |= Fuzz_RunFile(argv[Local_Arg]);
+            Local_Files++;
+        }
+    }
+    if (Local_Files)
+    {
+        return Local_Status;
+    }
+
+    srand((unsigned)Local_Seed);
+    Local_Start = clock();
+    for (Local_Run = 0; Local_Run < Local_Runs; Local_Run++)
+    {
+        Local_Size = 1U + ((size_t)rand() % sizeof(Local_Input));
+        for (Local_Index = 0; Local_Index < Local_Size; Local_Index++)
+        {
+            Local_Input[Local_Index] = (uint8_t)(rand() >> 7);
+        }
+        Fuzz_Input = Local_Input;
+        Fuzz_InputSize = Local_Size;
+        LLVMFuzzerTestOneInput(Local_Input, Local_Size);
+        Local_Steps += Local_Size;
+    }
+    Local_Seconds = (double)(clock() - Local_Start) / CLOCKS_PER_SEC;
+
+    printf("fuzz_phase: %lu inputs, %llu steps, %u crossings, seed %lu: invariants held\n",
+           Local_Runs, Local_Steps, (unsigned)PHASE_INTERSECTION_COUNT, Local_Seed);
+    printf("fuzz_phase: %.2f s, %.0f executions per minute\n", Local_Seconds,
+           (Local_Seconds > 0.0) ? (60.0 * Local_Runs / Local_Seconds) : 0.0);
+    return 0;
+}
+#endif
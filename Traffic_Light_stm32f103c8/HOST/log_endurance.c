@@ -0,0 +1,330 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : log_endurance.c            *****************/
+/****************************************************************/
+
+/*
+ * Endurance and power-fail test of LOG_program.c, unmodified, on the emu_flash model.
+ *
+ *   log_endurance [-b boots] [-r records] [-s seed]
+ *
+ * Each boot calls LOG_Init on whatever the last boot left in flash, reads the whole log back,
+ * then appends numbered records in batches and drains each batch until LOG_IsIdle. Two boots in
+ * three are cut short by a power failure inside a random erase or half-word program. The first
+ * boot finds the log area full of unerased bytes.
+ *
+ * At every boot the log must read back in order with every field intact. Every record that was
+ * in flash when LOG_IsIdle last returned 1 must still be there, unless it has aged out of the
+ * window of the oldest pages. Only records still queued at a power cut may be missing. Every
+ * LOG_Drain call must stay within one erase and six half-word programs. The stall check passed
+ * to LOG_Drain refuses one call in three: it must be asked with interrupts disabled, and a refused
+ * call must leave the flash alone. At the end the erase counts of the log pages are reported.
+ */
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "FLASH_interface.h"
+#include "SCB_interface.h"
+/*****************************< SERVICE *****************************/
+#include "LOG_interface.h"
+#include "LOG_config.h"
+#include "LOG_private.h"
+/*****************************< HOST *****************************/
+#include "emu_flash.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ENDURANCE_UNERASED_FILL     0xA5
+#define ENDURANCE_MAX_CUT_OPS       3000U
+#define ENDURANCE_MAX_BATCH         (LOG_QUEUE_SIZE + 4)    /**< Past the queue, so appends are refused too */
+#define ENDURANCE_DRAIN_PROGRAMS    6U      /**< Clear the old magic, then five header half-words */
+#define ENDURANCE_DRAIN_ERASES      1U
+#define ENDURANCE_DRAIN_CALLS       (4UL * LOG_QUEUE_SIZE)  /**< A full queue and a page opening, one call in three refused, with room to spare */
+
+/**< Records still readable however the last pages were torn: all pages but the head and the one after it */
+#define ENDURANCE_WINDOW            ((LOG_PAGE_COUNT - 2UL) * LOG_SLOTS_PER_PAGE)
+
+/*****************************< Private Variables *****************************/
+static jmp_buf Endurance_PowerFail;
+
+static u32 Endurance_Next = 1;              /**< Number of the next record to append */
+static u32 Endurance_Confirmed = 0;         /**< Highest number known to be in flash */
+static u8 *Endurance_Unsure = NULL;         /**< Bit per number: queued at a power cut, may be missing */
+static u32 Endurance_UnsureSize = 0;
+
+static u32 Endurance_MaxPrograms = 0;       /**< Worst LOG_Drain call */
+static u32 Endurance_MaxErases = 0;
+static u32 Endurance_Critical = 0;          /**< Nesting of SCB_EnterCritical */
+static u8 Endurance_Allowed = 0;            /**< Last answer of the stall check */
+static unsigned long Endurance_Failures = 0;
+/*****************************< Host MCAL *****************************/
+u32 SCB_EnterCritical(void)
+{
+    Endurance_Critical++;
+    return 0;
+}
+
+void SCB_ExitCritical(u32 Copy_PriMask)
+{
+    (void)Copy_PriMask;
+    Endurance_Critical--;
+}
+/*****************************< Private Functions *****************************/
+static void Endurance_Fail(const char *Copy_What, u32 Copy_Boot, u32 Copy_Number)
+{
+    if (Endurance_Failures++ < 10)
+    {
+        fprintf(stderr, "log_endurance: boot %lu: %s (record %lu)\n", (unsigned long)Copy_Boot, Copy_What,
+                (unsigned long)Copy_Number);
+    }
+}
+
+static void Endurance_PowerCut(void)
+{
+    longjmp(Endurance_PowerFail, 1);
+}
+
+static u8 Endurance_IsUnsure(u32 Copy_Number)
+{
+    return (Copy_Number < Endurance_UnsureSize) ? (u8)GET_BIT(Endurance_Unsure[Copy_Number / 8], Copy_Number % 8) : 0;
+}
+
+/**< Every field is derived from the record number, so any corruption shows */
+static void Endurance_Fields(u32 Copy_Number, LOG_Record_t *Copy_Record)
+{
+    Copy_Record->Time = Copy_Number;
+    Copy_Record->Id = (u8)(1 + (Copy_Number % 5));
+    Copy_Record->Arg = (u8)(Copy_Number >> 8);
+    Copy_Record->Value = (u16)(Copy_Number * 40503UL);
+}
+
+static void Endurance_Verify(u32 Copy_Boot)
+{
+    u32 Local_Cursor = 0;
+    u32 Local_Oldest = 0;
+    u32 Local_Newest = 0;
+    u32 Local_Number;
+    LOG_Record_t Local_Record;
+    LOG_Record_t Local_Expected;
+
+    while (LOG_Read(&Local_Cursor, &Local_Record) == E_OK)
+    {
+        Endurance_Fields(Local_Record.Time, &Local_Expected);
+        if ((Local_Record.Time == 0) || (Local_Record.Time >= Endurance_Next) ||
+            (Local_Record.Id != Local_Expected.Id) || (Local_Record.Arg != Local_Expected.Arg) ||
+            (Local_Record.Value != Local_Expected.Value))
+        {
+            Endurance_Fail("record read back corrupted", Copy_Boot, Local_Record.Time);
+            continue;
+        }
+        if (Local_Newest != 0)
+        {
+            if (Local_Record.Time <= Local_Newest)
+            {
+                Endurance_Fail("records out of order", Copy_Boot, Local_Record.Time);
+                continue;
+            }
+            for (Local_Number = Local_Newest + 1; Local_Number < Local_Record.Time; Local_Number++)
+            {
+                if (!Endurance_IsUnsure(Local_Number))
+                {
+                    Endurance_Fail("confirmed record missing", Copy_Boot, Local_Number);
+                    break;
+                }
+            }
+        }
+        else
+        {
+            Local_Oldest = Local_Record.Time;
+        }
+        Local_Newest = Local_Record.Time;
+    }
+
+    if (Local_Newest < Endurance_Confirmed)
+    {
+        Endurance_Fail("newest confirmed record missing", Copy_Boot, Endurance_Confirmed);
+    }
+    if ((Endurance_Confirmed > ENDURANCE_WINDOW) && (Local_Oldest > (Endurance_Confirmed - ENDURANCE_WINDOW)))
+    {
+        Endurance_Fail("log holds less history than its pages allow", Copy_Boot, Local_Oldest);
+    }
+}
+
+static u8 Endurance_MayStall(void)
+{
+    if (Endurance_Critical == 0)
+    {
+        Endurance_Fail("stall check asked with interrupts enabled", 0, Endurance_Next);
+    }
+    Endurance_Allowed = ((rand() % 3) != 0) ? 1 : 0;
+    return Endurance_Allowed;
+}
+
+static Std_ReturnType Endurance_Drain(u32 Copy_Boot)
+{
+    u32 Local_Programs;
+    u32 Local_Erases;
+    u32 Local_Calls;
+
+    for (Local_Calls = 0; !LOG_IsIdle(); Local_Calls++)
+    {
+        if (Local_Calls >= ENDURANCE_DRAIN_CALLS)
+        {
+            Endurance_Fail("LOG_Drain does not get the queue written", Copy_Boot, Endurance_Next);
+            return E_NOT_OK;
+        }
+        Local_Programs = EMU_FlashPrograms();
+        Local_Erases = EMU_FlashErases();
+        Endurance_Allowed = 1;
+        LOG_Drain(Endurance_MayStall);
+        Local_Programs = EMU_FlashPrograms() - Local_Programs;
+        Local_Erases = EMU_FlashErases() - Local_Erases;
+        if (!Endurance_Allowed && ((Local_Programs != 0) || (Local_Erases != 0)))
+        {
+            Endurance_Fail("LOG_Drain wrote the flash when the stall check refused", Copy_Boot, Endurance_Next);
+        }
+        if (Local_Programs > Endurance_MaxPrograms)
+        {
+            Endurance_MaxPrograms = Local_Programs;
+        }
+        if (Local_Erases > Endurance_MaxErases)
+        {
+            Endurance_MaxErases = Local_Erases;
+        }
+    }
+
+    return E_OK;
+}
+
+/**< Runs until the records are appended or the power fails; the state it keeps is what a reader could know */
+static void Endurance_Run(u32 Copy_Boot, u32 Copy_Records)
+{
+    LOG_Record_t Local_Record;
+    u32 Local_Appended = 0;
+    u32 Local_Batch;
+
+    while (Local_Appended < Copy_Records)
+    {
+        for (Local_Batch = 1U + (u32)rand() % ENDURANCE_MAX_BATCH; Local_Batch > 0; Local_Batch--)
+        {
+            Endurance_Fields(Endurance_Next, &Local_Record);
+            /**< A refused record is not in the log, so its number is used again */
+            if (LOG_Append(Local_Record.Id, Local_Record.Arg, Local_Record.Value, Local_Record.Time) == E_OK)
+            {
+                Endurance_Next++;
+                Local_Appended++;
+            }
+        }
+        if (Endurance_Drain(Copy_Boot) != E_OK)
+        {
+            return;
+        }
+        Endurance_Confirmed = Endurance_Next - 1;
+    }
+}
+/*****************************< Function Implementations *****************************/
+int main(int argc, char **argv)
+{
+    u32 Local_Boots = 3000;
+    u32 Local_Records = 2000;
+    unsigned long Local_Seed = 1UL;
+    volatile u32 Local_Boot;
+    volatile u32 Local_Cuts = 0;
+    u32 Local_Number;
+    u32 Local_Page;
+    u32 Local_MinErases = 0xFFFFFFFFUL;
+    u32 Local_MaxErases = 0;
+    int Local_Arg;
+
+    for (Local_Arg = 1; Local_Arg + 1 < argc; Local_Arg += 2)
+    {
+        if (!strcmp(argv[Local_Arg], "-b"))
+        {
+            Local_Boots = (u32)strtoul(argv[Local_Arg + 1], NULL, 0);
+        }
+        else if (!strcmp(argv[Local_Arg], "-r"))
+        {
+            Local_Records = (u32)strtoul(argv[Local_Arg + 1], NULL, 0);
+        }
+        else if (!strcmp(argv[Local_Arg], "-s"))
+        {
+            Local_Seed = strtoul(argv[Local_Arg + 1], NULL, 0);
+        }
+    }
+    srand((unsigned)Local_Seed);
+
+    Endurance_UnsureSize = Local_Boots * Local_Records + 1U;
+    Endurance_Unsure = calloc((Endurance_UnsureSize + 7U) / 8U, 1);
+    if (Endurance_Unsure == NULL)
+    {
+        perror("log_endurance");
+        return 1;
+    }
+
+    EMU_FlashInit(ENDURANCE_UNERASED_FILL, Endurance_PowerCut);
+
+    for (Local_Boot = 0; Local_Boot < Local_Boots; Local_Boot++)
+    {
+        if (LOG_Init() != E_OK)
+        {
+            Endurance_Fail("LOG_Init failed", Local_Boot, 0);
+        }
+        Endurance_Verify(Local_Boot);
+
+        if ((Local_Boot % 3) != 0)
+        {
+            EMU_FlashArmCut((u32)rand() % ENDURANCE_MAX_CUT_OPS);
+        }
+        if (setjmp(Endurance_PowerFail) == 0)
+        {
+            Endurance_Run(Local_Boot, Local_Records);
+        }
+        else
+        {
+            /**< Whatever was queued may or may not have made it */
+            for (Local_Number = Endurance_Confirmed + 1; Local_Number < Endurance_Next; Local_Number++)
+            {
+                SET_BIT(Endurance_Unsure[Local_Number / 8], Local_Number % 8);
+            }
+            Local_Cuts++;
+            /**< The cut lands inside LOG_Drain, and a reset clears the interrupt mask */
+            Endurance_Critical = 0;
+        }
+        EMU_FlashDisarmCut();
+    }
+
+    LOG_Init();
+    Endurance_Verify(Local_Boot);
+
+    if ((Endurance_MaxPrograms > ENDURANCE_DRAIN_PROGRAMS) || (Endurance_MaxErases > ENDURANCE_DRAIN_ERASES))
+    {
+        Endurance_Fail("a LOG_Drain call did more than one erase and six programs", Local_Boot, 0);
+    }
+    for (Local_Page = LOG_FIRST_PAGE; Local_Page < (LOG_FIRST_PAGE + LOG_PAGE_COUNT); Local_Page++)
+    {
+        if (EMU_FlashEraseCount(Local_Page) < Local_MinErases)
+        {
+            Local_MinErases = EMU_FlashEraseCount(Local_Page);
+        }
+        if (EMU_FlashEraseCount(Local_Page) > Local_MaxErases)
+        {
+            Local_MaxErases = EMU_FlashEraseCount(Local_Page);
+        }
+    }
+
+    printf("log_endurance: %lu boots (%lu cut by a power failure), seed %lu\n", (unsigned long)Local_Boots,
+           (unsigned long)Local_Cuts, Local_Seed);
+    printf("  %lu records appended, %lu programs, %lu erases, erases per log page %lu..%lu\n",
+           (unsigned long)(Endurance_Next - 1U), (unsigned long)EMU_FlashPrograms(), (unsigned long)EMU_FlashErases(),
+           (unsigned long)Local_MinErases, (unsigned long)Local_MaxErases);
+    printf("  worst LOG_Drain call: %lu erase, %lu programs\n", (unsigned long)Endurance_MaxErases,
+           (unsigned long)Endurance_MaxPrograms);
+    printf("  %lu failures, %lu flash errors\n", Endurance_Failures, (unsigned long)EMU_FlashErrors());
+    return ((Endurance_Failures == 0) && (EMU_FlashErrors() == 0)) ? 0 : 1;
+}
@@ -0,0 +1,430 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : replay_trace.c             *****************/
+/****************************************************************/
+
+/*
+ * Replays a trace recorded by TRACE on the target into the phase engine on the host.
+ *
+ *   replay_trace [-q] [-t run_ms] trace.bin       replay, print every signal change and a summary
+ *   replay_trace -g trace.bin [-n presses] [-s seed]   write a synthetic burst of button presses
+ *
+ * The trace is the raw TRACE encoding: the bytes of TRACE_GetBuffer read out with the debugger, or
+ * what a TRACE_SetSink sink received. TRACE_program.c, PHASE_program.c and PLAN_program.c run
+ * unmodified on a virtual microsecond clock. Each input event waits out its recorded delta, sets
+ * its pin to the recorded level and goes through TRACE_InjectEvent. The EXTI stub below runs the
+ * handler at once, and the handler makes the same engine calls as Inputs_Isr and Preempt_Isr in
+ * main.c. Ticks fall every PHASE_TICK_MS of virtual time from the start of the trace, and an edge
+ * at the same microsecond as a tick is taken first. Two builds fed the same trace therefore print
+ * the same timeline unless the engine changed, and `diff` shows the first phase that moved.
+ *
+ * The handler re-records every edge through TRACE into a streaming sink, and the replayer checks
+ * that the re-recorded input events match the source to the microsecond. The handler cost is
+ * measured in host nanoseconds, so it only compares builds against each other on this machine.
+ * Output changes and SysTick wraps in the trace are counted but not replayed. Detector and sync
+ * edges are not recorded by the firmware, so they do not appear.
+ */
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "EXTI_interface.h"
+#include "SCB_interface.h"
+/*****************************< APP *****************************/
+#include "TICK_interface.h"
+#include "TRACE_interface.h"
+#include "PHASE_interface.h"
+#include "PHASE_config.h"
+/*****************************< HOST *****************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**< Input lines as wired in main.c (Crossings[].button, Preempt_Pin) */
+#define REPLAY_PREEMPT_LINE     0
+static const u8 Replay_ButtonLines[] = { 4, 8 };
+
+#define REPLAY_TICK_US          (PHASE_TICK_MS * 1000ULL)
+
+/**< How long the engine runs on after the last edge unless -t says otherwise */
+#define REPLAY_RUN_ON_US        60000000ULL
+
+/*****************************< Private Variables *****************************/
+static unsigned long long Replay_TimeUs = 0;   /**< Absolute; TICK_GetTimeUs wraps like the target's */
+static u8 Replay_PinLevel[EXTI_LINE15 + 1];
+
+/**< Growable copy of what the handlers re-record */
+static u8 *Replay_Rerecorded = NULL;
+static u32 Replay_RerecordedLength = 0;
+static u32 Replay_RerecordedSize = 0;
+
+static unsigned long Replay_Handled = 0;
+static double Replay_HandlerNs = 0.0;
+static double Replay_HandlerMaxNs = 0.0;
+/*****************************< Host MCAL *****************************/
+u32 SCB_EnterCritical(void)
+{
+    return 0;
+}
+
+void SCB_ExitCritical(u32 Copy_PriMask)
+{
+    (void)Copy_PriMask;
+}
+
+u32 TICK_GetTimeUs(void)
+{
+    return (u32)Replay_TimeUs;
+}
+
+static void Replay_Isr(u8 Copy_Line);
+
+/**< The software interrupt register pends the line and the handler runs before the next instruction */
+Std_ReturnType EXTI_GenerateSoftwareInterrupt(u8 Copy_Line)
+{
+    if (Copy_Line > EXTI_LINE15)
+    {
+        return E_NOT_OK;
+    }
+    Replay_Isr(Copy_Line);
+    return E_OK;
+}
+/*****************************< Private Functions *****************************/
+static double Replay_NowNs(void)
+{
+    struct timespec Local_Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Local_Now);
+    return (double)Local_Now.tv_sec * 1e9 + (double)Local_Now.tv_nsec;
+}
+
+/**< The engine calls of Inputs_Isr and Preempt_Isr in main.c, for the lines that reach the trace */
+static void Replay_Isr(u8 Copy_Line)
+{
+    double Local_Start = Replay_NowNs();
+    u8 Local_Level = Replay_PinLevel[Copy_Line];
+    u8 Local_Index;
+
+    if (Copy_Line == REPLAY_PREEMPT_LINE)
+    {
+        TRACE_RecordInput(Copy_Line, Local_Level);
+        for (Local_Index = 0; Local_Index < PHASE_INTERSECTION_COUNT; Local_Index++)
+        {
+            PHASE_Preempt(Local_Index, Local_Level);
+        }
+    }
+    else
+    {
+        for (Local_Index = 0; Local_Index < PHASE_INTERSECTION_COUNT; Local_Index++)
+        {
+            if (Copy_Line == Replay_ButtonLines[Local_Index])
+            {
+                TRACE_RecordInput(Copy_Line, Local_Level);
+                PHASE_RequestPedestrian(Local_Index);
+            }
+        }
+    }
+
+    Local_Start = Replay_NowNs() - Local_Start;
+    Replay_HandlerNs += Local_Start;
+    if (Local_Start > Replay_HandlerMaxNs)
+    {
+        Replay_HandlerMaxNs = Local_Start;
+    }
+    Replay_Handled++;
+}
+
+static void Replay_Sink(const u8 *Copy_Data, u32 Copy_Length)
+{
+    if (Replay_RerecordedLength + Copy_Length > Replay_RerecordedSize)
+    {
+        Replay_RerecordedSize = 2U * (Replay_RerecordedLength + Copy_Length);
+        Replay_Rerecorded = realloc(Replay_Rerecorded, Replay_RerecordedSize);
+        if (Replay_Rerecorded == NULL)
+        {
+            perror("replay_trace");
+            exit(1);
+        }
+    }
+    memcpy(&Replay_Rerecorded[Replay_RerecordedLength], Copy_Data, Copy_Length);
+    Replay_RerecordedLength += Copy_Length;
+}
+
+static u8 *Replay_ReadFile(const char *Copy_Path, u32 *Copy_Length)
+{
+    FILE *Local_File = fopen(Copy_Path, "rb");
+    u8 *Local_Data = NULL;
+    long Local_Size;
+
+    if (Local_File == NULL)
+    {
+        perror(Copy_Path);
+        exit(1);
+    }
+    fseek(Local_File, 0, SEEK_END);
+    Local_Size = ftell(Local_File);
+    fseek(Local_File, 0, SEEK_SET);
+    Local_Data = malloc((Local_Size > 0) ? (size_t)Local_Size : 1U);
+    if ((Local_Data == NULL) || (fread(Local_Data, 1, (size_t)Local_Size, Local_File) != (size_t)Local_Size))
+    {
+        perror(Copy_Path);
+        exit(1);
+    }
+    fclose(Local_File);
+    *Copy_Length = (u32)Local_Size;
+    return Local_Data;
+}
+
+/**< Runs the ticks due before the given time and prints every signal change */
+static void Replay_RunUntil(unsigned long long Copy_TimeUs, unsigned long long *Copy_NextTickUs, u8 *Copy_Signals, u8 Copy_Quiet,
+                            unsigned long *Copy_Changes)
+{
+    u8 Local_Index;
+    u8 Local_Signals;
+
+    while (*Copy_NextTickUs < Copy_TimeUs)
+    {
+        Replay_TimeUs = *Copy_NextTickUs;
+        PHASE_Tick();
+        for (Local_Index = 0; Local_Index < PHASE_INTERSECTION_COUNT; Local_Index++)
+        {
+            Local_Signals = PHASE_GetSignals(Local_Index);
+            if (Local_Signals != Copy_Signals[Local_Index])
+            {
+                Copy_Signals[Local_Index] = Local_Signals;
+                (*Copy_Changes)++;
+                if (!Copy_Quiet)
+                {
+                    printf("%12.3f s  crossing %u  phase %u  signals 0x%02X\n", Replay_TimeUs / 1e6,
+                           Local_Index, PHASE_GetCurrentPhase(Local_Index), Local_Signals);
+                }
+            }
+        }
+        *Copy_NextTickUs += REPLAY_TICK_US;
+    }
+    Replay_TimeUs = Copy_TimeUs;
+}
+
+/**< Input events of two traces, on absolute time */
+static u8 Replay_SameInputs(const u8 *Copy_A, u32 Copy_LengthA, const u8 *Copy_B, u32 Copy_LengthB)
+{
+    u32 Local_OffsetA = 0;
+    u32 Local_OffsetB = 0;
+    u32 Local_TimeA = 0;
+    u32 Local_TimeB = 0;
+    TRACE_Event_t Local_A;
+    TRACE_Event_t Local_B;
+
+    while (1)
+    {
+        do
+        {
+            if (TRACE_DecodeEvent(Copy_A, Copy_LengthA, &Local_OffsetA, &Local_A) != E_OK)
+            {
+                Local_A.Kind = 0xFF;
+                break;
+            }
+            Local_TimeA += Local_A.DeltaUs;
+        } while (Local_A.Kind != TRACE_KIND_INPUT);
+        do
+        {
+            if (TRACE_DecodeEvent(Copy_B, Copy_LengthB, &Local_OffsetB, &Local_B) != E_OK)
+            {
+                Local_B.Kind = 0xFF;
+                break;
+            }
+            Local_TimeB += Local_B.DeltaUs;
+        } while (Local_B.Kind != TRACE_KIND_INPUT);
+
+        if ((Local_A.Kind == 0xFF) || (Local_B.Kind == 0xFF))
+        {
+            return (Local_A.Kind == Local_B.Kind) ? 1 : 0;
+        }
+        if ((Local_TimeA != Local_TimeB) || (Local_A.Source != Local_B.Source) || (Local_A.Value != Local_B.Value))
+        {
+            return 0;
+        }
+    }
+}
+
+static int Replay_Run(const char *Copy_Path, u32 Copy_RunMs, u8 Copy_Quiet)
+{
+    u32 Local_Length;
+    u8 *Local_Trace = Replay_ReadFile(Copy_Path, &Local_Length);
+    u32 Local_Offset = 0;
+    unsigned long long Local_TimeUs = 0;
+    unsigned long long Local_NextTickUs = REPLAY_TICK_US;
+    u8 Local_Signals[PHASE_INTERSECTION_COUNT];
+    u16 Local_Bins[PHASE_PED_WAIT_BINS];
+    unsigned long Local_Inputs = 0;
+    unsigned long Local_Other = 0;
+    unsigned long Local_Changes = 0;
+    unsigned long Local_Served;
+    TRACE_Event_t Local_Event;
+    u8 Local_Index;
+    u8 Local_Bin;
+    u8 Local_Same;
+
+    Replay_TimeUs = 0;
+    PHASE_Init();
+    TRACE_Init();
+    TRACE_SetSink(Replay_Sink);
+    for (Local_Index = 0; Local_Index < PHASE_INTERSECTION_COUNT; Local_Index++)
+    {
+        Local_Signals[Local_Index] = PHASE_GetSignals(Local_Index);
+    }
+
+    while (TRACE_DecodeEvent(Local_Trace, Local_Length, &Local_Offset, &Local_Event) == E_OK)
+    {
+        Local_TimeUs += Local_Event.DeltaUs;
+        if (Local_Event.Kind != TRACE_KIND_INPUT)
+        {
+            Local_Other++;
+            continue;
+        }
+        /**< The handler sees the edge before a tick due at the same microsecond */
+        Replay_RunUntil(Local_TimeUs, &Local_NextTickUs, Local_Signals, Copy_Quiet, &Local_Changes);
+        Replay_TimeUs = Local_TimeUs;
+        Replay_PinLevel[Local_Event.Source] = (u8)Local_Event.Value;
+        if (!Copy_Quiet)
+        {
+            printf("%12.3f s  line %u -> %u\n", Local_TimeUs / 1e6, Local_Event.Source, Local_Event.Value);
+        }
+        (void)TRACE_InjectEvent(&Local_Event);
+        (void)TRACE_Flush();
+        Local_Inputs++;
+    }
+    if (Local_Offset != Local_Length)
+    {
+        fprintf(stderr, "%s: truncated event at byte %lu of %lu\n", Copy_Path, (unsigned long)Local_Offset, (unsigned long)Local_Length);
+    }
+
+    /**< Run on until the last request has been served, or for the requested time */
+    Replay_RunUntil((Copy_RunMs != 0U) ? (Copy_RunMs * 1000ULL) : (Local_TimeUs + REPLAY_RUN_ON_US),
+                    &Local_NextTickUs, Local_Signals, Copy_Quiet, &Local_Changes);
+    (void)TRACE_Flush();
+    Local_Same = Replay_SameInputs(Local_Trace, Local_Offset, Replay_Rerecorded, Replay_RerecordedLength);
+
+    printf("%s: %lu input events replayed, %lu other events skipped, %.3f s of trace\n",
+           Copy_Path, Local_Inputs, Local_Other, Local_TimeUs / 1e6);
+    printf("signal changes: %lu up to %.3f s\n", Local_Changes, Replay_TimeUs / 1e6);
+    for (Local_Index = 0; Local_Index < PHASE_INTERSECTION_COUNT; Local_Index++)
+    {
+        (void)PHASE_GetPedWaitHistogram(Local_Index, Local_Bins);
+        Local_Served = 0;
+        printf("crossing %u press-to-walk (%u ms bins):", Local_Index, (unsigned)PHASE_PED_WAIT_BIN_MS);
+        for (Local_Bin = 0; Local_Bin < PHASE_PED_WAIT_BINS; Local_Bin++)
+        {
+            printf(" %u", Local_Bins[Local_Bin]);
+            Local_Served += Local_Bins[Local_Bin];
+        }
+        printf("  (%lu served)\n", Local_Served);
+    }
+    printf("handler cost: %.0f ns mean, %.0f ns max over %lu edges (host time)\n",
+           Replay_Handled ? (Replay_HandlerNs / Replay_Handled) : 0.0, Replay_HandlerMaxNs, Replay_Handled);
+    printf("re-recorded inputs %s the source trace\n", Local_Same ? "match" : "DIFFER FROM");
+
+    free(Local_Trace);
+    return Local_Same ? 0 : 1;
+}
+
+/**< Presses in bursts of 1 .. 8 a few hundred ms apart, bursts seconds to minutes apart, now and then a preemption */
+static int Replay_Generate(const char *Copy_Path, unsigned long Copy_Presses, unsigned long Copy_Seed)
+{
+    FILE *Local_File = fopen(Copy_Path, "wb");
+    unsigned long Local_Press = 0;
+    u8 Local_Burst;
+    u8 Local_Crossing;
+
+    if (Local_File == NULL)
+    {
+        perror(Copy_Path);
+        return 1;
+    }
+    srand((unsigned)Copy_Seed);
+    Replay_TimeUs = 0;
+    TRACE_Init();
+    TRACE_SetSink(Replay_Sink);
+
+    while (Local_Press < Copy_Presses)
+    {
+        Replay_TimeUs += 2000000UL + ((u32)rand() % 120000000UL);
+        if ((rand() % 16) == 0)
+        {
+            (void)TRACE_RecordInput(REPLAY_PREEMPT_LINE, 1);
+            Replay_TimeUs += 5000000UL + ((u32)rand() % 40000000UL);
+            (void)TRACE_RecordInput(REPLAY_PREEMPT_LINE, 0);
+            Replay_TimeUs += (u32)rand() % 1000000UL;
+        }
+        Local_Crossing = (u8)((u32)rand() % PHASE_INTERSECTION_COUNT);
+        for (Local_Burst = (u8)(1 + rand() % 8); Local_Burst && (Local_Press < Copy_Presses); Local_Burst--)
+        {
+            (void)TRACE_RecordInput(Replay_ButtonLines[Local_Crossing], 1);
+            Replay_TimeUs += 30000UL + ((u32)rand() % 400000UL);
+            Local_Press++;
+        }
+        (void)TRACE_Flush();
+    }
+
+    fwrite(Replay_Rerecorded, 1, Replay_RerecordedLength, Local_File);
+    fclose(Local_File);
+    printf("%s: %lu presses over %.3f s, %lu bytes\n", Copy_Path, Copy_Presses, Replay_TimeUs / 1e6,
+           (unsigned long)Replay_RerecordedLength);
+    return 0;
+}
+
+/*****************************< Function Implementations *****************************/
+int main(int argc, char **argv)
+{
+    const char *Local_Path = NULL;
+    const char *Local_Generate = NULL;
+    unsigned long Local_Presses = 200UL;
+    unsigned long Local_Seed = 1UL;
+    u32 Local_RunMs = 0;
+    u8 Local_Quiet = 0;
+    int Local_Arg;
+
+    for (Local_Arg = 1; Local_Arg < argc; Local_Arg++)
+    {
+        if (!strcmp(argv[Local_Arg], "-q"))
+        {
+            Local_Quiet = 1;
+        }
+        else if (!strcmp(argv[Local_Arg], "-g") && (Local_Arg + 1 < argc))
+        {
+            Local_Generate = argv[++Local_Arg];
+        }
+        else if (!strcmp(argv[Local_Arg], "-n") && (Local_Arg + 1 < argc))
+        {
+            Local_Presses = strtoul(argv[++Local_Arg], NULL, 0);
+        }
+        else if (!strcmp(argv[Local_Arg], "-s") && (Local_Arg + 1 < argc))
+        {
+            Local_Seed = strtoul(argv[++Local_Arg], NULL, 0);
+        }
+        else if (!strcmp(argv[Local_Arg], "-t") && (Local_Arg + 1 < argc))
+        {
+            Local_RunMs = (u32)strtoul(argv[++Local_Arg], NULL, 0);
+        }
+        else
+        {
+            Local_Path = argv[Local_Arg];
+        }
+    }
+
+    if (Local_Generate != NULL)
+    {
+        return Replay_Generate(Local_Generate, Local_Presses, Local_Seed);
+    }
+    if (Local_Path == NULL)
+    {
+        fprintf(stderr, "usage: replay_trace [-q] [-t run_ms] trace.bin\n"
+                        "       replay_trace -g trace.bin [-n presses] [-s seed]\n");
+        return 2;
+    }
+    return Replay_Run(Local_Path, Local_RunMs, Local_Quiet);
+}
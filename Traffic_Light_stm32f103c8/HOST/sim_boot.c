@@ -0,0 +1,629 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : sim_boot.c                 *****************/
+/****************************************************************/
+
+/*
+ * Boot timeline from the reset vector to the configured clock, on an emulated RCC and GPIO.
+ *
+ *   sim_boot [-x us] [-v]
+ *
+ * RCC_Programme.c and GPIO_Proggramm.c are compiled unmodified, except that the Makefile has
+ * their register macros call Boot_Register, so every access goes through the model. The model
+ * keeps the time: each access costs BOOT_CYCLES_PER_ACCESS cycles of the HCLK running then. HSI
+ * runs from reset, the PLL locks in its datasheet maximum, and the 8 MHz crystal starts after
+ * 1 ms by default or -x us (the datasheet gives 2 ms typical; at that the HSE_STARTUP_TIMEOUT of
+ * SetSysClockTo72 runs out first). Code that touches no register is not timed, and the power-on
+ * reset temporization before the reset vector is not included.
+ *
+ * Two reset paths are run, each with a good and with a dead crystal:
+ *   previous  SystemInit at SYSCLK_FREQ_72MHz (SetSysClockTo72 of the CMSIS startup, as it was
+ *             before the single bring-up), then main as it was: MCAL_RCC_InitSysClock with an
+ *             unbounded wait for HSE, then the pin modes of the heads, left dark
+ *   current   SystemInit without a clock change, then main up to the clock bring-up: the safe
+ *             image latched and the heads made outputs from HSI, the boot marker on PC13, then
+ *             MCAL_RCC_InitSysClock per RCC_config.h
+ * Both are transcriptions of the code they name and must follow it.
+ *
+ * For each run the table gives the times at which every red lamp pin is an output (heads
+ * driven), every red lamp is lit, the boot marker goes high, and the clock of RCC_config.h (or
+ * the fallback) runs, and the HCLK reached. A run still going after BOOT_LIMIT_MS hangs. The
+ * current path fails when it lights the reds only after touching the clock, when any green
+ * lamp lights, or when it does not finish on the dead crystal.
+ */
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "RCC_interface.h"
+#include "GPIO_Interface.h"
+/*****************************< APP *****************************/
+#include "PHASE_config.h"
+#include "SAFETY_interface.h"
+/*****************************< HOST *****************************/
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BOOT_CYCLES_PER_ACCESS  4           /**< Load or store on the bus with the instructions around it */
+#define BOOT_CMSIS_POLL_CYCLES  8           /**< Volatile counter and status of the SetSysClockTo72 loop */
+#define BOOT_HSE_START_US       1000        /**< Crystal start-up by default */
+#define BOOT_PLL_LOCK_NS        200000.0    /**< tLOCK, 200 us max */
+#define BOOT_LIMIT_MS           1000.0
+#define BOOT_NEVER              (-1.0)
+#define BOOT_HSI_FREQ           8000000.0
+#define BOOT_HSE_FREQ           8000000.0
+
+/**< RCC and FLASH registers used in the boot, with their bits */
+#define BOOT_RCC_CR             0x40021000U
+#define BOOT_RCC_CFGR           0x40021004U
+#define BOOT_RCC_CIR            0x40021008U
+#define BOOT_RCC_APB2ENR        0x40021018U
+#define BOOT_FLASH_ACR          0x40022000U
+#define BOOT_CR_HSION           0x00000001U
+#define BOOT_CR_HSIRDY          0x00000002U
+#define BOOT_CR_HSEON           0x00010000U
+#define BOOT_CR_HSERDY          0x00020000U
+#define BOOT_CR_HSEBYP          0x00040000U
+#define BOOT_CR_PLLON           0x01000000U
+#define BOOT_CR_PLLRDY          0x02000000U
+#define BOOT_CR_RESET           0x00000083U /**< HSION, HSIRDY and the HSITRIM default */
+#define BOOT_CFGR_SW            0x00000003U
+#define BOOT_CFGR_SWS           0x0000000CU
+#define BOOT_CFGR_SWS_SHIFT     2
+#define BOOT_CFGR_HPRE_SHIFT    4
+#define BOOT_CFGR_PLLSRC        0x00010000U
+#define BOOT_CFGR_PLLXTPRE      0x00020000U
+#define BOOT_CFGR_PLLMUL_SHIFT  18
+#define BOOT_SW_HSI             0
+#define BOOT_SW_HSE             1
+#define BOOT_SW_PLL             2
+
+/**< GPIO ports A..C: CRL, CRH, IDR, ODR, BSRR, BRR, LCKR */
+#define BOOT_GPIO_BASE          0x40010800U
+#define BOOT_GPIO_STRIDE        0x400U
+#define BOOT_GPIO_PORTS         3
+#define BOOT_GPIO_REGS          7
+#define BOOT_GPIO_CR_RESET      0x44444444U /**< Every pin a floating input */
+#define BOOT_GPIO_ODR           3
+#define BOOT_GPIO_BSRR          4
+#define BOOT_GPIO_BRR           5
+
+#define BOOT_MARKER_PIN         13          /**< PC13, main.c */
+
+/**< Registers of the model outside the GPIO ports */
+typedef enum
+{
+    BOOT_REG_CR,
+    BOOT_REG_CFGR,
+    BOOT_REG_CIR,
+    BOOT_REG_APB2ENR,
+    BOOT_REG_ACR,
+    BOOT_REG_COUNT
+} Boot_Reg_t;
+
+/**< Time an oscillator gets ready, BOOT_NEVER while off */
+typedef struct
+{
+    double HseReadyNs;
+    double PllReadyNs;
+} Boot_Clocks_t;
+
+/**< Moments of one boot, BOOT_NEVER when not reached */
+typedef struct
+{
+    double HeadsNs;         /**< Every red lamp pin an output */
+    double RedsNs;          /**< Every red lamp lit */
+    double MarkerNs;        /**< PC13 high and an output */
+    double ClockNs;         /**< MCAL_RCC_InitSysClock returned */
+    double Hclk;
+    u8 GreenLit;
+    u8 Hung;
+    u8 ClockTouched;        /**< The reset path has written the clock tree */
+    double RedsBeforeClock; /**< Reds lit before that, BOOT_NEVER otherwise */
+} Boot_Result_t;
+
+/*****************************< Private Variables *****************************/
+static u32 Boot_Rcc[BOOT_REG_COUNT];
+static u32 Boot_RccOther[16];          /**< Any other RCC register: reads back what was stored */
+static u32 Boot_Gpio[BOOT_GPIO_PORTS][BOOT_GPIO_REGS];
+static Boot_Clocks_t Boot_Clocks;
+static double Boot_Ns = 0;
+static double Boot_Sysclk = BOOT_HSI_FREQ;
+static u32 Boot_SeenCr = 0;             /**< CR as the model last settled it */
+static u32 Boot_SeenCfgr = 0;
+static u8 Boot_DeadCrystal = 0;
+static double Boot_HseStartNs = BOOT_HSE_START_US * 1e3;
+static u8 Boot_Verbose = 0;
+static Boot_Result_t *Boot_Now = NULL;
+static jmp_buf Boot_Hang;
+
+/**< Red and green lamp pins of the heads, from main.c: PORTA is the pedestrian head, PORTB the car head */
+static u16 Boot_RedPins[BOOT_GPIO_PORTS];
+static u16 Boot_GreenPins[BOOT_GPIO_PORTS];
+static u16 Boot_HeadPins[BOOT_GPIO_PORTS];
+/*****************************< Private Functions *****************************/
+static double Boot_Hclk(void)
+{
+    u32 Local_Hpre = (Boot_Rcc[BOOT_REG_CFGR] >> BOOT_CFGR_HPRE_SHIFT) & 0xFU;
+    static const u16 Local_Dividers[8] = { 2, 4, 8, 16, 64, 128, 256, 512 };
+
+    return (Local_Hpre < 8) ? Boot_Sysclk : (Boot_Sysclk / Local_Dividers[Local_Hpre - 8]);
+}
+
+static double Boot_PllFreq(void)
+{
+    u32 Local_Cfgr = Boot_Rcc[BOOT_REG_CFGR];
+    u32 Local_Mul = ((Local_Cfgr >> BOOT_CFGR_PLLMUL_SHIFT) & 0xFU) + 2;
+    double Local_Input;
+
+    if (Local_Cfgr & BOOT_CFGR_PLLSRC)
+    {
+        Local_Input = (Local_Cfgr & BOOT_CFGR_PLLXTPRE) ? (BOOT_HSE_FREQ / 2) : BOOT_HSE_FREQ;
+    }
+    else
+    {
+        Local_Input = BOOT_HSI_FREQ / 2;
+    }
+
+    return Local_Input * ((Local_Mul > 16) ? 16 : Local_Mul);
+}
+
+static u8 Boot_PinsAre(u8 Copy_Port, u16 Copy_Pins, u8 Copy_Output, u8 Copy_Lit)
+{
+    u8 Local_Pin;
+    u32 Local_Mode;
+
+    for (Local_Pin = 0; Local_Pin < 16; Local_Pin++)
+    {
+        if (!(Copy_Pins & (1U << Local_Pin)))
+        {
+            continue;
+        }
+        Local_Mode = (Boot_Gpio[Copy_Port][Local_Pin / 8] >> ((Local_Pin % 8) * 4)) & 0x3U;
+        if (Copy_Output && (Local_Mode == 0))
+        {
+            return 0;
+        }
+        if (Copy_Lit && ((Local_Mode == 0) || !(Boot_Gpio[Copy_Port][BOOT_GPIO_ODR] & (1U << Local_Pin))))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**< Applies what the driver stored since the last access, then moves the oscillators on to the current time */
+static void Boot_Settle(void)
+{
+    u32 Local_Cr = Boot_Rcc[BOOT_REG_CR];
+    u32 Local_Cfgr = Boot_Rcc[BOOT_REG_CFGR];
+    u8 Local_Port;
+    u32 Local_Source;
+    u8 Local_Ready;
+    u8 Local_Red = 1;
+    u8 Local_Heads = 1;
+    u16 Local_Lit;
+
+    /**< Ready flags are read-only: what was stored is replaced by the oscillator state */
+    Local_Cr &= ~(BOOT_CR_HSIRDY | BOOT_CR_HSERDY | BOOT_CR_PLLRDY);
+
+    if ((Local_Cr & BOOT_CR_HSEON) && !(Boot_SeenCr & BOOT_CR_HSEON))
+    {
+        Boot_Clocks.HseReadyNs = Boot_DeadCrystal ? BOOT_NEVER : (Boot_Ns + Boot_HseStartNs);
+    }
+    else if (!(Local_Cr & BOOT_CR_HSEON))
+    {
+        Boot_Clocks.HseReadyNs = BOOT_NEVER;
+    }
+
+    /**< The PLL locks once its input runs */
+    if (!(Local_Cr & BOOT_CR_PLLON))
+    {
+        Boot_Clocks.PllReadyNs = BOOT_NEVER;
+    }
+    else if (Boot_Clocks.PllReadyNs == BOOT_NEVER)
+    {
+        if (!(Local_Cfgr & BOOT_CFGR_PLLSRC))
+        {
+            Boot_Clocks.PllReadyNs = Boot_Ns + BOOT_PLL_LOCK_NS;
+        }
+        else if ((Boot_Clocks.HseReadyNs != BOOT_NEVER) && (Boot_Clocks.HseReadyNs <= Boot_Ns))
+        {
+            Boot_Clocks.PllReadyNs = Boot_Ns + BOOT_PLL_LOCK_NS;
+        }
+    }
+
+    Local_Cr |= BOOT_CR_HSIRDY;
+    if ((Boot_Clocks.HseReadyNs != BOOT_NEVER) && (Boot_Clocks.HseReadyNs <= Boot_Ns))
+    {
+        Local_Cr |= BOOT_CR_HSERDY;
+    }
+    if ((Boot_Clocks.PllReadyNs != BOOT_NEVER) && (Boot_Clocks.PllReadyNs <= Boot_Ns))
+    {
+        Local_Cr |= BOOT_CR_PLLRDY;
+    }
+    Boot_Rcc[BOOT_REG_CR] = Local_Cr;
+
+    /**< The switch takes effect once the selected source is ready; SWS shows the source running */
+    Local_Source = Local_Cfgr & BOOT_CFGR_SW;
+    Local_Ready = (Local_Source == BOOT_SW_HSI) ||
+                  ((Local_Source == BOOT_SW_HSE) && (Local_Cr & BOOT_CR_HSERDY)) ||
+                  ((Local_Source == BOOT_SW_PLL) && (Local_Cr & BOOT_CR_PLLRDY));
+    if (!Local_Ready)
+    {
+        Local_Source = (Local_Cfgr & BOOT_CFGR_SWS) >> BOOT_CFGR_SWS_SHIFT;
+    }
+    Boot_Sysclk = (Local_Source == BOOT_SW_PLL) ? Boot_PllFreq() : ((Local_Source == BOOT_SW_HSE) ? BOOT_HSE_FREQ : BOOT_HSI_FREQ);
+    Boot_Rcc[BOOT_REG_CFGR] = (Local_Cfgr & ~BOOT_CFGR_SWS) | (Local_Source << BOOT_CFGR_SWS_SHIFT);
+
+    if (((Local_Cr ^ Boot_SeenCr) & ~(BOOT_CR_HSIRDY | BOOT_CR_HSERDY | BOOT_CR_PLLRDY)) ||
+        ((Boot_Rcc[BOOT_REG_CFGR] ^ Boot_SeenCfgr) & ~BOOT_CFGR_SWS))
+    {
+        Boot_Now->ClockTouched = 1;
+    }
+    Boot_SeenCr = Local_Cr;
+    Boot_SeenCfgr = Boot_Rcc[BOOT_REG_CFGR];
+
+    /**< BSRR and BRR act on ODR and read back zero; a port without its clock ignores writes */
+    for (Local_Port = 0; Local_Port < BOOT_GPIO_PORTS; Local_Port++)
+    {
+        if (!(Boot_Rcc[BOOT_REG_APB2ENR] & (1U << (RCC_APB2ENR_IOPAEN + Local_Port))))
+        {
+            Boot_Gpio[Local_Port][0] = BOOT_GPIO_CR_RESET;
+            Boot_Gpio[Local_Port][1] = BOOT_GPIO_CR_RESET;
+            Boot_Gpio[Local_Port][BOOT_GPIO_ODR] = 0;
+        }
+        Boot_Gpio[Local_Port][BOOT_GPIO_ODR] |= Boot_Gpio[Local_Port][BOOT_GPIO_BSRR] & 0xFFFFU;
+        Boot_Gpio[Local_Port][BOOT_GPIO_ODR] &= ~((Boot_Gpio[Local_Port][BOOT_GPIO_BSRR] >> 16) |
+                                                  Boot_Gpio[Local_Port][BOOT_GPIO_BRR]);
+        Boot_Gpio[Local_Port][BOOT_GPIO_ODR] &= 0xFFFFU;
+        Boot_Gpio[Local_Port][BOOT_GPIO_BSRR] = 0;
+        Boot_Gpio[Local_Port][BOOT_GPIO_BRR] = 0;
+
+        Local_Heads &= Boot_PinsAre(Local_Port, Boot_RedPins[Local_Port], 1, 0);
+        Local_Red &= Boot_PinsAre(Local_Port, Boot_RedPins[Local_Port], 1, 1);
+        for (Local_Lit = 0; Local_Lit < 16; Local_Lit++)
+        {
+            if ((Boot_GreenPins[Local_Port] & (1U << Local_Lit)) &&
+                Boot_PinsAre(Local_Port, (u16)(1U << Local_Lit), 1, 1))
+            {
+                Boot_Now->GreenLit = 1;
+            }
+        }
+    }
+
+    if (Local_Heads && (Boot_Now->HeadsNs == BOOT_NEVER))
+    {
+        Boot_Now->HeadsNs = Boot_Ns;
+    }
+    if (Local_Red && (Boot_Now->RedsNs == BOOT_NEVER))
+    {
+        Boot_Now->RedsNs = Boot_Ns;
+        if (!Boot_Now->ClockTouched)
+        {
+            Boot_Now->RedsBeforeClock = Boot_Ns;
+        }
+    }
+    if (Boot_PinsAre(2, (u16)(1U << BOOT_MARKER_PIN), 1, 1) && (Boot_Now->MarkerNs == BOOT_NEVER))
+    {
+        Boot_Now->MarkerNs = Boot_Ns;
+    }
+}
+
+static void Boot_Spend(u32 Copy_Cycles)
+{
+    Boot_Ns += (Copy_Cycles * 1e9) / Boot_Hclk();
+    if (Boot_Ns > (BOOT_LIMIT_MS * 1e6))
+    {
+        longjmp(Boot_Hang, 1);
+    }
+}
+/*****************************< Host MCAL *****************************/
+/**< Every register access of the drivers: settles what the last one stored, spends its cycles, returns the register */
+volatile u32 *Boot_Register(u32 Copy_Address)
+{
+    u32 Local_Port;
+
+    Boot_Settle();
+    Boot_Spend(BOOT_CYCLES_PER_ACCESS);
+    Boot_Settle();
+
+    switch (Copy_Address)
+    {
+    case BOOT_RCC_CR:
+        return &Boot_Rcc[BOOT_REG_CR];
+    case BOOT_RCC_CFGR:
+        return &Boot_Rcc[BOOT_REG_CFGR];
+    case BOOT_RCC_CIR:
+        return &Boot_Rcc[BOOT_REG_CIR];
+    case BOOT_RCC_APB2ENR:
+        return &Boot_Rcc[BOOT_REG_APB2ENR];
+    case BOOT_FLASH_ACR:
+        return &Boot_Rcc[BOOT_REG_ACR];
+    default:
+        break;
+    }
+
+    if ((Copy_Address >= BOOT_RCC_CR) && (Copy_Address < (BOOT_RCC_CR + (sizeof(Boot_RccOther) / sizeof(u32)) * 4)))
+    {
+        return &Boot_RccOther[(Copy_Address - BOOT_RCC_CR) / 4];
+    }
+
+    Local_Port = (Copy_Address - BOOT_GPIO_BASE) / BOOT_GPIO_STRIDE;
+    if ((Copy_Address >= BOOT_GPIO_BASE) && (Local_Port < BOOT_GPIO_PORTS) &&
+        (((Copy_Address - BOOT_GPIO_BASE) % BOOT_GPIO_STRIDE) < (BOOT_GPIO_REGS * 4)))
+    {
+        return &Boot_Gpio[Local_Port][((Copy_Address - BOOT_GPIO_BASE) % BOOT_GPIO_STRIDE) / 4];
+    }
+
+    fprintf(stderr, "sim_boot: access to 0x%08X outside the model\n", (unsigned)Copy_Address);
+    exit(1);
+}
+
+#define BOOT_REG(ADDRESS)   (*Boot_Register(ADDRESS))
+/*****************************< Private Functions *****************************/
+static void Boot_Reset(u8 Copy_DeadCrystal, Boot_Result_t *Copy_Result)
+{
+    u8 Local_Port;
+
+    memset(Boot_Rcc, 0, sizeof(Boot_Rcc));
+    memset(Boot_RccOther, 0, sizeof(Boot_RccOther));
+    memset(Boot_Gpio, 0, sizeof(Boot_Gpio));
+    for (Local_Port = 0; Local_Port < BOOT_GPIO_PORTS; Local_Port++)
+    {
+        Boot_Gpio[Local_Port][0] = BOOT_GPIO_CR_RESET;
+        Boot_Gpio[Local_Port][1] = BOOT_GPIO_CR_RESET;
+    }
+    Boot_Rcc[BOOT_REG_CR] = BOOT_CR_RESET;
+    Boot_Rcc[BOOT_REG_ACR] = 0x30U;
+    Boot_Clocks.HseReadyNs = BOOT_NEVER;
+    Boot_Clocks.PllReadyNs = BOOT_NEVER;
+    Boot_Ns = 0;
+    Boot_Sysclk = BOOT_HSI_FREQ;
+    Boot_SeenCr = BOOT_CR_RESET;
+    Boot_SeenCfgr = 0;
+    Boot_DeadCrystal = Copy_DeadCrystal;
+
+    memset(Copy_Result, 0, sizeof(*Copy_Result));
+    Copy_Result->HeadsNs = BOOT_NEVER;
+    Copy_Result->RedsNs = BOOT_NEVER;
+    Copy_Result->MarkerNs = BOOT_NEVER;
+    Copy_Result->ClockNs = BOOT_NEVER;
+    Copy_Result->RedsBeforeClock = BOOT_NEVER;
+    Boot_Now = Copy_Result;
+}
+
+/**< SystemInit of system_stm32f10x.c up to SetSysClock: back to the reset clock configuration */
+static void Boot_SystemInitReset(void)
+{
+    BOOT_REG(BOOT_RCC_CR) |= 0x00000001U;
+    BOOT_REG(BOOT_RCC_CFGR) &= 0xF8FF0000U;
+    BOOT_REG(BOOT_RCC_CR) &= 0xFEF6FFFFU;
+    BOOT_REG(BOOT_RCC_CR) &= 0xFFFBFFFFU;
+    BOOT_REG(BOOT_RCC_CFGR) &= 0xFF80FFFFU;
+    BOOT_REG(BOOT_RCC_CIR) = 0x009F0000U;
+    Boot_SeenCr = Boot_Rcc[BOOT_REG_CR];
+    Boot_SeenCfgr = Boot_Rcc[BOOT_REG_CFGR];
+    Boot_Now->ClockTouched = 0;
+}
+
+/**< SetSysClockTo72 of system_stm32f10x.c, HSE_STARTUP_TIMEOUT 0x0500 */
+static void Boot_SetSysClockTo72(void)
+{
+    u32 Local_Polls = 0;
+    u32 Local_Ready;
+
+    BOOT_REG(BOOT_RCC_CR) |= BOOT_CR_HSEON;
+    do
+    {
+        Local_Ready = BOOT_REG(BOOT_RCC_CR) & BOOT_CR_HSERDY;
+        Boot_Spend(BOOT_CMSIS_POLL_CYCLES);
+        Local_Polls++;
+    } while ((Local_Ready == 0) && (Local_Polls != 0x0500U));
+
+    if (!(BOOT_REG(BOOT_RCC_CR) & BOOT_CR_HSERDY))
+    {
+        return;
+    }
+
+    BOOT_REG(BOOT_FLASH_ACR) |= 0x10U;
+    BOOT_REG(BOOT_FLASH_ACR) &= ~0x3U;
+    BOOT_REG(BOOT_FLASH_ACR) |= 0x2U;
+    BOOT_REG(BOOT_RCC_CFGR) |= 0x00000000U;
+    BOOT_REG(BOOT_RCC_CFGR) |= 0x00000000U;
+    BOOT_REG(BOOT_RCC_CFGR) |= 0x00000400U;
+    BOOT_REG(BOOT_RCC_CFGR) &= ~(BOOT_CFGR_PLLSRC | BOOT_CFGR_PLLXTPRE | (0xFU << BOOT_CFGR_PLLMUL_SHIFT));
+    BOOT_REG(BOOT_RCC_CFGR) |= BOOT_CFGR_PLLSRC | (0x7U << BOOT_CFGR_PLLMUL_SHIFT);
+    BOOT_REG(BOOT_RCC_CR) |= BOOT_CR_PLLON;
+    while (!(BOOT_REG(BOOT_RCC_CR) & BOOT_CR_PLLRDY))
+    {
+    }
+    BOOT_REG(BOOT_RCC_CFGR) &= ~BOOT_CFGR_SW;
+    BOOT_REG(BOOT_RCC_CFGR) |= BOOT_SW_PLL;
+    while ((BOOT_REG(BOOT_RCC_CFGR) & BOOT_CFGR_SWS) != (BOOT_SW_PLL << BOOT_CFGR_SWS_SHIFT))
+    {
+    }
+}
+
+/**< The reset path before the single bring-up: 72 MHz in SystemInit, then main switching to HSE and making the heads outputs */
+static void Boot_Previous(void)
+{
+    Boot_SystemInitReset();
+    Boot_SetSysClockTo72();
+
+    /**< MCAL_RCC_InitSysClock for RCC_HSE as it was: no timeout, CFGR written whole */
+    BOOT_REG(BOOT_RCC_CR) &= ~BOOT_CR_HSEBYP;
+    BOOT_REG(BOOT_RCC_CR) |= BOOT_CR_HSEON;
+    while (!(BOOT_REG(BOOT_RCC_CR) & BOOT_CR_HSERDY))
+    {
+    }
+    BOOT_REG(BOOT_RCC_CFGR) = 0x00000001U;
+    Boot_Settle();
+    Boot_Now->ClockNs = Boot_Ns;
+    Boot_Now->Hclk = Boot_Hclk();
+
+    (void)MCAL_RCC_EnablePeripheral(RCC_APB2, RCC_APB2ENR_IOPAEN);
+    (void)MCAL_RCC_EnablePeripheral(RCC_APB2, RCC_APB2ENR_IOPBEN);
+    (void)MCAL_RCC_EnablePeripheral(RCC_APB2, RCC_APB2ENR_AFIOEN);
+    (void)MCAL_GPIO_SetPinMode(GPIO_PORTA, GPIO_PIN1, GPIO_OUTPUT_PUSH_PULL_2MHZ);
+    (void)MCAL_GPIO_SetPinMode(GPIO_PORTA, GPIO_PIN2, GPIO_OUTPUT_PUSH_PULL_2MHZ);
+    (void)MCAL_GPIO_SetPinMode(GPIO_PORTA, GPIO_PIN3, GPIO_OUTPUT_PUSH_PULL_2MHZ);
+    (void)MCAL_GPIO_SetPinMode(GPIO_PORTB, GPIO_PIN1, GPIO_OUTPUT_PUSH_PULL_2MHZ);
+    (void)MCAL_GPIO_SetPinMode(GPIO_PORTB, GPIO_PIN2, GPIO_OUTPUT_PUSH_PULL_2MHZ);
+    (void)MCAL_GPIO_SetPinMode(GPIO_PORTB, GPIO_PIN3, GPIO_OUTPUT_PUSH_PULL_2MHZ);
+    Boot_Settle();
+}
+
+/**< main.c from the reset vector to the clock bring-up, after SystemInit left the core on HSI */
+static void Boot_Current(void)
+{
+    u32 Local_Image;
+    u8 Local_Crossing;
+
+    Boot_SystemInitReset();
+
+    (void)MCAL_RCC_EnablePeripheral(RCC_APB2, RCC_APB2ENR_IOPAEN);
+    (void)MCAL_RCC_EnablePeripheral(RCC_APB2, RCC_APB2ENR_IOPBEN);
+    (void)MCAL_RCC_EnablePeripheral(RCC_APB2, RCC_APB2ENR_IOPCEN);
+    SAFETY_Init();
+    Local_Image = SAFETY_GetFallbackImage();
+
+    /**< Signals_Write: one BSRR store per port, levels latched before the pins become outputs */
+    (void)MCAL_GPIO_SetPortValue(GPIO_PORTA, Boot_HeadPins[GPIO_PORTA], (u16)SAFETY_IMAGE_PORTA(Local_Image));
+    (void)MCAL_GPIO_SetPortValue(GPIO_PORTB, Boot_HeadPins[GPIO_PORTB], (u16)SAFETY_IMAGE_PORTB(Local_Image));
+
+    for (Local_Crossing = 0; Local_Crossing < PHASE_INTERSECTION_COUNT; Local_Crossing++)
+    {
+        (void)MCAL_GPIO_SetPinMode(GPIO_PORTA, (u8)(GPIO_PIN1 + (4 * Local_Crossing)), GPIO_OUTPUT_PUSH_PULL_2MHZ);
+        (void)MCAL_GPIO_SetPinMode(GPIO_PORTA, (u8)(GPIO_PIN2 + (4 * Local_Crossing)), GPIO_OUTPUT_PUSH_PULL_2MHZ);
+        (void)MCAL_GPIO_SetPinMode(GPIO_PORTA, (u8)(GPIO_PIN3 + (4 * Local_Crossing)), GPIO_OUTPUT_PUSH_PULL_2MHZ);
+        (void)MCAL_GPIO_SetPinMode(GPIO_PORTA, (u8)(GPIO_PIN4 + (4 * Local_Crossing)), GPIO_OUTPUT_PUSH_PULL_2MHZ);
+        (void)MCAL_GPIO_SetPinMode(GPIO_PORTB, (u8)(GPIO_PIN1 + (4 * Local_Crossing)), GPIO_OUTPUT_PUSH_PULL_2MHZ);
+        (void)MCAL_GPIO_SetPinMode(GPIO_PORTB, (u8)(GPIO_PIN2 + (4 * Local_Crossing)), GPIO_OUTPUT_PUSH_PULL_2MHZ);
+        (void)MCAL_GPIO_SetPinMode(GPIO_PORTB, (u8)(GPIO_PIN3 + (4 * Local_Crossing)), GPIO_OUTPUT_PUSH_PULL_2MHZ);
+    }
+    (void)MCAL_GPIO_SetPinValue(GPIO_PORTC, BOOT_MARKER_PIN, GPIO_HIGH);
+    (void)MCAL_GPIO_SetPinMode(GPIO_PORTC, BOOT_MARKER_PIN, GPIO_OUTPUT_PUSH_PULL_2MHZ);
+
+    (void)MCAL_RCC_InitSysClock();
+    Boot_Settle();
+    Boot_Now->ClockNs = Boot_Ns;
+    Boot_Now->Hclk = Boot_Hclk();
+}
+
+/**< Lamp pins of the crossings wired in main.c: ped red PA1, ped green PA3, car green PB1, car red PB3, four up per crossing */
+static void Boot_MapHeads(void)
+{
+    u8 Local_Crossing;
+
+    for (Local_Crossing = 0; Local_Crossing < PHASE_INTERSECTION_COUNT; Local_Crossing++)
+    {
+        Boot_RedPins[GPIO_PORTA] |= (u16)(1U << (GPIO_PIN1 + (4 * Local_Crossing)));
+        Boot_RedPins[GPIO_PORTB] |= (u16)(1U << (GPIO_PIN3 + (4 * Local_Crossing)));
+        Boot_GreenPins[GPIO_PORTA] |= (u16)(1U << (GPIO_PIN3 + (4 * Local_Crossing)));
+        Boot_GreenPins[GPIO_PORTB] |= (u16)(1U << (GPIO_PIN1 + (4 * Local_Crossing)));
+        Boot_HeadPins[GPIO_PORTA] |= (u16)(0xFU << (GPIO_PIN1 + (4 * Local_Crossing)));
+        Boot_HeadPins[GPIO_PORTB] |= (u16)(0x7U << (GPIO_PIN1 + (4 * Local_Crossing)));
+    }
+}
+
+static void Boot_PrintTime(double Copy_Ns)
+{
+    if (Copy_Ns == BOOT_NEVER)
+    {
+        printf("  %10s", "-");
+    }
+    else
+    {
+        printf("  %7.3f ms", Copy_Ns / 1e6);
+    }
+}
+
+static u8 Boot_Run(const char *Copy_Name, void (*Copy_Path)(void), u8 Copy_DeadCrystal, Boot_Result_t *Copy_Result)
+{
+    Boot_Reset(Copy_DeadCrystal, Copy_Result);
+    if (setjmp(Boot_Hang) == 0)
+    {
+        Copy_Path();
+    }
+    else
+    {
+        Copy_Result->Hung = 1;
+    }
+
+    printf("%-9s %-5s", Copy_Name, Copy_DeadCrystal ? "dead" : "good");
+    Boot_PrintTime(Copy_Result->HeadsNs);
+    Boot_PrintTime(Copy_Result->RedsNs);
+    Boot_PrintTime(Copy_Result->MarkerNs);
+    if (Copy_Result->Hung)
+    {
+        printf("  %10s  hangs past %.0f ms\n", "-", BOOT_LIMIT_MS);
+    }
+    else
+    {
+        Boot_PrintTime(Copy_Result->ClockNs);
+        printf("  %5.1f MHz%s\n", Copy_Result->Hclk / 1e6, Copy_Result->GreenLit ? "  green lit" : "");
+    }
+
+    return Copy_Result->Hung;
+}
+/*****************************< Function Implementations *****************************/
+int main(int argc, char **argv)
+{
+    Boot_Result_t Local_Result;
+    u8 Local_Dead;
+    u32 Local_Failures = 0;
+    int Local_Arg;
+
+    for (Local_Arg = 1; Local_Arg < argc; Local_Arg++)
+    {
+        if (strcmp(argv[Local_Arg], "-v") == 0)
+        {
+            Boot_Verbose = 1;
+        }
+        else if ((strcmp(argv[Local_Arg], "-x") == 0) && ((Local_Arg + 1) < argc))
+        {
+            Boot_HseStartNs = strtoul(argv[++Local_Arg], NULL, 0) * 1e3;
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-x us] [-v]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    Boot_MapHeads();
+
+    printf("%d crossing(s), %d cycles per register access, HSE start %.2f ms, PLL lock %.0f us\n",
+           PHASE_INTERSECTION_COUNT, BOOT_CYCLES_PER_ACCESS, Boot_HseStartNs / 1e6, BOOT_PLL_LOCK_NS / 1e3);
+    printf("path      xtal   heads out   reds lit    marker     clock up    HCLK\n");
+
+    for (Local_Dead = 0; Local_Dead < 2; Local_Dead++)
+    {
+        (void)Boot_Run("previous", Boot_Previous, Local_Dead, &Local_Result);
+    }
+
+    for (Local_Dead = 0; Local_Dead < 2; Local_Dead++)
+    {
+        if (Boot_Run("current", Boot_Current, Local_Dead, &Local_Result) ||
+            (Local_Result.RedsBeforeClock == BOOT_NEVER) || Local_Result.GreenLit)
+        {
+            Local_Failures++;
+        }
+        if (Boot_Verbose)
+        {
+            printf("          reds lit %s the clock tree was touched\n",
+                   (Local_Result.RedsBeforeClock != BOOT_NEVER) ? "before" : "after");
+        }
+    }
+
+    printf("sim_boot: %s\n", (Local_Failures == 0) ? "OK" : "FAIL");
+
+    return (Local_Failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,376 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : sim_coord.c                *****************/
+/****************************************************************/
+
+/*
+ * Multi-controller simulation of the cycle coordination (COORD) on one sync line.
+ *
+ *   sim_coord [-m minutes] [-j us] [-s seed] [-d dir] [-v]
+ *
+ * A master and three slaves, each the unmodified TICK, PHASE, PLAN and COORD modules over its
+ * own drifting crystal (see emu_node.h), loaded from dir/coord_node<n>.so (build/ by default);
+ * node 0 is the master. They power up at different times, the last one 13.3 s after the
+ * master, and run for the given simulated time (60 min by default).
+ *
+ * Events are taken in time order across the nodes. Each SysTick expiry runs the handler, then
+ * the main loop after a latency of 3 to 23 us. A change of the master's sync output reaches
+ * each slave's COORD_OnSyncEdge from 1 us up to the -j bound later: 5 us by default, the EXTI
+ * latency; larger bounds (at most half a pulse) model a filtered or noisy line.
+ *
+ * Every 20th main loop pass on average brings a vehicle call to the actuated car green, and
+ * every 400th (one in 20 s) a pedestrian request. Under coordination the request is served by
+ * the walk that follows the clearance, so the cycle keeps its length (see COORD_interface.h).
+ *
+ * All nodes have the same COORD_OFFSET_MS, so their cycles should start together. For each
+ * slave the deviation of its cycle starts from the master's last one is measured from
+ * SIM_SETTLE_MIN minutes on, and the lock is read at each cycle start. The run fails when a
+ * slave is not locked at the end, when its learned rate is more than SIM_RATE_TOLERANCE_PPM
+ * off the crystal difference, or when a cycle start deviates by more than one control tick.
+ */
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< APP *****************************/
+#include "PHASE_interface.h"
+#include "PHASE_config.h"
+#include "COORD_interface.h"
+#include "COORD_config.h"
+/*****************************< HOST *****************************/
+#include "emu_node.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <dlfcn.h>
+
+#define SIM_NODES               4
+#define SIM_NS_PER_S            1000000000ULL
+#define SIM_SETTLE_MIN          10          /**< Deviations are measured from then on */
+#define SIM_DETECT_ODDS         20          /**< One main loop pass in this many brings a vehicle call */
+#define SIM_PED_ODDS            400         /**< One main loop pass in this many brings a pedestrian request */
+#define SIM_RATE_TOLERANCE_PPM  25.0
+#define SIM_CYCLE_MS            ((double)COORD_CYCLE_MS)
+#define SIM_NONE                (~0ULL)     /**< No event pending */
+
+/**< Kinds of events of a node */
+typedef enum
+{
+    SIM_EVENT_BOOT,
+    SIM_EVENT_EXPIRY,       /**< SysTick handler */
+    SIM_EVENT_LOOP,         /**< Main loop pass after a handler */
+    SIM_EVENT_EDGE          /**< Sync line edge at a slave's input */
+} Sim_Event_t;
+
+/**< A node and its pending events */
+typedef struct
+{
+    const EMU_Node_t *Api;
+    u8 Up;
+    EMU_Time_t LoopNs;
+    EMU_Time_t EdgeNs;
+    u8 EdgeLevel;
+} Sim_Node_t;
+
+/*****************************< Private Variables *****************************/
+static const double Sim_ErrorPpm[SIM_NODES] = { 30, -80, 120, -150 };
+static const EMU_Time_t Sim_BootNs[SIM_NODES] = { 0, 370000000ULL, 820000000ULL, 13300000000ULL };
+
+static Sim_Node_t Sim_Nodes[SIM_NODES];
+static EMU_Time_t Sim_Now = 0;
+/*****************************< Private Functions *****************************/
+static u32 Sim_Random(u32 Copy_Range)
+{
+    return (u32)rand() % Copy_Range;
+}
+
+static Std_ReturnType Sim_Load(const char *Copy_Dir)
+{
+    char Local_Path[256];
+    void *Local_Handle;
+    u8 Local_Node;
+
+    for (Local_Node = 0; Local_Node < SIM_NODES; Local_Node++)
+    {
+        /**< One object per node: dlopen of a path already loaded would share its module state */
+        snprintf(Local_Path, sizeof(Local_Path), "%s/coord_node%u.so", Copy_Dir, Local_Node);
+        Local_Handle = dlopen(Local_Path, RTLD_NOW | RTLD_LOCAL);
+        if (Local_Handle == NULL)
+        {
+            fprintf(stderr, "%s\n", dlerror());
+            return E_NOT_OK;
+        }
+        Sim_Nodes[Local_Node].Api = dlsym(Local_Handle, "EMU_Node");
+        Sim_Nodes[Local_Node].LoopNs = SIM_NONE;
+        Sim_Nodes[Local_Node].EdgeNs = SIM_NONE;
+        if (Sim_Nodes[Local_Node].Api == NULL)
+        {
+            fprintf(stderr, "%s\n", dlerror());
+            return E_NOT_OK;
+        }
+    }
+
+    return E_OK;
+}
+
+/**< Earliest pending event of all nodes; time only moves forward, so each node sees its events in order */
+static EMU_Time_t Sim_NextEvent(u8 *Copy_Node, Sim_Event_t *Copy_Event)
+{
+    EMU_Time_t Local_Next = SIM_NONE;
+    EMU_Time_t Local_Time;
+    u8 Local_Node;
+
+    for (Local_Node = 0; Local_Node < SIM_NODES; Local_Node++)
+    {
+        if (!Sim_Nodes[Local_Node].Up)
+        {
+            if (Sim_BootNs[Local_Node] < Local_Next)
+            {
+                Local_Next = Sim_BootNs[Local_Node];
+                *Copy_Node = Local_Node;
+                *Copy_Event = SIM_EVENT_BOOT;
+            }
+            continue;
+        }
+        Local_Time = Sim_Nodes[Local_Node].Api->NextExpiry();
+        if (Local_Time < Local_Next)
+        {
+            Local_Next = Local_Time;
+            *Copy_Node = Local_Node;
+            *Copy_Event = SIM_EVENT_EXPIRY;
+        }
+        if (Sim_Nodes[Local_Node].LoopNs < Local_Next)
+        {
+            Local_Next = Sim_Nodes[Local_Node].LoopNs;
+            *Copy_Node = Local_Node;
+            *Copy_Event = SIM_EVENT_LOOP;
+        }
+        if (Sim_Nodes[Local_Node].EdgeNs < Local_Next)
+        {
+            Local_Next = Sim_Nodes[Local_Node].EdgeNs;
+            *Copy_Node = Local_Node;
+            *Copy_Event = SIM_EVENT_EDGE;
+        }
+    }
+
+    return Local_Next;
+}
+
+/**< Signed distance of a slave's cycle start from the master's, in ms, folded into half a cycle. The cycle is
+     the master's as simulated time sees it, which differs from COORD_CYCLE_MS by its crystal error */
+static double Sim_Deviation(EMU_Time_t Copy_Start, EMU_Time_t Copy_MasterStart, double Copy_CycleMs)
+{
+    double Local_Ms = ((double)Copy_Start - (double)Copy_MasterStart) / 1e6;
+
+    while (Local_Ms > (Copy_CycleMs / 2))
+    {
+        Local_Ms -= Copy_CycleMs;
+    }
+    while (Local_Ms < -(Copy_CycleMs / 2))
+    {
+        Local_Ms += Copy_CycleMs;
+    }
+
+    return Local_Ms;
+}
+/*****************************< Function Implementations *****************************/
+int main(int argc, char **argv)
+{
+    u32 Local_Minutes = 60;
+    u32 Local_Seed = 5;
+    u32 Local_JitterUs = 5;
+    const char *Local_Dir = "build";
+    u8 Local_Verbose = 0;
+    u32 Local_Starts[SIM_NODES] = { 0 };
+    EMU_Time_t Local_MasterStart = 0;
+    double Local_MasterCycleMs = SIM_CYCLE_MS;
+    EMU_Time_t Local_LockNs[SIM_NODES] = { 0 };
+    double Local_MaxDeviation[SIM_NODES] = { 0 };
+    EMU_Time_t Local_End;
+    EMU_Time_t Local_Next;
+    Sim_Node_t *Local_Sim;
+    Sim_Event_t Local_Event = SIM_EVENT_BOOT;
+    COORD_Status_t Local_Status;
+    u8 Local_Line = 0;
+    u8 Local_Output;
+    u8 Local_Node = 0;
+    u8 Local_Other;
+    u8 Local_Started = 0;
+    double Local_Ms;
+    double Local_TruePpm;
+    double Local_LearnedPpm;
+    int Local_Failed = 0;
+    int Local_Arg;
+
+    for (Local_Arg = 1; Local_Arg < argc; Local_Arg++)
+    {
+        if (strcmp(argv[Local_Arg], "-v") == 0)
+        {
+            Local_Verbose = 1;
+        }
+        else if ((Local_Arg + 1) >= argc)
+        {
+            fprintf(stderr, "usage: %s [-m minutes] [-j us] [-s seed] [-d dir] [-v]\n", argv[0]);
+            return 2;
+        }
+        else if (strcmp(argv[Local_Arg], "-m") == 0)
+        {
+            Local_Minutes = (u32)strtoul(argv[++Local_Arg], NULL, 0);
+        }
+        else if (strcmp(argv[Local_Arg], "-j") == 0)
+        {
+            Local_JitterUs = (u32)strtoul(argv[++Local_Arg], NULL, 0);
+        }
+        else if (strcmp(argv[Local_Arg], "-s") == 0)
+        {
+            Local_Seed = (u32)strtoul(argv[++Local_Arg], NULL, 0);
+        }
+        else if (strcmp(argv[Local_Arg], "-d") == 0)
+        {
+            Local_Dir = argv[++Local_Arg];
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-m minutes] [-j us] [-s seed] [-d dir] [-v]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    /**< An edge is delivered before the next one is driven */
+    if (Local_JitterUs < 2)
+    {
+        Local_JitterUs = 2;
+    }
+    else if (Local_JitterUs > ((COORD_PULSE_MS * 1000UL) / 2))
+    {
+        Local_JitterUs = (COORD_PULSE_MS * 1000UL) / 2;
+    }
+    if (Sim_Load(Local_Dir) != E_OK)
+    {
+        return 1;
+    }
+    srand(Local_Seed);
+    Local_End = (EMU_Time_t)Local_Minutes * 60ULL * SIM_NS_PER_S;
+
+    while (1)
+    {
+        Local_Next = Sim_NextEvent(&Local_Node, &Local_Event);
+        if (Local_Next > Local_End)
+        {
+            break;
+        }
+        Sim_Now = Local_Next;
+        Local_Sim = &Sim_Nodes[Local_Node];
+
+        switch (Local_Event)
+        {
+        case SIM_EVENT_BOOT:
+            Local_Sim->Up = 1;
+            Local_Sim->Api->Init(Sim_ErrorPpm[Local_Node], &Sim_Now);
+            continue;
+
+        case SIM_EVENT_EDGE:
+            Local_Sim->EdgeNs = SIM_NONE;
+            Local_Sim->Api->OnSyncEdge(Local_Sim->EdgeLevel);
+            continue;
+
+        case SIM_EVENT_EXPIRY:
+            if (Sim_Random(SIM_DETECT_ODDS) == 0)
+            {
+                Local_Sim->Api->DetectVehicle();
+            }
+            if (Sim_Random(SIM_PED_ODDS) == 0)
+            {
+                Local_Sim->Api->RequestPedestrian();
+            }
+            Local_Sim->Api->Expire();
+            if (Local_Sim->LoopNs == SIM_NONE)
+            {
+                Local_Sim->LoopNs = Sim_Now + 3000 + Sim_Random(20000);
+            }
+            continue;
+
+        default:
+            Local_Sim->LoopNs = SIM_NONE;
+            Local_Started = Local_Sim->Api->RunLoop();
+            break;
+        }
+
+        /**< The master drives the line; each slave sees the edge after its own delay */
+        if (Local_Node == 0)
+        {
+            Local_Output = Local_Sim->Api->GetSyncOutput();
+            if (Local_Output != Local_Line)
+            {
+                Local_Line = Local_Output;
+                for (Local_Other = 1; Local_Other < SIM_NODES; Local_Other++)
+                {
+                    if (Sim_Nodes[Local_Other].Up)
+                    {
+                        Sim_Nodes[Local_Other].EdgeNs = Sim_Now + 1000 + Sim_Random((Local_JitterUs - 1) * 1000);
+                        Sim_Nodes[Local_Other].EdgeLevel = Local_Output;
+                    }
+                }
+            }
+        }
+
+        if (!Local_Started)
+        {
+            continue;
+        }
+        Local_Starts[Local_Node]++;
+        if (Local_Node == 0)
+        {
+            if (Local_Starts[0] > 1)
+            {
+                Local_MasterCycleMs = ((double)Sim_Now - (double)Local_MasterStart) / 1e6;
+            }
+            Local_MasterStart = Sim_Now;
+            continue;
+        }
+        if (Local_Starts[0] == 0)
+        {
+            continue;
+        }
+
+        Local_Ms = Sim_Deviation(Sim_Now, Local_MasterStart, Local_MasterCycleMs);
+        Local_Sim->Api->GetStatus(&Local_Status);
+        if (Local_Status.Locked && (Local_LockNs[Local_Node] == 0))
+        {
+            Local_LockNs[Local_Node] = Sim_Now;
+        }
+        if ((Sim_Now >= (SIM_SETTLE_MIN * 60ULL * SIM_NS_PER_S)) && (fabs(Local_Ms) > Local_MaxDeviation[Local_Node]))
+        {
+            Local_MaxDeviation[Local_Node] = fabs(Local_Ms);
+        }
+        if (Local_Verbose)
+        {
+            printf("t=%7.1f s slave %u: start %+9.3f ms from master, error %+6d us, freq %+7d ppb, locked %u\n",
+                   (double)Sim_Now / 1e9, Local_Node, Local_Ms, (int)Local_Status.ErrorUs,
+                   (int)Local_Status.FreqPpb, Local_Status.Locked);
+        }
+    }
+
+    printf("%u min, master crystal %+.0f ppm, edges 1..%u us late, deviations from minute %u\n",
+           Local_Minutes, Sim_ErrorPpm[0], Local_JitterUs, SIM_SETTLE_MIN);
+    for (Local_Node = 1; Local_Node < SIM_NODES; Local_Node++)
+    {
+        Sim_Nodes[Local_Node].Api->GetStatus(&Local_Status);
+        Local_TruePpm = Sim_ErrorPpm[Local_Node] - Sim_ErrorPpm[0];
+        Local_LearnedPpm = (double)Local_Status.FreqPpb / 1000.0;
+        printf("slave %u: true %+4.0f ppm, learned %+8.1f ppm, locked by %6.1f s, max start deviation %7.3f ms, max edge error %u us\n",
+               Local_Node, Local_TruePpm, Local_LearnedPpm, (double)Local_LockNs[Local_Node] / 1e9,
+               Local_MaxDeviation[Local_Node], (unsigned)Local_Status.MaxErrorUs);
+        if (!Local_Status.Locked || (fabs(Local_LearnedPpm - Local_TruePpm) > SIM_RATE_TOLERANCE_PPM) ||
+            (Local_MaxDeviation[Local_Node] > PHASE_TICK_MS))
+        {
+            printf("slave %u: FAIL\n", Local_Node);
+            Local_Failed = 1;
+        }
+    }
+
+    return Local_Failed;
+}
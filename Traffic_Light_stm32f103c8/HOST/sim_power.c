@@ -0,0 +1,586 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : sim_power.c                *****************/
+/****************************************************************/
+
+/*
+ * Duty cycle and supply current of one controller over a day, for each way the core idles.
+ *
+ *   sim_power [-c cycles] [-s seed] [-v]
+ *
+ * The unmodified TICK, PHASE, PLAN and NIGHT modules run the main loop of main.c for 24
+ * simulated hours. Pedestrian requests and vehicle calls arrive at random at the hourly rates of
+ * SIM_PED_PER_HOUR and SIM_CARS_PER_HOUR, and each reaches the modules as Inputs_Isr passes it.
+ *
+ * The core runs from the 8 MHz HSE of RCC_config.h, and its work is charged in cycles:
+ * SIM_ISR_CYCLES per interrupt, SIM_LOOP_CYCLES per main loop pass, and the -c cost per
+ * control step (SIM_STEP_CYCLES by default; Control_MaxCycles of the telemetry is the figure
+ * of a real board). WFI sleeps up to the next SysTick or input interrupt, and STOP up to the
+ * next input. After STOP the clock restore keeps the core awake for SIM_RESTORE_US. The DWT
+ * counter advances only while the core runs, as on the target.
+ *
+ * The day runs three times on the same arrivals:
+ *   - periodic: TICK_Idle gets 1 idle tick, the TICK_MODE_PERIODIC behaviour;
+ *   - tickless: the idle bound of main.c, without STOP;
+ *   - STOP: as main.c, parking the signals in STOP at low demand.
+ * For each run it prints the share of time running, in WFI and in STOP, and the duty and current
+ * TICK_GetDuty reports, read once an hour and weighted by the time outside STOP. The mean
+ * current uses SIM_STOP_CURRENT_UA for the time in STOP, which TICK_GetDuty does not see. -v
+ * prints the hourly readings of each run.
+ *
+ * The run fails when, in an hour without STOP, TICK_GetDuty is more than SIM_DUTY_TOLERANCE
+ * per mille off the share of time the core ran, or when a wake-up from STOP took longer than
+ * NIGHT_WAKE_BOUND_US. Hours with STOP are not checked: the window of TICK_GetDuty counts the
+ * tick credited at each wake-up, so a night hour of short wake-ups reads far below what the core
+ * ran outside STOP.
+ */
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "STK_interface.h"
+#include "DWT_interface.h"
+#include "SCB_interface.h"
+#include "PWR_interface.h"
+#include "RCC_interface.h"
+/*****************************< SERVICE *****************************/
+#include "TICK_interface.h"
+#include "TICK_config.h"
+/*****************************< APP *****************************/
+#include "PHASE_interface.h"
+#include "PHASE_config.h"
+#include "NIGHT_interface.h"
+#include "NIGHT_config.h"
+#include "DET_config.h"
+/*****************************< HOST *****************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define SIM_HOURS               24
+#define SIM_NS_PER_HOUR         3600000000000ULL
+#define SIM_HCLK_FREQ           8000000UL   /**< RCC_config.h: HSE, undivided; HSI after STOP runs at the same rate */
+#define SIM_NS_PER_CYCLE        (1000000000UL / SIM_HCLK_FREQ)
+#define SIM_ISR_CYCLES          120         /**< Entry, handler and exit of one interrupt */
+#define SIM_LOOP_CYCLES         900         /**< One main loop pass: command, telemetry, log and the idle bound */
+#define SIM_STEP_CYCLES         4000        /**< One Control_Tick */
+#define SIM_RESTORE_US          1100        /**< Clock_Restore after STOP: HSE start-up, then the RTC resync */
+#define SIM_STOP_CURRENT_UA     24          /**< STOP with the low-power regulator (PWR_config.h) */
+#define SIM_DUTY_TOLERANCE      2.0
+#define SIM_TICKS_PER_SECOND    (1000 / PHASE_TICK_MS)
+#define SIM_DRAIN_TICKS         (DET_DRAIN_MS / PHASE_TICK_MS)
+#define SIM_NONE                (~0ULL)     /**< No interrupt pending */
+
+typedef unsigned long long Sim_Time_t;
+
+/**< How the main loop idles */
+typedef enum
+{
+    SIM_IDLE_PERIODIC = 0,
+    SIM_IDLE_TICKLESS,
+    SIM_IDLE_STOP,
+    SIM_IDLE_COUNT
+} Sim_Idle_t;
+
+/**< Where the time goes */
+typedef enum
+{
+    SIM_RUN = 0,
+    SIM_SLEEP,
+    SIM_STOP,
+    SIM_MODES
+} Sim_Mode_t;
+
+typedef struct
+{
+    Sim_Time_t Ns[SIM_MODES];
+    u32 Peds;
+    u32 Cars;
+    u8 Read;                /**< TICK_GetDuty had a window to report */
+    u32 DutyPermille;
+    u32 CurrentUa;
+} Sim_Hour_t;
+
+static const u16 SIM_PED_PER_HOUR[SIM_HOURS] =
+{
+    2, 1, 0, 0, 1, 4, 15, 40, 60, 35, 25, 30, 45, 40, 30, 35, 50, 60, 45, 25, 15, 8, 5, 3
+};
+static const u16 SIM_CARS_PER_HOUR[SIM_HOURS] =
+{
+    40, 20, 12, 10, 15, 60, 250, 600, 700, 450, 350, 380, 420, 400, 380, 420, 600, 700, 500, 300, 200, 120, 80, 60
+};
+static const char *const SIM_IDLE_NAMES[SIM_IDLE_COUNT] = { "periodic", "tickless", "STOP" };
+
+/*****************************< Private Variables *****************************/
+static Sim_Time_t Sim_Now = 0;
+static u32 Sim_Cycles = 0;                  /**< DWT CYCCNT */
+static u8 Sim_Masked = 0;                   /**< PRIMASK, or a handler running */
+static Sim_Time_t Sim_NextPed = 0;
+static Sim_Time_t Sim_NextCar = 0;
+static u8 Sim_InputPending = 0;
+static Sim_Hour_t Sim_Hours[SIM_HOURS];
+static Sim_Time_t Sim_StkStart = 0;
+static u32 Sim_StkUs = 0;
+static u8 Sim_StkActive = 0;
+static u8 Sim_StkPeriodic = 0;
+static void (*Sim_StkCallback)(void) = NULL;
+/*****************************< Private Functions *****************************/
+static void Sim_Advance(Sim_Mode_t Copy_Mode, Sim_Time_t Copy_Ns)
+{
+    Sim_Time_t Local_Piece;
+    u32 Local_Hour;
+
+    /**< Split at the hour boundaries, so a long STOP counts in every hour it spans */
+    while (Copy_Ns > 0)
+    {
+        Local_Hour = (u32)(Sim_Now / SIM_NS_PER_HOUR);
+        Local_Piece = ((Local_Hour + 1ULL) * SIM_NS_PER_HOUR) - Sim_Now;
+        if (Local_Piece > Copy_Ns)
+        {
+            Local_Piece = Copy_Ns;
+        }
+        if (Local_Hour < SIM_HOURS)
+        {
+            Sim_Hours[Local_Hour].Ns[Copy_Mode] += Local_Piece;
+        }
+        Sim_Now += Local_Piece;
+        Copy_Ns -= Local_Piece;
+    }
+}
+
+static void Sim_Charge(u32 Copy_Cycles)
+{
+    Sim_Cycles += Copy_Cycles;
+    Sim_Advance(SIM_RUN, (Sim_Time_t)Copy_Cycles * SIM_NS_PER_CYCLE);
+}
+
+/**< Poisson arrivals at the rate of the hour they fall in; an hour without any is skipped */
+static Sim_Time_t Sim_Arrival(Sim_Time_t Copy_From, const u16 *Copy_PerHour)
+{
+    Sim_Time_t Local_HourEnd;
+    double Local_Gap;
+    u16 Local_Rate;
+
+    while (1)
+    {
+        Local_HourEnd = ((Copy_From / SIM_NS_PER_HOUR) + 1ULL) * SIM_NS_PER_HOUR;
+        Local_Rate = Copy_PerHour[(Copy_From / SIM_NS_PER_HOUR) % SIM_HOURS];
+        if (Local_Rate != 0)
+        {
+            Local_Gap = -log((rand() + 1.0) / (RAND_MAX + 2.0)) * ((double)SIM_NS_PER_HOUR / Local_Rate);
+            if ((Copy_From + (Sim_Time_t)Local_Gap) < Local_HourEnd)
+            {
+                return Copy_From + (Sim_Time_t)Local_Gap + 1;
+            }
+        }
+        Copy_From = Local_HourEnd;
+    }
+}
+
+static Sim_Time_t Sim_StkExpiry(void)
+{
+    return Sim_StkActive ? (Sim_StkStart + (Sim_Time_t)Sim_StkUs * 1000ULL) : SIM_NONE;
+}
+
+static Sim_Time_t Sim_NextInterrupt(u8 Copy_Stopped)
+{
+    Sim_Time_t Local_Next = (Sim_NextPed < Sim_NextCar) ? Sim_NextPed : Sim_NextCar;
+
+    /**< SysTick is off in STOP; only the EXTI lines wake the core */
+    if (!Copy_Stopped && (Sim_StkExpiry() < Local_Next))
+    {
+        Local_Next = Sim_StkExpiry();
+    }
+
+    return Local_Next;
+}
+
+/**< Run every interrupt that is due, in time order; each one costs SIM_ISR_CYCLES */
+static void Sim_Deliver(void)
+{
+    Sim_Time_t Local_Stk;
+    u32 Local_Hour;
+
+    Sim_Masked = 1;
+    while (Sim_NextInterrupt(0) <= Sim_Now)
+    {
+        Local_Stk = Sim_StkExpiry();
+        if ((Local_Stk <= Sim_NextPed) && (Local_Stk <= Sim_NextCar))
+        {
+            /**< A periodic interval reloads at its own end, not when the handler runs */
+            if (Sim_StkPeriodic)
+            {
+                Sim_StkStart = Local_Stk;
+            }
+            else
+            {
+                Sim_StkActive = 0;
+            }
+            Sim_StkCallback();
+        }
+        else if (Sim_NextPed <= Sim_NextCar)
+        {
+            /**< Inputs_Isr for the button */
+            Local_Hour = (u32)(Sim_NextPed / SIM_NS_PER_HOUR);
+            if (Local_Hour < SIM_HOURS)
+            {
+                Sim_Hours[Local_Hour].Peds++;
+            }
+            NIGHT_OnRequest(Sim_Cycles);
+            PHASE_RequestPedestrian(0);
+            Sim_InputPending = 1;
+            Sim_NextPed = Sim_Arrival(Sim_NextPed, SIM_PED_PER_HOUR);
+        }
+        else
+        {
+            /**< Inputs_Isr for the rising edge of the detector */
+            Local_Hour = (u32)(Sim_NextCar / SIM_NS_PER_HOUR);
+            if (Local_Hour < SIM_HOURS)
+            {
+                Sim_Hours[Local_Hour].Cars++;
+            }
+            PHASE_DetectVehicle(0);
+            Sim_InputPending = 1;
+            Sim_NextCar = Sim_Arrival(Sim_NextCar, SIM_CARS_PER_HOUR);
+        }
+        Sim_Charge(SIM_ISR_CYCLES);
+    }
+    Sim_Masked = 0;
+}
+
+/**< Code of the main loop: interrupts that come due while it runs are taken at once */
+static void Sim_Run(u32 Copy_Cycles)
+{
+    Sim_Charge(Copy_Cycles);
+    if (!Sim_Masked)
+    {
+        Sim_Deliver();
+    }
+}
+
+static Std_ReturnType Sim_StartInterval(u32 Copy_Microseconds, void (*Copy_Callback)(void), u8 Copy_Periodic)
+{
+    if ((Copy_Microseconds == 0) || (Copy_Callback == NULL))
+    {
+        return E_NOT_OK;
+    }
+
+    Sim_StkStart = Sim_Now;
+    Sim_StkUs = Copy_Microseconds;
+    Sim_StkCallback = Copy_Callback;
+    Sim_StkPeriodic = Copy_Periodic;
+    Sim_StkActive = 1;
+
+    return E_OK;
+}
+/*****************************< Host MCAL *****************************/
+Std_ReturnType MCAL_STK_SetIntervalSingle(u32 Copy_Microseconds, void (*Copy_Callback)(void))
+{
+    return Sim_StartInterval(Copy_Microseconds, Copy_Callback, 0);
+}
+
+Std_ReturnType MCAL_STK_SetIntervalPeriodic(u32 Copy_Microseconds, void (*Copy_Callback)(void))
+{
+    return Sim_StartInterval(Copy_Microseconds, Copy_Callback, 1);
+}
+
+u32 MCAL_STK_GetIntervalElapsed_us(void)
+{
+    return Sim_StkActive ? (u32)((Sim_Now - Sim_StkStart) / 1000ULL) : 0;
+}
+
+void MCAL_STK_StopInterval(void)
+{
+    Sim_StkActive = 0;
+}
+
+void MCAL_STK_SetClockFreq(u32 Copy_HclkFreq)
+{
+    (void)Copy_HclkFreq;
+}
+
+u32 MCAL_DWT_GetCycles(void)
+{
+    return Sim_Cycles;
+}
+
+u32 SCB_EnterCritical(void)
+{
+    u32 Local_PriMask = Sim_Masked;
+
+    Sim_Masked = 1;
+
+    return Local_PriMask;
+}
+
+void SCB_ExitCritical(u32 Copy_PriMask)
+{
+    Sim_Masked = (u8)Copy_PriMask;
+    if (!Sim_Masked)
+    {
+        Sim_Deliver();
+    }
+}
+
+/**< The wake-up event is left pending; its handler runs when the caller unmasks */
+void SCB_WaitForInterrupt(void)
+{
+    Sim_Time_t Local_Next = Sim_NextInterrupt(0);
+
+    if (Local_Next > Sim_Now)
+    {
+        Sim_Advance(SIM_SLEEP, Local_Next - Sim_Now);
+    }
+}
+
+void MCAL_PWR_EnterStop(void)
+{
+    Sim_Time_t Local_Next = Sim_NextInterrupt(1);
+
+    if (Local_Next > Sim_Now)
+    {
+        Sim_Advance(SIM_STOP, Local_Next - Sim_Now);
+    }
+}
+
+void MCAL_RCC_ExitStop(void)
+{
+}
+
+u32 MCAL_RCC_GetSysClockFreq(void)
+{
+    return SIM_HCLK_FREQ;
+}
+/*****************************< Private Functions *****************************/
+static u8 Sim_WorkPending(void)
+{
+    return Sim_InputPending;
+}
+
+/**< One day of the main loop of main.c; returns the number of failed checks */
+static u32 Sim_Day(Sim_Idle_t Copy_Idle, u32 Copy_StepCycles, u32 Copy_Seed, u8 Copy_Verbose)
+{
+    const Sim_Time_t Local_End = SIM_HOURS * SIM_NS_PER_HOUR;
+    Sim_Time_t Local_Total[SIM_MODES] = { 0 };
+    Sim_Time_t Local_ReadAt = SIM_NS_PER_HOUR;
+    Sim_Time_t Local_Awake;
+    Sim_Hour_t *Local_Hour;
+    double Local_Duty;
+    double Local_TickDuty = 0;
+    double Local_TickUa = 0;
+    double Local_TickNs = 0;
+    double Local_MeanUa;
+    u32 Local_Failures = 0;
+    u32 Local_Ticks;
+    u32 Local_WakeLast = 0;
+    u32 Local_WakeMax = 0;
+    u32 Local_Drain = 0;
+    u16 Local_IdleTicks;
+    u16 Local_Bound;
+    u16 Local_Left;
+    u8 Local_Signals;
+    u8 Local_Restore = 0;
+    u8 Local_Index;
+    u8 Local_Mode;
+
+    Sim_Now = 0;
+    Sim_Cycles = 0;
+    Sim_Masked = 0;
+    Sim_InputPending = 0;
+    Sim_StkActive = 0;
+    memset(Sim_Hours, 0, sizeof(Sim_Hours));
+    srand(Copy_Seed);
+    Sim_NextPed = Sim_Arrival(0, SIM_PED_PER_HOUR);
+    Sim_NextCar = Sim_Arrival(0, SIM_CARS_PER_HOUR);
+
+    (void)TICK_Init(PHASE_TICK_MS, MCAL_RCC_GetSysClockFreq());
+    PHASE_Init();
+    NIGHT_Init();
+    Local_Signals = PHASE_GetSignals(0);
+
+    while (Sim_Now < Local_End)
+    {
+        Local_Ticks = TICK_Take();
+        while (Local_Ticks--)
+        {
+            /**< Control_Tick, charged before the outputs so a wake-up is timed to its full cost */
+            NIGHT_Tick();
+            PHASE_Tick();
+            Sim_Run(Copy_StepCycles);
+            if (PHASE_GetSignals(0) != Local_Signals)
+            {
+                Local_Signals = PHASE_GetSignals(0);
+                (void)NIGHT_OnSignalsChanged();
+            }
+            /**< DET_Tick drains the loop rings every DET_DRAIN_MS */
+            Local_Drain = (Local_Drain + 1) % SIM_DRAIN_TICKS;
+        }
+        if (Local_Restore)
+        {
+            Local_Restore = 0;
+            Sim_Run(SIM_RESTORE_US * (SIM_HCLK_FREQ / 1000000UL));
+            TICK_SetClockFreq(MCAL_RCC_GetSysClockFreq());
+        }
+        Sim_InputPending = 0;
+        Sim_Run(SIM_LOOP_CYCLES);
+
+        /**< The hourly reading; an hour spent in STOP has no window */
+        while ((Local_ReadAt <= Sim_Now) && (Local_ReadAt <= Local_End))
+        {
+            Local_Hour = &Sim_Hours[(Local_ReadAt / SIM_NS_PER_HOUR) - 1];
+            Local_Hour->Read = (TICK_GetDuty(&Local_Hour->DutyPermille, &Local_Hour->CurrentUa) == E_OK) ? 1 : 0;
+            Local_ReadAt += SIM_NS_PER_HOUR;
+        }
+
+        if ((Copy_Idle == SIM_IDLE_STOP) && NIGHT_CanStop() && (NIGHT_Stop(Sim_WorkPending) == E_OK))
+        {
+            Local_Restore = 1;
+        }
+        else if (Copy_Idle == SIM_IDLE_PERIODIC)
+        {
+            TICK_Idle(1, Sim_WorkPending);
+        }
+        else
+        {
+            /**< The bounds main.c takes from the phase engine, the countdown and the loop drain */
+            Local_IdleTicks = PHASE_GetTicksToNextEvent();
+            Local_Left = PHASE_GetWalkTicksLeft(0);
+            Local_Bound = (Local_Left != 0) ? (u16)(((Local_Left - 1) % SIM_TICKS_PER_SECOND) + 1) : PHASE_NO_EVENT;
+            if (Local_Bound < Local_IdleTicks)
+            {
+                Local_IdleTicks = Local_Bound;
+            }
+            Local_Bound = (u16)(SIM_DRAIN_TICKS - Local_Drain);
+            if (Local_Bound < Local_IdleTicks)
+            {
+                Local_IdleTicks = Local_Bound;
+            }
+            TICK_Idle(Local_IdleTicks, Sim_WorkPending);
+        }
+    }
+
+    for (Local_Index = 0; Local_Index < SIM_HOURS; Local_Index++)
+    {
+        Local_Hour = &Sim_Hours[Local_Index];
+        Local_Awake = Local_Hour->Ns[SIM_RUN] + Local_Hour->Ns[SIM_SLEEP];
+        for (Local_Mode = 0; Local_Mode < SIM_MODES; Local_Mode++)
+        {
+            Local_Total[Local_Mode] += Local_Hour->Ns[Local_Mode];
+        }
+        Local_Duty = (Local_Awake != 0) ? ((1000.0 * Local_Hour->Ns[SIM_RUN]) / Local_Awake) : 0;
+
+        if (Local_Hour->Read)
+        {
+            Local_TickDuty += Local_Hour->DutyPermille * (double)Local_Awake;
+            Local_TickUa += Local_Hour->CurrentUa * (double)Local_Awake;
+            Local_TickNs += Local_Awake;
+            if ((Local_Hour->Ns[SIM_STOP] == 0) && (fabs(Local_Hour->DutyPermille - Local_Duty) > SIM_DUTY_TOLERANCE))
+            {
+                printf("sim_power: %s %02u h: TICK_GetDuty %u permille, the core ran %.1f\n", SIM_IDLE_NAMES[Copy_Idle],
+                       Local_Index, Local_Hour->DutyPermille, Local_Duty);
+                Local_Failures++;
+            }
+        }
+    }
+
+    NIGHT_GetWakeLatency(&Local_WakeLast, &Local_WakeMax);
+    if (Local_WakeMax > NIGHT_WAKE_BOUND_US)
+    {
+        Local_Failures++;
+    }
+
+    Local_MeanUa = ((Local_Total[SIM_RUN] * (double)TICK_RUN_CURRENT_UA) + (Local_Total[SIM_SLEEP] * (double)TICK_SLEEP_CURRENT_UA) +
+                    (Local_Total[SIM_STOP] * (double)SIM_STOP_CURRENT_UA)) / Local_End;
+    printf("%-9s %7.1f %7.1f %7.1f  %7.1f %7.0f  %8.0f %8.1f  ", SIM_IDLE_NAMES[Copy_Idle],
+           (1000.0 * Local_Total[SIM_RUN]) / Local_End, (1000.0 * Local_Total[SIM_SLEEP]) / Local_End,
+           (1000.0 * Local_Total[SIM_STOP]) / Local_End, (Local_TickNs > 0) ? (Local_TickDuty / Local_TickNs) : 0.0,
+           (Local_TickNs > 0) ? (Local_TickUa / Local_TickNs) : 0.0, Local_MeanUa, (Local_MeanUa * SIM_HOURS) / 1000.0);
+    if (Copy_Idle == SIM_IDLE_STOP)
+    {
+        printf("%5u us\n", Local_WakeMax);
+    }
+    else
+    {
+        printf("%8s\n", "-");
+    }
+
+    for (Local_Index = 0; Copy_Verbose && (Local_Index < SIM_HOURS); Local_Index++)
+    {
+        Local_Hour = &Sim_Hours[Local_Index];
+        Local_Awake = Local_Hour->Ns[SIM_RUN] + Local_Hour->Ns[SIM_SLEEP];
+        printf("  %02u h %4u peds %4u cars  STOP %5.1f %%  ran %6.1f permille of the rest  TICK_GetDuty ", Local_Index,
+               Local_Hour->Peds, Local_Hour->Cars, (100.0 * Local_Hour->Ns[SIM_STOP]) / SIM_NS_PER_HOUR,
+               (Local_Awake != 0) ? ((1000.0 * Local_Hour->Ns[SIM_RUN]) / Local_Awake) : 0.0);
+        if (Local_Hour->Read)
+        {
+            printf("%4u permille %5u uA\n", Local_Hour->DutyPermille, Local_Hour->CurrentUa);
+        }
+        else
+        {
+            printf("no window\n");
+        }
+    }
+
+    return Local_Failures;
+}
+/*****************************< Function Implementations *****************************/
+int main(int argc, char **argv)
+{
+    u32 Local_StepCycles = SIM_STEP_CYCLES;
+    u32 Local_Seed = 3;
+    u32 Local_Failures = 0;
+    u32 Local_Peds = 0;
+    u32 Local_Cars = 0;
+    u8 Local_Verbose = 0;
+    u8 Local_Idle;
+    int Local_Arg;
+
+    for (Local_Arg = 1; Local_Arg < argc; Local_Arg++)
+    {
+        if (strcmp(argv[Local_Arg], "-v") == 0)
+        {
+            Local_Verbose = 1;
+        }
+        else if ((strcmp(argv[Local_Arg], "-c") == 0) && ((Local_Arg + 1) < argc))
+        {
+            Local_StepCycles = (u32)strtoul(argv[++Local_Arg], NULL, 0);
+        }
+        else if ((strcmp(argv[Local_Arg], "-s") == 0) && ((Local_Arg + 1) < argc))
+        {
+            Local_Seed = (u32)strtoul(argv[++Local_Arg], NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-c cycles] [-s seed] [-v]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    printf("%u h at %.0f MHz, %u cycles per control step, %u per loop pass; run %u uA, WFI %u uA, STOP %u uA\n",
+           SIM_HOURS, SIM_HCLK_FREQ / 1e6, Local_StepCycles, SIM_LOOP_CYCLES, TICK_RUN_CURRENT_UA, TICK_SLEEP_CURRENT_UA,
+           SIM_STOP_CURRENT_UA);
+    printf("idle      --- permille of the day ---  TICK_GetDuty       mean current   wake-up\n");
+    printf("               run     WFI    STOP  permille      uA        uA  mAh/day       max\n");
+    printf("%-9s %7.1f %7.1f %7.1f  %7s %7s  %8u %8.1f  %8s\n", "none", 1000.0, 0.0, 0.0, "-", "-", TICK_RUN_CURRENT_UA,
+           (TICK_RUN_CURRENT_UA * SIM_HOURS) / 1000.0, "-");
+
+    for (Local_Idle = 0; Local_Idle < SIM_IDLE_COUNT; Local_Idle++)
+    {
+        Local_Failures += Sim_Day((Sim_Idle_t)Local_Idle, Local_StepCycles, Local_Seed, Local_Verbose);
+    }
+
+    /**< Every run saw the same arrivals */
+    for (Local_Idle = 0; Local_Idle < SIM_HOURS; Local_Idle++)
+    {
+        Local_Peds += Sim_Hours[Local_Idle].Peds;
+        Local_Cars += Sim_Hours[Local_Idle].Cars;
+    }
+    printf("%u pedestrian requests and %u vehicle calls a day\n", Local_Peds, Local_Cars);
+    printf("sim_power: %s\n", (Local_Failures == 0) ? "OK" : "FAIL");
+
+    return (Local_Failures == 0) ? 0 : 1;
+}
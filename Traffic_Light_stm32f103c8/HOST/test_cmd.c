@@ -0,0 +1,277 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : test_cmd.c                 *****************/
+/****************************************************************/
+
+/*
+ * Plan uploads through CMD_program.c, unmodified, checked against the acknowledgement it sends.
+ *
+ *   test_cmd
+ *
+ * Each case edits one phase of the default plan, frames it as a CMD_SET_PHASE_TABLE command
+ * (COBS, CRC-16/CCITT-FALSE) and feeds it to CMD_ReceiveBytes. The acknowledgement goes out as
+ * telemetry through the real TLM encoder and is read back with tlm_host, so the check sees the
+ * status a ground station would. Signals map to the pins of crossing 0 in main.c, and the
+ * safety monitor is the firmware's own.
+ *
+ * The clearance cases are the point: a phase that can end at its minimum, by gap-out or by a
+ * request, must be timed from that minimum and not from its duration.
+ */
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "GPIO_interface.h"
+/*****************************< SERVICE *****************************/
+#include "TLM_interface.h"
+/*****************************< APP *****************************/
+#include "PHASE_interface.h"
+#include "PHASE_config.h"
+#include "PLAN_interface.h"
+#include "SAFETY_interface.h"
+#include "CMD_interface.h"
+/*****************************< HOST *****************************/
+#include "tlm_host.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_DESCRIPTOR_SIZE    8
+#define TEST_BODY_SIZE          (TEST_DESCRIPTOR_SIZE * PHASE_COUNT)
+#define TEST_TX_SIZE            256
+#define TEST_NO_ACK             0xFF
+#define TEST_KEEP               0xFFFF      /**< Case field left as in the default plan */
+
+typedef struct
+{
+    const char *Name;
+    u8 Phase;           /**< Phase the case edits */
+    u8 Signals;
+    u8 Flags;
+    u16 DurationMs;
+    u16 MinMs;
+    u8 NextOnRequest;
+    u8 Expected;        /**< CMD_STATUS_x */
+} Test_Case_t;
+
+/*****************************< Private Variables *****************************/
+static const Test_Case_t Test_Cases[] =
+{
+    { "default plan",                         PHASE_COUNT,     0, 0, 0, 0, 0, CMD_STATUS_OK },
+    { "clearance 2000 ms",                    PHASE_CLEARANCE, PHASE_SIG_CAR_YELLOW | PHASE_SIG_PED_YELLOW, PHASE_FLAG_NONE,
+      2000, 0, PHASE_PED_WALK, CMD_STATUS_NO_CLEARANCE },
+    { "actuated clearance, min 1000 ms",      PHASE_CLEARANCE, PHASE_SIG_CAR_YELLOW | PHASE_SIG_PED_YELLOW, PHASE_FLAG_ACTUATED,
+      5000, 1000, PHASE_PED_WALK, CMD_STATUS_NO_CLEARANCE },
+    { "actuated clearance, min 3000 ms",      PHASE_CLEARANCE, PHASE_SIG_CAR_YELLOW | PHASE_SIG_PED_YELLOW, PHASE_FLAG_ACTUATED,
+      5000, 3000, PHASE_PED_WALK, CMD_STATUS_OK },
+    { "clearance ends on request, min 1000 ms", PHASE_CLEARANCE, PHASE_SIG_CAR_YELLOW | PHASE_SIG_PED_YELLOW, PHASE_FLAG_ENDS_ON_REQUEST,
+      5000, 1000, PHASE_PED_WALK, CMD_STATUS_NO_CLEARANCE },
+    { "clearance ends on request into warning", PHASE_CLEARANCE, PHASE_SIG_CAR_YELLOW | PHASE_SIG_PED_YELLOW, PHASE_FLAG_ENDS_ON_REQUEST,
+      5000, 1000, PHASE_WARNING, CMD_STATUS_NO_CLEARANCE },
+    { "walk with car green",                  PHASE_PED_WALK,  PHASE_SIG_CAR_GREEN | PHASE_SIG_PED_GREEN, PHASE_FLAG_SERVES_PED,
+      5000, 0, PHASE_CAR_CHANGE, CMD_STATUS_UNSAFE_IMAGE },
+};
+
+static u8 Test_Tx[TEST_TX_SIZE];
+static u8 Test_Sequence = 0;
+static u8 Test_AckCommand = TEST_NO_ACK;
+static u8 Test_AckStatus = TEST_NO_ACK;
+/*****************************< Host MCAL *****************************/
+u32 MCAL_DWT_GetCycles(void)
+{
+    return 0;
+}
+
+u32 SCB_EnterCritical(void)
+{
+    return 0;
+}
+
+void SCB_ExitCritical(u32 Copy_PriMask)
+{
+    (void)Copy_PriMask;
+}
+
+u8 *MCAL_USART_TxReserve(u32 Copy_Length)
+{
+    return (Copy_Length <= TEST_TX_SIZE) ? Test_Tx : NULL;
+}
+
+/**< The UART is the wire: committed telemetry goes straight to the decoder */
+Std_ReturnType MCAL_USART_TxCommit(u32 Copy_Length)
+{
+    TLMH_Feed(Test_Tx, Copy_Length);
+    return E_OK;
+}
+
+Std_ReturnType TOD_SetTime(u32 Copy_Seconds)
+{
+    (void)Copy_Seconds;
+    return E_NOT_OK;
+}
+/*****************************< Private Functions *****************************/
+/**< Pins of crossing 0 in main.c */
+static u32 Test_MapImage(u8 Copy_Signals)
+{
+    u32 Local_Image = 0;
+
+    if (Copy_Signals & PHASE_SIG_PED_RED)    Local_Image |= SAFETY_IMAGE_PORTA_PIN(GPIO_PIN1);
+    if (Copy_Signals & PHASE_SIG_PED_YELLOW) Local_Image |= SAFETY_IMAGE_PORTA_PIN(GPIO_PIN2);
+    if (Copy_Signals & PHASE_SIG_PED_GREEN)  Local_Image |= SAFETY_IMAGE_PORTA_PIN(GPIO_PIN3);
+    if (Copy_Signals & PHASE_SIG_PED_WAIT)   Local_Image |= SAFETY_IMAGE_PORTA_PIN(GPIO_PIN4);
+    if (Copy_Signals & PHASE_SIG_CAR_GREEN)  Local_Image |= SAFETY_IMAGE_PORTB_PIN(GPIO_PIN1);
+    if (Copy_Signals & PHASE_SIG_CAR_YELLOW) Local_Image |= SAFETY_IMAGE_PORTB_PIN(GPIO_PIN2);
+    if (Copy_Signals & PHASE_SIG_CAR_RED)    Local_Image |= SAFETY_IMAGE_PORTB_PIN(GPIO_PIN3);
+
+    return Local_Image;
+}
+
+static void Test_Ack(u8 Copy_Sequence, unsigned long long Copy_TimeUs, const TLM_Record_t *Copy_Record)
+{
+    (void)Copy_Sequence;
+    (void)Copy_TimeUs;
+
+    if (Copy_Record->Id == TLM_MSG_ACK)
+    {
+        Test_AckCommand = Copy_Record->Arg;
+        Test_AckStatus = (u8)Copy_Record->Value;
+    }
+}
+
+/**< CRC-16/CCITT-FALSE, bit by bit: independent of the nibble table of the firmware */
+static u16 Test_Crc16(const u8 *Copy_Data, u32 Copy_Length)
+{
+    u16 Local_Crc = 0xFFFF;
+    u8 Local_Bit;
+
+    while (Copy_Length--)
+    {
+        Local_Crc ^= (u16)(*Copy_Data++ << 8);
+        for (Local_Bit = 0; Local_Bit < 8; Local_Bit++)
+        {
+            Local_Crc = (Local_Crc & 0x8000) ? (u16)((Local_Crc << 1) ^ 0x1021) : (u16)(Local_Crc << 1);
+        }
+    }
+
+    return Local_Crc;
+}
+
+/**< COBS-encode a frame and append the delimiter; returns the wire length */
+static u32 Test_Cobs(const u8 *Copy_In, u32 Copy_Length, u8 *Copy_Out)
+{
+    u32 Local_Code = 0;
+    u32 Local_Out = 1;
+    u32 Local_In;
+
+    for (Local_In = 0; Local_In < Copy_Length; Local_In++)
+    {
+        if (Copy_In[Local_In] == 0)
+        {
+            Copy_Out[Local_Code] = (u8)(Local_Out - Local_Code);
+            Local_Code = Local_Out++;
+        }
+        else
+        {
+            Copy_Out[Local_Out++] = Copy_In[Local_In];
+            if ((Local_Out - Local_Code) == 0xFF)
+            {
+                Copy_Out[Local_Code] = 0xFF;
+                Local_Code = Local_Out++;
+            }
+        }
+    }
+    Copy_Out[Local_Code] = (u8)(Local_Out - Local_Code);
+    Copy_Out[Local_Out++] = 0x00;
+
+    return Local_Out;
+}
+
+/**< The default plan on the wire, with the edit of one case applied */
+static void Test_Body(const Test_Case_t *Copy_Case, u8 *Copy_Body)
+{
+    const PHASE_Descriptor_t *Local_Table = PLAN_GetTable(PLAN_DEFAULT);
+    u16 Local_DurationMs;
+    u16 Local_MinMs;
+    u8 *Local_Out;
+    u8 Local_Phase;
+
+    for (Local_Phase = 0; Local_Phase < PHASE_COUNT; Local_Phase++)
+    {
+        Local_Out = &Copy_Body[Local_Phase * TEST_DESCRIPTOR_SIZE];
+        Local_DurationMs = (u16)(Local_Table[Local_Phase].DurationTicks * PHASE_TICK_MS);
+        Local_MinMs = (u16)(Local_Table[Local_Phase].MinTicks * PHASE_TICK_MS);
+
+        Local_Out[0] = Local_Table[Local_Phase].Signals;
+        Local_Out[1] = Local_Table[Local_Phase].Flags;
+        Local_Out[6] = Local_Table[Local_Phase].Next;
+        Local_Out[7] = Local_Table[Local_Phase].NextOnRequest;
+
+        if (Local_Phase == Copy_Case->Phase)
+        {
+            Local_Out[0] = Copy_Case->Signals;
+            Local_Out[1] = Copy_Case->Flags;
+            Local_DurationMs = Copy_Case->DurationMs;
+            Local_MinMs = Copy_Case->MinMs;
+            Local_Out[7] = Copy_Case->NextOnRequest;
+        }
+
+        Local_Out[2] = (u8)Local_DurationMs;
+        Local_Out[3] = (u8)(Local_DurationMs >> 8);
+        Local_Out[4] = (u8)Local_MinMs;
+        Local_Out[5] = (u8)(Local_MinMs >> 8);
+    }
+}
+
+/**< Send one SET_PHASE_TABLE and return the status acknowledged for it */
+static u8 Test_Upload(const Test_Case_t *Copy_Case)
+{
+    u8 Local_Frame[2 + TEST_BODY_SIZE + 2];
+    u8 Local_Wire[sizeof(Local_Frame) + (sizeof(Local_Frame) / 254) + 2];
+    u32 Local_Length = 2 + TEST_BODY_SIZE;
+    u16 Local_Crc;
+
+    Local_Frame[0] = Test_Sequence++;
+    Local_Frame[1] = CMD_SET_PHASE_TABLE;
+    Test_Body(Copy_Case, &Local_Frame[2]);
+    Local_Crc = Test_Crc16(Local_Frame, Local_Length);
+    Local_Frame[Local_Length++] = (u8)Local_Crc;
+    Local_Frame[Local_Length++] = (u8)(Local_Crc >> 8);
+
+    Test_AckCommand = TEST_NO_ACK;
+    Test_AckStatus = TEST_NO_ACK;
+    CMD_ReceiveBytes(Local_Wire, Test_Cobs(Local_Frame, Local_Length, Local_Wire));
+    CMD_Process();
+    TLM_Flush();
+
+    return (Test_AckCommand == CMD_SET_PHASE_TABLE) ? Test_AckStatus : TEST_NO_ACK;
+}
+/*****************************< Function Implementations *****************************/
+int main(void)
+{
+    unsigned long Local_Failures = 0;
+    u32 Local_Case;
+    u8 Local_Status;
+
+    SAFETY_Init();
+    PHASE_Init();
+    TLM_Init(8000000UL);
+    TLMH_Init(Test_Ack);
+    CMD_Init(Test_MapImage);
+
+    for (Local_Case = 0; Local_Case < (sizeof(Test_Cases) / sizeof(Test_Cases[0])); Local_Case++)
+    {
+        Local_Status = Test_Upload(&Test_Cases[Local_Case]);
+        if (Local_Status != Test_Cases[Local_Case].Expected)
+        {
+            printf("test_cmd: %-40s status %u, expected %u\n", Test_Cases[Local_Case].Name,
+                   Local_Status, Test_Cases[Local_Case].Expected);
+            Local_Failures++;
+        }
+    }
+
+    printf("test_cmd: %lu cases, %lu failures\n", (unsigned long)Local_Case, Local_Failures);
+
+    return (Local_Failures == 0) ? 0 : 1;
+}
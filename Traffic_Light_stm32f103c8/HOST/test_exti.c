@@ -0,0 +1,235 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : test_exti.c                *****************/
+/****************************************************************/
+
+/*
+ * Randomized test of EXTI_program.c, unmodified, with several input lines pending at once.
+ *
+ *   test_exti [-n rounds] [-s seed]
+ *
+ * The EXTI block is mapped at its real address. PR is write-1-to-clear, which plain memory
+ * cannot do, so Test_Sync applies it after every EXTI_CLR_PendingFLag: the bits stored clear
+ * the latches, and PR then reads back what is still latched.
+ *
+ * The lines are those of main.c: preemption on EXTI0, the buttons of both crossings (PB4,
+ * PB8), their detectors (PB9, PB10) and the sync input (PB11). The handlers follow Preempt_Isr
+ * and Inputs_Isr: each pending line is serviced once and cleared, in the same order. Each round
+ * latches a random set of lines, more edges arrive while the handlers run, and the NVIC model
+ * enters the handler of any group that still has a line pending, EXTI0 first. Every latched
+ * edge must be serviced exactly once, and nothing may stay pending at the end of a round.
+ */
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "EXTI_interface.h"
+#include "EXTI_private.h"
+/*****************************< HOST *****************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#define TEST_PAGE_MASK          0xFFFU
+#define TEST_PREEMPT_LINE       0
+#define TEST_SYNC_LINE          11
+#define TEST_CROSSINGS          2
+#define TEST_LATE_ODDS          4           /**< One service step in this many sees a new edge arrive */
+
+/*****************************< Private Variables *****************************/
+static const u8 Test_Buttons[TEST_CROSSINGS] = { 4, 8 };
+static const u8 Test_Detectors[TEST_CROSSINGS] = { 9, 10 };
+static const u8 Test_Lines[] = { 0, 4, 8, 9, 10, 11 };
+
+static u32 Test_Latched = 0;            /**< Pending latches of the model */
+static unsigned long Test_Edges[16];    /**< Edges that set a latch */
+static unsigned long Test_Serviced[16];
+static unsigned long Test_Failures = 0;
+/*****************************< Host MCAL *****************************/
+Std_ReturnType MCAL_AFIO_SetEXTIConfiguration(u8 Copy_Line, u8 Copy_PortMap)
+{
+    (void)Copy_Line;
+    (void)Copy_PortMap;
+    return E_OK;
+}
+/*****************************< Private Functions *****************************/
+static void Test_Map(void)
+{
+    void *Local_Page = (void *)(unsigned long)(EXTI_BASE_ADDRESS & ~TEST_PAGE_MASK);
+
+    if (mmap(Local_Page, TEST_PAGE_MASK + 1U, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0) != Local_Page)
+    {
+        perror("test_exti: cannot map the register page");
+        exit(1);
+    }
+}
+
+/**< Write-1-to-clear: what the driver left in PR was stored, and clears those latches */
+static void Test_Sync(void)
+{
+    Test_Latched &= ~EXTI->PR;
+    EXTI->PR = Test_Latched;
+}
+
+/**< An edge on a line: latches it, or merges with the edge already latched as on the chip */
+static void Test_Edge(u8 Copy_Line)
+{
+    if (!GET_BIT(Test_Latched, Copy_Line))
+    {
+        Test_Edges[Copy_Line]++;
+    }
+    SET_BIT(Test_Latched, Copy_Line);
+    EXTI->PR = Test_Latched;
+}
+
+/**< Maybe let an edge arrive while a handler runs */
+static void Test_MaybeLate(void)
+{
+    if ((rand() % TEST_LATE_ODDS) == 0)
+    {
+        Test_Edge(Test_Lines[rand() % sizeof(Test_Lines)]);
+    }
+}
+
+static void Test_Service(u8 Copy_Line)
+{
+    Test_MaybeLate();
+    Test_Serviced[Copy_Line]++;
+    EXTI_CLR_PendingFLag(Copy_Line);
+    Test_Sync();
+    Test_MaybeLate();
+}
+
+/**< Preempt_Isr: one line */
+static void Test_PreemptIsr(void)
+{
+    Test_Service(TEST_PREEMPT_LINE);
+}
+
+/**< Inputs_Isr: every button and detector, then the sync input */
+static void Test_InputsIsr(void)
+{
+    u8 Local_Crossing;
+
+    for (Local_Crossing = 0; Local_Crossing < TEST_CROSSINGS; Local_Crossing++)
+    {
+        if (EXTI_GetPendingFlag(Test_Buttons[Local_Crossing]))
+        {
+            Test_Service(Test_Buttons[Local_Crossing]);
+        }
+        if (EXTI_GetPendingFlag(Test_Detectors[Local_Crossing]))
+        {
+            Test_Service(Test_Detectors[Local_Crossing]);
+        }
+    }
+    if (EXTI_GetPendingFlag(TEST_SYNC_LINE))
+    {
+        Test_Service(TEST_SYNC_LINE);
+    }
+}
+
+/**< NVIC: take the pending groups until none is left, EXTI0 above the others */
+static void Test_Nvic(void)
+{
+    u32 Local_Entries;
+
+    for (Local_Entries = 0; Test_Latched != 0; Local_Entries++)
+    {
+        if (Local_Entries > 1000)
+        {
+            fprintf(stderr, "test_exti: lines 0x%04X never cleared\n", (unsigned)Test_Latched);
+            Test_Failures++;
+            return;
+        }
+        if (GET_BIT(Test_Latched, 0))
+        {
+            EXTI0_IRQHandler();
+        }
+        else if (GET_BIT(Test_Latched, 4))
+        {
+            EXTI4_IRQHandler();
+        }
+        else if (Test_Latched & 0x03E0U)
+        {
+            EXTI9_5_IRQHandler();
+        }
+        else
+        {
+            EXTI15_10_IRQHandler();
+        }
+    }
+}
+/*****************************< Function Implementations *****************************/
+int main(int argc, char **argv)
+{
+    unsigned long Local_Rounds = 200000UL;
+    unsigned long Local_Seed = 1UL;
+    unsigned long Local_Round;
+    unsigned long Local_Together = 0;
+    unsigned long Local_Edges = 0;
+    u8 Local_Index;
+    u8 Local_Line;
+    int Local_Arg;
+
+    for (Local_Arg = 1; Local_Arg + 1 < argc; Local_Arg += 2)
+    {
+        if (!strcmp(argv[Local_Arg], "-n"))
+        {
+            Local_Rounds = strtoul(argv[Local_Arg + 1], NULL, 0);
+        }
+        else if (!strcmp(argv[Local_Arg], "-s"))
+        {
+            Local_Seed = strtoul(argv[Local_Arg + 1], NULL, 0);
+        }
+    }
+    srand((unsigned)Local_Seed);
+
+    Test_Map();
+    memset((void *)EXTI, 0, sizeof(EXTI_RegDef_t));
+    EXTI_Line0Callback(Test_PreemptIsr);
+    EXTI_Callback(Test_InputsIsr);
+
+    for (Local_Round = 0; Local_Round < Local_Rounds; Local_Round++)
+    {
+        for (Local_Index = 0; Local_Index < sizeof(Test_Lines); Local_Index++)
+        {
+            if (rand() & 1)
+            {
+                Test_Edge(Test_Lines[Local_Index]);
+            }
+        }
+        if ((Test_Latched & (Test_Latched - 1)) != 0)
+        {
+            Local_Together++;
+        }
+        Test_Nvic();
+        if (EXTI->PR != 0)
+        {
+            fprintf(stderr, "test_exti: round %lu left PR 0x%04X\n", Local_Round, (unsigned)EXTI->PR);
+            Test_Failures++;
+            EXTI->PR = 0;
+            Test_Latched = 0;
+        }
+    }
+
+    for (Local_Index = 0; Local_Index < sizeof(Test_Lines); Local_Index++)
+    {
+        Local_Line = Test_Lines[Local_Index];
+        Local_Edges += Test_Edges[Local_Line];
+        if (Test_Serviced[Local_Line] != Test_Edges[Local_Line])
+        {
+            fprintf(stderr, "test_exti: line %u: %lu edges latched, %lu serviced\n",
+                    Local_Line, Test_Edges[Local_Line], Test_Serviced[Local_Line]);
+            Test_Failures++;
+        }
+    }
+
+    printf("test_exti: %lu rounds, seed %lu\n", Local_Rounds, Local_Seed);
+    printf("  %lu edges latched, %lu rounds with several lines pending at once\n", Local_Edges, Local_Together);
+    printf("  %lu failures\n", Test_Failures);
+    return (Test_Failures == 0) ? 0 : 1;
+}
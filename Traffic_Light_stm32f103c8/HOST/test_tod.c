@@ -0,0 +1,361 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : test_tod.c                 *****************/
+/****************************************************************/
+
+/*
+ * Check of the time-of-day plan scheduler (TOD_program.c), unmodified, on the real phase
+ * engine and plans.
+ *
+ *   test_tod [-w weeks] [-s seed]
+ *
+ * The RTC is a seconds counter with its backup registers. The clock is set to a random second
+ * of the first week, then the control loop runs for the given number of weeks (two by default):
+ * TOD_Tick before PHASE_Tick as in Control_Tick, the RTC counting once every 1000 / PHASE_TICK_MS
+ * ticks, and a pedestrian request every TEST_PED_S seconds on average so that cycles keep
+ * starting.
+ *
+ * Single comparison: each TOD_Tick reads the RTC once, and only the tick on which the RTC
+ * reaches a transition of TOD_SCHEDULE may install a table, once per crossing. PHASE_InstallTable
+ * is wrapped (ld --wrap) to count the calls.
+ *
+ * Drift: at every tick TOD_GetPlan must be the plan TOD_SCHEDULE gives for the RTC time, worked
+ * out here from the schedule itself; so every switch lands on its scheduled second, week after
+ * week. After a switch the engine must run the new plan from its next cycle start. The tickless
+ * bound TOD_GetTicksToNextEvent may not sleep past a transition by more than one RTC second.
+ *
+ * Then the clock is set back, forward and onto a weekend, the controller is reset with and
+ * without the backup mark, and the RTC is stopped; the plan must follow each time.
+ */
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "RTC_interface.h"
+/*****************************< APP *****************************/
+#include "PHASE_interface.h"
+#include "PHASE_config.h"
+#include "PLAN_interface.h"
+#include "TOD_interface.h"
+#include "TOD_config.h"
+/*****************************< HOST *****************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_TICKS_PER_SECOND   (1000 / PHASE_TICK_MS)
+#define TEST_SECONDS_PER_DAY    86400UL
+#define TEST_SECONDS_PER_WEEK   (7 * TEST_SECONDS_PER_DAY)
+#define TEST_PED_S              90
+#define TEST_BACKUP_REGISTERS   10
+
+/*****************************< Private Variables *****************************/
+static const TOD_Entry_t Test_Schedule[] = { TOD_SCHEDULE };
+#define TEST_ENTRY_COUNT        (sizeof(Test_Schedule) / sizeof(Test_Schedule[0]))
+
+static u8 Test_Running = 1;
+static u32 Test_Counter = 0;
+static u16 Test_Backup[TEST_BACKUP_REGISTERS + 1];
+static unsigned long Test_Reads = 0;
+static unsigned long Test_Installs = 0;
+static unsigned long Test_Failures = 0;
+/*****************************< Host MCAL *****************************/
+void MCAL_RTC_Init(void)
+{
+}
+
+u8 MCAL_RTC_IsRunning(void)
+{
+    return Test_Running;
+}
+
+u32 MCAL_RTC_GetCounter(void)
+{
+    Test_Reads++;
+    return Test_Counter;
+}
+
+Std_ReturnType MCAL_RTC_SetCounter(u32 Copy_Seconds)
+{
+    if (!Test_Running)
+    {
+        return E_NOT_OK;
+    }
+
+    Test_Counter = Copy_Seconds;
+
+    return E_OK;
+}
+
+Std_ReturnType MCAL_RTC_WaitSync(void)
+{
+    return E_OK;
+}
+
+u16 MCAL_RTC_ReadBackup(u8 Copy_Register)
+{
+    return ((Copy_Register >= 1) && (Copy_Register <= TEST_BACKUP_REGISTERS)) ? Test_Backup[Copy_Register] : 0;
+}
+
+Std_ReturnType MCAL_RTC_WriteBackup(u8 Copy_Register, u16 Copy_Value)
+{
+    if ((Copy_Register < 1) || (Copy_Register > TEST_BACKUP_REGISTERS))
+    {
+        return E_NOT_OK;
+    }
+
+    Test_Backup[Copy_Register] = Copy_Value;
+
+    return E_OK;
+}
+
+Std_ReturnType __real_PHASE_InstallTable(u8 Copy_Intersection, const PHASE_Descriptor_t *Copy_Table);
+
+Std_ReturnType __wrap_PHASE_InstallTable(u8 Copy_Intersection, const PHASE_Descriptor_t *Copy_Table)
+{
+    Test_Installs++;
+    return __real_PHASE_InstallTable(Copy_Intersection, Copy_Table);
+}
+/*****************************< Private Functions *****************************/
+static void Test_Check(u8 Copy_Condition, const char *Copy_What)
+{
+    if (!Copy_Condition)
+    {
+        fprintf(stderr, "test_tod: %s\n", Copy_What);
+        Test_Failures++;
+    }
+}
+
+static u32 Test_Random(u32 Copy_Range)
+{
+    return (u32)rand() % Copy_Range;
+}
+
+/**< Plan of the schedule at Copy_Seconds: the latest transition of the week up to then, else last week's last */
+static u8 Test_Expected(u32 Copy_Seconds, u8 *Copy_AtTransition)
+{
+    u32 Local_WeekSecond = Copy_Seconds % TEST_SECONDS_PER_WEEK;
+    u32 Local_Second;
+    u32 Local_Best = 0;
+    u32 Local_Last = 0;
+    u8 Local_BestPlan = TOD_PLAN_NONE;
+    u8 Local_LastPlan = TOD_PLAN_NONE;
+    u8 Local_Entry;
+    u8 Local_Day;
+
+    *Copy_AtTransition = 0;
+
+    for (Local_Entry = 0; Local_Entry < TEST_ENTRY_COUNT; Local_Entry++)
+    {
+        for (Local_Day = 0; Local_Day < 7; Local_Day++)
+        {
+            if (!GET_BIT(Test_Schedule[Local_Entry].Days, Local_Day))
+            {
+                continue;
+            }
+
+            Local_Second = (Local_Day * TEST_SECONDS_PER_DAY) + (Test_Schedule[Local_Entry].Hour * 3600UL) +
+                           (Test_Schedule[Local_Entry].Minute * 60UL);
+            if ((Local_Second <= Local_WeekSecond) && ((Local_BestPlan == TOD_PLAN_NONE) || (Local_Second > Local_Best)))
+            {
+                Local_Best = Local_Second;
+                Local_BestPlan = Test_Schedule[Local_Entry].Plan;
+            }
+            if ((Local_LastPlan == TOD_PLAN_NONE) || (Local_Second > Local_Last))
+            {
+                Local_Last = Local_Second;
+                Local_LastPlan = Test_Schedule[Local_Entry].Plan;
+            }
+            if (Local_Second == Local_WeekSecond)
+            {
+                *Copy_AtTransition = 1;
+            }
+        }
+    }
+
+    return (Local_BestPlan != TOD_PLAN_NONE) ? Local_BestPlan : Local_LastPlan;
+}
+
+static u8 Test_PlanAt(u32 Copy_Seconds)
+{
+    u8 Local_AtTransition;
+
+    return Test_Expected(Copy_Seconds, &Local_AtTransition);
+}
+/*****************************< Function Implementations *****************************/
+int main(int argc, char **argv)
+{
+    unsigned long Local_Weeks = 2;
+    unsigned long Local_Seed = 1;
+    unsigned long Local_Ticks;
+    unsigned long Local_Tick;
+    unsigned long Local_Reads;
+    unsigned long Local_Installs;
+    unsigned long Local_Transitions = 0;
+    unsigned long Local_Switches = 0;
+    unsigned long Local_TakeOvers = 0;
+    unsigned long Local_WakeTick = 0;               /**< Latest tick a tickless sleep taken so far would end on */
+    unsigned long Local_SwitchTick = 0;
+    unsigned long Local_MaxTakeOver = 0;            /**< Ticks from a switch to the cycle start running the new plan */
+    unsigned long Local_MaxLate = 0;                /**< Ticks a sleep ran past a transition */
+    u32 Local_Start;
+    u32 Local_Second;
+    u16 Local_Bound;
+    u8 Local_Offset;
+    u8 Local_Plan;
+    u8 Local_Phase;
+    u8 Local_LastPhase;
+    u8 Local_AtTransition;
+    u8 Local_Awaiting = 0;
+    int Local_Arg;
+
+    for (Local_Arg = 1; Local_Arg < argc; Local_Arg++)
+    {
+        if ((strcmp(argv[Local_Arg], "-w") == 0) && ((Local_Arg + 1) < argc))
+        {
+            Local_Weeks = strtoul(argv[++Local_Arg], NULL, 0);
+        }
+        else if ((strcmp(argv[Local_Arg], "-s") == 0) && ((Local_Arg + 1) < argc))
+        {
+            Local_Seed = strtoul(argv[++Local_Arg], NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-w weeks] [-s seed]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    srand((unsigned)Local_Seed);
+
+    /**< Before the clock is set the plans are left alone */
+    PHASE_Init();
+    Test_Check(TOD_Init() == E_OK, "TOD_SCHEDULE rejected");
+    Test_Check(TOD_GetPlan() == TOD_PLAN_NONE, "a plan selected before the clock was set");
+    Test_Check(TOD_GetTicksToNextEvent() == PHASE_NO_EVENT, "a tickless bound before the clock was set");
+
+    Local_Start = Test_Random(TEST_SECONDS_PER_WEEK);
+    Test_Check(TOD_SetTime(Local_Start) == E_OK, "TOD_SetTime refused on a running RTC");
+    Test_Check(TOD_GetPlan() == Test_PlanAt(Local_Start), "wrong plan right after TOD_SetTime");
+
+    /**< The RTC second starts part-way into a control tick period */
+    Local_Offset = (u8)Test_Random(TEST_TICKS_PER_SECOND);
+    Local_Ticks = Local_Weeks * TEST_SECONDS_PER_WEEK * TEST_TICKS_PER_SECOND;
+    Local_LastPhase = PHASE_GetCurrentPhase(0);
+    Local_Plan = TOD_GetPlan();
+
+    for (Local_Tick = 0; Local_Tick < Local_Ticks; Local_Tick++)
+    {
+        Local_AtTransition = 0;
+        if ((Local_Tick % TEST_TICKS_PER_SECOND) == Local_Offset)
+        {
+            Test_Counter++;
+            (void)Test_Expected(Test_Counter, &Local_AtTransition);
+        }
+        if (Test_Random(TEST_PED_S * TEST_TICKS_PER_SECOND) == 0)
+        {
+            PHASE_RequestPedestrian(0);
+        }
+
+        Local_Reads = Test_Reads;
+        Local_Installs = Test_Installs;
+        TOD_Tick();
+        PHASE_Tick();
+
+        if ((Test_Reads - Local_Reads) != 1)
+        {
+            fprintf(stderr, "test_tod: tick %lu read the RTC %lu times\n", Local_Tick, Test_Reads - Local_Reads);
+            Test_Failures++;
+        }
+        if ((Test_Installs - Local_Installs) != (Local_AtTransition ? PHASE_INTERSECTION_COUNT : 0))
+        {
+            fprintf(stderr, "test_tod: second %lu installed %lu tables\n", (unsigned long)Test_Counter, Test_Installs - Local_Installs);
+            Test_Failures++;
+        }
+        if (TOD_GetPlan() != Test_PlanAt(Test_Counter))
+        {
+            fprintf(stderr, "test_tod: second %lu runs plan %u, the schedule gives %u\n", (unsigned long)Test_Counter,
+                    TOD_GetPlan(), Test_PlanAt(Test_Counter));
+            Test_Failures++;
+        }
+
+        if (Local_AtTransition)
+        {
+            Local_Transitions++;
+            if (Local_WakeTick > Local_Tick)
+            {
+                Local_MaxLate = (Local_WakeTick - Local_Tick > Local_MaxLate) ? (Local_WakeTick - Local_Tick) : Local_MaxLate;
+            }
+            Local_WakeTick = 0;
+        }
+        if (TOD_GetPlan() != Local_Plan)
+        {
+            Local_Plan = TOD_GetPlan();
+            Local_Switches++;
+            Local_SwitchTick = Local_Tick;
+            Local_Awaiting = 1;
+        }
+
+        /**< The new plan runs from the next cycle start */
+        Local_Phase = PHASE_GetCurrentPhase(0);
+        if (Local_Awaiting && (Local_Phase == PHASE_CYCLE_START) && (Local_LastPhase != PHASE_CYCLE_START))
+        {
+            Local_Awaiting = 0;
+            Local_TakeOvers++;
+            if (PHASE_GetActiveTable(0) != PLAN_GetTable(Local_Plan))
+            {
+                fprintf(stderr, "test_tod: second %lu: cycle started on the old plan\n", (unsigned long)Test_Counter);
+                Test_Failures++;
+            }
+            if ((Local_Tick - Local_SwitchTick) > Local_MaxTakeOver)
+            {
+                Local_MaxTakeOver = Local_Tick - Local_SwitchTick;
+            }
+        }
+        Local_LastPhase = Local_Phase;
+
+        /**< A sleep from here would end on this tick */
+        Local_Bound = TOD_GetTicksToNextEvent();
+        Test_Check(Local_Bound >= 1, "tickless bound of 0");
+        if ((Local_Tick + Local_Bound) > Local_WakeTick)
+        {
+            Local_WakeTick = Local_Tick + Local_Bound;
+        }
+    }
+    Test_Check(Local_MaxLate <= TEST_TICKS_PER_SECOND, "a tickless sleep passed a transition by more than one second");
+
+    /**< Setting the clock selects at once, in either direction */
+    Local_Second = 8 * 3600UL;                                     /**< Monday 08:00 */
+    Test_Check((TOD_SetTime(Local_Second) == E_OK) && (TOD_GetPlan() == PLAN_PEAK), "Monday 08:00 is not on the peak plan");
+    Local_Second = 6 * 3600UL;                                     /**< Monday 06:00 */
+    Test_Check((TOD_SetTime(Local_Second) == E_OK) && (TOD_GetPlan() == PLAN_DEFAULT), "setting the clock back kept the peak plan");
+    Local_Second = (5 * TEST_SECONDS_PER_DAY) + (8 * 3600UL);      /**< Saturday 08:00 */
+    Test_Check((TOD_SetTime(Local_Second) == E_OK) && (TOD_GetPlan() == PLAN_DEFAULT), "Saturday 08:00 is not on the default plan");
+    Local_Second = (4 * TEST_SECONDS_PER_DAY) + (17 * 3600UL) + (3 * TEST_SECONDS_PER_WEEK);
+    Test_Check((TOD_SetTime(Local_Second) == E_OK) && (TOD_GetPlan() == PLAN_PEAK), "Friday 17:00 of week 4 is not on the peak plan");
+
+    /**< A reset keeps the clock while the backup domain is powered */
+    PHASE_Init();
+    Test_Check((TOD_Init() == E_OK) && (TOD_GetPlan() == PLAN_PEAK), "the plan was not reselected after a reset");
+    Test_Check(PHASE_GetActiveTable(0) != PLAN_GetTable(PLAN_PEAK), "the plan took over before a cycle boundary");
+
+    /**< A backup domain reset clears the mark, and a stopped LSE cannot be set */
+    memset(Test_Backup, 0, sizeof(Test_Backup));
+    PHASE_Init();
+    Test_Check((TOD_Init() == E_OK) && (TOD_GetPlan() == TOD_PLAN_NONE), "a plan selected after the backup domain was reset");
+    Test_Running = 0;
+    Test_Check(TOD_SetTime(0) == E_NOT_OK, "TOD_SetTime accepted with the RTC stopped");
+    Test_Check(TOD_GetPlan() == TOD_PLAN_NONE, "a plan selected with the RTC stopped");
+
+    printf("test_tod: %lu weeks from second %lu of the week, seed %lu\n", Local_Weeks, (unsigned long)Local_Start, Local_Seed);
+    printf("  %lu ticks, one RTC read each; %lu transitions, %lu plan switches, %lu taken over at a cycle start\n",
+           Local_Ticks, Local_Transitions, Local_Switches, Local_TakeOvers);
+    printf("  switch to cycle start at most %.2f s; tickless sleep past a transition at most %.2f s\n",
+           (double)Local_MaxTakeOver / TEST_TICKS_PER_SECOND, (double)Local_MaxLate / TEST_TICKS_PER_SECOND);
+    printf("  %lu failures\n", Test_Failures);
+
+    return (Test_Failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,290 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : test_usart_dma.c           *****************/
+/****************************************************************/
+
+/*
+ * Randomized test of USART_program.c and DMA_program.c, unmodified, on the emu_usart model.
+ *
+ *   test_usart_dma [-n steps] [-s seed]
+ *
+ * Producers reserve slots of random size and fill them in pieces while the line runs, so DMA
+ * completions land between the reserve, the writes and the commit. They then commit all or part
+ * of each slot, or use the copying MCAL_USART_Write. Every byte carries the next value of a
+ * running sequence, so the TX pin must show that sequence with no gap, repeat or stale byte.
+ * Bursts of random length arrive on RX, some longer than the DMA ring, and the RX callback must
+ * see them in order. MCAL_USART_IsTxIdle must only report idle once the model's transmitter is
+ * empty, and must do so once the line has drained. The test also checks the baud divider.
+ */
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "DMA_interface.h"
+#include "USART_interface.h"
+#include "USART_config.h"
+#include "USART_private.h"
+#include "SCB_interface.h"
+/*****************************< HOST *****************************/
+#include "emu_usart.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_PCLK_HZ            72000000UL
+#define TEST_MAX_SLOT           300
+#define TEST_MAX_BURST          400
+
+/*****************************< Private Variables *****************************/
+static u8 Test_TxSeq = 0;               /**< Next value a producer writes */
+static u8 Test_WireSeq = 0;             /**< Next value expected on the TX pin */
+static unsigned long long Test_TxCommitted = 0;
+static unsigned long long Test_TxOnWire = 0;
+
+static u8 Test_RxSeq = 0;               /**< Next value injected on RX */
+static u8 Test_RxExpect = 0;            /**< Next value expected by the callback */
+static unsigned long long Test_RxInjected = 0;
+static unsigned long long Test_RxReceived = 0;
+
+static unsigned long Test_Failures = 0;
+/*****************************< Host MCAL *****************************/
+u32 SCB_EnterCritical(void)
+{
+    return 0;
+}
+
+void SCB_ExitCritical(u32 Copy_PriMask)
+{
+    (void)Copy_PriMask;
+}
+/*****************************< Private Functions *****************************/
+static void Test_Fail(const char *Copy_What, unsigned long long Copy_At)
+{
+    if (Test_Failures++ < 10)
+    {
+        fprintf(stderr, "test_usart_dma: %s at byte %llu\n", Copy_What, Copy_At);
+    }
+}
+
+static void Test_TxSink(u8 Copy_Byte)
+{
+    if (Copy_Byte != Test_WireSeq)
+    {
+        Test_Fail("TX pin out of sequence", Test_TxOnWire);
+        Test_WireSeq = Copy_Byte;
+    }
+    Test_WireSeq++;
+    Test_TxOnWire++;
+}
+
+static void Test_RxCallback(const u8 *Copy_Data, u32 Copy_Length)
+{
+    while (Copy_Length--)
+    {
+        if (*Copy_Data != Test_RxExpect)
+        {
+            Test_Fail("RX callback out of sequence", Test_RxReceived);
+            Test_RxExpect = *Copy_Data;
+        }
+        Copy_Data++;
+        Test_RxExpect++;
+        Test_RxReceived++;
+    }
+}
+
+static void Test_Line(u32 Copy_Chars)
+{
+    EMU_UsartStep(Copy_Chars);
+}
+
+static void Test_CheckIdle(void)
+{
+    u8 Local_Idle = MCAL_USART_IsTxIdle();
+
+    EMU_UsartSync();
+    if (Local_Idle && (!EMU_UsartTxDrained() || (Test_TxOnWire != Test_TxCommitted)))
+    {
+        Test_Fail("IsTxIdle reported idle with bytes still to send", Test_TxOnWire);
+    }
+}
+
+/**< Reserve, fill in pieces with the line running in between, commit all or part */
+static u32 Test_Produce(void)
+{
+    u32 Local_Length = 1U + (u32)rand() % TEST_MAX_SLOT;
+    u32 Local_Commit;
+    u32 Local_Filled = 0;
+    u32 Local_Piece;
+    u8 *Local_Slot;
+    u8 Local_Data[TEST_MAX_SLOT];
+    u32 Local_Index;
+
+    if ((rand() % 4) == 0)
+    {
+        for (Local_Index = 0; Local_Index < Local_Length; Local_Index++)
+        {
+            Local_Data[Local_Index] = (u8)(Test_TxSeq + Local_Index);
+        }
+        if (MCAL_USART_Write(Local_Data, Local_Length) != E_OK)
+        {
+            EMU_UsartSync();
+            return 0;
+        }
+        EMU_UsartSync();
+        Test_TxSeq = (u8)(Test_TxSeq + Local_Length);
+        Test_TxCommitted += Local_Length;
+        return Local_Length;
+    }
+
+    Local_Slot = MCAL_USART_TxReserve(Local_Length);
+    EMU_UsartSync();
+    if (Local_Slot == NULL)
+    {
+        return 0;
+    }
+
+    Local_Commit = (rand() % 3) ? Local_Length : ((u32)rand() % (Local_Length + 1U));
+    while (Local_Filled < Local_Commit)
+    {
+        Local_Piece = 1U + (u32)rand() % (Local_Commit - Local_Filled);
+        for (Local_Index = 0; Local_Index < Local_Piece; Local_Index++)
+        {
+            Local_Slot[Local_Filled + Local_Index] = (u8)(Test_TxSeq + Local_Filled + Local_Index);
+        }
+        Local_Filled += Local_Piece;
+        Test_Line((u32)rand() % 4U);
+    }
+    /**< Bytes reserved but not committed hold garbage that must never be sent */
+    for (Local_Index = Local_Commit; Local_Index < Local_Length; Local_Index++)
+    {
+        Local_Slot[Local_Index] = (u8)(Test_TxSeq + Local_Index + 0x55);
+    }
+
+    if (MCAL_USART_TxCommit(Local_Commit) != E_OK)
+    {
+        Test_Fail("TxCommit refused a reserved slot", Test_TxCommitted);
+    }
+    EMU_UsartSync();
+    Test_TxSeq = (u8)(Test_TxSeq + Local_Commit);
+    Test_TxCommitted += Local_Commit;
+    return Local_Commit;
+}
+
+static void Test_Receive(void)
+{
+    u8 Local_Burst[TEST_MAX_BURST];
+    u32 Local_Length = 1U + (u32)rand() % TEST_MAX_BURST;
+    u32 Local_Index;
+
+    for (Local_Index = 0; Local_Index < Local_Length; Local_Index++)
+    {
+        Local_Burst[Local_Index] = Test_RxSeq++;
+    }
+    EMU_UsartRxInject(Local_Burst, Local_Length);
+    Test_RxInjected += Local_Length;
+}
+
+static void Test_Baud(void)
+{
+    if ((MCAL_USART_Init(1000000UL) != E_NOT_OK) || (MCAL_USART_SetClockFreq(1000000UL) != E_NOT_OK))
+    {
+        Test_Fail("a clock below 16 x baud was accepted", 0);
+    }
+    if ((MCAL_USART_SetClockFreq(8000000UL) != E_OK) || (USART1->BRR != 69U))
+    {
+        Test_Fail("BRR at 8 MHz is not 69 (8000000 / 115200 rounded)", 0);
+    }
+    if ((MCAL_USART_SetClockFreq(TEST_PCLK_HZ) != E_OK) || (USART1->BRR != 625U))
+    {
+        Test_Fail("BRR at 72 MHz is not 625", 0);
+    }
+    EMU_UsartSync();
+}
+
+/*****************************< Function Implementations *****************************/
+int main(int argc, char **argv)
+{
+    unsigned long Local_Steps = 2000000UL;
+    unsigned long Local_Seed = 1UL;
+    unsigned long Local_Step;
+    unsigned long Local_Refused = 0;
+    u32 Local_Drain;
+    int Local_Arg;
+
+    for (Local_Arg = 1; Local_Arg + 1 < argc; Local_Arg += 2)
+    {
+        if (!strcmp(argv[Local_Arg], "-n"))
+        {
+            Local_Steps = strtoul(argv[Local_Arg + 1], NULL, 0);
+        }
+        else if (!strcmp(argv[Local_Arg], "-s"))
+        {
+            Local_Seed = strtoul(argv[Local_Arg + 1], NULL, 0);
+        }
+    }
+    srand((unsigned)Local_Seed);
+
+    EMU_UsartInit(Test_TxSink);
+    if (MCAL_USART_Init(TEST_PCLK_HZ) != E_OK)
+    {
+        fprintf(stderr, "test_usart_dma: MCAL_USART_Init failed\n");
+        return 1;
+    }
+    MCAL_USART_SetRxCallback(Test_RxCallback);
+    EMU_UsartSync();
+    Test_Baud();
+    Test_CheckIdle();
+
+    for (Local_Step = 0; Local_Step < Local_Steps; Local_Step++)
+    {
+        switch (rand() % 8)
+        {
+        case 0:
+        case 1:
+        case 2:
+            if (Test_Produce() == 0)
+            {
+                Local_Refused++;
+            }
+            break;
+        case 3:
+            if ((rand() % 8) == 0)
+            {
+                Test_Receive();
+            }
+            break;
+        case 4:
+            Test_CheckIdle();
+            break;
+        default:
+            Test_Line(1U + (u32)rand() % 64U);
+            break;
+        }
+    }
+
+    /**< Drain: everything committed leaves, everything injected arrives, and the driver says idle */
+    for (Local_Drain = 0; (Local_Drain < 1000000U) && !MCAL_USART_IsTxIdle(); Local_Drain++)
+    {
+        Test_Line(1);
+    }
+    Test_Line(2);
+    Test_CheckIdle();
+    if (!MCAL_USART_IsTxIdle() || (Test_TxOnWire != Test_TxCommitted))
+    {
+        Test_Fail("transmitter did not drain", Test_TxOnWire);
+    }
+    if (Test_RxReceived != Test_RxInjected)
+    {
+        Test_Fail("RX bytes missing after the line went idle", Test_RxReceived);
+    }
+
+    printf("test_usart_dma: %lu steps, seed %lu\n", Local_Steps, Local_Seed);
+    printf("  TX: %llu bytes committed, %llu on the pin, %lu reservations refused (ring full)\n",
+           Test_TxCommitted, Test_TxOnWire, Local_Refused);
+    printf("  RX: %llu bytes injected, %llu delivered\n", Test_RxInjected, Test_RxReceived);
+    printf("  %lu failures, %lu model violations\n", Test_Failures, (unsigned long)EMU_UsartErrors());
+    return ((Test_Failures == 0) && (EMU_UsartErrors() == 0)) ? 0 : 1;
+}
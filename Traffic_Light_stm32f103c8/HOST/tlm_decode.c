@@ -0,0 +1,134 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : tlm_decode.c               *****************/
+/****************************************************************/
+
+/*
+ * Decodes a capture of the telemetry UART into one line per record.
+ *
+ *   tlm_decode [capture]       (stdin if no file is given)
+ *
+ * Each line gives the time since the first record in microseconds, the frame sequence number,
+ * the message name and its fields. A summary of frames, bad frames and sequence gaps goes to
+ * stderr. The capture may start or end in the middle of a frame.
+ */
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "DWT_interface.h"
+#include "SCB_interface.h"
+#include "USART_interface.h"
+/*****************************< APP *****************************/
+#include "TLM_interface.h"
+/*****************************< HOST *****************************/
+#include "tlm_host.h"
+#include <stdio.h>
+
+#define DECODE_CHUNK_SIZE       4096
+
+/*****************************< Host MCAL *****************************/
+/**< The encoder half of TLM_program.c is linked but never called */
+u32 MCAL_DWT_GetCycles(void)
+{
+    return 0;
+}
+
+u32 SCB_EnterCritical(void)
+{
+    return 0;
+}
+
+void SCB_ExitCritical(u32 Copy_PriMask)
+{
+    (void)Copy_PriMask;
+}
+
+u8 *MCAL_USART_TxReserve(u32 Copy_Length)
+{
+    (void)Copy_Length;
+    return NULL;
+}
+
+Std_ReturnType MCAL_USART_TxCommit(u32 Copy_Length)
+{
+    (void)Copy_Length;
+    return E_NOT_OK;
+}
+/*****************************< Private Functions *****************************/
+static void Decode_Print(u8 Copy_Sequence, unsigned long long Copy_TimeUs, const TLM_Record_t *Copy_Record)
+{
+    const char *Local_Name = TLMH_MessageName(Copy_Record->Id);
+    const char *Local_Counter;
+
+    printf("%12llu %3u ", Copy_TimeUs, Copy_Sequence);
+    switch (Copy_Record->Id)
+    {
+    case TLM_MSG_PHASE:
+        printf("%s phase=%u signals=0x%02lX\n", Local_Name, Copy_Record->Arg, (unsigned long)Copy_Record->Value);
+        break;
+    case TLM_MSG_INPUT:
+        printf("%s line=%u level=%lu\n", Local_Name, Copy_Record->Arg, (unsigned long)Copy_Record->Value);
+        break;
+    case TLM_MSG_COUNTER:
+        Local_Counter = TLMH_CounterName(Copy_Record->Arg);
+        if (Local_Counter != NULL)
+        {
+            printf("%s %s=%lu\n", Local_Name, Local_Counter, (unsigned long)Copy_Record->Value);
+        }
+        else
+        {
+            printf("%s #%u=%lu\n", Local_Name, Copy_Record->Arg, (unsigned long)Copy_Record->Value);
+        }
+        break;
+    case TLM_MSG_FAULT:
+        printf("%s code=%u\n", Local_Name, Copy_Record->Arg);
+        break;
+    case TLM_MSG_ACK:
+        printf("%s command=%u status=%lu\n", Local_Name, Copy_Record->Arg, (unsigned long)Copy_Record->Value);
+        break;
+    case TLM_MSG_PED_WAIT:
+        printf("%s bin=%u served=%lu\n", Local_Name, Copy_Record->Arg, (unsigned long)Copy_Record->Value);
+        break;
+    default:
+        printf("id=0x%02X arg=%u value=%lu\n", Copy_Record->Id, Copy_Record->Arg, (unsigned long)Copy_Record->Value);
+        break;
+    }
+}
+/*****************************< Function Implementations *****************************/
+int main(int argc, char **argv)
+{
+    FILE *Local_File = stdin;
+    u8 Local_Chunk[DECODE_CHUNK_SIZE];
+    size_t Local_Read;
+    const TLMH_Stats_t *Local_Stats;
+
+    if (argc > 1)
+    {
+        Local_File = fopen(argv[1], "rb");
+        if (Local_File == NULL)
+        {
+            perror(argv[1]);
+            return 1;
+        }
+    }
+
+    TLMH_Init(Decode_Print);
+    while ((Local_Read = fread(Local_Chunk, 1, sizeof(Local_Chunk), Local_File)) > 0)
+    {
+        TLMH_Feed(Local_Chunk, (u32)Local_Read);
+    }
+    if (Local_File != stdin)
+    {
+        fclose(Local_File);
+    }
+
+    Local_Stats = TLMH_GetStats();
+    fprintf(stderr, "tlm_decode: %llu bytes, %lu frames, %llu records, %lu bad frames, %lu frames missing\n",
+            Local_Stats->Bytes, Local_Stats->Frames, Local_Stats->Records, Local_Stats->BadFrames,
+            Local_Stats->SequenceGaps);
+    return 0;
+}
@@ -0,0 +1,130 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : tlm_host.c                 *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< APP *****************************/
+#include "TLM_interface.h"
+#include "TLM_config.h"
+/*****************************< HOST *****************************/
+#include "tlm_host.h"
+#include <string.h>
+
+/**< Sequence, records and CRC after COBS, plus its code byte; anything longer is not a frame */
+#define TLMH_FRAME_MAX          (TLM_FRAME_SIZE + 1)
+
+/*****************************< Private Variables *****************************/
+static TLMH_Handler_t TLMH_Handler = NULL;
+static u8 TLMH_Frame[TLMH_FRAME_MAX];
+static u32 TLMH_FrameLength = 0;
+static u8 TLMH_Overlong = 0;
+static u8 TLMH_Anchored = 0;
+static u8 TLMH_NextSequence = 0;
+static unsigned long long TLMH_TimeUs = 0;
+static TLMH_Stats_t TLMH_Stats;
+
+static const char *const TLMH_MessageNames[] = {
+    NULL, "PHASE", "INPUT", "COUNTER", "FAULT", "ACK", "PED_WAIT",
+};
+
+static const char *const TLMH_CounterNames[] = {
+    "DROPPED", "PED_REQUESTS", "ISR_MAX_CYCLES", "LOG_DROPPED", "DUTY_PERMILLE", "CURRENT_UA",
+    "WAKE_LATENCY_US", "CONTROL_MAX_CYCLES", "VEHICLE_CALLS", "PREEMPT_MAX_CYCLES", "CYCLE_MS",
+    "FLOW_VPH", "SYNC_MAX_ERROR_US", "LANE_VEHICLES", "LANE_OCCUPANCY_PERMILLE", "LANE_SPEED_KMH_X10",
+};
+/*****************************< Private Functions *****************************/
+static void TLMH_Frame_Done(void)
+{
+    u8 Local_Sequence;
+    u32 Local_Length;
+    u32 Local_Offset = 0;
+    TLM_Record_t Local_Record;
+
+    if (TLMH_Overlong || (TLM_DecodeFrame(TLMH_Frame, TLMH_FrameLength, &Local_Sequence, &Local_Length) != E_OK))
+    {
+        TLMH_Stats.BadFrames++;
+        return;
+    }
+
+    if (TLMH_Anchored && (Local_Sequence != TLMH_NextSequence))
+    {
+        TLMH_Stats.SequenceGaps += (u8)(Local_Sequence - TLMH_NextSequence);
+    }
+    TLMH_Anchored = 1;
+    TLMH_NextSequence = (u8)(Local_Sequence + 1U);
+    TLMH_Stats.Frames++;
+
+    /**< Records start after the sequence number */
+    while (Local_Offset < Local_Length)
+    {
+        if (TLM_DecodeRecord(&TLMH_Frame[1], Local_Length, &Local_Offset, &Local_Record) != E_OK)
+        {
+            TLMH_Stats.BadFrames++;
+            return;
+        }
+        TLMH_TimeUs += Local_Record.DeltaUs;
+        TLMH_Stats.Records++;
+        if (TLMH_Handler != NULL)
+        {
+            TLMH_Handler(Local_Sequence, TLMH_TimeUs, &Local_Record);
+        }
+    }
+}
+/*****************************< Function Implementations *****************************/
+void TLMH_Init(TLMH_Handler_t Copy_Handler)
+{
+    TLMH_Handler = Copy_Handler;
+    TLMH_FrameLength = 0;
+    TLMH_Overlong = 0;
+    TLMH_Anchored = 0;
+    TLMH_TimeUs = 0;
+    memset(&TLMH_Stats, 0, sizeof(TLMH_Stats));
+}
+
+void TLMH_Feed(const u8 *Copy_Data, u32 Copy_Length)
+{
+    TLMH_Stats.Bytes += Copy_Length;
+
+    while (Copy_Length--)
+    {
+        if (*Copy_Data == 0x00)
+        {
+            /**< Back-to-back delimiters carry no frame */
+            if (TLMH_FrameLength || TLMH_Overlong)
+            {
+                TLMH_Frame_Done();
+            }
+            TLMH_FrameLength = 0;
+            TLMH_Overlong = 0;
+        }
+        else if (TLMH_FrameLength < TLMH_FRAME_MAX)
+        {
+            TLMH_Frame[TLMH_FrameLength++] = *Copy_Data;
+        }
+        else
+        {
+            TLMH_Overlong = 1;
+        }
+        Copy_Data++;
+    }
+}
+
+const TLMH_Stats_t *TLMH_GetStats(void)
+{
+    return &TLMH_Stats;
+}
+
+const char *TLMH_MessageName(u8 Copy_Id)
+{
+    return (Copy_Id < (sizeof(TLMH_MessageNames) / sizeof(TLMH_MessageNames[0]))) ? TLMH_MessageNames[Copy_Id] : NULL;
+}
+
+const char *TLMH_CounterName(u8 Copy_Counter)
+{
+    return (Copy_Counter < (sizeof(TLMH_CounterNames) / sizeof(TLMH_CounterNames[0]))) ? TLMH_CounterNames[Copy_Counter] : NULL;
+}
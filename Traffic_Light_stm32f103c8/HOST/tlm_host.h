@@ -0,0 +1,51 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : tlm_host.h                 *****************/
+/****************************************************************/
+#ifndef TLM_HOST_H_
+#define TLM_HOST_H_
+
+/*
+ * Host side of the telemetry link: splits the UART byte stream into frames, decodes them with
+ * the firmware's own TLM_DecodeFrame and TLM_DecodeRecord, and rebuilds absolute time from the
+ * record deltas. Feed it bytes in any chunking; a frame split across two calls is carried over.
+ */
+
+#include "TLM_interface.h"
+
+/**< Called for every record of every valid frame, in order */
+typedef void (*TLMH_Handler_t)(u8 Copy_Sequence, unsigned long long Copy_TimeUs, const TLM_Record_t *Copy_Record);
+
+typedef struct
+{
+    unsigned long long Bytes;       /**< Bytes fed, delimiters included */
+    unsigned long Frames;           /**< Valid frames */
+    unsigned long BadFrames;        /**< COBS or CRC errors, oversized frames, undecodable records */
+    unsigned long SequenceGaps;     /**< Frames missing between two valid ones */
+    unsigned long long Records;
+} TLMH_Stats_t;
+
+/**
+ * @brief Reset the decoder; the first valid frame anchors the sequence.
+ */
+void TLMH_Init(TLMH_Handler_t Copy_Handler);
+
+/**
+ * @brief Decode a chunk of the UART stream.
+ */
+void TLMH_Feed(const u8 *Copy_Data, u32 Copy_Length);
+
+/**
+ * @brief Get the decoder counters.
+ */
+const TLMH_Stats_t *TLMH_GetStats(void);
+
+/**
+ * @brief Name of a message ID or counter ID for printing, or NULL if unknown.
+ */
+const char *TLMH_MessageName(u8 Copy_Id);
+const char *TLMH_CounterName(u8 Copy_Counter);
+
+#endif /**< TLM_HOST_H_ */
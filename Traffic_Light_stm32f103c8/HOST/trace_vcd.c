@@ -0,0 +1,423 @@
+/****************************************************************/
+/******* Author    : Moaz Ragab                 *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : trace_vcd.c                *****************/
+/****************************************************************/
+
+/*
+ * Streams a TRACE recording out as a Value Change Dump for waveform viewers.
+ *
+ *   trace_vcd in.trace out.vcd              convert a dump read from the target (or - for stdin/stdout)
+ *   trace_vcd -d days [-s seed] out.vcd     run the phase engine for days of virtual time and dump it
+ *
+ * Every GPIO output change becomes one change per pin that moved (PA0..PC15). Every EXTI edge sets
+ * the level of its line (EXTI0..EXTI15) and fires its event (EXTI0_edge..), so edges on a line traced
+ * on one edge only still show. Every SysTick wrap toggles the "systick" wire. The time
+ * scale is 1 us, the resolution of the trace.
+ *
+ * Memory stays bounded however long the run. Input is read and decoded in VCD_CHUNK_SIZE blocks
+ * with TRACE_DecodeEvent, and an event split across two blocks is carried over. Output goes
+ * through one VCD_OUT_SIZE buffer. In -d mode the unmodified TRACE ring (TRACE_BUFFER_SIZE) is
+ * the only other buffer. The engine's outputs and ticks are recorded through TRACE_RecordOutput
+ * and TRACE_RecordTick, where GPIO and STK would record them with tracing enabled. A sink writes
+ * each flushed block straight into the VCD, so the trace is never held whole.
+ */
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "EXTI_interface.h"
+#include "GPIO_interface.h"
+#include "SCB_interface.h"
+/*****************************< APP *****************************/
+#include "TICK_interface.h"
+#include "TRACE_interface.h"
+#include "TRACE_config.h"
+#include "PHASE_interface.h"
+#include "PHASE_config.h"
+/*****************************< HOST *****************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+
+#define VCD_CHUNK_SIZE          4096
+#define VCD_OUT_SIZE            65536
+#define VCD_PORT_COUNT          3
+#define VCD_PINS                16
+
+/**< One-character identifiers: ports' pins, then the EXTI levels and edges, then the SysTick wire */
+#define VCD_ID_PIN(PORT, PIN)   ((char)('!' + (PORT) * VCD_PINS + (PIN)))
+#define VCD_ID_EXTI(LINE)       ((char)('!' + VCD_PORT_COUNT * VCD_PINS + (LINE)))
+#define VCD_ID_EDGE(LINE)       ((char)('!' + (VCD_PORT_COUNT + 1) * VCD_PINS + (LINE)))
+#define VCD_ID_SYSTICK          ((char)('!' + (VCD_PORT_COUNT + 2) * VCD_PINS))
+
+/**< Crossing 0 as wired in main.c: pedestrian head and wait lamp on PORTA, car head and button on PORTB */
+#define VCD_PED_RED             1
+#define VCD_PED_YELLOW          2
+#define VCD_PED_GREEN           3
+#define VCD_WAIT                4
+#define VCD_CAR_GREEN           1
+#define VCD_CAR_YELLOW          2
+#define VCD_CAR_RED             3
+#define VCD_BUTTON_LINE         4
+
+/*****************************< Private Variables *****************************/
+static FILE *VCD_File;
+static char VCD_Out[VCD_OUT_SIZE];
+static u32 VCD_OutLength = 0;
+static unsigned long long VCD_WrittenBytes = 0;
+
+/**< Absolute time of the stream and of the last "#time" line written */
+static unsigned long long VCD_TimeUs = 0;
+static unsigned long long VCD_StampedUs = ~0ULL;
+
+static u16 VCD_Odr[VCD_PORT_COUNT];
+static u8 VCD_Systick = 0;
+static unsigned long long VCD_Events = 0;
+
+/**< Bytes the -d mode's sink has not decoded yet: at most one event split between two flushes */
+static u8 VCD_Pending[VCD_CHUNK_SIZE];
+static u32 VCD_PendingLength = 0;
+
+static unsigned long long VCD_SimTimeUs = 0;
+/*****************************< Host MCAL *****************************/
+u32 SCB_EnterCritical(void)
+{
+    return 0;
+}
+
+void SCB_ExitCritical(u32 Copy_PriMask)
+{
+    (void)Copy_PriMask;
+}
+
+u32 TICK_GetTimeUs(void)
+{
+    return (u32)VCD_SimTimeUs;
+}
+
+Std_ReturnType EXTI_GenerateSoftwareInterrupt(u8 Copy_Line)
+{
+    (void)Copy_Line;
+    return E_NOT_OK;
+}
+/*****************************< Private Functions *****************************/
+static void VCD_FlushOut(void)
+{
+    if (fwrite(VCD_Out, 1, VCD_OutLength, VCD_File) != VCD_OutLength)
+    {
+        perror("trace_vcd");
+        exit(1);
+    }
+    VCD_WrittenBytes += VCD_OutLength;
+    VCD_OutLength = 0;
+}
+
+static void VCD_Write(const char *Copy_Text, u32 Copy_Length)
+{
+    if (VCD_OutLength + Copy_Length > VCD_OUT_SIZE)
+    {
+        VCD_FlushOut();
+    }
+    memcpy(&VCD_Out[VCD_OutLength], Copy_Text, Copy_Length);
+    VCD_OutLength += Copy_Length;
+}
+
+static void VCD_Change(char Copy_Id, u8 Copy_Value)
+{
+    char Local_Line[32];
+    int Local_Length;
+
+    if (VCD_StampedUs != VCD_TimeUs)
+    {
+        VCD_StampedUs = VCD_TimeUs;
+        Local_Length = snprintf(Local_Line, sizeof(Local_Line), "#%llu\n", VCD_TimeUs);
+        VCD_Write(Local_Line, (u32)Local_Length);
+    }
+    Local_Line[0] = (char)('0' + Copy_Value);
+    Local_Line[1] = Copy_Id;
+    Local_Line[2] = '\n';
+    VCD_Write(Local_Line, 3);
+}
+
+static void VCD_Header(void)
+{
+    static const char Local_Ports[VCD_PORT_COUNT] = { 'A', 'B', 'C' };
+    char Local_Line[96];
+    int Local_Length;
+    u8 Local_Port;
+    u8 Local_Pin;
+
+    Local_Length = snprintf(Local_Line, sizeof(Local_Line), "$version trace_vcd (TRACE stream) $end\n$timescale 1 us $end\n");
+    VCD_Write(Local_Line, (u32)Local_Length);
+    for (Local_Port = 0; Local_Port < VCD_PORT_COUNT; Local_Port++)
+    {
+        Local_Length = snprintf(Local_Line, sizeof(Local_Line), "$scope module GPIO%c $end\n", Local_Ports[Local_Port]);
+        VCD_Write(Local_Line, (u32)Local_Length);
+        for (Local_Pin = 0; Local_Pin < VCD_PINS; Local_Pin++)
+        {
+            Local_Length = snprintf(Local_Line, sizeof(Local_Line), "$var wire 1 %c P%c%u $end\n",
+                                    VCD_ID_PIN(Local_Port, Local_Pin), Local_Ports[Local_Port], Local_Pin);
+            VCD_Write(Local_Line, (u32)Local_Length);
+        }
+        VCD_Write("$upscope $end\n", 14);
+    }
+    VCD_Write("$scope module EXTI $end\n", 24);
+    for (Local_Pin = 0; Local_Pin < VCD_PINS; Local_Pin++)
+    {
+        Local_Length = snprintf(Local_Line, sizeof(Local_Line), "$var wire 1 %c EXTI%u $end\n$var event 1 %c EXTI%u_edge $end\n",
+                                VCD_ID_EXTI(Local_Pin), Local_Pin, VCD_ID_EDGE(Local_Pin), Local_Pin);
+        VCD_Write(Local_Line, (u32)Local_Length);
+    }
+    VCD_Write("$upscope $end\n", 14);
+    Local_Length = snprintf(Local_Line, sizeof(Local_Line), "$var wire 1 %c systick $end\n$enddefinitions $end\n$dumpvars\n", VCD_ID_SYSTICK);
+    VCD_Write(Local_Line, (u32)Local_Length);
+
+    /**< Everything starts low at time 0, which is TRACE_Init */
+    VCD_TimeUs = 0;
+    for (Local_Port = 0; Local_Port < VCD_PORT_COUNT; Local_Port++)
+    {
+        for (Local_Pin = 0; Local_Pin < VCD_PINS; Local_Pin++)
+        {
+            VCD_Change(VCD_ID_PIN(Local_Port, Local_Pin), 0);
+        }
+    }
+    for (Local_Pin = 0; Local_Pin < VCD_PINS; Local_Pin++)
+    {
+        VCD_Change(VCD_ID_EXTI(Local_Pin), 0);
+    }
+    VCD_Change(VCD_ID_SYSTICK, 0);
+    VCD_Write("$end\n", 5);
+}
+
+static void VCD_Event(const TRACE_Event_t *Copy_Event)
+{
+    u16 Local_Moved;
+    u8 Local_Pin;
+
+    VCD_TimeUs += Copy_Event->DeltaUs;
+    VCD_Events++;
+
+    switch (Copy_Event->Kind)
+    {
+    case TRACE_KIND_INPUT:
+        VCD_Change(VCD_ID_EXTI(Copy_Event->Source), (u8)Copy_Event->Value);
+        VCD_Change(VCD_ID_EDGE(Copy_Event->Source), 1);
+        break;
+    case TRACE_KIND_OUTPUT:
+        if (Copy_Event->Source >= VCD_PORT_COUNT)
+        {
+            break;
+        }
+        Local_Moved = VCD_Odr[Copy_Event->Source] ^ Copy_Event->Value;
+        for (Local_Pin = 0; Local_Pin < VCD_PINS; Local_Pin++)
+        {
+            if (GET_BIT(Local_Moved, Local_Pin))
+            {
+                VCD_Change(VCD_ID_PIN(Copy_Event->Source, Local_Pin), (u8)GET_BIT(Copy_Event->Value, Local_Pin));
+            }
+        }
+        VCD_Odr[Copy_Event->Source] = Copy_Event->Value;
+        break;
+    default:
+        VCD_Systick ^= 1U;
+        VCD_Change(VCD_ID_SYSTICK, VCD_Systick);
+        break;
+    }
+}
+
+/**< Decodes whole events from the front of a block; returns the bytes used, a split event stays behind */
+static u32 VCD_Decode(const u8 *Copy_Data, u32 Copy_Length)
+{
+    u32 Local_Offset = 0;
+    TRACE_Event_t Local_Event;
+
+    while (TRACE_DecodeEvent(Copy_Data, Copy_Length, &Local_Offset, &Local_Event) == E_OK)
+    {
+        VCD_Event(&Local_Event);
+    }
+    return Local_Offset;
+}
+
+/**< Appends to the carried-over bytes and decodes what is complete */
+static void VCD_Feed(const u8 *Copy_Data, u32 Copy_Length)
+{
+    u32 Local_Take;
+    u32 Local_Used;
+
+    while (Copy_Length)
+    {
+        Local_Take = (Copy_Length < (VCD_CHUNK_SIZE - VCD_PendingLength)) ? Copy_Length : (VCD_CHUNK_SIZE - VCD_PendingLength);
+        memcpy(&VCD_Pending[VCD_PendingLength], Copy_Data, Local_Take);
+        VCD_PendingLength += Local_Take;
+        Copy_Data += Local_Take;
+        Copy_Length -= Local_Take;
+
+        Local_Used = VCD_Decode(VCD_Pending, VCD_PendingLength);
+        memmove(VCD_Pending, &VCD_Pending[Local_Used], VCD_PendingLength - Local_Used);
+        VCD_PendingLength -= Local_Used;
+    }
+}
+
+static void VCD_Sink(const u8 *Copy_Data, u32 Copy_Length)
+{
+    VCD_Feed(Copy_Data, Copy_Length);
+}
+
+static int VCD_Convert(FILE *Copy_In)
+{
+    u8 Local_Chunk[VCD_CHUNK_SIZE];
+    size_t Local_Read;
+
+    while ((Local_Read = fread(Local_Chunk, 1, sizeof(Local_Chunk), Copy_In)) > 0)
+    {
+        VCD_Feed(Local_Chunk, (u32)Local_Read);
+    }
+    if (VCD_PendingLength)
+    {
+        fprintf(stderr, "trace_vcd: %lu bytes of a truncated event at the end ignored\n", (unsigned long)VCD_PendingLength);
+    }
+    return 0;
+}
+
+/**< Signals of crossing 0 as the two port images Signals_Write would leave in the ODRs */
+static void VCD_SimOutputs(u8 Copy_Signals, u16 *Copy_PortA, u16 *Copy_PortB)
+{
+    u16 Local_A = 0;
+    u16 Local_B = 0;
+
+    if (Copy_Signals & PHASE_SIG_PED_RED)    SET_BIT(Local_A, VCD_PED_RED);
+    if (Copy_Signals & PHASE_SIG_PED_YELLOW) SET_BIT(Local_A, VCD_PED_YELLOW);
+    if (Copy_Signals & PHASE_SIG_PED_GREEN)  SET_BIT(Local_A, VCD_PED_GREEN);
+    if (Copy_Signals & PHASE_SIG_PED_WAIT)   SET_BIT(Local_A, VCD_WAIT);
+    if (Copy_Signals & PHASE_SIG_CAR_GREEN)  SET_BIT(Local_B, VCD_CAR_GREEN);
+    if (Copy_Signals & PHASE_SIG_CAR_YELLOW) SET_BIT(Local_B, VCD_CAR_YELLOW);
+    if (Copy_Signals & PHASE_SIG_CAR_RED)    SET_BIT(Local_B, VCD_CAR_RED);
+    *Copy_PortA = Local_A;
+    *Copy_PortB = Local_B;
+}
+
+/**< 1 .. 180 s at 1 us resolution */
+static unsigned long long VCD_PressGapUs(void)
+{
+    return 1000000ULL + (unsigned long long)(rand() % 179000) * 1000ULL + (unsigned long long)(rand() % 1000);
+}
+
+/**< Days of the engine at one SysTick wrap per tick, a button press every 1 .. 180 s */
+static int VCD_Simulate(unsigned long Copy_Days, unsigned long Copy_Seed)
+{
+    unsigned long long Local_EndUs = (unsigned long long)Copy_Days * 86400ULL * 1000000ULL;
+    unsigned long long Local_NextPressUs;
+    unsigned long long Local_TickUs = 0;
+    u16 Local_PortA = 0xFFFF;
+    u16 Local_PortB = 0xFFFF;
+    u16 Local_NewA;
+    u16 Local_NewB;
+
+    srand((unsigned)Copy_Seed);
+    VCD_SimTimeUs = 0;
+    TRACE_Init();
+    TRACE_SetSink(VCD_Sink);
+    PHASE_Init();
+    Local_NextPressUs = VCD_PressGapUs();
+
+    while (VCD_SimTimeUs < Local_EndUs)
+    {
+        /**< A press lands inside the tick period that takes it; the button EXTI line is rising-edge only */
+        if (Local_NextPressUs <= VCD_SimTimeUs + PHASE_TICK_MS * 1000ULL)
+        {
+            VCD_SimTimeUs = Local_NextPressUs;
+            (void)TRACE_RecordInput(VCD_BUTTON_LINE, 1);
+            PHASE_RequestPedestrian(0);
+            Local_NextPressUs += VCD_PressGapUs();
+        }
+        VCD_SimTimeUs = Local_TickUs += PHASE_TICK_MS * 1000ULL;
+        (void)TRACE_RecordTick();
+        PHASE_Tick();
+        VCD_SimOutputs(PHASE_GetSignals(0), &Local_NewA, &Local_NewB);
+        if (Local_NewA != Local_PortA)
+        {
+            Local_PortA = Local_NewA;
+            (void)TRACE_RecordOutput(GPIO_PORTA, Local_PortA);
+        }
+        if (Local_NewB != Local_PortB)
+        {
+            Local_PortB = Local_NewB;
+            (void)TRACE_RecordOutput(GPIO_PORTB, Local_PortB);
+        }
+        if (TRACE_Flush() != E_OK)
+        {
+            fprintf(stderr, "trace_vcd: TRACE dropped events, flush more often\n");
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*****************************< Function Implementations *****************************/
+int main(int argc, char **argv)
+{
+    const char *Local_In = NULL;
+    const char *Local_Out = NULL;
+    unsigned long Local_Days = 0;
+    unsigned long Local_Seed = 1UL;
+    FILE *Local_InFile = stdin;
+    struct rusage Local_Usage;
+    int Local_Status;
+    int Local_Arg;
+
+    for (Local_Arg = 1; Local_Arg < argc; Local_Arg++)
+    {
+        if (!strcmp(argv[Local_Arg], "-d") && (Local_Arg + 1 < argc))
+        {
+            Local_Days = strtoul(argv[++Local_Arg], NULL, 0);
+        }
+        else if (!strcmp(argv[Local_Arg], "-s") && (Local_Arg + 1 < argc))
+        {
+            Local_Seed = strtoul(argv[++Local_Arg], NULL, 0);
+        }
+        else if ((Local_In == NULL) && (Local_Days == 0))
+        {
+            Local_In = argv[Local_Arg];
+        }
+        else
+        {
+            Local_Out = argv[Local_Arg];
+        }
+    }
+    if ((Local_Days != 0) && (Local_Out == NULL))
+    {
+        Local_Out = Local_In;
+        Local_In = NULL;
+    }
+    if ((Local_Out == NULL) || ((Local_Days == 0) && (Local_In == NULL)))
+    {
+        fprintf(stderr, "usage: trace_vcd in.trace out.vcd\n       trace_vcd -d days [-s seed] out.vcd\n");
+        return 2;
+    }
+
+    VCD_File = strcmp(Local_Out, "-") ? fopen(Local_Out, "w") : stdout;
+    if ((Local_In != NULL) && strcmp(Local_In, "-"))
+    {
+        Local_InFile = fopen(Local_In, "rb");
+    }
+    if ((VCD_File == NULL) || (Local_InFile == NULL))
+    {
+        perror("trace_vcd");
+        return 1;
+    }
+
+    VCD_Header();
+    Local_Status = (Local_Days != 0) ? VCD_Simulate(Local_Days, Local_Seed) : VCD_Convert(Local_InFile);
+    VCD_FlushOut();
+    fclose(VCD_File);
+
+    getrusage(RUSAGE_SELF, &Local_Usage);
+    fprintf(stderr, "trace_vcd: %llu events, %.3f s, %llu VCD bytes, peak RSS %ld KB (buffers: %u B in, %u B out, %u B TRACE ring)\n",
+            VCD_Events, VCD_TimeUs / 1e6, VCD_WrittenBytes, Local_Usage.ru_maxrss,
+            (unsigned)VCD_CHUNK_SIZE, (unsigned)VCD_OUT_SIZE, (unsigned)TRACE_BUFFER_SIZE);
+    return Local_Status;
+}